@@ -1,6 +1,8 @@
 /**************************************************************************//**
  * @file
- * A simple double-linked list.
+ * A simple list, whose items are held in order in a contiguous array.  The
+ * first few items are held in the list itself, so that short lists need no
+ * allocation.
  *
  * @note  No thread protection so you will need to use appropriate
  * synchronization if use spans multiple threads.
@@ -39,14 +41,33 @@
 
 #include <assert.h>
 #include <malloc.h>
+#include <string.h>
 
 #include "double_list.h"
 #include "evel.h"
 
+/*****************************************************************************/
+/* The item in the slot after the last item of a list, so that the next item */
+/* can be found from an item alone.                                          */
+/*****************************************************************************/
+static char dlist_end;
+#define DLIST_END ((void *) &dlist_end)
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static DLIST_ITEM * dlist_slots(DLIST * list);
+static int dlist_capacity(DLIST * list);
+static void dlist_replace_slots(DLIST * list,
+                                DLIST_ITEM * slots,
+                                int capacity,
+                                int owns_slots);
+
 /**************************************************************************//**
  * List initialization.
  *
- * Initialize the list supplied to be empty.
+ * Initialize the list supplied to be empty.  A list which has been zeroed is
+ * also empty.
  *
  * @param   list    Pointer to the list to be initialized.
 
@@ -62,10 +83,12 @@ void dlist_initialize(DLIST * list)
   assert(list != NULL);
 
   /***************************************************************************/
-  /* Initialize the list as empty.                                           */
+  /* Initialize the list as empty, using its inline slots.                   */
   /***************************************************************************/
-  list->head = NULL;
-  list->tail = NULL;
+  list->slots = NULL;
+  list->count = 0;
+  list->capacity = 0;
+  list->owns_slots = 0;
 
   EVEL_EXIT();
 }
@@ -73,27 +96,30 @@ void dlist_initialize(DLIST * list)
 void * dlist_pop_last(DLIST * list)
 {
   void *item = NULL;
-  DLIST_ITEM *current_tail = NULL;
-  DLIST_ITEM *new_tail = NULL;
+  DLIST_ITEM * slots;
 
   assert(list != NULL);
 
-  current_tail = list->tail;
-  if (current_tail != NULL)
+  if (list->count > 0)
   {
-    item = current_tail->item;
-    new_tail = current_tail->previous;
-    if (new_tail == NULL)
-    {
-      list->head = NULL;
-      list->tail = NULL;
-    }
-    else
+    slots = dlist_slots(list);
+    list->count--;
+    item = slots[list->count].item;
+    slots[list->count].item = DLIST_END;
+
+    /*************************************************************************/
+    /* Once empty, go back to the inline slots.                              */
+    /*************************************************************************/
+    if ((list->count == 0) && (list->slots != NULL))
     {
-      new_tail->next = NULL;
-      list->tail = new_tail;
+      if (list->owns_slots)
+      {
+        free(list->slots);
+      }
+      list->slots = NULL;
+      list->capacity = 0;
+      list->owns_slots = 0;
     }
-    free(current_tail);
   }
 
   return item;
@@ -101,8 +127,7 @@ void * dlist_pop_last(DLIST * list)
 
 void dlist_push_first(DLIST * list, void * item)
 {
-  DLIST_ITEM * new_element = NULL;
-  DLIST_ITEM * current_head = NULL;
+  DLIST_ITEM * slots;
 
   /***************************************************************************/
   /* Check assumptions.  Note that we do allow putting NULL pointers into    */
@@ -110,29 +135,21 @@ void dlist_push_first(DLIST * list, void * item)
   /***************************************************************************/
   assert(list != NULL);
 
-  current_head = list->head;
-
-  new_element = malloc(sizeof(DLIST_ITEM));
-  assert(new_element != NULL);
-  new_element->next = current_head;
-  new_element->previous = NULL;
-  new_element->item = item;
-  list->head = new_element;
-
-  if (current_head != NULL)
+  if (dlist_is_full(list))
   {
-    current_head->previous = new_element;
-  }
-  else
-  {
-    list->tail = new_element;
+    dlist_replace_slots(list, NULL, 2 * dlist_capacity(list), 1);
   }
+
+  slots = dlist_slots(list);
+  memmove(&slots[1], &slots[0], list->count * sizeof(DLIST_ITEM));
+  slots[0].item = item;
+  list->count++;
+  slots[list->count].item = DLIST_END;
 }
 
 void dlist_push_last(DLIST * list, void * item)
 {
-  DLIST_ITEM * new_element = NULL;
-  DLIST_ITEM * current_tail = NULL;
+  DLIST_ITEM * slots;
 
   /***************************************************************************/
   /* Check assumptions.  Note that we do allow putting NULL pointers into    */
@@ -140,55 +157,135 @@ void dlist_push_last(DLIST * list, void * item)
   /***************************************************************************/
   assert(list != NULL);
 
-  current_tail = list->tail;
-
-  new_element = malloc(sizeof(DLIST_ITEM));
-  assert(new_element != NULL);
-  new_element->next = NULL;
-  new_element->previous = current_tail;
-  new_element->item = item;
-  list->tail = new_element;
-
-  if (current_tail != NULL)
+  if (dlist_is_full(list))
   {
-    current_tail->next = new_element;
+    dlist_replace_slots(list, NULL, 2 * dlist_capacity(list), 1);
   }
-  else
+
+  slots = dlist_slots(list);
+  slots[list->count].item = item;
+  list->count++;
+  slots[list->count].item = DLIST_END;
+}
+
+/**************************************************************************//**
+ * Whether the list has to move to larger slots before another item is added.
+ *
+ * @param   list    Pointer to the list.
+ * @returns Non-zero if the list is full.
+ *****************************************************************************/
+int dlist_is_full(DLIST * list)
+{
+  return (list->count + 2 > dlist_capacity(list));
+}
+
+/**************************************************************************//**
+ * Move the items of a list to slots provided by the caller, which the list
+ * will not free.
+ *
+ * @param   list      Pointer to the list.
+ * @param   slots     The slots, of which there must be more than there are
+ *                    items in the list.
+ * @param   capacity  The number of slots.
+ *****************************************************************************/
+void dlist_move_slots(DLIST * list, DLIST_ITEM * slots, int capacity)
+{
+  assert(slots != NULL);
+
+  dlist_replace_slots(list, slots, capacity, 0);
+}
+
+/**************************************************************************//**
+ * Make a copy of a list share the slots of the original without changing
+ * them.
+ *
+ * The copy is left full, so that it moves its items to slots of its own
+ * before anything is added to it, and does not free the shared slots.
+ *
+ * @param   list    Pointer to the copy of the list.
+ *****************************************************************************/
+void dlist_share_slots(DLIST * list)
+{
+  assert(list != NULL);
+
+  if (list->slots != NULL)
   {
-    list->head = new_element;
+    list->capacity = list->count + 1;
+    list->owns_slots = 0;
   }
 }
 
 DLIST_ITEM * dlist_get_first(DLIST * list)
 {
-  return list->head;
+  return (list->count > 0) ? &dlist_slots(list)[0] : NULL;
 }
 
 DLIST_ITEM * dlist_get_last(DLIST * list)
 {
-  return list->tail;
+  return (list->count > 0) ? &dlist_slots(list)[list->count - 1] : NULL;
 }
 
 DLIST_ITEM * dlist_get_next(DLIST_ITEM * item)
 {
-  return item->next;
+  return ((item + 1)->item == DLIST_END) ? NULL : item + 1;
 }
 
 int dlist_is_empty(DLIST * list)
 {
-  return (list->head == NULL);
+  return (list->count == 0);
 }
 
 int dlist_count(DLIST * list)
 {
-  int count = 0;
-  DLIST_ITEM * item = list->head;
+  return list->count;
+}
 
-  while (item != NULL)
+/**************************************************************************//**
+ * The slots currently holding the items of a list.
+ *****************************************************************************/
+static DLIST_ITEM * dlist_slots(DLIST * list)
+{
+  return (list->slots != NULL) ? list->slots : list->inline_slots;
+}
+
+/**************************************************************************//**
+ * The number of slots currently holding the items of a list.
+ *****************************************************************************/
+static int dlist_capacity(DLIST * list)
+{
+  return (list->slots != NULL) ? list->capacity : DLIST_INLINE_SLOTS;
+}
+
+/**************************************************************************//**
+ * Move the items of a list to new slots.
+ *
+ * @param   list        Pointer to the list.
+ * @param   slots       The new slots, or NULL to allocate them.
+ * @param   capacity    The number of new slots.
+ * @param   owns_slots  Whether the list is to free the new slots.
+ *****************************************************************************/
+static void dlist_replace_slots(DLIST * list,
+                                DLIST_ITEM * slots,
+                                int capacity,
+                                int owns_slots)
+{
+  assert(list != NULL);
+  assert(capacity > list->count + 1);
+
+  if (slots == NULL)
   {
-    count++;
-    item = item->next;
+    slots = malloc(capacity * sizeof(DLIST_ITEM));
+    assert(slots != NULL);
   }
 
-  return count;
+  memcpy(slots, dlist_slots(list), list->count * sizeof(DLIST_ITEM));
+  slots[list->count].item = DLIST_END;
+
+  if (list->owns_slots)
+  {
+    free(list->slots);
+  }
+  list->slots = slots;
+  list->capacity = capacity;
+  list->owns_slots = owns_slots;
 }
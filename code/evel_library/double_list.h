@@ -3,7 +3,9 @@
 
 /**************************************************************************//**
  * @file
- * A simple double-linked list.
+ * A simple list, whose items are held in order in a contiguous array.  The
+ * first few items are held in the list itself, so that short lists need no
+ * allocation.
  *
  * @note  No thread protection so you will need to use appropriate
  * synchronization if use spans multiple threads.
@@ -40,20 +42,34 @@
  * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *****************************************************************************/
 
+/*****************************************************************************/
+/* Number of item slots held in the list itself.  One slot always marks the  */
+/* end of the list, so lists of up to DLIST_INLINE_SLOTS - 1 items need no   */
+/* allocation.                                                               */
+/*****************************************************************************/
+#define DLIST_INLINE_SLOTS 4
+
+/**************************************************************************//**
+ * An item in a list.  The next item follows it in memory.
+ *
+ * @note  Adding an item may move the others, so pointers to items are only
+ * valid until the list is next added to.
+ *****************************************************************************/
 typedef struct dlist_item
 {
-  struct dlist_item * previous;
-  struct dlist_item * next;
   void * item;
 } DLIST_ITEM;
 
 /**************************************************************************//**
- * Double-linked list structure
+ * List structure
  *****************************************************************************/
 typedef struct dlist
 {
-  DLIST_ITEM * head;
-  DLIST_ITEM * tail;
+  DLIST_ITEM * slots;        /* Slots outside the list, or NULL if inline.   */
+  int count;
+  int capacity;
+  int owns_slots;            /* Whether the list frees slots.                */
+  DLIST_ITEM inline_slots[DLIST_INLINE_SLOTS];
 } DLIST;
 
 
@@ -61,6 +77,9 @@ void dlist_initialize(DLIST * list);
 void * dlist_pop_last(DLIST * list);
 void dlist_push_first(DLIST * list, void * item);
 void dlist_push_last(DLIST * list, void * item);
+int dlist_is_full(DLIST * list);
+void dlist_move_slots(DLIST * list, DLIST_ITEM * slots, int capacity);
+void dlist_share_slots(DLIST * list);
 DLIST_ITEM * dlist_get_first(DLIST * list);
 DLIST_ITEM * dlist_get_last(DLIST * list);
 DLIST_ITEM * dlist_get_next(DLIST_ITEM * item);
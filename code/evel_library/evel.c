@@ -124,6 +124,11 @@ EVEL_ERR_CODES evel_initialize(const char * const fqdn,
   /***************************************************************************/
   log_initialize(verbosity == 0 ? EVEL_LOG_INFO : EVEL_LOG_DEBUG, "EVEL");
   EVEL_INFO("EVEL started");
+
+  /***************************************************************************/
+  /* Start the clock event epochs are taken from.                            */
+  /***************************************************************************/
+  evel_clock_initialize();
   EVEL_INFO("API server is: %s", fqdn);
   EVEL_INFO("API port is: %d", port);
 
@@ -279,13 +284,25 @@ EVEL_ERR_CODES evel_terminate(void)
   /* Clean up allocated memory.                                              */
   /***************************************************************************/
   free(functional_role);
+  evel_free_header_identity();
 
   /***************************************************************************/
   /* Clean up event throttling.                                              */
   /***************************************************************************/
   evel_throttle_terminate();
 
+  /***************************************************************************/
+  /* Free the event structures kept for reuse.                               */
+  /***************************************************************************/
+  evel_event_pool_terminate();
+
+  /***************************************************************************/
+  /* Stop the clock.                                                         */
+  /***************************************************************************/
+  evel_clock_terminate();
+
   EVEL_INFO("EVEL stopped");
+  log_terminate();
   return(rc);
 }
 
@@ -302,6 +319,21 @@ void evel_free_event(void * event)
   EVEL_ENTER();
 
   if (event != NULL)
+  {
+    evel_memory_release(evt_ptr);
+  }
+
+  if ((event != NULL) && (evt_ptr->arena != NULL))
+  {
+    /*************************************************************************/
+    /* Everything the event owns was allocated from, or adopted by, its      */
+    /* arena, so there is nothing to walk.                                   */
+    /*************************************************************************/
+    EVEL_DEBUG("Event at %lp has an arena", evt_ptr);
+    evel_free_arena(evt_ptr->arena);
+    evel_event_release(evt_ptr->event_domain, evt_ptr);
+  }
+  else if (event != NULL)
   {
     /*************************************************************************/
     /* Work out what kind of event we're dealing with so we can cast it      */
@@ -312,92 +344,79 @@ void evel_free_event(void * event)
     case EVEL_DOMAIN_INTERNAL:
       EVEL_DEBUG("Event is an Internal event at %lp", evt_ptr);
       evel_free_internal_event((EVENT_INTERNAL *) evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_INTERNAL));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_INTERNAL, evt_ptr);
       break;
 
     case EVEL_DOMAIN_HEARTBEAT:
       EVEL_DEBUG("Event is a Heartbeat at %lp", evt_ptr);
       evel_free_header(evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_HEADER));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_HEARTBEAT, evt_ptr);
       break;
 
     case EVEL_DOMAIN_FAULT:
       EVEL_DEBUG("Event is a Fault at %lp", evt_ptr);
       evel_free_fault((EVENT_FAULT *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_FAULT));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_FAULT, evt_ptr);
       break;
 
     case EVEL_DOMAIN_MEASUREMENT:
       EVEL_DEBUG("Event is a Measurement at %lp", evt_ptr);
       evel_free_measurement((EVENT_MEASUREMENT *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_MEASUREMENT));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_MEASUREMENT, evt_ptr);
       break;
 
     case EVEL_DOMAIN_MOBILE_FLOW:
       EVEL_DEBUG("Event is a Mobile Flow at %lp", evt_ptr);
       evel_free_mobile_flow((EVENT_MOBILE_FLOW *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_MOBILE_FLOW));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_MOBILE_FLOW, evt_ptr);
       break;
 
     case EVEL_DOMAIN_REPORT:
       EVEL_DEBUG("Event is a Report at %lp", evt_ptr);
       evel_free_report((EVENT_REPORT *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_REPORT));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_REPORT, evt_ptr);
       break;
 
     case EVEL_DOMAIN_HEARTBEAT_FIELD:
       EVEL_DEBUG("Event is a Heartbeat Field Event at %lp", evt_ptr);
       evel_free_hrtbt_field((EVENT_HEARTBEAT_FIELD *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_HEARTBEAT_FIELD));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_HEARTBEAT_FIELD, evt_ptr);
       break;
 
     case EVEL_DOMAIN_SIPSIGNALING:
       EVEL_DEBUG("Event is a Signaling at %lp", evt_ptr);
       evel_free_signaling((EVENT_SIGNALING *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_SIGNALING));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_SIPSIGNALING, evt_ptr);
       break;
 
     case EVEL_DOMAIN_STATE_CHANGE:
       EVEL_DEBUG("Event is a State Change at %lp", evt_ptr);
       evel_free_state_change((EVENT_STATE_CHANGE *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_STATE_CHANGE));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_STATE_CHANGE, evt_ptr);
       break;
 
     case EVEL_DOMAIN_SYSLOG:
       EVEL_DEBUG("Event is a Syslog at %lp", evt_ptr);
       evel_free_syslog((EVENT_SYSLOG *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_SYSLOG));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_SYSLOG, evt_ptr);
       break;
 
     case EVEL_DOMAIN_OTHER:
       EVEL_DEBUG("Event is an Other at %lp", evt_ptr);
       evel_free_other((EVENT_OTHER *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_OTHER));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_OTHER, evt_ptr);
       break;
 
     case EVEL_DOMAIN_VOICE_QUALITY:
       EVEL_DEBUG("Event is an VoiceQuality at %lp", evt_ptr);
       evel_free_voice_quality((EVENT_VOICE_QUALITY *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_VOICE_QUALITY));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_VOICE_QUALITY, evt_ptr);
       break;
 
     case EVEL_DOMAIN_THRESHOLD_CROSS:
       EVEL_DEBUG("Event is a Threshold crossing at %lp", evt_ptr);
       evel_free_threshold_cross((EVENT_THRESHOLD_CROSS *)evt_ptr);
-      memset(evt_ptr, 0, sizeof(EVENT_THRESHOLD_CROSS));
-      free(evt_ptr);
+      evel_event_release(EVEL_DOMAIN_THRESHOLD_CROSS, evt_ptr);
       break;
 
     default:
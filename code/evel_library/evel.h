@@ -79,6 +79,8 @@ typedef enum {
   EVEL_BAD_METADATA,              /** OpenStack metadata invalid format.     */
   EVEL_BAD_JSON_FORMAT,           /** JSON failed to parse correctly.        */
   EVEL_JSON_KEY_NOT_FOUND,        /** Failed to find the specified JSON key. */
+  EVEL_TEMPLATE_STALE,            /** Template outdated by new throttling.   */
+  EVEL_MEMORY_LIMIT_REACHED,      /** Queued events at the memory limit.     */
   EVEL_MAX_ERROR_CODES            /** Maximum number of valid error codes.   */
 } EVEL_ERR_CODES;
 
@@ -96,6 +98,15 @@ typedef enum {
   EVEL_LOG_MAX               = 101
 } EVEL_LOG_LEVELS;
 
+/**************************************************************************//**
+ * Encodings in which events can be sent to the API.
+ *****************************************************************************/
+typedef enum {
+  EVEL_ENCODING_JSON,         /** JSON text, as application/json.            */
+  EVEL_ENCODING_CBOR,         /** RFC 7049 CBOR, as application/cbor.        */
+  EVEL_MAX_ENCODINGS          /** Maximum number of recognized encodings.    */
+} EVEL_ENCODINGS;
+
 /*****************************************************************************/
 /* Maximum string lengths.                                                   */
 /*****************************************************************************/
@@ -103,6 +114,7 @@ typedef enum {
 #define EVEL_MAX_JSON_BODY           16000
 #define EVEL_MAX_ERROR_STRING_LEN    255
 #define EVEL_MAX_URL_LEN             511
+#define EVEL_SEQUENCE_ID_LEN         12
 
 /**************************************************************************//**
  * This value represents there being no restriction on the reporting interval.
@@ -383,6 +395,32 @@ typedef struct evel_option_int
   EVEL_BOOLEAN is_set;
 } EVEL_OPTION_INT;
 
+/**************************************************************************//**
+ * Presence bitmap for a structure's packed optional fields: bit n is set if
+ * the field with index n has been set.
+ *****************************************************************************/
+typedef unsigned long long EVEL_OPTION_BITMAP;
+
+/**************************************************************************//**
+ * A value in an ::EVEL_OPTION_SPARSE_INT, with the index it was set for.
+ *****************************************************************************/
+typedef struct evel_sparse_int_entry
+{
+  int index;
+  int value;
+} EVEL_SPARSE_INT_ENTRY;
+
+/**************************************************************************//**
+ * Optional parameter holder for a sparse array of int, of which only the
+ * values that are set are stored, in increasing order of index.
+ *****************************************************************************/
+typedef struct evel_option_sparse_int
+{
+  EVEL_SPARSE_INT_ENTRY * entries;
+  int count;
+  int capacity;
+} EVEL_OPTION_SPARSE_INT;
+
 /**************************************************************************//**
  * Optional parameter holder for unsigned long long.
  *****************************************************************************/
@@ -417,6 +455,21 @@ typedef struct internal_header_fields
 #define EVEL_HEADER_MAJOR_VERSION 1
 #define EVEL_HEADER_MINOR_VERSION 2
 
+/*****************************************************************************/
+/* Arena owning the memory of an event, see ::evel_set_event_arenas.         */
+/*****************************************************************************/
+typedef struct evel_arena EVEL_ARENA;
+
+/*****************************************************************************/
+/* Default identity shared between event headers.                            */
+/*****************************************************************************/
+typedef struct evel_identity EVEL_IDENTITY;
+
+/*****************************************************************************/
+/* Event which others are created as copies of, see ::evel_new_prototype.    */
+/*****************************************************************************/
+typedef struct evel_prototype EVEL_PROTOTYPE;
+
 /**************************************************************************//**
  * Event header.
  * JSON equivalent field: commonEventHeader
@@ -451,6 +504,45 @@ typedef struct event_header {
   EVEL_OPTION_STRING nfcnaming_code;
   EVEL_OPTION_STRING nfnaming_code;
 
+  /***************************************************************************/
+  /* Generation of the default identity (VM name and UUID) this header was   */
+  /* created with, used to share cached JSON between headers.  Zero once the */
+  /* identity has been changed on this header.                               */
+  /***************************************************************************/
+  unsigned int identity_generation;
+
+  /***************************************************************************/
+  /* The shared identity which the name, source, reporting entity and event  */
+  /* name fields may point into.  It outlives the header, so only strings    */
+  /* not belonging to it are freed with the header.                          */
+  /***************************************************************************/
+  EVEL_IDENTITY * identity;
+
+  /***************************************************************************/
+  /* Arena the event's strings and list items are allocated from, or NULL if */
+  /* they are allocated from the heap.                                       */
+  /***************************************************************************/
+  EVEL_ARENA * arena;
+
+  /***************************************************************************/
+  /* Prototype the event was created from, whose strings and lists it points */
+  /* at until they are set on the event, or NULL.                            */
+  /***************************************************************************/
+  EVEL_PROTOTYPE * prototype;
+
+  /***************************************************************************/
+  /* Bytes charged to the domain's memory usage while the event is queued,   */
+  /* and the domain charged, which for encoded events is that of the event   */
+  /* they encode.                                                            */
+  /***************************************************************************/
+  size_t memory_charged;
+  EVEL_EVENT_DOMAINS memory_domain;
+
+  /***************************************************************************/
+  /* The eventId when it is the sequence number, as event_id then points to. */
+  /***************************************************************************/
+  char sequence_id[EVEL_SEQUENCE_ID_LEN];
+
 } EVENT_HEADER;
 
 /*****************************************************************************/
@@ -561,6 +653,21 @@ typedef struct json_object_instance
  * @retval  NULL  Failed to create the json object instance.
  *****************************************************************************/
 EVEL_JSON_OBJECT_INSTANCE * evel_new_jsonobjinstance(const char *const yourjson);
+/**************************************************************************//**
+ * Create a new json object instance from trusted json, taking ownership of it.
+ *
+ * Unlike ::evel_new_jsonobjinstance the json is neither parsed nor copied, so
+ * it must already be a valid json object, and must have been allocated with
+ * malloc since it is freed along with the instance.  It is only checked in
+ * debug builds, where invalid json fails an assertion.
+ *
+ * @param   yourjson       json string, which the instance takes ownership of.
+ * @returns pointer to the newly manufactured ::EVEL_JSON_OBJECT_INSTANCE.
+ *          not used (i.e. posted) it must be released using ::evel_free_jsonobjectinstance.
+ * @retval  NULL  Failed to create the json object instance, in which case
+ *                the caller keeps ownership of the json string.
+ *****************************************************************************/
+EVEL_JSON_OBJECT_INSTANCE * evel_new_jsonobjinstance_take(char * yourjson);
 /**************************************************************************//**
  * Free an json object instance.
  *
@@ -683,52 +790,65 @@ typedef struct measurement_cpu_use {
 } MEASUREMENT_CPU_USE;
 
 
+/**************************************************************************//**
+ * Optional fields of a ::MEASUREMENT_DISK_USE, in the order they are encoded.
+ *****************************************************************************/
+typedef enum {
+  EVEL_DISK_IO_TIME_AVG,
+  EVEL_DISK_IO_TIME_LAST,
+  EVEL_DISK_IO_TIME_MAX,
+  EVEL_DISK_IO_TIME_MIN,
+  EVEL_DISK_MERGED_READ_AVG,
+  EVEL_DISK_MERGED_READ_LAST,
+  EVEL_DISK_MERGED_READ_MAX,
+  EVEL_DISK_MERGED_READ_MIN,
+  EVEL_DISK_MERGED_WRITE_AVG,
+  EVEL_DISK_MERGED_WRITE_LAST,
+  EVEL_DISK_MERGED_WRITE_MAX,
+  EVEL_DISK_MERGED_WRITE_MIN,
+  EVEL_DISK_OCTETS_READ_AVG,
+  EVEL_DISK_OCTETS_READ_LAST,
+  EVEL_DISK_OCTETS_READ_MAX,
+  EVEL_DISK_OCTETS_READ_MIN,
+  EVEL_DISK_OCTETS_WRITE_AVG,
+  EVEL_DISK_OCTETS_WRITE_LAST,
+  EVEL_DISK_OCTETS_WRITE_MAX,
+  EVEL_DISK_OCTETS_WRITE_MIN,
+  EVEL_DISK_OPS_READ_AVG,
+  EVEL_DISK_OPS_READ_LAST,
+  EVEL_DISK_OPS_READ_MAX,
+  EVEL_DISK_OPS_READ_MIN,
+  EVEL_DISK_OPS_WRITE_AVG,
+  EVEL_DISK_OPS_WRITE_LAST,
+  EVEL_DISK_OPS_WRITE_MAX,
+  EVEL_DISK_OPS_WRITE_MIN,
+  EVEL_DISK_PENDING_OPERATIONS_AVG,
+  EVEL_DISK_PENDING_OPERATIONS_LAST,
+  EVEL_DISK_PENDING_OPERATIONS_MAX,
+  EVEL_DISK_PENDING_OPERATIONS_MIN,
+  EVEL_DISK_TIME_READ_AVG,
+  EVEL_DISK_TIME_READ_LAST,
+  EVEL_DISK_TIME_READ_MAX,
+  EVEL_DISK_TIME_READ_MIN,
+  EVEL_DISK_TIME_WRITE_AVG,
+  EVEL_DISK_TIME_WRITE_LAST,
+  EVEL_DISK_TIME_WRITE_MAX,
+  EVEL_DISK_TIME_WRITE_MIN,
+  EVEL_MAX_DISK_FIELDS
+} EVEL_DISK_FIELDS;
+
 /**************************************************************************//**
  * Disk Usage.
  * JSON equivalent field: diskUsage
  *****************************************************************************/
 typedef struct measurement_disk_use {
   char * id;
-  EVEL_OPTION_DOUBLE iotimeavg;
-  EVEL_OPTION_DOUBLE iotimelast;
-  EVEL_OPTION_DOUBLE iotimemax;
-  EVEL_OPTION_DOUBLE iotimemin;
-  EVEL_OPTION_DOUBLE mergereadavg;
-  EVEL_OPTION_DOUBLE mergereadlast;
-  EVEL_OPTION_DOUBLE mergereadmax;
-  EVEL_OPTION_DOUBLE mergereadmin;
-  EVEL_OPTION_DOUBLE mergewriteavg;
-  EVEL_OPTION_DOUBLE mergewritelast;
-  EVEL_OPTION_DOUBLE mergewritemax;
-  EVEL_OPTION_DOUBLE mergewritemin;
-  EVEL_OPTION_DOUBLE octetsreadavg;
-  EVEL_OPTION_DOUBLE octetsreadlast;
-  EVEL_OPTION_DOUBLE octetsreadmax;
-  EVEL_OPTION_DOUBLE octetsreadmin;
-  EVEL_OPTION_DOUBLE octetswriteavg;
-  EVEL_OPTION_DOUBLE octetswritelast;
-  EVEL_OPTION_DOUBLE octetswritemax;
-  EVEL_OPTION_DOUBLE octetswritemin;
-  EVEL_OPTION_DOUBLE opsreadavg;
-  EVEL_OPTION_DOUBLE opsreadlast;
-  EVEL_OPTION_DOUBLE opsreadmax;
-  EVEL_OPTION_DOUBLE opsreadmin;
-  EVEL_OPTION_DOUBLE opswriteavg;
-  EVEL_OPTION_DOUBLE opswritelast;
-  EVEL_OPTION_DOUBLE opswritemax;
-  EVEL_OPTION_DOUBLE opswritemin;
-  EVEL_OPTION_DOUBLE pendingopsavg;
-  EVEL_OPTION_DOUBLE pendingopslast;
-  EVEL_OPTION_DOUBLE pendingopsmax;
-  EVEL_OPTION_DOUBLE pendingopsmin;
-  EVEL_OPTION_DOUBLE timereadavg;
-  EVEL_OPTION_DOUBLE timereadlast;
-  EVEL_OPTION_DOUBLE timereadmax;
-  EVEL_OPTION_DOUBLE timereadmin;
-  EVEL_OPTION_DOUBLE timewriteavg;
-  EVEL_OPTION_DOUBLE timewritelast;
-  EVEL_OPTION_DOUBLE timewritemax;
-  EVEL_OPTION_DOUBLE timewritemin;
+
+  /***************************************************************************/
+  /* Optional fields, indexed by ::EVEL_DISK_FIELDS.                         */
+  /***************************************************************************/
+  EVEL_OPTION_BITMAP present;
+  double values[EVEL_MAX_DISK_FIELDS];
 
 } MEASUREMENT_DISK_USE;
 
@@ -880,88 +1000,99 @@ typedef struct measurement_latency_bucket {
 } MEASUREMENT_LATENCY_BUCKET;
 
 /**************************************************************************//**
- * Virtual NIC usage.
- * JSON equivalent field: vNicUsage
+ * Optional fields of a ::MEASUREMENT_VNIC_PERFORMANCE, in the order they are
+ * encoded.
  *****************************************************************************/
-typedef struct measurement_vnic_performance {
-  /***************************************************************************/
-  /* Optional fields                                                         */
-  /***************************************************************************/
+typedef enum {
   /*Cumulative count of broadcast packets received as read at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_bcast_packets_acc;
+  EVEL_VNIC_RECEIVED_BROADCAST_PACKETS_ACCUMULATED,
   /*Count of broadcast packets received within the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_bcast_packets_delta;
+  EVEL_VNIC_RECEIVED_BROADCAST_PACKETS_DELTA,
   /*Cumulative count of discarded packets received as read at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_discarded_packets_acc;
+  EVEL_VNIC_RECEIVED_DISCARDED_PACKETS_ACCUMULATED,
   /*Count of discarded packets received within the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_discarded_packets_delta;
+  EVEL_VNIC_RECEIVED_DISCARDED_PACKETS_DELTA,
   /*Cumulative count of error packets received as read at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_error_packets_acc;
+  EVEL_VNIC_RECEIVED_ERROR_PACKETS_ACCUMULATED,
   /*Count of error packets received within the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_error_packets_delta;
+  EVEL_VNIC_RECEIVED_ERROR_PACKETS_DELTA,
   /*Cumulative count of multicast packets received as read at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_mcast_packets_acc;
+  EVEL_VNIC_RECEIVED_MULTICAST_PACKETS_ACCUMULATED,
   /*Count of mcast packets received within the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_mcast_packets_delta;
+  EVEL_VNIC_RECEIVED_MULTICAST_PACKETS_DELTA,
   /*Cumulative count of octets received as read at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_octets_acc;
+  EVEL_VNIC_RECEIVED_OCTETS_ACCUMULATED,
   /*Count of octets received within the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_octets_delta;
+  EVEL_VNIC_RECEIVED_OCTETS_DELTA,
   /*Cumulative count of all packets received as read at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_total_packets_acc;
+  EVEL_VNIC_RECEIVED_TOTAL_PACKETS_ACCUMULATED,
   /*Count of all packets received within the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_total_packets_delta;
+  EVEL_VNIC_RECEIVED_TOTAL_PACKETS_DELTA,
   /*Cumulative count of unicast packets received as read at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_ucast_packets_acc;
+  EVEL_VNIC_RECEIVED_UNICAST_PACKETS_ACCUMULATED,
   /*Count of unicast packets received within the measurement interval*/
-  EVEL_OPTION_DOUBLE recvd_ucast_packets_delta;
+  EVEL_VNIC_RECEIVED_UNICAST_PACKETS_DELTA,
   /*Cumulative count of transmitted broadcast packets at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_bcast_packets_acc;
+  EVEL_VNIC_TRANSMITTED_BROADCAST_PACKETS_ACCUMULATED,
   /*Count of transmitted broadcast packets within the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_bcast_packets_delta;
+  EVEL_VNIC_TRANSMITTED_BROADCAST_PACKETS_DELTA,
   /*Cumulative count of transmit discarded packets at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_discarded_packets_acc;
+  EVEL_VNIC_TRANSMITTED_DISCARDED_PACKETS_ACCUMULATED,
   /*Count of transmit discarded packets within the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_discarded_packets_delta;
+  EVEL_VNIC_TRANSMITTED_DISCARDED_PACKETS_DELTA,
   /*Cumulative count of transmit error packets at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_error_packets_acc;
+  EVEL_VNIC_TRANSMITTED_ERROR_PACKETS_ACCUMULATED,
   /*Count of transmit error packets within the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_error_packets_delta;
+  EVEL_VNIC_TRANSMITTED_ERROR_PACKETS_DELTA,
   /*Cumulative count of transmit multicast packets at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_mcast_packets_acc;
+  EVEL_VNIC_TRANSMITTED_MULTICAST_PACKETS_ACCUMULATED,
   /*Count of transmit multicast packets within the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_mcast_packets_delta;
+  EVEL_VNIC_TRANSMITTED_MULTICAST_PACKETS_DELTA,
   /*Cumulative count of transmit octets at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_octets_acc;
+  EVEL_VNIC_TRANSMITTED_OCTETS_ACCUMULATED,
   /*Count of transmit octets received within the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_octets_delta;
+  EVEL_VNIC_TRANSMITTED_OCTETS_DELTA,
   /*Cumulative count of all transmit packets at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_total_packets_acc;
+  EVEL_VNIC_TRANSMITTED_TOTAL_PACKETS_ACCUMULATED,
   /*Count of transmit packets within the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_total_packets_delta;
+  EVEL_VNIC_TRANSMITTED_TOTAL_PACKETS_DELTA,
   /*Cumulative count of all transmit unicast packets at the end of
    the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_ucast_packets_acc;
+  EVEL_VNIC_TRANSMITTED_UNICAST_PACKETS_ACCUMULATED,
   /*Count of transmit unicast packets within the measurement interval*/
-  EVEL_OPTION_DOUBLE tx_ucast_packets_delta;
+  EVEL_VNIC_TRANSMITTED_UNICAST_PACKETS_DELTA,
+  EVEL_MAX_VNIC_FIELDS
+} EVEL_VNIC_FIELDS;
+
+/**************************************************************************//**
+ * Virtual NIC usage.
+ * JSON equivalent field: vNicUsage
+ *****************************************************************************/
+typedef struct measurement_vnic_performance {
   /* Indicates whether vNicPerformance values are likely inaccurate
            due to counter overflow or other condtions*/
   char *valuesaresuspect;
   char *vnic_id;
 
+  /***************************************************************************/
+  /* Optional fields, indexed by ::EVEL_VNIC_FIELDS.                         */
+  /***************************************************************************/
+  EVEL_OPTION_BITMAP present;
+  double values[EVEL_MAX_VNIC_FIELDS];
+
 } MEASUREMENT_VNIC_PERFORMANCE;
 
 /**************************************************************************//**
@@ -1073,9 +1204,11 @@ typedef struct mobile_gtp_per_flow_metrics {
   /***************************************************************************/
   /* Optional fields                                                         */
   /***************************************************************************/
-  EVEL_OPTION_INT ip_tos_counts[EVEL_TOS_SUPPORTED];
-  EVEL_OPTION_INT tcp_flag_counts[EVEL_MAX_TCP_FLAGS];
-  EVEL_OPTION_INT qci_cos_counts[EVEL_MAX_QCI_COS_TYPES];
+  EVEL_OPTION_SPARSE_INT ip_tos_counts;
+  EVEL_OPTION_BITMAP tcp_flags_present;
+  int tcp_flag_counts[EVEL_MAX_TCP_FLAGS];
+  EVEL_OPTION_BITMAP qci_cos_present;
+  int qci_cos_counts[EVEL_MAX_QCI_COS_TYPES];
   EVEL_OPTION_INT dur_connection_failed_status;
   EVEL_OPTION_INT dur_tunnel_failed_status;
   EVEL_OPTION_STRING flow_activated_by;
@@ -1397,9 +1530,346 @@ EVEL_ERR_CODES evel_initialize(const char * const fqdn,
  *****************************************************************************/
 EVEL_ERR_CODES evel_terminate(void);
 
+/**************************************************************************//**
+ * Enable or disable streaming of events to the API.
+ *
+ * When streaming, each event is encoded as it is sent, using chunked transfer
+ * encoding, rather than being encoded in full before the post starts.  This
+ * bounds the memory needed for very large events and gets the first bytes on
+ * the wire sooner.
+ *
+ * @note  This must be called before ::evel_initialize.
+ *
+ * @param enable        Whether to stream events.
+ *****************************************************************************/
+void evel_set_streaming(const bool enable);
+
+/**************************************************************************//**
+ * Enable or disable encoding of events in the threads which post them.
+ *
+ * When enabled, ::evel_post_event encodes the event in the calling thread and
+ * queues just the JSON, so that encoding scales with the number of posting
+ * threads and the event handler thread is left only to send it.  Events are
+ * then encoded with the throttle specification in force when posted, rather
+ * than when sent, and are not streamed.
+ *
+ * @note  This must be called before ::evel_initialize.
+ *
+ * @param enable        Whether to encode events when they are posted.
+ *****************************************************************************/
+void evel_set_producer_encoding(const bool enable);
+
+/**************************************************************************//**
+ * Set the number of threads used to encode events before they are sent.
+ *
+ * When non-zero, a pool of encoder threads takes events from the queue and
+ * encodes them in parallel, handing them to the event handler thread in the
+ * order they were posted, so that encoding uses several cores without the
+ * posting threads doing any of it.  Events are not then streamed.
+ *
+ * @note  This must be called before ::evel_initialize.
+ *
+ * @param threads       The number of encoder threads, or 0 for none.
+ *****************************************************************************/
+void evel_set_encoder_threads(const int threads);
+
+/**************************************************************************//**
+ * Set the encoding in which events are sent to the API.
+ *
+ * JSON is the default.  CBOR walks the same event structures and produces
+ * the same keys and values, but is smaller and far cheaper to encode and to
+ * decode, for collectors which accept it.  Objects added as JSON text (see
+ * ::evel_new_jsonobjinstance) are sent as CBOR byte strings tagged as embedded
+ * JSON.  Responses from the API, and any posts made in reply to them, are
+ * still JSON.
+ *
+ * @note  This must be called before ::evel_initialize.
+ *
+ * @param encoding      The encoding to use.
+ *****************************************************************************/
+void evel_set_encoding(const EVEL_ENCODINGS encoding);
+
+/**************************************************************************//**
+ * Enable or disable asynchronous logging.
+ *
+ * When enabled, logs are formatted by the threads making them but written
+ * to syslog by a separate logging thread, so that a slow syslog never holds
+ * up the library.  Each thread has its own ring of waiting logs, and if it
+ * fills the logs are dropped, and the number dropped logged, rather than
+ * waiting for space.  Logs longer than 511 characters are truncated.
+ *
+ * @note  This must be called before ::evel_initialize.
+ *
+ * @param enable        Whether to log asynchronously.
+ *****************************************************************************/
+void evel_set_async_logging(const bool enable);
+
+/**************************************************************************//**
+ * Enable or disable event arenas.
+ *
+ * When enabled, the strings and list items of new events are allocated from
+ * an arena belonging to the event, which is released in one go when the
+ * event is freed.  Memory is not reclaimed when a value is replaced, so this
+ * suits events which are built once then posted.
+ *
+ * @note  Only events created afterwards are affected.
+ *
+ * @param enable        Whether new events get arenas.
+ *****************************************************************************/
+void evel_set_event_arenas(const bool enable);
+
+/**************************************************************************//**
+ * Set how many event sequence numbers each thread takes at once.
+ *
+ * Taking a block of numbers at once means threads creating many events
+ * rarely contend for the shared sequence, but events from different threads
+ * are then no longer numbered in the order they were created.  The default
+ * is 1, so that they are.  Numbers a thread has taken but not used when it
+ * exits, or when the sequence is reset, are skipped.
+ *
+ * @param size          The number of sequence numbers in each block.
+ *****************************************************************************/
+void evel_set_event_sequence_block(const int size);
+
+/**************************************************************************//**
+ * Clocks event epochs can be taken from.
+ *****************************************************************************/
+typedef enum {
+  EVEL_CLOCK_SYSTEM,          /** The system clock.                          */
+  EVEL_CLOCK_COARSE,          /** The system clock read to the last tick.    */
+  EVEL_CLOCK_TSC,             /** The x86-64 TSC, kept to the system clock.  */
+  EVEL_CLOCK_CACHED,          /** The time read by a thread at intervals.    */
+  EVEL_MAX_CLOCK_SOURCES      /** Maximum number of clocks.                  */
+} EVEL_CLOCK_SOURCES;
+
+/**************************************************************************//**
+ * Set the clock event epochs are taken from.
+ *
+ * The system clock is the default.  On hosts where reading it is a system
+ * call, the others are cheaper but less exact: the coarse clock only moves
+ * each scheduler tick, and the cached clock is only as fresh as the
+ * resolution asked for.  The TSC clock is calibrated against the system
+ * clock for 100ms in ::evel_initialize and is anchored to it again each
+ * second, so between anchors it can drift from the system clock by the
+ * error in the measured rate and by any adjustment made to the system
+ * clock, and steps back to it at the next anchor.  Without an invariant
+ * x86-64 TSC, the system clock is used instead of the TSC clock.
+ *
+ * @note  This must be called before ::evel_initialize.
+ *
+ * @param source        The clock.
+ * @param resolution    How often the cached clock is refreshed, in
+ *                      microseconds.  Not used by the other clocks.
+ *****************************************************************************/
+void evel_set_clock_source(const EVEL_CLOCK_SOURCES source,
+                           const int resolution);
+
+/**************************************************************************//**
+ * What ::evel_post_event does when the memory limit is reached.
+ *****************************************************************************/
+typedef enum {
+  EVEL_MEMORY_LIMIT_SHED,         /** Drop the event.                        */
+  EVEL_MEMORY_LIMIT_BLOCK,        /** Wait for queued events to be sent.     */
+  EVEL_MAX_MEMORY_LIMIT_ACTIONS
+} EVEL_MEMORY_LIMIT_ACTIONS;
+
+/**************************************************************************//**
+ * Set a limit on the memory held by queued events.
+ *
+ * An event is charged to its domain from when it is posted until it has been
+ * sent: the size of its structure, and of its arena if it has one or its
+ * encoding once encoded, whether by the posting thread with
+ * ::evel_set_producer_encoding or by the encoder threads.  The strings and
+ * lists of an event with neither are not counted, so the limit is only
+ * effective for events with arenas, see ::evel_set_event_arenas, or which
+ * are encoded before they wait to be sent.  Each domain's throttle
+ * specification is charged to it while in force.  Once all domains hold the
+ * limit, ::evel_post_event either drops further events, returning
+ * ::EVEL_MEMORY_LIMIT_REACHED, or waits until there is room.  An event is
+ * always accepted when nothing is queued, however large it is.
+ *
+ * @param limit         The limit in bytes, or 0 for none.  The default is
+ *                      none.
+ * @param action        What to do with events posted at the limit.
+ *****************************************************************************/
+void evel_set_memory_limit(const size_t limit,
+                           const EVEL_MEMORY_LIMIT_ACTIONS action);
+
+/**************************************************************************//**
+ * Get the memory held by queued events of a domain.
+ *
+ * This includes the domain's throttle specification.  Events without arenas
+ * are counted at the size of their structure only until they are encoded.
+ *
+ * @param domain        The domain, or ::EVEL_MAX_DOMAINS for all domains.
+ * @param current       Where to store the bytes held now.
+ * @param high_water    Where to store the most bytes held at once.
+ *****************************************************************************/
+void evel_get_memory_usage(const EVEL_EVENT_DOMAINS domain,
+                           size_t * const current,
+                           size_t * const high_water);
+
 EVEL_ERR_CODES evel_post_event(EVENT_HEADER * event);
 const char * evel_error_string(void);
 
+/*****************************************************************************/
+/* Templates for posting recurring events of the same shape.                 */
+/*****************************************************************************/
+typedef struct evel_template EVEL_TEMPLATE;
+
+/**************************************************************************//**
+ * Create a template from a representative event.
+ *
+ * The event is encoded once, noting where each double and unsigned long long
+ * value, the eventId, the sequence and the epochs were written.  Events
+ * posted from the template are copies of that encoding with just those values
+ * replaced, so are not encoded again.
+ *
+ * The event is encoded with the throttle specification for its domain in
+ * force now.  If that changes, ::evel_post_template fails and a new template
+ * must be made.
+ *
+ * @note  A template must only be used from one thread at a time.
+ *
+ * @param event   The representative event.  The caller keeps ownership.
+ *
+ * @returns Pointer to the new ::EVEL_TEMPLATE, which must be released using
+ *          ::evel_free_template.
+ * @retval  NULL  Failed to allocate memory for the template.
+ *****************************************************************************/
+EVEL_TEMPLATE * evel_new_template(EVENT_HEADER * event);
+
+/**************************************************************************//**
+ * Find a value which can be set in a template.
+ *
+ * @param tmpl        Pointer to the ::EVEL_TEMPLATE.
+ * @param key         The JSON key of the value, such as "cpuIdle".
+ * @param occurrence  Which of the values with that key, counting from 0 in
+ *                    the order they are encoded.
+ *
+ * @returns The slot holding the value.
+ * @retval  -1  There is no such value in the template.
+ *****************************************************************************/
+int evel_template_find_slot(EVEL_TEMPLATE * tmpl,
+                            const char * const key,
+                            const int occurrence);
+
+/**************************************************************************//**
+ * Set a double value in a template, for the events posted from it.
+ *
+ * @param tmpl        Pointer to the ::EVEL_TEMPLATE.
+ * @param slot        The slot, from ::evel_template_find_slot, which must
+ *                    hold a double.
+ * @param value       The value to set.
+ *****************************************************************************/
+void evel_template_set_double(EVEL_TEMPLATE * tmpl,
+                              const int slot,
+                              const double value);
+
+/**************************************************************************//**
+ * Set an unsigned long long value in a template, for the events posted from
+ * it.
+ *
+ * @param tmpl        Pointer to the ::EVEL_TEMPLATE.
+ * @param slot        The slot, from ::evel_template_find_slot, which must
+ *                    hold an unsigned long long.
+ * @param value       The value to set.
+ *****************************************************************************/
+void evel_template_set_ull(EVEL_TEMPLATE * tmpl,
+                           const int slot,
+                           const unsigned long long value);
+
+/**************************************************************************//**
+ * Post an event from a template.
+ *
+ * The event gets the next sequence number and, if the representative event's
+ * eventId was its sequence number, that as its eventId too.  Its
+ * lastEpochMicrosec is the current time, and its startEpochMicrosec the same
+ * time before that as in the representative event.
+ *
+ * @param tmpl        Pointer to the ::EVEL_TEMPLATE.
+ *
+ * @returns Status code
+ * @retval  EVEL_SUCCESS On success
+ * @retval  EVEL_TEMPLATE_STALE The throttle specification has changed since
+ *                              the template was made.
+ * @retval  "One of ::EVEL_ERR_CODES" On failure.
+ *****************************************************************************/
+EVEL_ERR_CODES evel_post_template(EVEL_TEMPLATE * tmpl);
+
+/**************************************************************************//**
+ * Free a template.
+ *
+ * @note  It is safe to free a NULL pointer.
+ *
+ * @param tmpl        Pointer to the ::EVEL_TEMPLATE.
+ *****************************************************************************/
+void evel_free_template(EVEL_TEMPLATE * tmpl);
+
+/*****************************************************************************/
+/* Prototypes for creating many events of the same shape.                    */
+/*****************************************************************************/
+
+/**************************************************************************//**
+ * Create a prototype from a Fault or Signaling event.
+ *
+ * Events created from the prototype are copies of the event which share its
+ * strings and lists, so cost an allocation or two however many fields it has.
+ * Setting a field on one of them replaces the value from the prototype, even
+ * those which may otherwise only be set once.
+ *
+ * @note  The event must not be changed or posted once it is a prototype.
+ *        Events may be created from the prototype by any thread.
+ *
+ * @param event   The event.  The prototype takes ownership of it.
+ *
+ * @returns Pointer to the new ::EVEL_PROTOTYPE, which must be released using
+ *          ::evel_free_prototype.
+ * @retval  NULL  Failed to allocate memory for the prototype.
+ *****************************************************************************/
+EVEL_PROTOTYPE * evel_new_prototype(EVENT_HEADER * event);
+
+/**************************************************************************//**
+ * Create a new Fault event from a prototype.
+ *
+ * @param prototype   Pointer to the ::EVEL_PROTOTYPE, made from a Fault.
+ * @param ev_id       The eventId of the new event.  The caller does not need
+ *                    to preserve the value once the function returns.
+ *
+ * @returns pointer to the newly manufactured ::EVENT_FAULT.  If the event is
+ *          not used (i.e. posted) it must be released using ::evel_free_event.
+ * @retval  NULL  Failed to create the event.
+ *****************************************************************************/
+EVENT_FAULT * evel_new_fault_from_prototype(EVEL_PROTOTYPE * prototype,
+                                            const char * const ev_id);
+
+/**************************************************************************//**
+ * Create a new Signaling event from a prototype.
+ *
+ * @param prototype   Pointer to the ::EVEL_PROTOTYPE, made from a Signaling
+ *                    event.
+ * @param ev_id       The eventId of the new event.  The caller does not need
+ *                    to preserve the value once the function returns.
+ *
+ * @returns pointer to the newly manufactured ::EVENT_SIGNALING.  If the event
+ *          is not used (i.e. posted) it must be released using
+ *          ::evel_free_event.
+ * @retval  NULL  Failed to create the event.
+ *****************************************************************************/
+EVENT_SIGNALING * evel_new_signaling_from_prototype(EVEL_PROTOTYPE * prototype,
+                                                    const char * const ev_id);
+
+/**************************************************************************//**
+ * Free a prototype.
+ *
+ * Events already created from it keep it until they are freed themselves.
+ *
+ * @note  It is safe to free a NULL pointer.
+ *
+ * @param prototype   Pointer to the ::EVEL_PROTOTYPE.
+ *****************************************************************************/
+void evel_free_prototype(EVEL_PROTOTYPE * prototype);
+
 
 /**************************************************************************//**
  * Free an event.
@@ -1422,6 +1892,18 @@ int evel_json_encode_event(char * json,
                            int max_size,
                            EVENT_HEADER * event);
 
+/**************************************************************************//**
+ * Get the length of the encoded event, without encoding it.
+ *
+ * The event is sized without throttling, which can only remove fields, so
+ * this is an upper bound on the number of bytes ::evel_json_encode_event
+ * writes.  A buffer of one byte more than this holds the event in full.
+ *
+ * @param event     Pointer to the ::EVENT_HEADER to size.
+ * @returns Number of bytes in the encoded event, excluding the NUL.
+ *****************************************************************************/
+int evel_event_encoded_size(EVENT_HEADER * event);
+
 /**************************************************************************//**
  * Initialize an event instance id.
  *
@@ -1543,6 +2025,17 @@ void evel_init_header(EVENT_HEADER * const header,const char *const eventname);
 void evel_header_type_set(EVENT_HEADER * const header,
                           const char * const type);
 
+/**************************************************************************//**
+ * Set the Event Type property of the event header, without copying it.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param type          The Event Type to be set.  ASCIIZ string allocated with
+ *                      malloc.  The event header takes ownership of it, so the
+ *                      caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_header_type_set_take(EVENT_HEADER * const header, char * const type);
+
 /**************************************************************************//**
  * Set the Start Epoch property of the event header.
  *
@@ -1578,6 +2071,21 @@ void evel_last_epoch_set(EVENT_HEADER * const header,
 void evel_reporting_entity_name_set(EVENT_HEADER * const header,
                                     const char * const entity_name);
 
+/**************************************************************************//**
+ * Set the Reporting Entity Name property of the event header, without copying
+ * it.
+ *
+ * @note The Reporting Entity Name defaults to the OpenStack VM Name.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param entity_name   The entity name to set.  ASCIIZ string allocated with
+ *                      malloc.  The event header takes ownership of it, so
+ *                      the caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_reporting_entity_name_set_take(EVENT_HEADER * const header,
+                                         char * const entity_name);
+
 /**************************************************************************//**
  * Set the Reporting Entity Id property of the event header.
  *
@@ -1589,6 +2097,21 @@ void evel_reporting_entity_name_set(EVENT_HEADER * const header,
 void evel_reporting_entity_id_set(EVENT_HEADER * const header,
                                   const char * const entity_id);
 
+/**************************************************************************//**
+ * Set the Reporting Entity Id property of the event header, without copying
+ * it.
+ *
+ * @note The Reporting Entity Id defaults to the OpenStack VM UUID.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param entity_id     The entity id to set.  ASCIIZ string allocated with
+ *                      malloc.  The event header takes ownership of it, so
+ *                      the caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_reporting_entity_id_set_take(EVENT_HEADER * const header,
+                                       char * const entity_id);
+
 /**************************************************************************//**
  * Set the NFC Naming code property of the event header.
  *
@@ -1597,6 +2120,19 @@ void evel_reporting_entity_id_set(EVENT_HEADER * const header,
  *****************************************************************************/
 void evel_nfcnamingcode_set(EVENT_HEADER * const header,
                          const char * const nfcnam);
+
+/**************************************************************************//**
+ * Set the NFC Naming code property of the event header, without copying it.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param nfcnam        The NFC Naming code to be set.  ASCIIZ string allocated
+ *                      with malloc.  The event header takes ownership of it,
+ *                      so the caller must not use or free it after the
+ *                      function returns.
+ *****************************************************************************/
+void evel_nfcnamingcode_set_take(EVENT_HEADER * const header,
+                                 char * const nfcnam);
+
 /**************************************************************************//**
  * Set the NF Naming code property of the event header.
  *
@@ -1606,6 +2142,18 @@ void evel_nfcnamingcode_set(EVENT_HEADER * const header,
 void evel_nfnamingcode_set(EVENT_HEADER * const header,
                          const char * const nfnam);
 
+/**************************************************************************//**
+ * Set the NF Naming code property of the event header, without copying it.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param nfnam         The NF Naming code to be set.  ASCIIZ string allocated
+ *                      with malloc.  The event header takes ownership of it,
+ *                      so the caller must not use or free it after the
+ *                      function returns.
+ *****************************************************************************/
+void evel_nfnamingcode_set_take(EVENT_HEADER * const header,
+                                char * const nfnam);
+
 /*****************************************************************************/
 /*****************************************************************************/
 /*                                                                           */
@@ -1669,19 +2217,49 @@ void evel_fault_category_set(EVENT_FAULT * fault,
                               const char * const category);
 
 /**************************************************************************//**
- * Set the Alarm Interface A property of the Fault.
+ * Set the Fault Category property of the Fault, without copying it.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
- *        overwrite, just ignoring the update instead.
+ *        overwrite, just ignoring (and freeing) the update instead.
  *
  * @param fault      Pointer to the fault.
- * @param interface  The Alarm Interface A to be set. ASCIIZ string. The caller
- *                   does not need to preserve the value once the function
+ * @param category   The Fault Category to be set.  ASCIIZ string allocated
+ *                   with malloc.  The Fault takes ownership of it, so the
+ *                   caller must not use or free it after the function
  *                   returns.
  *****************************************************************************/
-void evel_fault_interface_set(EVENT_FAULT * fault,
-                              const char * const interface);
+void evel_fault_category_set_take(EVENT_FAULT * fault, char * const category);
+
+/**************************************************************************//**
+ * Set the Alarm Interface A property of the Fault.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring the update instead.
+ *
+ * @param fault      Pointer to the fault.
+ * @param interface  The Alarm Interface A to be set. ASCIIZ string. The caller
+ *                   does not need to preserve the value once the function
+ *                   returns.
+ *****************************************************************************/
+void evel_fault_interface_set(EVENT_FAULT * fault,
+                              const char * const interface);
+
+/**************************************************************************//**
+ * Set the Alarm Interface A property of the Fault, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param fault      Pointer to the fault.
+ * @param interface  The Alarm Interface A to be set.  ASCIIZ string allocated
+ *                   with malloc.  The Fault takes ownership of it, so the
+ *                   caller must not use or free it after the function
+ *                   returns.
+ *****************************************************************************/
+void evel_fault_interface_set_take(EVENT_FAULT * fault, char * const interface);
 
 /**************************************************************************//**
  * Add an additional value name/value pair to the Fault.
@@ -1696,6 +2274,20 @@ void evel_fault_interface_set(EVENT_FAULT * fault,
  *****************************************************************************/
 void evel_fault_addl_info_add(EVENT_FAULT * fault, char * name, char * value);
 
+/**************************************************************************//**
+ * Add an additional value name/value pair to the Fault, without copying it.
+ *
+ * @param fault     Pointer to the fault.
+ * @param name      ASCIIZ string with the attribute's name, allocated with
+ *                  malloc.  The Fault takes ownership of it, so the caller
+ *                  must not use or free it after the function returns.
+ * @param value     ASCIIZ string with the attribute's value, allocated with
+ *                  malloc.  The Fault takes ownership of it, as for name.
+ *****************************************************************************/
+void evel_fault_addl_info_add_take(EVENT_FAULT * fault,
+                                   char * name,
+                                   char * value);
+
 /**************************************************************************//**
  * Set the Event Type property of the Fault.
  *
@@ -1763,6 +2355,41 @@ void evel_free_measurement(EVENT_MEASUREMENT * event);
 void evel_measurement_type_set(EVENT_MEASUREMENT * measurement,
                                const char * const type);
 
+/**************************************************************************//**
+ * Add an additional value name/value pair to the Measurement.
+ *
+ * The name and value are null delimited ASCII strings.  The library takes
+ * a copy so the caller does not have to preserve values after the function
+ * returns.
+ *
+ * @param measurement     Pointer to the measurement.
+ * @param name      ASCIIZ string with the attribute's name.  The caller
+ *                  does not need to preserve the value once the function
+ *                  returns.
+ * @param value     ASCIIZ string with the attribute's value.  The caller
+ *                  does not need to preserve the value once the function
+ *                  returns.
+ *****************************************************************************/
+void evel_measurement_addl_info_add(EVENT_MEASUREMENT * measurement,
+                                    char * name,
+                                    char * value);
+
+/**************************************************************************//**
+ * Add an additional value name/value pair to the Measurement, without
+ * copying it.
+ *
+ * @param measurement     Pointer to the measurement.
+ * @param name      ASCIIZ string with the attribute's name, allocated with
+ *                  malloc.  The Measurement takes ownership of it, so the
+ *                  caller must not use or free it after the function returns.
+ * @param value     ASCIIZ string with the attribute's value, allocated with
+ *                  malloc.  The Measurement takes ownership of it, as for
+ *                  name.
+ *****************************************************************************/
+void evel_measurement_addl_info_add_take(EVENT_MEASUREMENT * measurement,
+                                         char * name,
+                                         char * value);
+
 /**************************************************************************//**
  * Set the Concurrent Sessions property of the Measurement.
  *
@@ -2743,6 +3370,22 @@ void evel_free_mobile_flow(EVENT_MOBILE_FLOW * event);
 void evel_mobile_flow_type_set(EVENT_MOBILE_FLOW * mobile_flow,
                                const char * const type);
 
+/**************************************************************************//**
+ * Set the Event Type property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param type        The Event Type to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Mobile Flow takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_type_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                    char * const type);
+
 /**************************************************************************//**
  * Set the Application Type property of the Mobile Flow.
  *
@@ -2758,6 +3401,22 @@ void evel_mobile_flow_type_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_app_type_set(EVENT_MOBILE_FLOW * mobile_flow,
                                    const char * const type);
 
+/**************************************************************************//**
+ * Set the Application Type property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param type        The Application Type to be set.  ASCIIZ string allocated
+ *                    with malloc.  The Mobile Flow takes ownership of it, so
+ *                    the caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_app_type_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                        char * const type);
+
 /**************************************************************************//**
  * Set the Application Protocol Type property of the Mobile Flow.
  *
@@ -2773,6 +3432,23 @@ void evel_mobile_flow_app_type_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_app_prot_type_set(EVENT_MOBILE_FLOW * mobile_flow,
                                         const char * const type);
 
+/**************************************************************************//**
+ * Set the Application Protocol Type property of the Mobile Flow, without
+ * copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param type        The Application Protocol Type to be set.  ASCIIZ string
+ *                    allocated with malloc.  The Mobile Flow takes ownership
+ *                    of it, so the caller must not use or free it after the
+ *                    function returns.
+ *****************************************************************************/
+void evel_mobile_flow_app_prot_type_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                             char * const type);
+
 /**************************************************************************//**
  * Set the Application Protocol Version property of the Mobile Flow.
  *
@@ -2788,6 +3464,23 @@ void evel_mobile_flow_app_prot_type_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_app_prot_ver_set(EVENT_MOBILE_FLOW * mobile_flow,
                                        const char * const version);
 
+/**************************************************************************//**
+ * Set the Application Protocol Version property of the Mobile Flow, without
+ * copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param version     The Application Protocol Version to be set.  ASCIIZ
+ *                    string allocated with malloc.  The Mobile Flow takes
+ *                    ownership of it, so the caller must not use or free it
+ *                    after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_app_prot_ver_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                            char * const version);
+
 /**************************************************************************//**
  * Set the CID property of the Mobile Flow.
  *
@@ -2802,6 +3495,21 @@ void evel_mobile_flow_app_prot_ver_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_cid_set(EVENT_MOBILE_FLOW * mobile_flow,
                               const char * const cid);
 
+/**************************************************************************//**
+ * Set the CID property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param cid         The CID to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_cid_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const cid);
+
 /**************************************************************************//**
  * Set the Connection Type property of the Mobile Flow.
  *
@@ -2817,6 +3525,22 @@ void evel_mobile_flow_cid_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_con_type_set(EVENT_MOBILE_FLOW * mobile_flow,
                                    const char * const type);
 
+/**************************************************************************//**
+ * Set the Connection Type property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param type        The Connection Type to be set.  ASCIIZ string allocated
+ *                    with malloc.  The Mobile Flow takes ownership of it, so
+ *                    the caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_con_type_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                        char * const type);
+
 /**************************************************************************//**
  * Set the ECGI property of the Mobile Flow.
  *
@@ -2831,6 +3555,21 @@ void evel_mobile_flow_con_type_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_ecgi_set(EVENT_MOBILE_FLOW * mobile_flow,
                                const char * const ecgi);
 
+/**************************************************************************//**
+ * Set the ECGI property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param ecgi        The ECGI to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_ecgi_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                    char * const ecgi);
+
 /**************************************************************************//**
  * Set the GTP Protocol Type property of the Mobile Flow.
  *
@@ -2846,6 +3585,22 @@ void evel_mobile_flow_ecgi_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_gtp_prot_type_set(EVENT_MOBILE_FLOW * mobile_flow,
                                         const char * const type);
 
+/**************************************************************************//**
+ * Set the GTP Protocol Type property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param type        The GTP Protocol Type to be set.  ASCIIZ string allocated
+ *                    with malloc.  The Mobile Flow takes ownership of it, so
+ *                    the caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_gtp_prot_type_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                             char * const type);
+
 /**************************************************************************//**
  * Set the GTP Protocol Version property of the Mobile Flow.
  *
@@ -2861,6 +3616,23 @@ void evel_mobile_flow_gtp_prot_type_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_gtp_prot_ver_set(EVENT_MOBILE_FLOW * mobile_flow,
                                        const char * const version);
 
+/**************************************************************************//**
+ * Set the GTP Protocol Version property of the Mobile Flow, without copying
+ * it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param version     The GTP Protocol Version to be set.  ASCIIZ string
+ *                    allocated with malloc.  The Mobile Flow takes ownership
+ *                    of it, so the caller must not use or free it after the
+ *                    function returns.
+ *****************************************************************************/
+void evel_mobile_flow_gtp_prot_ver_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                            char * const version);
+
 /**************************************************************************//**
  * Set the HTTP Header property of the Mobile Flow.
  *
@@ -2875,6 +3647,22 @@ void evel_mobile_flow_gtp_prot_ver_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_http_header_set(EVENT_MOBILE_FLOW * mobile_flow,
                                       const char * const header);
 
+/**************************************************************************//**
+ * Set the HTTP Header property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param header      The HTTP header to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Mobile Flow takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_http_header_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                           char * const header);
+
 /**************************************************************************//**
  * Set the IMEI property of the Mobile Flow.
  *
@@ -2889,6 +3677,21 @@ void evel_mobile_flow_http_header_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_imei_set(EVENT_MOBILE_FLOW * mobile_flow,
                                const char * const imei);
 
+/**************************************************************************//**
+ * Set the IMEI property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param imei        The IMEI to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_imei_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                    char * const imei);
+
 /**************************************************************************//**
  * Set the IMSI property of the Mobile Flow.
  *
@@ -2903,6 +3706,21 @@ void evel_mobile_flow_imei_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_imsi_set(EVENT_MOBILE_FLOW * mobile_flow,
                                const char * const imsi);
 
+/**************************************************************************//**
+ * Set the IMSI property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param imsi        The IMSI to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_imsi_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                    char * const imsi);
+
 /**************************************************************************//**
  * Set the LAC property of the Mobile Flow.
  *
@@ -2917,6 +3735,21 @@ void evel_mobile_flow_imsi_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_lac_set(EVENT_MOBILE_FLOW * mobile_flow,
                               const char * const lac);
 
+/**************************************************************************//**
+ * Set the LAC property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param lac         The LAC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_lac_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const lac);
+
 /**************************************************************************//**
  * Set the MCC property of the Mobile Flow.
  *
@@ -2931,6 +3764,21 @@ void evel_mobile_flow_lac_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_mcc_set(EVENT_MOBILE_FLOW * mobile_flow,
                               const char * const mcc);
 
+/**************************************************************************//**
+ * Set the MCC property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param mcc         The MCC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_mcc_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const mcc);
+
 /**************************************************************************//**
  * Set the MNC property of the Mobile Flow.
  *
@@ -2945,6 +3793,21 @@ void evel_mobile_flow_mcc_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_mnc_set(EVENT_MOBILE_FLOW * mobile_flow,
                               const char * const mnc);
 
+/**************************************************************************//**
+ * Set the MNC property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param mnc         The MNC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_mnc_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const mnc);
+
 /**************************************************************************//**
  * Set the MSISDN property of the Mobile Flow.
  *
@@ -2959,6 +3822,22 @@ void evel_mobile_flow_mnc_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_msisdn_set(EVENT_MOBILE_FLOW * mobile_flow,
                                  const char * const msisdn);
 
+/**************************************************************************//**
+ * Set the MSISDN property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param msisdn      The MSISDN to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Mobile Flow takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_msisdn_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                      char * const msisdn);
+
 /**************************************************************************//**
  * Set the Other Functional Role property of the Mobile Flow.
  *
@@ -2974,6 +3853,23 @@ void evel_mobile_flow_msisdn_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_other_func_role_set(EVENT_MOBILE_FLOW * mobile_flow,
                                           const char * const role);
 
+/**************************************************************************//**
+ * Set the Other Functional Role property of the Mobile Flow, without copying
+ * it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param role        The Other Functional Role to be set.  ASCIIZ string
+ *                    allocated with malloc.  The Mobile Flow takes ownership
+ *                    of it, so the caller must not use or free it after the
+ *                    function returns.
+ *****************************************************************************/
+void evel_mobile_flow_other_func_role_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                               char * const role);
+
 /**************************************************************************//**
  * Set the RAC property of the Mobile Flow.
  *
@@ -2988,6 +3884,21 @@ void evel_mobile_flow_other_func_role_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_rac_set(EVENT_MOBILE_FLOW * mobile_flow,
                               const char * const rac);
 
+/**************************************************************************//**
+ * Set the RAC property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param rac         The RAC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_rac_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const rac);
+
 /**************************************************************************//**
  * Set the Radio Access Technology property of the Mobile Flow.
  *
@@ -3003,6 +3914,23 @@ void evel_mobile_flow_rac_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_radio_acc_tech_set(EVENT_MOBILE_FLOW * mobile_flow,
                                          const char * const tech);
 
+/**************************************************************************//**
+ * Set the Radio Access Technology property of the Mobile Flow, without copying
+ * it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param tech        The Radio Access Technology to be set.  ASCIIZ string
+ *                    allocated with malloc.  The Mobile Flow takes ownership
+ *                    of it, so the caller must not use or free it after the
+ *                    function returns.
+ *****************************************************************************/
+void evel_mobile_flow_radio_acc_tech_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                              char * const tech);
+
 /**************************************************************************//**
  * Set the SAC property of the Mobile Flow.
  *
@@ -3017,6 +3945,21 @@ void evel_mobile_flow_radio_acc_tech_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_sac_set(EVENT_MOBILE_FLOW * mobile_flow,
                               const char * const sac);
 
+/**************************************************************************//**
+ * Set the SAC property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param sac         The SAC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_sac_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const sac);
+
 /**************************************************************************//**
  * Set the Sampling Algorithm property of the Mobile Flow.
  *
@@ -3044,6 +3987,21 @@ void evel_mobile_flow_samp_alg_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_tac_set(EVENT_MOBILE_FLOW * mobile_flow,
                               const char * const tac);
 
+/**************************************************************************//**
+ * Set the TAC property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param tac         The TAC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_tac_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const tac);
+
 /**************************************************************************//**
  * Set the Tunnel ID property of the Mobile Flow.
  *
@@ -3058,6 +4016,22 @@ void evel_mobile_flow_tac_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_tunnel_id_set(EVENT_MOBILE_FLOW * mobile_flow,
                                     const char * const tunnel_id);
 
+/**************************************************************************//**
+ * Set the Tunnel ID property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param tunnel_id   The Tunnel ID to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Mobile Flow takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_tunnel_id_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                         char * const tunnel_id);
+
 /**************************************************************************//**
  * Set the VLAN ID property of the Mobile Flow.
  *
@@ -3072,6 +4046,22 @@ void evel_mobile_flow_tunnel_id_set(EVENT_MOBILE_FLOW * mobile_flow,
 void evel_mobile_flow_vlan_id_set(EVENT_MOBILE_FLOW * mobile_flow,
                                   const char * const vlan_id);
 
+/**************************************************************************//**
+ * Set the VLAN ID property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param vlan_id     The VLAN ID to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Mobile Flow takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_vlan_id_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                       char * const vlan_id);
+
 /**************************************************************************//**
  * Create a new Mobile GTP Per Flow Metrics.
  *
@@ -3471,6 +4461,22 @@ void evel_free_signaling(EVENT_SIGNALING * const event);
 void evel_signaling_type_set(EVENT_SIGNALING * const event,
                              const char * const type);
 
+/**************************************************************************//**
+ * Set the Event Type property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param type          The Event Type to be set.  ASCIIZ string allocated with
+ *                      malloc.  The Signaling event takes ownership of it, so
+ *                      the caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_signaling_type_set_take(EVENT_SIGNALING * const event,
+                                  char * const type);
+
 /**************************************************************************//**
  * Add an additional value name/value pair to the SIP signaling.
  *
@@ -3488,6 +4494,22 @@ void evel_signaling_type_set(EVENT_SIGNALING * const event,
  *****************************************************************************/
 void evel_signaling_addl_info_add(EVENT_SIGNALING * event, char * name, char * value);
 
+/**************************************************************************//**
+ * Add an additional value name/value pair to the SIP signaling, without
+ * copying it.
+ *
+ * @param event     Pointer to the Signaling event.
+ * @param name      ASCIIZ string with the attribute's name, allocated with
+ *                  malloc.  The Signaling event takes ownership of it, so the
+ *                  caller must not use or free it after the function returns.
+ * @param value     ASCIIZ string with the attribute's value, allocated with
+ *                  malloc.  The Signaling event takes ownership of it, as for
+ *                  name.
+ *****************************************************************************/
+void evel_signaling_addl_info_add_take(EVENT_SIGNALING * event,
+                                       char * name,
+                                       char * value);
+
 /**************************************************************************//**
  * Set the Correlator property of the Signaling event.
  *
@@ -3503,6 +4525,22 @@ void evel_signaling_addl_info_add(EVENT_SIGNALING * event, char * name, char * v
 void evel_signaling_correlator_set(EVENT_SIGNALING * const event,
                                    const char * const correlator);
 
+/**************************************************************************//**
+ * Set the Correlator property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param correlator    The correlator to be set.  ASCIIZ string allocated with
+ *                      malloc.  The Signaling event takes ownership of it, so
+ *                      the caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_signaling_correlator_set_take(EVENT_SIGNALING * const event,
+                                        char * const correlator);
+
 /**************************************************************************//**
  * Set the Local Ip Address property of the Signaling event.
  *
@@ -3519,6 +4557,24 @@ void evel_signaling_correlator_set(EVENT_SIGNALING * const event,
 void evel_signaling_local_ip_address_set(EVENT_SIGNALING * const event,
                                          const char * const local_ip_address);
 
+/**************************************************************************//**
+ * Set the Local Ip Address property of the Signaling event, without copying
+ * it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param local_ip_address
+ *                      The Local Ip Address to be set.  ASCIIZ string
+ *                      allocated with malloc.  The Signaling event takes
+ *                      ownership of it, so the caller must not use or free it
+ *                      after the function returns.
+ *****************************************************************************/
+void evel_signaling_local_ip_address_set_take(EVENT_SIGNALING * const event,
+                                              char * const local_ip_address);
+
 /**************************************************************************//**
  * Set the Local Port property of the Signaling event.
  *
@@ -3534,6 +4590,22 @@ void evel_signaling_local_ip_address_set(EVENT_SIGNALING * const event,
 void evel_signaling_local_port_set(EVENT_SIGNALING * const event,
                                    const char * const local_port);
 
+/**************************************************************************//**
+ * Set the Local Port property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param local_port    The Local Port to be set.  ASCIIZ string allocated with
+ *                      malloc.  The Signaling event takes ownership of it, so
+ *                      the caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_signaling_local_port_set_take(EVENT_SIGNALING * const event,
+                                        char * const local_port);
+
 /**************************************************************************//**
  * Set the Remote Ip Address property of the Signaling event.
  *
@@ -3550,6 +4622,24 @@ void evel_signaling_local_port_set(EVENT_SIGNALING * const event,
 void evel_signaling_remote_ip_address_set(EVENT_SIGNALING * const event,
                                          const char * const remote_ip_address);
 
+/**************************************************************************//**
+ * Set the Remote Ip Address property of the Signaling event, without copying
+ * it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param remote_ip_address
+ *                      The Remote Ip Address to be set.  ASCIIZ string
+ *                      allocated with malloc.  The Signaling event takes
+ *                      ownership of it, so the caller must not use or free it
+ *                      after the function returns.
+ *****************************************************************************/
+void evel_signaling_remote_ip_address_set_take(EVENT_SIGNALING * const event,
+                                               char * const remote_ip_address);
+
 /**************************************************************************//**
  * Set the Remote Port property of the Signaling event.
  *
@@ -3564,6 +4654,22 @@ void evel_signaling_remote_ip_address_set(EVENT_SIGNALING * const event,
  *****************************************************************************/
 void evel_signaling_remote_port_set(EVENT_SIGNALING * const event,
                                     const char * const remote_port);
+
+/**************************************************************************//**
+ * Set the Remote Port property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param remote_port   The Remote Port to be set.  ASCIIZ string allocated
+ *                      with malloc.  The Signaling event takes ownership of
+ *                      it, so the caller must not use or free it after the
+ *                      function returns.
+ *****************************************************************************/
+void evel_signaling_remote_port_set_take(EVENT_SIGNALING * const event,
+                                         char * const remote_port);
 /**************************************************************************//**
  * Set the Vendor module property of the Signaling event.
  *
@@ -3578,6 +4684,21 @@ void evel_signaling_remote_port_set(EVENT_SIGNALING * const event,
  *****************************************************************************/
 void evel_signaling_vnfmodule_name_set(EVENT_SIGNALING * const event,
                                     const char * const module_name);
+
+/**************************************************************************//**
+ * Set the Vendor module property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param modulename    The module name to be set. ASCIIZ string. The caller
+ *                      does not need to preserve the value once the function
+ *                      returns.
+ *****************************************************************************/
+void evel_signaling_vnfmodule_name_set_take(EVENT_SIGNALING * const event,
+                                            char * const module_name);
 /**************************************************************************//**
  * Set the Vendor module property of the Signaling event.
  *
@@ -3593,6 +4714,22 @@ void evel_signaling_vnfmodule_name_set(EVENT_SIGNALING * const event,
 void evel_signaling_vnfname_set(EVENT_SIGNALING * const event,
                                     const char * const vnfname);
 
+/**************************************************************************//**
+ * Set the Vendor module property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param vnfname       The Virtual Network function to be set.  ASCIIZ string
+ *                      allocated with malloc.  The Signaling event takes
+ *                      ownership of it, so the caller must not use or free it
+ *                      after the function returns.
+ *****************************************************************************/
+void evel_signaling_vnfname_set_take(EVENT_SIGNALING * const event,
+                                     char * const vnfname);
+
 /**************************************************************************//**
  * Set the Compressed SIP property of the Signaling event.
  *
@@ -3609,6 +4746,23 @@ void evel_signaling_vnfname_set(EVENT_SIGNALING * const event,
 void evel_signaling_compressed_sip_set(EVENT_SIGNALING * const event,
                                        const char * const compressed_sip);
 
+/**************************************************************************//**
+ * Set the Compressed SIP property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param compressed_sip
+ *                      The Compressed SIP to be set.  ASCIIZ string allocated
+ *                      with malloc.  The Signaling event takes ownership of
+ *                      it, so the caller must not use or free it after the
+ *                      function returns.
+ *****************************************************************************/
+void evel_signaling_compressed_sip_set_take(EVENT_SIGNALING * const event,
+                                            char * const compressed_sip);
+
 /**************************************************************************//**
  * Set the Summary SIP property of the Signaling event.
  *
@@ -3624,6 +4778,22 @@ void evel_signaling_compressed_sip_set(EVENT_SIGNALING * const event,
 void evel_signaling_summary_sip_set(EVENT_SIGNALING * const event,
                                     const char * const summary_sip);
 
+/**************************************************************************//**
+ * Set the Summary SIP property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param summary_sip   The Summary SIP to be set.  ASCIIZ string allocated
+ *                      with malloc.  The Signaling event takes ownership of
+ *                      it, so the caller must not use or free it after the
+ *                      function returns.
+ *****************************************************************************/
+void evel_signaling_summary_sip_set_take(EVENT_SIGNALING * const event,
+                                         char * const summary_sip);
+
 
 /*****************************************************************************/
 /*****************************************************************************/
@@ -3683,6 +4853,22 @@ void evel_free_state_change(EVENT_STATE_CHANGE * const state_change);
 void evel_state_change_type_set(EVENT_STATE_CHANGE * const state_change,
                                 const char * const type);
 
+/**************************************************************************//**
+ * Set the Event Type property of the State Change, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param state_change  Pointer to the ::EVENT_STATE_CHANGE.
+ * @param type          The Event Type to be set.  ASCIIZ string allocated with
+ *                      malloc.  The State Change takes ownership of it, so the
+ *                      caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_state_change_type_set_take(EVENT_STATE_CHANGE * const state_change,
+                                     char * const type);
+
 /**************************************************************************//**
  * Add an additional field name/value pair to the State Change.
  *
@@ -3702,6 +4888,24 @@ void evel_state_change_addl_field_add(EVENT_STATE_CHANGE * const state_change,
                                       const char * const name,
                                       const char * const value);
 
+/**************************************************************************//**
+ * Add an additional field name/value pair to the State Change, without
+ * copying it.
+ *
+ * @param state_change  Pointer to the ::EVENT_STATE_CHANGE.
+ * @param name          ASCIIZ string with the attribute's name, allocated
+ *                      with malloc.  The State Change takes ownership of it,
+ *                      so the caller must not use or free it after the
+ *                      function returns.
+ * @param value         ASCIIZ string with the attribute's value, allocated
+ *                      with malloc.  The State Change takes ownership of it,
+ *                      as for name.
+ *****************************************************************************/
+void evel_state_change_addl_field_add_take(
+                                       EVENT_STATE_CHANGE * const state_change,
+                                       char * name,
+                                       char * value);
+
 /*****************************************************************************/
 /*****************************************************************************/
 /*                                                                           */
@@ -3749,6 +4953,20 @@ EVENT_SYSLOG * evel_new_syslog(const char* ev_name, const char *ev_id,
 void evel_syslog_type_set(EVENT_SYSLOG * syslog,
                           const char * const type);
 
+/**************************************************************************//**
+ * Set the Event Type property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param syslog      Pointer to the syslog.
+ * @param type        The Event Type to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Syslog takes ownership of it, so the caller
+ *                    must not use or free it after the function returns.
+ *****************************************************************************/
+void evel_syslog_type_set_take(EVENT_SYSLOG * syslog, char * const type);
+
 /**************************************************************************//**
  * Free a Syslog.
  *
@@ -3793,6 +5011,22 @@ void evel_syslog_addl_field_add(EVENT_SYSLOG * syslog,
 void evel_syslog_event_source_host_set(EVENT_SYSLOG * syslog,
                                        const char * const host);
 
+/**************************************************************************//**
+ * Set the Event Source Host property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param syslog      Pointer to the Syslog.
+ * @param host        The Event Source Host to be set.  ASCIIZ string allocated
+ *                    with malloc.  The Syslog takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_syslog_event_source_host_set_take(EVENT_SYSLOG * syslog,
+                                            char * const host);
+
 /**************************************************************************//**
  * Set the Syslog Facility property of the Syslog.
  *
@@ -3821,6 +5055,20 @@ void evel_syslog_facility_set(EVENT_SYSLOG * syslog,
  *****************************************************************************/
 void evel_syslog_proc_set(EVENT_SYSLOG * syslog, const char * const proc);
 
+/**************************************************************************//**
+ * Set the Process property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param syslog      Pointer to the Syslog.
+ * @param proc        The Process to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Syslog takes ownership of it, so the caller
+ *                    must not use or free it after the function returns.
+ *****************************************************************************/
+void evel_syslog_proc_set_take(EVENT_SYSLOG * syslog, char * const proc);
+
 /**************************************************************************//**
  * Set the Process ID property of the Syslog.
  *
@@ -3859,6 +5107,21 @@ void evel_syslog_version_set(EVENT_SYSLOG * syslog, int version);
  *****************************************************************************/
 void evel_syslog_s_data_set(EVENT_SYSLOG * syslog, const char * const s_data);
 
+/**************************************************************************//**
+ * Set the Structured Data property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param syslog      Pointer to the Syslog.
+ * @param s_data      The Structured Data to be set.  ASCIIZ string allocated
+ *                    with malloc.  The Syslog takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_syslog_s_data_set_take(EVENT_SYSLOG * syslog, char * const s_data);
+
 /**************************************************************************//**
  * Set the Structured SDID property of the Syslog.
  *
@@ -3873,6 +5136,20 @@ void evel_syslog_s_data_set(EVENT_SYSLOG * syslog, const char * const s_data);
  *****************************************************************************/
 void evel_syslog_sdid_set(EVENT_SYSLOG * syslog, const char * const sdid);
 
+/**************************************************************************//**
+ * Set the Structured SDID property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param syslog     Pointer to the Syslog.
+ * @param sdid     The Structured Data to be set.  ASCIIZ string allocated with
+ *                 malloc.  The Syslog takes ownership of it, so the caller
+ *                 must not use or free it after the function returns.
+ *****************************************************************************/
+void evel_syslog_sdid_set_take(EVENT_SYSLOG * syslog, char * const sdid);
+
 /**************************************************************************//**
  * Set the Structured Severity property of the Syslog.
  *
@@ -3887,6 +5164,22 @@ void evel_syslog_sdid_set(EVENT_SYSLOG * syslog, const char * const sdid);
  *****************************************************************************/
 void evel_syslog_severity_set(EVENT_SYSLOG * syslog, const char * const severty);
 
+/**************************************************************************//**
+ * Set the Structured Severity property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.  An
+ *        unrecognized severity is freed and ignored in the same way.
+ *
+ * @param syslog     Pointer to the Syslog.
+ * @param severty    The Severity to be set.  ASCIIZ string allocated with
+ *                   malloc.  The Syslog takes ownership of it, so the caller
+ *                   must not use or free it after the function returns.
+ *****************************************************************************/
+void evel_syslog_severity_set_take(EVENT_SYSLOG * syslog,
+                                   char * const severty);
+
 
 /*****************************************************************************/
 /*****************************************************************************/
@@ -3948,6 +5241,18 @@ void evel_other_field_add(EVENT_OTHER * other,
                           char * name,
                           char * value);
 
+/**************************************************************************//**
+ * Add a field name/value pair to the Other, without copying it.
+ *
+ * @param other     Pointer to the Other.
+ * @param name      ASCIIZ string with the field's name, allocated with
+ *                  malloc.  The Other takes ownership of it, so the caller
+ *                  must not use or free it after the function returns.
+ * @param value     ASCIIZ string with the field's value, allocated with
+ *                  malloc.  The Other takes ownership of it, as for name.
+ *****************************************************************************/
+void evel_other_field_add_take(EVENT_OTHER * other, char * name, char * value);
+
 /*****************************************************************************/
 /*****************************************************************************/
 /*                                                                           */
@@ -3971,6 +5276,33 @@ int evel_get_measurement_interval();
 #define EVEL_VOICEQ_MAJOR_VERSION 1
 #define EVEL_VOICEQ_MINOR_VERSION 1
 
+/**************************************************************************//**
+ * Optional fields of an ::END_OF_CALL_VOICE_QUALITY_METRICS, in the order
+ * they are encoded.
+ *****************************************************************************/
+typedef enum {
+  EVEL_VQM_ENDPOINT_JITTER,
+  EVEL_VQM_ENDPOINT_RTP_OCTETS_DISCARDED,
+  EVEL_VQM_ENDPOINT_RTP_OCTETS_RECEIVED,
+  EVEL_VQM_ENDPOINT_RTP_OCTETS_SENT,
+  EVEL_VQM_ENDPOINT_RTP_PACKETS_DISCARDED,
+  EVEL_VQM_ENDPOINT_RTP_PACKETS_RECEIVED,
+  EVEL_VQM_ENDPOINT_RTP_PACKETS_SENT,
+  EVEL_VQM_LOCAL_JITTER,
+  EVEL_VQM_LOCAL_RTP_OCTETS_DISCARDED,
+  EVEL_VQM_LOCAL_RTP_OCTETS_RECEIVED,
+  EVEL_VQM_LOCAL_RTP_OCTETS_SENT,
+  EVEL_VQM_LOCAL_RTP_PACKETS_DISCARDED,
+  EVEL_VQM_LOCAL_RTP_PACKETS_RECEIVED,
+  EVEL_VQM_LOCAL_RTP_PACKETS_SENT,
+  EVEL_VQM_MOS_CQE,
+  EVEL_VQM_PACKETS_LOST,
+  EVEL_VQM_PACKET_LOSS_PERCENT,
+  EVEL_VQM_R_FACTOR,
+  EVEL_VQM_ROUND_TRIP_DELAY,
+  EVEL_MAX_VQM_FIELDS
+} EVEL_VQM_FIELDS;
+
 /**************************************************************************//**
  * End of Call Voice Quality Metrices
  * JSON equivalent field: endOfCallVqmSummaries
@@ -3983,27 +5315,10 @@ typedef struct end_of_call_vqm_summaries {
 	char* endpointDescription;
 
 	/***************************************************************************/
-	/* Optional fields                                                         */
+	/* Optional fields, indexed by ::EVEL_VQM_FIELDS.                          */
 	/***************************************************************************/
-	EVEL_OPTION_INT endpointJitter;
-	EVEL_OPTION_INT endpointRtpOctetsDiscarded;
-	EVEL_OPTION_INT endpointRtpOctetsReceived;
-	EVEL_OPTION_INT endpointRtpOctetsSent;
-	EVEL_OPTION_INT endpointRtpPacketsDiscarded;
-	EVEL_OPTION_INT endpointRtpPacketsReceived;
-	EVEL_OPTION_INT endpointRtpPacketsSent;
-	EVEL_OPTION_INT localJitter;
-	EVEL_OPTION_INT localRtpOctetsDiscarded;
-	EVEL_OPTION_INT localRtpOctetsReceived;
-	EVEL_OPTION_INT localRtpOctetsSent;
-	EVEL_OPTION_INT localRtpPacketsDiscarded;
-	EVEL_OPTION_INT localRtpPacketsReceived;
-	EVEL_OPTION_INT localRtpPacketsSent;
-	EVEL_OPTION_INT mosCqe;
-	EVEL_OPTION_INT packetsLost;
-	EVEL_OPTION_INT packetLossPercent;
-	EVEL_OPTION_INT rFactor;
-	EVEL_OPTION_INT roundTripDelay;
+	EVEL_OPTION_BITMAP present;
+	int values[EVEL_MAX_VQM_FIELDS];
 
 } END_OF_CALL_VOICE_QUALITY_METRICS;
 
@@ -4445,34 +5760,131 @@ void evel_threshold_cross_addl_info_add(EVENT_THRESHOLD_CROSS * const tcp,
 /*****************************************************************************/
 /*****************************************************************************/
 
+/**************************************************************************//**
+ * Rate limiting state for one place errors are logged.
+ *
+ * Zero-initialized, as a static, it starts a new interval on first use.
+ * Once it first suppresses an error it is listed, with the error's format,
+ * so that the count can be reported even if the error is not made again.
+ *****************************************************************************/
+typedef struct evel_log_limit {
+  time_t interval_start;
+  unsigned int count;
+  unsigned int suppressed;
+  const char * format;
+  const char * key;
+  bool listed;
+  struct evel_log_limit * next;
+} EVEL_LOG_LIMIT;
+
 /*****************************************************************************/
-/* Debug macros.                                                             */
+/* Debug macros.  The level is checked before calling log_debug so that      */
+/* filtered logs cost no more than a comparison, and building with           */
+/* EVEL_NO_TRACE compiles out function tracing and debug logs altogether.    */
 /*****************************************************************************/
-#define EVEL_DEBUG(FMT, ...)   log_debug(EVEL_LOG_DEBUG, (FMT), ##__VA_ARGS__)
-#define EVEL_INFO(FMT, ...)    log_debug(EVEL_LOG_INFO, (FMT), ##__VA_ARGS__)
-#define EVEL_SPAMMY(FMT, ...)  log_debug(EVEL_LOG_SPAMMY, (FMT), ##__VA_ARGS__)
-#define EVEL_ERROR(FMT, ...)   log_debug(EVEL_LOG_ERROR, "ERROR: " FMT, \
-                                         ##__VA_ARGS__)
+#define EVEL_LOG_ON(LEVEL) ((LEVEL) >= debug_level)
+#define EVEL_LOG(LEVEL, FMT, ...)                                             \
+        do                                                                    \
+        {                                                                     \
+          if (EVEL_LOG_ON(LEVEL))                                             \
+          {                                                                   \
+            log_debug((LEVEL), (FMT), ##__VA_ARGS__);                         \
+          }                                                                   \
+        } while (0)
+
+#ifdef EVEL_NO_TRACE
+#define EVEL_TRACE(LEVEL, FMT, ...)                                           \
+        do                                                                    \
+        {                                                                     \
+          if (0)                                                              \
+          {                                                                   \
+            log_debug((LEVEL), (FMT), ##__VA_ARGS__);                         \
+          }                                                                   \
+        } while (0)
+#define EVEL_ENTER()                                                          \
+        {                                                                     \
+        }
+#define EVEL_EXIT()                                                           \
+        {                                                                     \
+        }
+#define EVEL_DEBUG_ON() (0)
+#else
+#define EVEL_TRACE(LEVEL, FMT, ...) EVEL_LOG((LEVEL), (FMT), ##__VA_ARGS__)
 #define EVEL_ENTER()                                                          \
         {                                                                     \
-          log_debug(EVEL_LOG_DEBUG, "Enter %s {", __FUNCTION__);              \
-          debug_indent += 2;                                                  \
+          if (EVEL_LOG_ON(EVEL_LOG_DEBUG))                                    \
+          {                                                                   \
+            log_debug(EVEL_LOG_DEBUG, "Enter %s {", __FUNCTION__);            \
+            debug_indent += 2;                                                \
+          }                                                                   \
         }
 #define EVEL_EXIT()                                                           \
         {                                                                     \
-          debug_indent -= 2;                                                  \
-          log_debug(EVEL_LOG_DEBUG, "Exit %s }", __FUNCTION__);               \
+          if (EVEL_LOG_ON(EVEL_LOG_DEBUG))                                    \
+          {                                                                   \
+            debug_indent = (debug_indent > 2) ? debug_indent - 2 : 0;         \
+            log_debug(EVEL_LOG_DEBUG, "Exit %s }", __FUNCTION__);             \
+          }                                                                   \
         }
+#define EVEL_DEBUG_ON() EVEL_LOG_ON(EVEL_LOG_DEBUG)
+#endif
+
+#define EVEL_DEBUG(FMT, ...)   EVEL_TRACE(EVEL_LOG_DEBUG, (FMT), ##__VA_ARGS__)
+#define EVEL_SPAMMY(FMT, ...)  EVEL_TRACE(EVEL_LOG_SPAMMY, (FMT), ##__VA_ARGS__)
+#define EVEL_INFO(FMT, ...)    EVEL_LOG(EVEL_LOG_INFO, (FMT), ##__VA_ARGS__)
+
+/*****************************************************************************/
+/* Errors are rate limited separately at each place they are logged, so      */
+/* that one failing repeatedly can't flood the logs.                         */
+/*****************************************************************************/
+#define EVEL_ERROR(FMT, ...)                                                  \
+        do                                                                    \
+        {                                                                     \
+          static EVEL_LOG_LIMIT evel_log_limit;                               \
+          if (EVEL_LOG_ON(EVEL_LOG_ERROR) &&                                  \
+              log_limit_allow(&evel_log_limit, (FMT)))                        \
+          {                                                                   \
+            log_debug(EVEL_LOG_ERROR, "ERROR: " FMT, ##__VA_ARGS__);          \
+          }                                                                   \
+        } while (0)
+#define log_error_state(FMT, ...)                                             \
+        do                                                                    \
+        {                                                                     \
+          static EVEL_LOG_LIMIT evel_log_limit;                               \
+          log_error_state_limited(&evel_log_limit, (FMT), ##__VA_ARGS__);     \
+        } while (0)
+
+/*****************************************************************************/
+/* Errors from helpers shared by many callers are rate limited separately    */
+/* for each key, such as the description of the field being set, as well as  */
+/* each place.                                                               */
+/*****************************************************************************/
+#define EVEL_ERROR_KEYED(KEY, FMT, ...)                                       \
+        do                                                                    \
+        {                                                                     \
+          static EVEL_LOG_LIMIT evel_log_limit;                               \
+          if (EVEL_LOG_ON(EVEL_LOG_ERROR) &&                                  \
+              log_limit_allow(log_limit_keyed(&evel_log_limit, (KEY)),        \
+                              (FMT)))                                         \
+          {                                                                   \
+            log_debug(EVEL_LOG_ERROR, "ERROR: " FMT, ##__VA_ARGS__);          \
+          }                                                                   \
+        } while (0)
+#define log_error_state_keyed(KEY, FMT, ...)                                  \
+        do                                                                    \
+        {                                                                     \
+          static EVEL_LOG_LIMIT evel_log_limit;                               \
+          log_error_state_limited(log_limit_keyed(&evel_log_limit, (KEY)),    \
+                                  (FMT), ##__VA_ARGS__);                      \
+        } while (0)
 
 #define INDENT_SEPARATORS                                                     \
         "| | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | | "
 
 extern EVEL_LOG_LEVELS debug_level;
-extern int debug_indent;
+extern __thread int debug_indent;
 extern FILE * fout;
 
-#define EVEL_DEBUG_ON() ((debug_level) >= EVEL_LOG_DEBUG)
-
 /**************************************************************************//**
  * Initialize logging
  *
@@ -4481,6 +5893,11 @@ extern FILE * fout;
  *****************************************************************************/
 void log_initialize(EVEL_LOG_LEVELS level, const char * ident);
 
+/**************************************************************************//**
+ * Stop logging asynchronously, writing any logs still waiting.
+ *****************************************************************************/
+void log_terminate(void);
+
 /**************************************************************************//**
  * Log debug information
  *
@@ -4495,10 +5912,74 @@ void log_debug(EVEL_LOG_LEVELS level, char * format, ...);
 /***************************************************************************//*
  * Store the formatted string into the static error string and log the error.
  *
+ * Calls are made through the macro of the same name, which rate limits the
+ * logs from each call separately using ::log_error_state_limited.
+ *
  * @param format  Error string in standard printf format.
  * @param ...     Variable parameters to be substituted into the format string.
  *****************************************************************************/
-void log_error_state(char * format, ...);
+void (log_error_state)(char * format, ...);
+
+/***************************************************************************//*
+ * Store the formatted string into the static error string and log the error,
+ * if the rate limit allows.
+ *
+ * The error string is always stored, so ::evel_error_string still returns
+ * the latest error.
+ *
+ * @param limit   The rate limiting state for the caller, or NULL for none.
+ * @param format  Error string in standard printf format.
+ * @param ...     Variable parameters to be substituted into the format string.
+ *****************************************************************************/
+void log_error_state_limited(EVEL_LOG_LIMIT * limit, char * format, ...);
+
+/**************************************************************************//**
+ * Decide whether an error may be logged under its rate limit.
+ *
+ * The first errors in each interval are logged, and the rest counted.  The
+ * count of those suppressed is logged by ::log_limit_flush once the interval
+ * is over, or first if one is made in a later interval.
+ *
+ * @param limit   The rate limiting state for where the error is made.
+ * @param format  The format of the error, used to describe it in the count.
+ * @returns true if the error should be logged, false if suppressed.
+ *****************************************************************************/
+bool log_limit_allow(EVEL_LOG_LIMIT * limit, const char * const format);
+
+/**************************************************************************//**
+ * Get the rate limiting state for a key at a place errors are logged.
+ *
+ * Once too many keys are in use, further keys share the state of the place.
+ *
+ * @param site    The rate limiting state for the place.
+ * @param key     The key, such as the description of a field.
+ * @returns The rate limiting state to use.
+ *****************************************************************************/
+EVEL_LOG_LIMIT * log_limit_keyed(EVEL_LOG_LIMIT * site, const char * key);
+
+/**************************************************************************//**
+ * Log the counts of suppressed errors whose intervals are over.
+ *
+ * Called at intervals by the logging and event handler threads, and from
+ * ::log_terminate to log all the counts, over or not.
+ *
+ * @param all     Whether to log the counts of intervals not yet over.
+ *****************************************************************************/
+void log_limit_flush(const bool all);
+
+/**************************************************************************//**
+ * Set the rate limit for errors.
+ *
+ * Each place in the library which logs errors may log @p burst of them in
+ * each @p interval seconds.  Errors beyond that are counted, and the count
+ * logged in a summary once the interval is over.  The default is 10 errors
+ * in 60 seconds.
+ *
+ * @param burst     The number of errors to log in each interval, or 0 to log
+ *                  them all.
+ * @param interval  The length of the interval in seconds.
+ *****************************************************************************/
+void evel_set_error_log_limit(const int burst, const int interval);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,448 @@
+/**************************************************************************//**
+ * @file
+ * Arenas from which all the memory an event owns can be allocated, so that
+ * building an event is a series of pointer bumps and freeing it releases
+ * a handful of chunks rather than walking every string and list item.
+ *
+ * License
+ * -------
+ *
+ * Copyright(c) <2016>, AT&T Intellectual Property.  All other rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:  This product includes
+ *    software developed by the AT&T.
+ * 4. Neither the name of AT&T nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific
+ *    prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AT&T INTELLECTUAL PROPERTY ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AT&T INTELLECTUAL PROPERTY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <stddef.h>
+
+#include "evel.h"
+#include "evel_internal.h"
+
+/*****************************************************************************/
+/* Size of an arena's first chunk, which each further chunk doubles up to    */
+/* the maximum.                                                              */
+/*****************************************************************************/
+#define EVEL_ARENA_FIRST_CHUNK 4096
+#define EVEL_ARENA_MAX_CHUNK 65536
+
+/*****************************************************************************/
+/* Alignment of every allocation from an arena.                              */
+/*****************************************************************************/
+#define EVEL_ARENA_ALIGN (sizeof(max_align_t))
+
+/**************************************************************************//**
+ * A chunk of memory allocated from by an arena.
+ *****************************************************************************/
+typedef struct evel_arena_chunk {
+  struct evel_arena_chunk * next;
+  size_t size;
+  size_t used;
+  max_align_t data[];
+} EVEL_ARENA_CHUNK;
+
+/**************************************************************************//**
+ * Memory from the heap which is freed with an arena.
+ *****************************************************************************/
+typedef struct evel_arena_cleanup {
+  struct evel_arena_cleanup * next;
+  void (*free_fn)(void *);
+  void * data;
+} EVEL_ARENA_CLEANUP;
+
+/**************************************************************************//**
+ * An arena, which lives at the start of its first chunk.
+ *****************************************************************************/
+struct evel_arena {
+  EVEL_ARENA_CHUNK * chunks;
+  EVEL_ARENA_CLEANUP * cleanups;
+  size_t next_chunk_size;
+};
+
+/*****************************************************************************/
+/* Whether new events get arenas, see ::evel_set_event_arenas.               */
+/*****************************************************************************/
+static bool evel_arenas_enabled = false;
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static EVEL_ARENA_CHUNK * evel_new_arena_chunk(const size_t size);
+
+/**************************************************************************//**
+ * Enable or disable event arenas.
+ *
+ * When enabled, the strings and list items of new events are allocated from
+ * an arena belonging to the event, which is released in one go when the
+ * event is freed.  Memory is not reclaimed when a value is replaced, so this
+ * suits events which are built once then posted.
+ *
+ * @note  Only events created afterwards are affected.
+ *
+ * @param enable        Whether new events get arenas.
+ *****************************************************************************/
+void evel_set_event_arenas(const bool enable)
+{
+  __atomic_store_n(&evel_arenas_enabled, enable, __ATOMIC_RELAXED);
+}
+
+/**************************************************************************//**
+ * Create the arena for a new event, if event arenas are enabled.
+ *
+ * @returns Pointer to the new ::EVEL_ARENA.
+ * @retval  NULL  Event arenas are disabled, or the arena could not be
+ *                allocated, so the event should use the heap.
+ *****************************************************************************/
+EVEL_ARENA * evel_new_event_arena(void)
+{
+  EVEL_ARENA * arena = NULL;
+
+  EVEL_ENTER();
+
+  if (__atomic_load_n(&evel_arenas_enabled, __ATOMIC_RELAXED))
+  {
+    arena = evel_new_arena();
+  }
+
+  EVEL_EXIT();
+  return arena;
+}
+
+/**************************************************************************//**
+ * Create an arena, whether or not event arenas are enabled.
+ *
+ * @returns Pointer to the new ::EVEL_ARENA.
+ * @retval  NULL  The arena could not be allocated.
+ *****************************************************************************/
+EVEL_ARENA * evel_new_arena(void)
+{
+  EVEL_ARENA_CHUNK * chunk;
+  EVEL_ARENA * arena = NULL;
+
+  EVEL_ENTER();
+
+  chunk = evel_new_arena_chunk(EVEL_ARENA_FIRST_CHUNK);
+  if (chunk == NULL)
+  {
+    log_error_state("Failed to allocate event arena");
+    goto exit_label;
+  }
+
+  /***************************************************************************/
+  /* The arena is the first thing allocated from its own first chunk.        */
+  /***************************************************************************/
+  arena = (EVEL_ARENA *) chunk->data;
+  chunk->used = (sizeof(EVEL_ARENA) + EVEL_ARENA_ALIGN - 1) &
+                ~(EVEL_ARENA_ALIGN - 1);
+  arena->chunks = chunk;
+  arena->cleanups = NULL;
+  arena->next_chunk_size = 2 * EVEL_ARENA_FIRST_CHUNK;
+
+exit_label:
+  EVEL_EXIT();
+  return arena;
+}
+
+/**************************************************************************//**
+ * Allocate memory from an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to allocate from
+ *                      the heap.
+ * @param size          Number of bytes to allocate.
+ * @returns Pointer to the memory, which is not initialized.
+ * @retval  NULL  Failed to allocate the memory.
+ *****************************************************************************/
+void * evel_arena_alloc(EVEL_ARENA * const arena, const size_t size)
+{
+  EVEL_ARENA_CHUNK * chunk;
+  size_t aligned;
+  size_t chunk_size;
+  void * memory;
+
+  if (arena == NULL)
+  {
+    return malloc(size);
+  }
+
+  aligned = (size + EVEL_ARENA_ALIGN - 1) & ~(EVEL_ARENA_ALIGN - 1);
+  chunk = arena->chunks;
+  if (chunk->size - chunk->used < aligned)
+  {
+    /*************************************************************************/
+    /* Allocations too big for the next chunk get a chunk of their own,      */
+    /* kept behind the current one so that its free space is not lost.       */
+    /*************************************************************************/
+    chunk_size = arena->next_chunk_size;
+    if (aligned > chunk_size / 4)
+    {
+      chunk = evel_new_arena_chunk(aligned);
+      if (chunk == NULL)
+      {
+        return NULL;
+      }
+      chunk->next = arena->chunks->next;
+      arena->chunks->next = chunk;
+    }
+    else
+    {
+      chunk = evel_new_arena_chunk(chunk_size);
+      if (chunk == NULL)
+      {
+        return NULL;
+      }
+      chunk->next = arena->chunks;
+      arena->chunks = chunk;
+      if (chunk_size < EVEL_ARENA_MAX_CHUNK)
+      {
+        arena->next_chunk_size = 2 * chunk_size;
+      }
+    }
+  }
+
+  memory = (char *) chunk->data + chunk->used;
+  chunk->used += aligned;
+
+  return memory;
+}
+
+/**************************************************************************//**
+ * Copy a string into an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to copy onto the
+ *                      heap.
+ * @param string        The ASCIIZ string to copy.
+ * @returns Pointer to the copy.
+ * @retval  NULL  Failed to allocate memory for the copy.
+ *****************************************************************************/
+char * evel_arena_strdup(EVEL_ARENA * const arena, const char * const string)
+{
+  size_t size;
+  char * copy;
+
+  assert(string != NULL);
+
+  if (arena == NULL)
+  {
+    return strdup(string);
+  }
+
+  size = strlen(string) + 1;
+  copy = evel_arena_alloc(arena, size);
+  if (copy != NULL)
+  {
+    memcpy(copy, string, size);
+  }
+
+  return copy;
+}
+
+/**************************************************************************//**
+ * Take ownership of a string allocated on the heap, for an arena.
+ *
+ * If there is an arena, it frees the string when it is itself freed;
+ * otherwise the string is freed with the rest of its event as normal.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL.
+ * @param string        The ASCIIZ string, allocated with malloc.
+ * @returns The string.
+ * @retval  NULL  Failed to allocate memory for the arena to free the string,
+ *                which has been freed already.
+ *****************************************************************************/
+char * evel_arena_take_string(EVEL_ARENA * const arena, char * const string)
+{
+  assert(string != NULL);
+
+  /***************************************************************************/
+  /* If the arena can't take the string, nothing would free it, so free it   */
+  /* now and fail as evel_arena_strdup would.                                */
+  /***************************************************************************/
+  if ((arena != NULL) && !evel_arena_adopt(arena, free, string))
+  {
+    free(string);
+    return NULL;
+  }
+
+  return string;
+}
+
+/**************************************************************************//**
+ * Add an item to the end of a list, allocating any larger slots the list
+ * needs from an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to allocate the
+ *                      slots from the heap.
+ * @param list          Pointer to the list.
+ * @param item          The item to add.
+ *****************************************************************************/
+void evel_arena_list_push(EVEL_ARENA * const arena,
+                          DLIST * const list,
+                          void * const item)
+{
+  DLIST_ITEM * slots;
+  int capacity;
+
+  if ((arena != NULL) && dlist_is_full(list))
+  {
+    capacity = 2 * (dlist_count(list) + 1);
+    slots = evel_arena_alloc(arena, capacity * sizeof(DLIST_ITEM));
+    assert(slots != NULL);
+    dlist_move_slots(list, slots, capacity);
+  }
+
+  dlist_push_last(list, item);
+}
+
+/**************************************************************************//**
+ * Have an arena free memory from the heap when it is itself freed.
+ *
+ * This is for structures created before it was known which event they
+ * would belong to.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA.
+ * @param free_fn       Function to free the memory.
+ * @param data          The memory to pass to @p free_fn.
+ * @returns Whether the arena will free the memory.
+ *****************************************************************************/
+bool evel_arena_adopt(EVEL_ARENA * const arena,
+                      void (*free_fn)(void *),
+                      void * const data)
+{
+  EVEL_ARENA_CLEANUP * cleanup;
+  bool adopted = false;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(arena != NULL);
+  assert(free_fn != NULL);
+
+  cleanup = evel_arena_alloc(arena, sizeof(EVEL_ARENA_CLEANUP));
+  if (cleanup == NULL)
+  {
+    log_error_state("Failed to allocate arena cleanup");
+    goto exit_label;
+  }
+  cleanup->free_fn = free_fn;
+  cleanup->data = data;
+  cleanup->next = arena->cleanups;
+  arena->cleanups = cleanup;
+  adopted = true;
+
+exit_label:
+  EVEL_EXIT();
+  return adopted;
+}
+
+/**************************************************************************//**
+ * Get the memory held by an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA.
+ * @returns The total size of its chunks, in bytes.
+ *****************************************************************************/
+size_t evel_arena_size(EVEL_ARENA * const arena)
+{
+  EVEL_ARENA_CHUNK * chunk;
+  size_t size = 0;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(arena != NULL);
+
+  for (chunk = arena->chunks; chunk != NULL; chunk = chunk->next)
+  {
+    size += offsetof(EVEL_ARENA_CHUNK, data) + chunk->size;
+  }
+
+  EVEL_EXIT();
+  return size;
+}
+
+/**************************************************************************//**
+ * Free an arena and everything allocated from, or adopted by, it.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA.
+ *****************************************************************************/
+void evel_free_arena(EVEL_ARENA * const arena)
+{
+  EVEL_ARENA_CLEANUP * cleanup;
+  EVEL_ARENA_CHUNK * chunk;
+  EVEL_ARENA_CHUNK * next;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(arena != NULL);
+
+  for (cleanup = arena->cleanups; cleanup != NULL; cleanup = cleanup->next)
+  {
+    cleanup->free_fn(cleanup->data);
+  }
+
+  /***************************************************************************/
+  /* The arena itself is in one of the chunks, so is not read once they are  */
+  /* being freed.                                                            */
+  /***************************************************************************/
+  chunk = arena->chunks;
+  while (chunk != NULL)
+  {
+    next = chunk->next;
+    free(chunk);
+    chunk = next;
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Allocate a chunk for an arena.
+ *
+ * @param size          Number of bytes which can be allocated from it.
+ * @returns Pointer to the chunk.
+ * @retval  NULL  Failed to allocate the chunk.
+ *****************************************************************************/
+static EVEL_ARENA_CHUNK * evel_new_arena_chunk(const size_t size)
+{
+  EVEL_ARENA_CHUNK * chunk;
+
+  chunk = malloc(offsetof(EVEL_ARENA_CHUNK, data) + size);
+  if (chunk != NULL)
+  {
+    chunk->next = NULL;
+    chunk->size = size;
+    chunk->used = 0;
+  }
+
+  return chunk;
+}
@@ -0,0 +1,447 @@
+/**************************************************************************//**
+ * @file
+ * The clock the library takes event epochs from, which can be cheaper to
+ * read than the system clock on hosts where that is a system call.
+ *
+ * License
+ * -------
+ *
+ * Copyright(c) <2016>, AT&T Intellectual Property.  All other rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:  This product includes
+ *    software developed by the AT&T.
+ * 4. Neither the name of AT&T nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific
+ *    prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AT&T INTELLECTUAL PROPERTY ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AT&T INTELLECTUAL PROPERTY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <assert.h>
+#include <limits.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define EVEL_CLOCK_HAVE_TSC 1
+#endif
+
+#include "evel.h"
+#include "evel_internal.h"
+
+/*****************************************************************************/
+/* How long to count TSC ticks for when first calibrating, and how often to  */
+/* re-anchor the TSC clock to the system clock, in nanoseconds.              */
+/*****************************************************************************/
+#define EVEL_CLOCK_CALIBRATION_NSEC 100000000
+#define EVEL_CLOCK_ANCHOR_NSEC 1000000000ULL
+
+/*****************************************************************************/
+/* How many times to read a clock between two TSC readings, keeping the      */
+/* reading with the closest pair, so that one preempted read is ignored.     */
+/*****************************************************************************/
+#define EVEL_CLOCK_SAMPLE_TRIES 5
+
+/**************************************************************************//**
+ * A clock reading and the TSC at the time.
+ *****************************************************************************/
+typedef struct evel_clock_sample {
+  unsigned long long tsc;
+  unsigned long long nsec;
+} EVEL_CLOCK_SAMPLE;
+
+/*****************************************************************************/
+/* The clock asked for, the resolution of the cached clock, and the clock in */
+/* use, which is the system clock until ::evel_clock_initialize starts the   */
+/* one asked for, and if that cannot be used.                                */
+/*****************************************************************************/
+static EVEL_CLOCK_SOURCES evel_clock_requested = EVEL_CLOCK_SYSTEM;
+static int evel_clock_resolution = 1000;
+static EVEL_CLOCK_SOURCES evel_clock_source = EVEL_CLOCK_SYSTEM;
+
+/*****************************************************************************/
+/* The TSC and monotonic clock when calibration started.  The rate of the    */
+/* TSC is measured from here each time the clock is anchored, so is known    */
+/* more exactly the longer the library runs.                                 */
+/*****************************************************************************/
+static EVEL_CLOCK_SAMPLE evel_clock_tsc_start;
+
+/*****************************************************************************/
+/* The TSC clock's anchor: a TSC reading, the system time in nanoseconds it  */
+/* was taken, the nanoseconds per tick scaled up by 2^32, and the ticks      */
+/* after which to anchor again.  Readers take these under the sequence,      */
+/* which is odd while they are being changed.  Only the thread which sets    */
+/* the anchoring flag changes them.                                          */
+/*****************************************************************************/
+static unsigned int evel_clock_tsc_sequence;
+static unsigned long long evel_clock_tsc_base;
+static unsigned long long evel_clock_tsc_base_nsec;
+static unsigned long long evel_clock_tsc_scale;
+static unsigned long long evel_clock_tsc_anchor_ticks;
+static bool evel_clock_tsc_anchoring = false;
+
+/*****************************************************************************/
+/* The cached time, and the thread which refreshes it.                       */
+/*****************************************************************************/
+static unsigned long long evel_clock_cached_usec;
+static pthread_t evel_clock_ticker;
+static bool evel_clock_ticker_stop = false;
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static unsigned long long evel_clock_read(const clockid_t clock);
+#ifdef EVEL_CLOCK_HAVE_TSC
+static void evel_clock_sample(const clockid_t clock,
+                              EVEL_CLOCK_SAMPLE * const sample);
+static unsigned long long evel_clock_tsc_anchor(void);
+static unsigned long long evel_clock_tsc_read(void);
+#endif
+static bool evel_clock_calibrate_tsc(void);
+static void * evel_clock_ticker_main(void * arg);
+
+/**************************************************************************//**
+ * Set the clock event epochs are taken from.
+ *
+ * @note  This must be called before ::evel_initialize.
+ *
+ * @param source        The clock.
+ * @param resolution    How often the cached clock is refreshed, in
+ *                      microseconds.  Not used by the other clocks.
+ *****************************************************************************/
+void evel_set_clock_source(const EVEL_CLOCK_SOURCES source,
+                           const int resolution)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(source < EVEL_MAX_CLOCK_SOURCES);
+  assert(resolution > 0);
+
+  evel_clock_requested = source;
+  evel_clock_resolution = resolution;
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Start the clock asked for with ::evel_set_clock_source.
+ *
+ * Called from ::evel_initialize.  If the clock cannot be used, the system
+ * clock is used instead.
+ *****************************************************************************/
+void evel_clock_initialize(void)
+{
+  EVEL_ENTER();
+
+  switch (evel_clock_requested)
+  {
+    case EVEL_CLOCK_TSC:
+      if (!evel_clock_calibrate_tsc())
+      {
+        EVEL_INFO("No invariant TSC - using the system clock");
+        goto exit_label;
+      }
+      EVEL_INFO("TSC clock at %llu ticks per second",
+                evel_clock_tsc_anchor_ticks);
+      break;
+
+    case EVEL_CLOCK_CACHED:
+      evel_clock_cached_usec = evel_clock_read(CLOCK_REALTIME);
+      evel_clock_ticker_stop = false;
+      if (pthread_create(&evel_clock_ticker,
+                         NULL,
+                         evel_clock_ticker_main,
+                         NULL) != 0)
+      {
+        EVEL_ERROR("Failed to start clock thread - using the system clock");
+        goto exit_label;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  __atomic_store_n(&evel_clock_source,
+                   evel_clock_requested,
+                   __ATOMIC_RELEASE);
+
+exit_label:
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Go back to the system clock, stopping the cached clock's thread.
+ *
+ * Called from ::evel_terminate.
+ *****************************************************************************/
+void evel_clock_terminate(void)
+{
+  EVEL_CLOCK_SOURCES source;
+
+  EVEL_ENTER();
+
+  source = __atomic_exchange_n(&evel_clock_source,
+                               EVEL_CLOCK_SYSTEM,
+                               __ATOMIC_ACQ_REL);
+  if (source == EVEL_CLOCK_CACHED)
+  {
+    __atomic_store_n(&evel_clock_ticker_stop, true, __ATOMIC_RELEASE);
+    pthread_join(evel_clock_ticker, NULL);
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Get the time for an event epoch.
+ *
+ * @returns Microseconds since the UNIX epoch.
+ *****************************************************************************/
+unsigned long long evel_time_microsec(void)
+{
+  unsigned long long usec;
+
+  switch (__atomic_load_n(&evel_clock_source, __ATOMIC_ACQUIRE))
+  {
+    case EVEL_CLOCK_COARSE:
+      usec = evel_clock_read(CLOCK_REALTIME_COARSE);
+      break;
+
+#ifdef EVEL_CLOCK_HAVE_TSC
+    case EVEL_CLOCK_TSC:
+      usec = evel_clock_tsc_read();
+      break;
+#endif
+
+    case EVEL_CLOCK_CACHED:
+      usec = __atomic_load_n(&evel_clock_cached_usec, __ATOMIC_RELAXED);
+      break;
+
+    default:
+      usec = evel_clock_read(CLOCK_REALTIME);
+      break;
+  }
+
+  return usec;
+}
+
+/**************************************************************************//**
+ * Read a clock.
+ *
+ * @param clock         The clock.
+ * @returns Its time in microseconds.
+ *****************************************************************************/
+static unsigned long long evel_clock_read(const clockid_t clock)
+{
+  struct timespec ts;
+
+  clock_gettime(clock, &ts);
+  return ts.tv_nsec / 1000 + 1000000ULL * ts.tv_sec;
+}
+
+#ifdef EVEL_CLOCK_HAVE_TSC
+/**************************************************************************//**
+ * Read a clock, with the TSC at the time.
+ *
+ * The clock is read between two TSC readings, several times, and the read
+ * with the closest readings kept, taking the TSC as midway between them.
+ *
+ * @param clock         The clock.
+ * @param sample        Where to store the reading.
+ *****************************************************************************/
+static void evel_clock_sample(const clockid_t clock,
+                              EVEL_CLOCK_SAMPLE * const sample)
+{
+  struct timespec ts;
+  unsigned long long before;
+  unsigned long long after;
+  unsigned long long best = ULLONG_MAX;
+  int try;
+
+  for (try = 0; try < EVEL_CLOCK_SAMPLE_TRIES; try++)
+  {
+    before = __rdtsc();
+    clock_gettime(clock, &ts);
+    after = __rdtsc();
+    if (after - before < best)
+    {
+      best = after - before;
+      sample->tsc = before + best / 2;
+      sample->nsec = ts.tv_nsec + 1000000000ULL * ts.tv_sec;
+    }
+  }
+}
+
+/**************************************************************************//**
+ * Anchor the TSC clock to the system clock, measuring the rate of the TSC
+ * since calibration started.
+ *
+ * Only one thread may anchor the clock at once.
+ *
+ * @returns The system time of the anchor in microseconds.
+ *****************************************************************************/
+static unsigned long long evel_clock_tsc_anchor(void)
+{
+  EVEL_CLOCK_SAMPLE monotonic;
+  EVEL_CLOCK_SAMPLE realtime;
+  unsigned long long scale;
+  unsigned int sequence;
+
+  evel_clock_sample(CLOCK_MONOTONIC, &monotonic);
+  evel_clock_sample(CLOCK_REALTIME, &realtime);
+  scale = ((unsigned __int128) (monotonic.nsec - evel_clock_tsc_start.nsec)
+           << 32) / (monotonic.tsc - evel_clock_tsc_start.tsc);
+
+  sequence = evel_clock_tsc_sequence;
+  __atomic_store_n(&evel_clock_tsc_sequence, sequence + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  __atomic_store_n(&evel_clock_tsc_base, realtime.tsc, __ATOMIC_RELAXED);
+  __atomic_store_n(&evel_clock_tsc_base_nsec,
+                   realtime.nsec,
+                   __ATOMIC_RELAXED);
+  __atomic_store_n(&evel_clock_tsc_scale, scale, __ATOMIC_RELAXED);
+  __atomic_store_n(&evel_clock_tsc_anchor_ticks,
+                   (EVEL_CLOCK_ANCHOR_NSEC << 32) / scale,
+                   __ATOMIC_RELAXED);
+  __atomic_store_n(&evel_clock_tsc_sequence, sequence + 2, __ATOMIC_RELEASE);
+
+  return realtime.nsec / 1000;
+}
+
+/**************************************************************************//**
+ * Read the TSC clock, anchoring it again if it is due.
+ *
+ * @returns Microseconds since the UNIX epoch.
+ *****************************************************************************/
+static unsigned long long evel_clock_tsc_read(void)
+{
+  unsigned long long ticks;
+  unsigned long long base_nsec;
+  unsigned long long scale;
+  unsigned long long anchor_ticks;
+  unsigned long long usec;
+  unsigned int sequence;
+  bool anchoring = false;
+
+  do
+  {
+    sequence = __atomic_load_n(&evel_clock_tsc_sequence, __ATOMIC_ACQUIRE);
+    ticks = __rdtsc() - __atomic_load_n(&evel_clock_tsc_base,
+                                        __ATOMIC_RELAXED);
+    base_nsec = __atomic_load_n(&evel_clock_tsc_base_nsec, __ATOMIC_RELAXED);
+    scale = __atomic_load_n(&evel_clock_tsc_scale, __ATOMIC_RELAXED);
+    anchor_ticks = __atomic_load_n(&evel_clock_tsc_anchor_ticks,
+                                   __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  } while (((sequence & 1) != 0) ||
+           (sequence != __atomic_load_n(&evel_clock_tsc_sequence,
+                                        __ATOMIC_RELAXED)));
+
+  /***************************************************************************/
+  /* Once the anchor is old, or the TSC reads behind it as it may on another */
+  /* CPU, the first thread to notice anchors again and uses the new anchor.  */
+  /***************************************************************************/
+  if ((ticks > anchor_ticks) &&
+      __atomic_compare_exchange_n(&evel_clock_tsc_anchoring,
+                                  &anchoring,
+                                  true,
+                                  false,
+                                  __ATOMIC_ACQUIRE,
+                                  __ATOMIC_RELAXED))
+  {
+    usec = evel_clock_tsc_anchor();
+    __atomic_store_n(&evel_clock_tsc_anchoring, false, __ATOMIC_RELEASE);
+  }
+  else
+  {
+    usec = (base_nsec +
+            (unsigned long long) (((unsigned __int128) ticks * scale) >> 32))
+           / 1000;
+  }
+
+  return usec;
+}
+#endif
+
+/**************************************************************************//**
+ * Measure the rate of the TSC against the system clock, and anchor the TSC
+ * clock to it.
+ *
+ * @returns Whether the TSC runs at a constant rate, so can be used.
+ *****************************************************************************/
+static bool evel_clock_calibrate_tsc(void)
+{
+#ifdef EVEL_CLOCK_HAVE_TSC
+  unsigned int eax;
+  unsigned int ebx;
+  unsigned int ecx;
+  unsigned int edx;
+  const struct timespec pause = {0, EVEL_CLOCK_CALIBRATION_NSEC};
+
+  /***************************************************************************/
+  /* Only an invariant TSC keeps time through frequency and power changes.   */
+  /***************************************************************************/
+  if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) ||
+      ((edx & (1 << 8)) == 0))
+  {
+    return false;
+  }
+
+  evel_clock_sample(CLOCK_MONOTONIC, &evel_clock_tsc_start);
+  nanosleep(&pause, NULL);
+  evel_clock_tsc_anchor();
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**************************************************************************//**
+ * Refresh the cached time until told to stop.
+ *
+ * @param arg           Not used.
+ * @returns NULL.
+ *****************************************************************************/
+static void * evel_clock_ticker_main(void * arg)
+{
+  struct timespec tick;
+
+  (void) arg;
+
+  tick.tv_sec = evel_clock_resolution / 1000000;
+  tick.tv_nsec = (evel_clock_resolution % 1000000) * 1000;
+  while (!__atomic_load_n(&evel_clock_ticker_stop, __ATOMIC_ACQUIRE))
+  {
+    nanosleep(&tick, NULL);
+    __atomic_store_n(&evel_clock_cached_usec,
+                     evel_clock_read(CLOCK_REALTIME),
+                     __ATOMIC_RELAXED);
+  }
+
+  return NULL;
+}
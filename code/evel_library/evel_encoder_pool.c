@@ -0,0 +1,292 @@
+/**************************************************************************//**
+ * @file
+ * Pool of encoder threads between the event ring-buffer and the sender.
+ *
+ * Events are encoded in parallel by the workers and handed to the event
+ * handler thread in the order they were posted, so that encoding is spread
+ * over several cores without the posting threads doing any of it.
+ *
+ * License
+ * -------
+ *
+ * Copyright(c) <2016>, AT&T Intellectual Property.  All other rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:  This product includes
+ *    software developed by the AT&T.
+ * 4. Neither the name of AT&T nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific
+ *    prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AT&T INTELLECTUAL PROPERTY ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AT&T INTELLECTUAL PROPERTY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "evel.h"
+#include "evel_internal.h"
+#include "ring_buffer.h"
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void * evel_encoder_pool_worker(void * arg);
+
+/**************************************************************************//**
+ * Initialize a ::EVEL_ENCODER_POOL and start its worker threads.
+ *
+ * @param pool          Pointer to the ::EVEL_ENCODER_POOL to initialize.
+ * @param source        The ring-buffer from which to take events.
+ * @param num_threads   The number of worker threads to start.
+ * @returns Status code
+ * @retval  EVEL_SUCCESS      On success
+ * @retval  ::EVEL_ERR_CODES  On failure.
+ *****************************************************************************/
+EVEL_ERR_CODES evel_encoder_pool_initialize(EVEL_ENCODER_POOL * pool,
+                                            struct ring_buffer * source,
+                                            const int num_threads)
+{
+  EVEL_ERR_CODES rc = EVEL_SUCCESS;
+  int pthread_rc = 0;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(pool != NULL);
+  assert(source != NULL);
+  assert(num_threads > 0);
+
+  memset(pool, 0, sizeof(EVEL_ENCODER_POOL));
+  pool->source = source;
+  pthread_mutex_init(&pool->read_mutex, NULL);
+  pthread_mutex_init(&pool->mutex, NULL);
+  pthread_cond_init(&pool->cond, NULL);
+
+  /***************************************************************************/
+  /* Allow each worker to run one event ahead of the sender, so that a slow  */
+  /* event doesn't stall the rest of the pool immediately.                   */
+  /***************************************************************************/
+  pool->num_slots = 2 * num_threads;
+  pool->slots = calloc(pool->num_slots, sizeof(EVENT_HEADER *));
+  pool->slot_filled = calloc(pool->num_slots, sizeof(bool));
+  pool->threads = calloc(num_threads, sizeof(pthread_t));
+  if ((pool->slots == NULL) ||
+      (pool->slot_filled == NULL) ||
+      (pool->threads == NULL))
+  {
+    rc = EVEL_OUT_OF_MEMORY;
+    log_error_state("Out of memory allocating encoder pool");
+    goto exit_label;
+  }
+
+  /***************************************************************************/
+  /* Start the workers.                                                      */
+  /***************************************************************************/
+  while (pool->num_threads < num_threads)
+  {
+    pthread_rc = pthread_create(&pool->threads[pool->num_threads],
+                                NULL,
+                                evel_encoder_pool_worker,
+                                pool);
+    if (pthread_rc != 0)
+    {
+      rc = EVEL_PTHREAD_LIBRARY_FAIL;
+      log_error_state("Failed to start encoder thread. "
+                      "Error code=%d", pthread_rc);
+      goto exit_label;
+    }
+    pool->num_threads++;
+  }
+
+exit_label:
+  EVEL_EXIT();
+  return rc;
+}
+
+/**************************************************************************//**
+ * Wait for the worker threads of a ::EVEL_ENCODER_POOL to exit and free it.
+ *
+ * The workers exit once one of them has taken an ::EVT_CMD_TERMINATE event
+ * from the ring-buffer, so that must have been posted and read back.
+ *
+ * @param pool          Pointer to the ::EVEL_ENCODER_POOL to terminate.
+ *****************************************************************************/
+void evel_encoder_pool_terminate(EVEL_ENCODER_POOL * pool)
+{
+  int index;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(pool != NULL);
+
+  for (index = 0; index < pool->num_threads; index++)
+  {
+    pthread_join(pool->threads[index], NULL);
+  }
+
+  /***************************************************************************/
+  /* Nothing can be left in the slots, since nothing is taken from the       */
+  /* ring-buffer after the terminate event which the sender has read.        */
+  /***************************************************************************/
+  free(pool->threads);
+  free(pool->slots);
+  free(pool->slot_filled);
+  pool->threads = NULL;
+  pool->slots = NULL;
+  pool->slot_filled = NULL;
+  pool->num_threads = 0;
+
+  pthread_cond_destroy(&pool->cond);
+  pthread_mutex_destroy(&pool->mutex);
+  pthread_mutex_destroy(&pool->read_mutex);
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Read the next event from a ::EVEL_ENCODER_POOL, in the order posted.
+ *
+ * Regular events are returned as ::EVT_CMD_POST_ENCODED internal events,
+ * and other internal events are returned as they were posted.
+ *
+ * @param pool          Pointer to the ::EVEL_ENCODER_POOL.
+ * @returns Pointer to the next event, which the caller must free.
+ *****************************************************************************/
+EVENT_HEADER * evel_encoder_pool_read(EVEL_ENCODER_POOL * pool)
+{
+  EVENT_HEADER * event = NULL;
+  int slot;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(pool != NULL);
+
+  /***************************************************************************/
+  /* Take slots in ticket order, skipping any whose event was dropped        */
+  /* because it could not be encoded.                                        */
+  /***************************************************************************/
+  pthread_mutex_lock(&pool->mutex);
+  while (event == NULL)
+  {
+    slot = pool->next_delivery % pool->num_slots;
+    while (!pool->slot_filled[slot])
+    {
+      pthread_cond_wait(&pool->cond, &pool->mutex);
+    }
+    event = pool->slots[slot];
+    pool->slots[slot] = NULL;
+    pool->slot_filled[slot] = false;
+    pool->next_delivery++;
+    pthread_cond_broadcast(&pool->cond);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+
+  EVEL_EXIT();
+  return event;
+}
+
+/**************************************************************************//**
+ * Encoder pool worker.
+ *
+ * Take events from the ring-buffer, encode them and put them in their slots
+ * until the terminate event is seen.
+ *
+ * @param arg           Pointer to the ::EVEL_ENCODER_POOL.
+ *****************************************************************************/
+static void * evel_encoder_pool_worker(void * arg)
+{
+  EVEL_ENCODER_POOL * pool = (EVEL_ENCODER_POOL *) arg;
+  EVENT_HEADER * event;
+  EVENT_INTERNAL * internal_event;
+  unsigned long ticket;
+  bool terminate;
+  int slot;
+
+  EVEL_INFO("Encoder thread started");
+
+  while (true)
+  {
+    /*************************************************************************/
+    /* Take the next event and its ticket.  Only the worker holding the read */
+    /* mutex waits on the ring-buffer, so after the terminate event is taken */
+    /* the others see the flag here rather than waiting forever.             */
+    /*************************************************************************/
+    pthread_mutex_lock(&pool->read_mutex);
+    if (pool->terminate)
+    {
+      pthread_mutex_unlock(&pool->read_mutex);
+      break;
+    }
+    event = ring_buffer_read(pool->source);
+    ticket = pool->next_ticket++;
+    terminate = false;
+    if (event->event_domain == EVEL_DOMAIN_INTERNAL)
+    {
+      internal_event = (EVENT_INTERNAL *) event;
+      terminate = (internal_event->command == EVT_CMD_TERMINATE);
+      pool->terminate = terminate;
+    }
+    pthread_mutex_unlock(&pool->read_mutex);
+
+    /*************************************************************************/
+    /* Encode regular events.  Internal events, including any that were     */
+    /* encoded when posted, go to the sender as they are.                    */
+    /*************************************************************************/
+    if (event->event_domain != EVEL_DOMAIN_INTERNAL)
+    {
+      EVEL_DEBUG("Encoder thread encoding event %s", event->event_id);
+      event = evel_encode_posted_event(event);
+    }
+
+    /*************************************************************************/
+    /* Wait for the ticket's slot to come round, then fill it.               */
+    /*************************************************************************/
+    pthread_mutex_lock(&pool->mutex);
+    while (ticket >= pool->next_delivery + pool->num_slots)
+    {
+      pthread_cond_wait(&pool->cond, &pool->mutex);
+    }
+    slot = ticket % pool->num_slots;
+    pool->slots[slot] = event;
+    pool->slot_filled[slot] = true;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+
+    if (terminate)
+    {
+      break;
+    }
+  }
+
+  EVEL_INFO("Encoder thread stopped");
+
+  return NULL;
+}
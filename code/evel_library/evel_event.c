@@ -39,7 +39,7 @@
 #include <string.h>
 #include <assert.h>
 #include <stdlib.h>
-#include <sys/time.h>
+#include <pthread.h>
 
 #include "evel.h"
 #include "evel_internal.h"
@@ -51,6 +51,107 @@
  *****************************************************************************/
 static int event_sequence = 1;
 
+/*****************************************************************************/
+/* How many sequence numbers each thread takes at once, and the generation   */
+/* of the sequence, bumped whenever it is reset so that threads drop the     */
+/* rest of the blocks they have.                                             */
+/*****************************************************************************/
+static int event_sequence_block = 1;
+static unsigned int event_sequence_generation = 0;
+
+/*****************************************************************************/
+/* Each thread's block of sequence numbers: the next to use, the end of the  */
+/* block and the generation of the sequence it was taken from.               */
+/*****************************************************************************/
+static __thread int thread_sequence_next = 0;
+static __thread int thread_sequence_end = 0;
+static __thread unsigned int thread_sequence_generation = 0;
+
+/**************************************************************************//**
+ * Generation of the default identity (VM name and UUID) given to new event
+ * headers.  Bumped whenever the metadata changes.
+ *****************************************************************************/
+static unsigned int header_identity_generation = 1;
+
+/**************************************************************************//**
+ * The default identity given to event headers, which point at its strings
+ * rather than each having copies.  It is replaced when the generation
+ * changes, and the identities it replaces are kept until the library is
+ * terminated, since headers don't count references to them.
+ *****************************************************************************/
+struct evel_identity {
+  EVEL_IDENTITY * retired;
+  unsigned int generation;
+  char * vm_name;
+  char * vm_uuid;
+  char * functional_role;
+};
+
+/*****************************************************************************/
+/* The current identity, read without locking, the identities it replaced,   */
+/* and the mutex taken to replace it.                                        */
+/*****************************************************************************/
+static EVEL_IDENTITY * header_identity = NULL;
+static EVEL_IDENTITY * header_identity_retired = NULL;
+static pthread_mutex_t header_identity_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*****************************************************************************/
+/* Size of the per-thread cache of commonEventHeader JSON.                   */
+/*****************************************************************************/
+#define EVEL_HEADER_CACHE_SIZE 1024
+
+/**************************************************************************//**
+ * The pre-encoded fragments of the commonEventHeader.
+ *****************************************************************************/
+typedef enum {
+  EVEL_HEADER_FRAGMENT_ENTITY_NAME,  /** reportingEntityName                 */
+  EVEL_HEADER_FRAGMENT_SOURCE_NAME,  /** sourceName                          */
+  EVEL_HEADER_FRAGMENT_VERSION,      /** version                             */
+  EVEL_HEADER_FRAGMENT_IDS,          /** reportingEntityId to nfNamingCode   */
+  EVEL_HEADER_MAX_FRAGMENTS
+} EVEL_HEADER_FRAGMENTS;
+
+/**************************************************************************//**
+ * Cache of the JSON for the parts of the commonEventHeader which rarely
+ * change between events, so that only the per-event fields need encoding.
+ * There is one per encoding thread so that no locking is needed.
+ *****************************************************************************/
+typedef struct evel_header_cache {
+  /***************************************************************************/
+  /* What the fragments were built for.  A generation of 0 means not built.  */
+  /***************************************************************************/
+  unsigned int generation;
+  EVEL_ENCODINGS encoding;
+  int major_version;
+  int minor_version;
+  char * nfcnaming_code;
+  char * nfnaming_code;
+
+  /***************************************************************************/
+  /* The fragments, back to back.                                            */
+  /***************************************************************************/
+  int fragment_start[EVEL_HEADER_MAX_FRAGMENTS];
+  int fragment_length[EVEL_HEADER_MAX_FRAGMENTS];
+  char json[EVEL_HEADER_CACHE_SIZE];
+} EVEL_HEADER_CACHE;
+
+/**************************************************************************//**
+ * Key for the per-thread ::EVEL_HEADER_CACHE.
+ *****************************************************************************/
+static pthread_key_t header_cache_key;
+static pthread_once_t header_cache_key_once = PTHREAD_ONCE_INIT;
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static EVEL_IDENTITY * evel_new_header_identity(
+                                               const unsigned int generation);
+static EVEL_IDENTITY * evel_header_identity_acquire(void);
+static void evel_init_header_identity(EVENT_HEADER * const header,
+                                      const bool role_name);
+static bool evel_header_owns(const EVENT_HEADER * const header,
+                             const char * const string);
+
 /**************************************************************************//**
  * Set the next event_sequence to use.
  *
@@ -58,14 +159,117 @@ static int event_sequence = 1;
  *****************************************************************************/
 void evel_set_next_event_sequence(const int sequence)
 {
+  int previous;
+
   EVEL_ENTER();
 
-  EVEL_INFO("Setting event sequence to %d, was %d ", sequence, event_sequence);
-  event_sequence = sequence;
+  previous = __atomic_exchange_n(&event_sequence, sequence, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&event_sequence_generation, 1, __ATOMIC_RELEASE);
+  EVEL_INFO("Setting event sequence to %d, was %d ", sequence, previous);
 
   EVEL_EXIT();
 }
 
+/**************************************************************************//**
+ * Set how many event sequence numbers each thread takes at once.
+ *
+ * @param size          The number of sequence numbers in each block.
+ *****************************************************************************/
+void evel_set_event_sequence_block(const int size)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(size > 0);
+
+  __atomic_store_n(&event_sequence_block, size, __ATOMIC_RELAXED);
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Take the next event sequence number.
+ *
+ * @returns The sequence number for the new event.
+ *****************************************************************************/
+int evel_next_event_sequence(void)
+{
+  unsigned int generation;
+  int block;
+  int sequence;
+
+  EVEL_ENTER();
+
+  block = __atomic_load_n(&event_sequence_block, __ATOMIC_RELAXED);
+  if (block == 1)
+  {
+    sequence = __atomic_fetch_add(&event_sequence, 1, __ATOMIC_RELAXED);
+    goto exit_label;
+  }
+
+  /***************************************************************************/
+  /* Take a new block when this thread's is used up, or is from before the   */
+  /* sequence was reset.                                                     */
+  /***************************************************************************/
+  generation = __atomic_load_n(&event_sequence_generation, __ATOMIC_ACQUIRE);
+  if ((thread_sequence_next == thread_sequence_end) ||
+      (thread_sequence_generation != generation))
+  {
+    thread_sequence_next = __atomic_fetch_add(&event_sequence,
+                                              block,
+                                              __ATOMIC_RELAXED);
+    thread_sequence_end = thread_sequence_next + block;
+    thread_sequence_generation = generation;
+  }
+  sequence = thread_sequence_next++;
+
+exit_label:
+  EVEL_EXIT();
+  return sequence;
+}
+
+/**************************************************************************//**
+ * Format an event sequence number as the default eventId.
+ *
+ * @param buffer        Where to write the ASCIIZ number, of at least
+ *                      ::EVEL_SEQUENCE_ID_LEN characters.
+ * @param sequence      The sequence number.
+ * @returns The length of the number written.
+ *****************************************************************************/
+int evel_format_sequence(char * const buffer, const int sequence)
+{
+  char digits[EVEL_SEQUENCE_ID_LEN];
+  unsigned int value;
+  int num_digits = 0;
+  int length = 0;
+
+  /***************************************************************************/
+  /* Work in unsigned so that the most negative number can be negated.       */
+  /***************************************************************************/
+  value = (unsigned int) sequence;
+  if (sequence < 0)
+  {
+    buffer[length++] = '-';
+    value = 0U - value;
+  }
+
+  do
+  {
+    digits[num_digits++] = '0' + (value % 10);
+    value /= 10;
+  } while (value != 0);
+
+  while (num_digits > 0)
+  {
+    buffer[length++] = digits[--num_digits];
+  }
+  buffer[length] = '\0';
+
+  return length;
+}
+
 
 /**************************************************************************//**
  * Create a new heartbeat event of given name and type.
@@ -91,13 +295,13 @@ EVENT_HEADER * evel_new_heartbeat_nameid(const char* ev_name, const char *ev_id)
   /***************************************************************************/
   /* Allocate the header.                                                    */
   /***************************************************************************/
-  heartbeat = malloc(sizeof(EVENT_HEADER));
+  heartbeat = evel_event_alloc(EVEL_DOMAIN_HEARTBEAT);
   if (heartbeat == NULL)
   {
     log_error_state("Out of memory");
     goto exit_label;
   }
-  memset(heartbeat, 0, sizeof(EVENT_HEADER));
+  heartbeat->arena = evel_new_event_arena();
 
   /***************************************************************************/
   /* Initialize the header.  Get a new event sequence number.  Note that if  */
@@ -128,13 +332,13 @@ EVENT_HEADER * evel_new_heartbeat()
   /***************************************************************************/
   /* Allocate the header.                                                    */
   /***************************************************************************/
-  heartbeat = malloc(sizeof(EVENT_HEADER));
+  heartbeat = evel_event_alloc(EVEL_DOMAIN_HEARTBEAT);
   if (heartbeat == NULL)
   {
     log_error_state("Out of memory");
     goto exit_label;
   }
-  memset(heartbeat, 0, sizeof(EVENT_HEADER));
+  heartbeat->arena = evel_new_event_arena();
 
   /***************************************************************************/
   /* Initialize the header.  Get a new event sequence number.  Note that if  */
@@ -142,7 +346,9 @@ EVENT_HEADER * evel_new_heartbeat()
   /* everything downstream can cope with NULLs.                              */
   /***************************************************************************/
   evel_init_header(heartbeat,"Heartbeat");
-  evel_force_option_string(&heartbeat->event_type, "Autonomous heartbeat");
+  evel_arena_force_option_string(heartbeat->arena,
+                                 &heartbeat->event_type,
+                                 "Autonomous heartbeat");
 
 exit_label:
   EVEL_EXIT();
@@ -156,36 +362,28 @@ exit_label:
  *****************************************************************************/
 void evel_init_header(EVENT_HEADER * const header,const char *const eventname)
 {
-  char scratchpad[EVEL_MAX_STRING_LEN + 1] = {0};
-  struct timeval tv;
-
   EVEL_ENTER();
 
   assert(header != NULL);
 
-  gettimeofday(&tv, NULL);
-
   /***************************************************************************/
   /* Initialize the header.  Get a new event sequence number.  Note that if  */
   /* any memory allocation fails in here we will fail gracefully because     */
   /* everything downstream can cope with NULLs.                              */
   /***************************************************************************/
   header->event_domain = EVEL_DOMAIN_HEARTBEAT;
-  snprintf(scratchpad, EVEL_MAX_STRING_LEN, "%d", event_sequence);
-  header->event_id = strdup(scratchpad);
-  if( eventname == NULL )
-     header->event_name = strdup(functional_role);
-  else
-     header->event_name = strdup(eventname);
-  header->last_epoch_microsec = tv.tv_usec + 1000000 * tv.tv_sec;
+  header->sequence = evel_next_event_sequence();
+  evel_format_sequence(header->sequence_id, header->sequence);
+  header->event_id = header->sequence_id;
+  if (eventname != NULL)
+  {
+    header->event_name = evel_arena_strdup(header->arena, eventname);
+  }
+  header->last_epoch_microsec = evel_time_microsec();
   header->priority = EVEL_PRIORITY_NORMAL;
-  header->reporting_entity_name = strdup(openstack_vm_name());
-  header->source_name = strdup(openstack_vm_name());
-  header->sequence = event_sequence;
   header->start_epoch_microsec = header->last_epoch_microsec;
   header->major_version = EVEL_HEADER_MAJOR_VERSION;
   header->minor_version = EVEL_HEADER_MINOR_VERSION;
-  event_sequence++;
 
   /***************************************************************************/
   /* Optional parameters.                                                    */
@@ -193,10 +391,14 @@ void evel_init_header(EVENT_HEADER * const header,const char *const eventname)
   evel_init_option_string(&header->event_type);
   evel_init_option_string(&header->nfcnaming_code);
   evel_init_option_string(&header->nfnaming_code);
-  evel_force_option_string(&header->reporting_entity_id, openstack_vm_uuid());
-  evel_force_option_string(&header->source_id, openstack_vm_uuid());
   evel_init_option_intheader(&header->internal_field);
 
+  /***************************************************************************/
+  /* Point at the shared identity, which also names the event if no name was */
+  /* given.                                                                  */
+  /***************************************************************************/
+  evel_init_header_identity(header, (eventname == NULL));
+
   EVEL_EXIT();
 }
 
@@ -208,33 +410,26 @@ void evel_init_header(EVENT_HEADER * const header,const char *const eventname)
  *****************************************************************************/
 void evel_init_header_nameid(EVENT_HEADER * const header,const char *const eventname, const char *eventid)
 {
-  struct timeval tv;
-
   EVEL_ENTER();
 
   assert(header != NULL);
   assert(eventname != NULL);
   assert(eventid != NULL);
 
-  gettimeofday(&tv, NULL);
-
   /***************************************************************************/
   /* Initialize the header.  Get a new event sequence number.  Note that if  */
   /* any memory allocation fails in here we will fail gracefully because     */
   /* everything downstream can cope with NULLs.                              */
   /***************************************************************************/
   header->event_domain = EVEL_DOMAIN_HEARTBEAT;
-  header->event_id = strdup(eventid);
-  header->event_name = strdup(eventname);
-  header->last_epoch_microsec = tv.tv_usec + 1000000 * tv.tv_sec;
+  header->event_id = evel_arena_strdup(header->arena, eventid);
+  header->event_name = evel_arena_strdup(header->arena, eventname);
+  header->last_epoch_microsec = evel_time_microsec();
   header->priority = EVEL_PRIORITY_NORMAL;
-  header->reporting_entity_name = strdup(openstack_vm_name());
-  header->source_name = strdup(openstack_vm_name());
-  header->sequence = event_sequence;
+  header->sequence = evel_next_event_sequence();
   header->start_epoch_microsec = header->last_epoch_microsec;
   header->major_version = EVEL_HEADER_MAJOR_VERSION;
   header->minor_version = EVEL_HEADER_MINOR_VERSION;
-  event_sequence++;
 
   /***************************************************************************/
   /* Optional parameters.                                                    */
@@ -242,10 +437,13 @@ void evel_init_header_nameid(EVENT_HEADER * const header,const char *const event
   evel_init_option_string(&header->event_type);
   evel_init_option_string(&header->nfcnaming_code);
   evel_init_option_string(&header->nfnaming_code);
-  evel_force_option_string(&header->reporting_entity_id, openstack_vm_uuid());
-  evel_force_option_string(&header->source_id, openstack_vm_uuid());
   evel_init_option_intheader(&header->internal_field);
 
+  /***************************************************************************/
+  /* Point at the shared identity.                                           */
+  /***************************************************************************/
+  evel_init_header_identity(header, false);
+
   EVEL_EXIT();
 }
 
@@ -272,7 +470,43 @@ void evel_header_type_set(EVENT_HEADER * const header,
   assert(header != NULL);
   assert(type != NULL);
 
-  evel_set_option_string(&header->event_type, type, "Event Type");
+  evel_uninherit_option_string(header, &header->event_type);
+  evel_arena_set_option_string(header->arena,
+                               &header->event_type,
+                               type,
+                               "Event Type");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Event Type property of the event header, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param type          The Event Type to be set.  ASCIIZ string allocated with
+ *                      malloc.  The event header takes ownership of it, so the
+ *                      caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_header_type_set_take(EVENT_HEADER * const header, char * const type)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(header != NULL);
+  assert(type != NULL);
+
+  evel_uninherit_option_string(header, &header->event_type);
+  evel_arena_take_option_string(header->arena,
+                                &header->event_type,
+                                type,
+                                "Event Type");
 
   EVEL_EXIT();
 }
@@ -339,7 +573,39 @@ void evel_nfcnamingcode_set(EVENT_HEADER * const header,
   /***************************************************************************/
   assert(header != NULL);
   assert(nfcnam != NULL);
-  evel_set_option_string(&header->nfcnaming_code, nfcnam, "NFC Naming Code");
+  evel_uninherit_option_string(header, &header->nfcnaming_code);
+  evel_arena_set_option_string(header->arena,
+                               &header->nfcnaming_code,
+                               nfcnam,
+                               "NFC Naming Code");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the NFC Naming code property of the event header, without copying it.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param nfcnam        The NFC Naming code to be set.  ASCIIZ string allocated
+ *                      with malloc.  The event header takes ownership of it,
+ *                      so the caller must not use or free it after the
+ *                      function returns.
+ *****************************************************************************/
+void evel_nfcnamingcode_set_take(EVENT_HEADER * const header,
+                                 char * const nfcnam)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions and assign the new value.                           */
+  /***************************************************************************/
+  assert(header != NULL);
+  assert(nfcnam != NULL);
+  evel_uninherit_option_string(header, &header->nfcnaming_code);
+  evel_arena_take_option_string(header->arena,
+                                &header->nfcnaming_code,
+                                nfcnam,
+                                "NFC Naming Code");
 
   EVEL_EXIT();
 }
@@ -360,7 +626,39 @@ void evel_nfnamingcode_set(EVENT_HEADER * const header,
   /***************************************************************************/
   assert(header != NULL);
   assert(nfnam != NULL);
-  evel_set_option_string(&header->nfnaming_code, nfnam, "NF Naming Code");
+  evel_uninherit_option_string(header, &header->nfnaming_code);
+  evel_arena_set_option_string(header->arena,
+                               &header->nfnaming_code,
+                               nfnam,
+                               "NF Naming Code");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the NF Naming code property of the event header, without copying it.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param nfnam         The NF Naming code to be set.  ASCIIZ string allocated
+ *                      with malloc.  The event header takes ownership of it,
+ *                      so the caller must not use or free it after the
+ *                      function returns.
+ *****************************************************************************/
+void evel_nfnamingcode_set_take(EVENT_HEADER * const header,
+                                char * const nfnam)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions and assign the new value.                           */
+  /***************************************************************************/
+  assert(header != NULL);
+  assert(nfnam != NULL);
+  evel_uninherit_option_string(header, &header->nfnaming_code);
+  evel_arena_take_option_string(header->arena,
+                                &header->nfnaming_code,
+                                nfnam,
+                                "NF Naming Code");
 
   EVEL_EXIT();
 }
@@ -388,10 +686,58 @@ void evel_reporting_entity_name_set(EVENT_HEADER * const header,
 
   /***************************************************************************/
   /* Free the previously allocated memory and replace it with a copy of the  */
-  /* provided one.                                                           */
+  /* provided one.  Memory from the event's arena is freed with the event,   */
+  /* and the shared identity is not the header's to free.                    */
+  /***************************************************************************/
+  if ((header->arena == NULL) &&
+      evel_header_owns(header, header->reporting_entity_name))
+  {
+    free(header->reporting_entity_name);
+  }
+  header->reporting_entity_name = evel_arena_strdup(header->arena,
+                                                    entity_name);
+  header->identity_generation = 0;
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Reporting Entity Name property of the event header, without copying
+ * it.
+ *
+ * @note The Reporting Entity Name defaults to the OpenStack VM Name.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param entity_name   The entity name to set.  ASCIIZ string allocated with
+ *                      malloc.  The event header takes ownership of it, so
+ *                      the caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_reporting_entity_name_set_take(EVENT_HEADER * const header,
+                                         char * const entity_name)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions and assign the new value.                           */
   /***************************************************************************/
-  free(header->reporting_entity_name);
-  header->reporting_entity_name = strdup(entity_name);
+  assert(header != NULL);
+  assert(entity_name != NULL);
+  assert(header->reporting_entity_name != NULL);
+
+  /***************************************************************************/
+  /* Free the previously allocated memory and replace it with the provided   */
+  /* one.  Memory from the event's arena is freed with the event, and the    */
+  /* shared identity is not the header's to free.                            */
+  /***************************************************************************/
+  if ((header->arena == NULL) &&
+      evel_header_owns(header, header->reporting_entity_name))
+  {
+    free(header->reporting_entity_name);
+  }
+  header->reporting_entity_name = evel_arena_take_string(header->arena,
+                                                         entity_name);
+  header->identity_generation = 0;
 
   EVEL_EXIT();
 }
@@ -417,17 +763,514 @@ void evel_reporting_entity_id_set(EVENT_HEADER * const header,
 
   /***************************************************************************/
   /* Free the previously allocated memory and replace it with a copy of the  */
-  /* provided one.  Note that evel_force_option_string strdups entity_id.    */
+  /* provided one.  Note that evel_arena_force_option_string copies          */
+  /* entity_id.  Memory from the event's arena is freed with the event, and  */
+  /* the shared identity is not the header's to free.                        */
+  /***************************************************************************/
+  if ((header->arena == NULL) &&
+      evel_header_owns(header, header->reporting_entity_id.value))
+  {
+    evel_free_option_string(&header->reporting_entity_id);
+  }
+  else
+  {
+    evel_init_option_string(&header->reporting_entity_id);
+  }
+  evel_arena_force_option_string(header->arena,
+                                 &header->reporting_entity_id,
+                                 entity_id);
+  header->identity_generation = 0;
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Reporting Entity Id property of the event header, without copying
+ * it.
+ *
+ * @note The Reporting Entity Id defaults to the OpenStack VM UUID.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param entity_id     The entity id to set.  ASCIIZ string allocated with
+ *                      malloc.  The event header takes ownership of it, so
+ *                      the caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_reporting_entity_id_set_take(EVENT_HEADER * const header,
+                                       char * const entity_id)
+{
+  EVEL_ENTER();
+
   /***************************************************************************/
-  evel_free_option_string(&header->reporting_entity_id);
-  evel_force_option_string(&header->reporting_entity_id, entity_id);
+  /* Check preconditions and assign the new value.                           */
+  /***************************************************************************/
+  assert(header != NULL);
+  assert(entity_id != NULL);
+
+  /***************************************************************************/
+  /* Free the previously allocated memory and replace it with the provided   */
+  /* one.  Memory from the event's arena is freed with the event, and the    */
+  /* shared identity is not the header's to free.                            */
+  /***************************************************************************/
+  if ((header->arena == NULL) &&
+      evel_header_owns(header, header->reporting_entity_id.value))
+  {
+    evel_free_option_string(&header->reporting_entity_id);
+  }
+  else
+  {
+    evel_init_option_string(&header->reporting_entity_id);
+  }
+  header->reporting_entity_id.value = evel_arena_take_string(header->arena,
+                                                             entity_id);
+  header->reporting_entity_id.is_set = EVEL_TRUE;
+  header->identity_generation = 0;
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Note that the identity given to new event headers has changed.
+ *
+ * Called when the metadata is (re)loaded, so that JSON cached for the
+ * headers of earlier events is not used for later ones.
+ *****************************************************************************/
+void evel_header_identity_changed(void)
+{
+  EVEL_ENTER();
+
+  __atomic_add_fetch(&header_identity_generation, 1, __ATOMIC_RELEASE);
 
   EVEL_EXIT();
 }
 
+/**************************************************************************//**
+ * Free the shared identity given to event headers, and those it replaced.
+ *
+ * Headers refer to the identities without counting references, so events
+ * must have been freed first.
+ *****************************************************************************/
+void evel_free_header_identity(void)
+{
+  EVEL_IDENTITY * identity;
+  EVEL_IDENTITY * retired;
+
+  EVEL_ENTER();
+
+  pthread_mutex_lock(&header_identity_mutex);
+  identity = __atomic_exchange_n(&header_identity, NULL, __ATOMIC_ACQ_REL);
+  if (identity != NULL)
+  {
+    identity->retired = header_identity_retired;
+    header_identity_retired = identity;
+  }
+  while (header_identity_retired != NULL)
+  {
+    retired = header_identity_retired;
+    header_identity_retired = retired->retired;
+    free(retired);
+  }
+  pthread_mutex_unlock(&header_identity_mutex);
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Make a new shared identity from the metadata and functional role.
+ *
+ * @param generation    The identity generation before the metadata is read.
+ * @returns Pointer to the new ::EVEL_IDENTITY.
+ * @retval  NULL  Failed to allocate memory for the identity.
+ *****************************************************************************/
+static EVEL_IDENTITY * evel_new_header_identity(const unsigned int generation)
+{
+  EVEL_IDENTITY * identity;
+  const char * role;
+  size_t name_size;
+  size_t uuid_size;
+  size_t role_size;
+
+  /***************************************************************************/
+  /* The strings follow the structure in the same allocation.                */
+  /***************************************************************************/
+  role = (functional_role != NULL) ? functional_role : "";
+  name_size = strlen(openstack_vm_name()) + 1;
+  uuid_size = strlen(openstack_vm_uuid()) + 1;
+  role_size = strlen(role) + 1;
+  identity = malloc(sizeof(EVEL_IDENTITY) + name_size + uuid_size + role_size);
+  if (identity == NULL)
+  {
+    return NULL;
+  }
+  identity->retired = NULL;
+  identity->vm_name = (char *) (identity + 1);
+  identity->vm_uuid = identity->vm_name + name_size;
+  identity->functional_role = identity->vm_uuid + uuid_size;
+  memcpy(identity->vm_name, openstack_vm_name(), name_size);
+  memcpy(identity->vm_uuid, openstack_vm_uuid(), uuid_size);
+  memcpy(identity->functional_role, role, role_size);
+
+  /***************************************************************************/
+  /* Terminate the strings in case the metadata changed between measuring    */
+  /* and copying them.  If it did, give the identity a generation of 0 so    */
+  /* that the cached JSON isn't shared and the identity is replaced for the  */
+  /* next header.                                                            */
+  /***************************************************************************/
+  identity->vm_name[name_size - 1] = '\0';
+  identity->vm_uuid[uuid_size - 1] = '\0';
+  if (generation ==
+      __atomic_load_n(&header_identity_generation, __ATOMIC_ACQUIRE))
+  {
+    identity->generation = generation;
+  }
+  else
+  {
+    identity->generation = 0;
+  }
+
+  return identity;
+}
+
+/**************************************************************************//**
+ * Get the shared identity, replacing it first if the identity has changed
+ * since it was made.
+ *
+ * The current identity is read without locking; the mutex is only taken to
+ * replace it, and the identity replaced is retired rather than freed since
+ * headers may still point into it.
+ *
+ * @returns Pointer to the ::EVEL_IDENTITY.
+ * @retval  NULL  Failed to allocate memory for a new identity.
+ *****************************************************************************/
+static EVEL_IDENTITY * evel_header_identity_acquire(void)
+{
+  EVEL_IDENTITY * identity;
+  EVEL_IDENTITY * current;
+  unsigned int generation;
+
+  generation = __atomic_load_n(&header_identity_generation, __ATOMIC_ACQUIRE);
+  identity = __atomic_load_n(&header_identity, __ATOMIC_ACQUIRE);
+  if ((identity != NULL) && (identity->generation == generation))
+  {
+    return identity;
+  }
+
+  /***************************************************************************/
+  /* Check again under the mutex in case another thread has replaced it.     */
+  /***************************************************************************/
+  pthread_mutex_lock(&header_identity_mutex);
+  generation = __atomic_load_n(&header_identity_generation, __ATOMIC_ACQUIRE);
+  current = __atomic_load_n(&header_identity, __ATOMIC_RELAXED);
+  if ((current != NULL) && (current->generation == generation))
+  {
+    identity = current;
+    goto unlock_label;
+  }
+
+  identity = evel_new_header_identity(generation);
+  if (identity == NULL)
+  {
+    goto unlock_label;
+  }
+  if (current != NULL)
+  {
+    current->retired = header_identity_retired;
+    header_identity_retired = current;
+  }
+  __atomic_store_n(&header_identity, identity, __ATOMIC_RELEASE);
+
+unlock_label:
+  pthread_mutex_unlock(&header_identity_mutex);
+  return identity;
+}
+
+/**************************************************************************//**
+ * Point the identity fields of a new header at the shared identity.
+ *
+ * If the shared identity can't be had, the header gets copies instead.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param role_name     Whether to name the event after the functional role.
+ *****************************************************************************/
+static void evel_init_header_identity(EVENT_HEADER * const header,
+                                      const bool role_name)
+{
+  EVEL_IDENTITY * identity;
+
+  identity = evel_header_identity_acquire();
+  if (identity == NULL)
+  {
+    header->reporting_entity_name = evel_arena_strdup(header->arena,
+                                                      openstack_vm_name());
+    header->source_name = evel_arena_strdup(header->arena,
+                                            openstack_vm_name());
+    evel_arena_force_option_string(header->arena,
+                                   &header->reporting_entity_id,
+                                   openstack_vm_uuid());
+    evel_arena_force_option_string(header->arena,
+                                   &header->source_id,
+                                   openstack_vm_uuid());
+    if (role_name)
+    {
+      header->event_name = evel_arena_strdup(header->arena, functional_role);
+    }
+    header->identity_generation = 0;
+    return;
+  }
+
+  header->identity = identity;
+
+  header->reporting_entity_name = identity->vm_name;
+  header->source_name = identity->vm_name;
+  header->reporting_entity_id.value = identity->vm_uuid;
+  header->reporting_entity_id.is_set = EVEL_TRUE;
+  header->source_id.value = identity->vm_uuid;
+  header->source_id.is_set = EVEL_TRUE;
+  if (role_name)
+  {
+    header->event_name = identity->functional_role;
+  }
+  header->identity_generation = identity->generation;
+}
+
+/**************************************************************************//**
+ * Whether a string in a header is the header's own, rather than part of the
+ * shared identity.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER.
+ * @param string        The string.
+ * @returns Whether the header owns the string.
+ *****************************************************************************/
+static bool evel_header_owns(const EVENT_HEADER * const header,
+                             const char * const string)
+{
+  const EVEL_IDENTITY * identity = header->identity;
+
+  return ((identity == NULL) ||
+          ((string != identity->vm_name) &&
+           (string != identity->vm_uuid) &&
+           (string != identity->functional_role)));
+}
+
+/**************************************************************************//**
+ * Free a thread's ::EVEL_HEADER_CACHE when the thread exits.
+ *
+ * @param value         Pointer to the ::EVEL_HEADER_CACHE.
+ *****************************************************************************/
+static void evel_header_cache_free(void * value)
+{
+  EVEL_HEADER_CACHE * cache = (EVEL_HEADER_CACHE *) value;
+
+  free(cache->nfcnaming_code);
+  free(cache->nfnaming_code);
+  free(cache);
+}
+
+/**************************************************************************//**
+ * Create the key for the per-thread ::EVEL_HEADER_CACHE.
+ *****************************************************************************/
+static void evel_header_cache_key_create(void)
+{
+  pthread_key_create(&header_cache_key, evel_header_cache_free);
+}
+
+/**************************************************************************//**
+ * Check whether an optional string matches the value cached for it.
+ *
+ * @param cached        The cached value, or NULL if it was not set.
+ * @param option        The optional string.
+ * @returns true if they match, false otherwise.
+ *****************************************************************************/
+static bool evel_header_cache_option_matches(const char * const cached,
+                                             const EVEL_OPTION_STRING * option)
+{
+  if (!option->is_set)
+  {
+    return (cached == NULL);
+  }
+  return ((cached != NULL) && (strcmp(cached, option->value) == 0));
+}
+
+/**************************************************************************//**
+ * Copy an optional string's value for the ::EVEL_HEADER_CACHE.
+ *
+ * @param option        The optional string.
+ * @returns Copy of the value, or NULL if it is not set.
+ *****************************************************************************/
+static char * evel_header_cache_option_copy(const EVEL_OPTION_STRING * option)
+{
+  return (option->is_set ? strdup(option->value) : NULL);
+}
+
+/**************************************************************************//**
+ * Rebuild the fragments of an ::EVEL_HEADER_CACHE for an event header.
+ *
+ * @param cache         Pointer to the ::EVEL_HEADER_CACHE.
+ * @param event         Pointer to the ::EVENT_HEADER to build it for.
+ * @param encoding      The encoding to build the fragments in.
+ * @returns true if the fragments were built, false if they did not fit.
+ *****************************************************************************/
+static bool evel_header_cache_build(EVEL_HEADER_CACHE * cache,
+                                    EVENT_HEADER * event,
+                                    const EVEL_ENCODINGS encoding)
+{
+  EVEL_JSON_BUFFER json_buffer;
+  EVEL_JSON_BUFFER * jbuf = &json_buffer;
+  int fragment;
+  int start = 0;
+
+  EVEL_ENTER();
+
+  cache->generation = 0;
+  free(cache->nfcnaming_code);
+  free(cache->nfnaming_code);
+  cache->nfcnaming_code = evel_header_cache_option_copy(&event->nfcnaming_code);
+  cache->nfnaming_code = evel_header_cache_option_copy(&event->nfnaming_code);
+
+  /***************************************************************************/
+  /* Encode each fragment into its own JSON_BUFFER so each starts without a  */
+  /* comma, exactly as the fields would have been encoded in place.          */
+  /***************************************************************************/
+  for (fragment = 0; fragment < EVEL_HEADER_MAX_FRAGMENTS; fragment++)
+  {
+    evel_json_buffer_init(jbuf,
+                          cache->json + start,
+                          EVEL_HEADER_CACHE_SIZE - start,
+                          NULL);
+    jbuf->encoding = encoding;
+    switch (fragment)
+    {
+      case EVEL_HEADER_FRAGMENT_ENTITY_NAME:
+        evel_enc_kv_string(
+          jbuf, EVEL_KEY_REPORTING_ENTITY_NAME, event->reporting_entity_name);
+        break;
+
+      case EVEL_HEADER_FRAGMENT_SOURCE_NAME:
+        evel_enc_kv_string(jbuf, EVEL_KEY_SOURCE_NAME, event->source_name);
+        break;
+
+      case EVEL_HEADER_FRAGMENT_VERSION:
+        evel_enc_version(
+          jbuf, EVEL_KEY_VERSION, event->major_version, event->minor_version);
+        break;
+
+      case EVEL_HEADER_FRAGMENT_IDS:
+        evel_enc_kv_opt_string(
+          jbuf, EVEL_KEY_REPORTING_ENTITY_ID, &event->reporting_entity_id);
+        evel_enc_kv_opt_string(jbuf, EVEL_KEY_SOURCE_ID, &event->source_id);
+        evel_enc_kv_opt_string(
+          jbuf, EVEL_KEY_NFC_NAMING_CODE, &event->nfcnaming_code);
+        evel_enc_kv_opt_string(
+          jbuf, EVEL_KEY_NF_NAMING_CODE, &event->nfnaming_code);
+        break;
+    }
+
+    /*************************************************************************/
+    /* If the buffer filled up then the fragment may have been truncated.    */
+    /*************************************************************************/
+    if (jbuf->offset >= jbuf->max_size - 2)
+    {
+      EVEL_DEBUG("Header too large to cache");
+      EVEL_EXIT();
+      return false;
+    }
+    cache->fragment_start[fragment] = start;
+    cache->fragment_length[fragment] = jbuf->offset;
+    start += jbuf->offset;
+  }
+
+  cache->generation = event->identity_generation;
+  cache->encoding = encoding;
+  cache->major_version = event->major_version;
+  cache->minor_version = event->minor_version;
+
+  EVEL_EXIT();
+  return true;
+}
+
+/**************************************************************************//**
+ * Get this thread's ::EVEL_HEADER_CACHE, ready for use for an event header.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER being encoded into.
+ * @param event         Pointer to the ::EVENT_HEADER being encoded.
+ * @returns Pointer to the cache, or NULL if it cannot be used for the header.
+ *****************************************************************************/
+static EVEL_HEADER_CACHE * evel_header_cache_get(EVEL_JSON_BUFFER * jbuf,
+                                                 EVENT_HEADER * event)
+{
+  EVEL_HEADER_CACHE * cache = NULL;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Headers with their own identity aren't cached, nor are throttled ones   */
+  /* since the throttling could suppress fields within the fragments.        */
+  /***************************************************************************/
+  if ((event->identity_generation == 0) || (jbuf->throttle_spec != NULL))
+  {
+    goto exit_label;
+  }
+
+  pthread_once(&header_cache_key_once, evel_header_cache_key_create);
+  cache = pthread_getspecific(header_cache_key);
+  if (cache == NULL)
+  {
+    cache = malloc(sizeof(EVEL_HEADER_CACHE));
+    if (cache == NULL)
+    {
+      goto exit_label;
+    }
+    memset(cache, 0, sizeof(EVEL_HEADER_CACHE));
+    pthread_setspecific(header_cache_key, cache);
+  }
+
+  if ((cache->generation != event->identity_generation) ||
+      (cache->encoding != jbuf->encoding) ||
+      (cache->major_version != event->major_version) ||
+      (cache->minor_version != event->minor_version) ||
+      (!evel_header_cache_option_matches(cache->nfcnaming_code,
+                                         &event->nfcnaming_code)) ||
+      (!evel_header_cache_option_matches(cache->nfnaming_code,
+                                         &event->nfnaming_code)))
+  {
+    EVEL_DEBUG("Rebuilding header cache for generation %u",
+               event->identity_generation);
+    if (!evel_header_cache_build(cache, event, jbuf->encoding))
+    {
+      cache = NULL;
+    }
+  }
+
+exit_label:
+  EVEL_EXIT();
+  return cache;
+}
+
+/**************************************************************************//**
+ * Encode a fragment from the ::EVEL_HEADER_CACHE.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to encode into.
+ * @param cache         Pointer to the ::EVEL_HEADER_CACHE.
+ * @param fragment      The fragment to encode.
+ *****************************************************************************/
+static void evel_enc_header_fragment(EVEL_JSON_BUFFER * jbuf,
+                                     const EVEL_HEADER_CACHE * const cache,
+                                     const EVEL_HEADER_FRAGMENTS fragment)
+{
+  if (cache->fragment_length[fragment] > 0)
+  {
+    evel_enc_kv_fragment(jbuf,
+                         cache->json + cache->fragment_start[fragment],
+                         cache->fragment_length[fragment]);
+  }
+}
+
 /**************************************************************************//**
  * Encode the event as a JSON event object according to AT&T's schema.
  *
+ * The fields which rarely change between events are taken from the
+ * per-thread ::EVEL_HEADER_CACHE where possible.
+ *
  * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to encode into.
  * @param event         Pointer to the ::EVENT_HEADER to encode.
  *****************************************************************************/
@@ -436,6 +1279,7 @@ void evel_json_encode_header(EVEL_JSON_BUFFER * jbuf,
 {
   char * domain;
   char * priority;
+  EVEL_HEADER_CACHE * cache;
 
   EVEL_ENTER();
 
@@ -443,39 +1287,71 @@ void evel_json_encode_header(EVEL_JSON_BUFFER * jbuf,
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(jbuf->json != NULL);
   assert(jbuf->max_size > 0);
   assert(event != NULL);
 
   domain = evel_event_domain(event->event_domain);
   priority = evel_event_priority(event->priority);
-  evel_json_open_named_object(jbuf, "commonEventHeader");
+  evel_json_open_named_object(jbuf, EVEL_KEY_COMMON_EVENT_HEADER);
+  cache = evel_header_cache_get(jbuf, event);
 
   /***************************************************************************/
   /* Mandatory fields.                                                       */
   /***************************************************************************/
-  evel_enc_kv_string(jbuf, "domain", domain);
-  evel_enc_kv_string(jbuf, "eventId", event->event_id);
-  evel_enc_kv_string(jbuf, "eventName", event->event_name);
-  evel_enc_kv_ull(jbuf, "lastEpochMicrosec", event->last_epoch_microsec);
-  evel_enc_kv_string(jbuf, "priority", priority);
-  evel_enc_kv_string(
-    jbuf, "reportingEntityName", event->reporting_entity_name);
-  evel_enc_kv_int(jbuf, "sequence", event->sequence);
-  evel_enc_kv_string(jbuf, "sourceName", event->source_name);
-  evel_enc_kv_ull(jbuf, "startEpochMicrosec", event->start_epoch_microsec);
-  evel_enc_version(
-    jbuf, "version", event->major_version, event->minor_version);
+  evel_enc_kv_string(jbuf, EVEL_KEY_DOMAIN, domain);
+  evel_enc_kv_string(jbuf, EVEL_KEY_EVENT_ID, event->event_id);
+  evel_enc_kv_string(jbuf, EVEL_KEY_EVENT_NAME, event->event_name);
+  evel_enc_kv_ull(
+    jbuf, EVEL_KEY_LAST_EPOCH_MICROSEC, event->last_epoch_microsec);
+  evel_enc_kv_string(jbuf, EVEL_KEY_PRIORITY, priority);
+  if (cache != NULL)
+  {
+    evel_enc_header_fragment(jbuf, cache, EVEL_HEADER_FRAGMENT_ENTITY_NAME);
+  }
+  else
+  {
+    evel_enc_kv_string(
+      jbuf, EVEL_KEY_REPORTING_ENTITY_NAME, event->reporting_entity_name);
+  }
+  evel_enc_kv_int(jbuf, EVEL_KEY_SEQUENCE, event->sequence);
+  if (cache != NULL)
+  {
+    evel_enc_header_fragment(jbuf, cache, EVEL_HEADER_FRAGMENT_SOURCE_NAME);
+  }
+  else
+  {
+    evel_enc_kv_string(jbuf, EVEL_KEY_SOURCE_NAME, event->source_name);
+  }
+  evel_enc_kv_ull(
+    jbuf, EVEL_KEY_START_EPOCH_MICROSEC, event->start_epoch_microsec);
+  if (cache != NULL)
+  {
+    evel_enc_header_fragment(jbuf, cache, EVEL_HEADER_FRAGMENT_VERSION);
+  }
+  else
+  {
+    evel_enc_version(
+      jbuf, EVEL_KEY_VERSION, event->major_version, event->minor_version);
+  }
 
   /***************************************************************************/
   /* Optional fields.                                                        */
   /***************************************************************************/
-  evel_enc_kv_opt_string(jbuf, "eventType", &event->event_type);
-  evel_enc_kv_opt_string(
-    jbuf, "reportingEntityId", &event->reporting_entity_id);
-  evel_enc_kv_opt_string(jbuf, "sourceId", &event->source_id);
-  evel_enc_kv_opt_string(jbuf, "nfcNamingCode", &event->nfcnaming_code);
-  evel_enc_kv_opt_string(jbuf, "nfNamingCode", &event->nfnaming_code);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_EVENT_TYPE, &event->event_type);
+  if (cache != NULL)
+  {
+    evel_enc_header_fragment(jbuf, cache, EVEL_HEADER_FRAGMENT_IDS);
+  }
+  else
+  {
+    evel_enc_kv_opt_string(
+      jbuf, EVEL_KEY_REPORTING_ENTITY_ID, &event->reporting_entity_id);
+    evel_enc_kv_opt_string(jbuf, EVEL_KEY_SOURCE_ID, &event->source_id);
+    evel_enc_kv_opt_string(
+      jbuf, EVEL_KEY_NFC_NAMING_CODE, &event->nfcnaming_code);
+    evel_enc_kv_opt_string(
+      jbuf, EVEL_KEY_NF_NAMING_CODE, &event->nfnaming_code);
+  }
 
   evel_json_close_object(jbuf);
 
@@ -504,16 +1380,40 @@ void evel_free_header(EVENT_HEADER * const event)
   /***************************************************************************/
   /* Free all internal strings.                                              */
   /***************************************************************************/
-  free(event->event_id);
+  if (event->event_id != event->sequence_id)
+  {
+    free(event->event_id);
+  }
   evel_free_option_string(&event->event_type);
-  free(event->event_name);
-  evel_free_option_string(&event->reporting_entity_id);
-  free(event->reporting_entity_name);
-  evel_free_option_string(&event->source_id);
   evel_free_option_string(&event->nfcnaming_code);
   evel_free_option_string(&event->nfnaming_code);
   evel_free_option_intheader(&event->internal_field);
-  free(event->source_name);
+
+  /***************************************************************************/
+  /* Only free the identity strings which don't belong to the shared         */
+  /* identity, which is freed when the library is terminated.                */
+  /***************************************************************************/
+  if (evel_header_owns(event, event->event_name))
+  {
+    free(event->event_name);
+  }
+  if (evel_header_owns(event, event->reporting_entity_id.value))
+  {
+    evel_free_option_string(&event->reporting_entity_id);
+  }
+  if (evel_header_owns(event, event->reporting_entity_name))
+  {
+    free(event->reporting_entity_name);
+  }
+  if (evel_header_owns(event, event->source_id.value))
+  {
+    evel_free_option_string(&event->source_id);
+  }
+  if (evel_header_owns(event, event->source_name))
+  {
+    free(event->source_name);
+  }
+  event->identity = NULL;
 
   EVEL_EXIT();
 }
@@ -537,16 +1437,110 @@ int evel_json_encode_event(char * json,
   EVEL_ENTER();
 
   /***************************************************************************/
-  /* Get the latest throttle specification for the domain.                   */
+  /* Get the latest throttle specification for the domain, holding it while  */
+  /* we encode since this may not be the event handler thread.               */
   /***************************************************************************/
+  evel_throttle_lock_specs();
   throttle_spec = evel_get_throttle_spec(event->event_domain);
 
   /***************************************************************************/
-  /* Initialize the JSON_BUFFER and open the top-level objects.              */
+  /* Initialize the JSON_BUFFER and encode the event into it.                */
   /***************************************************************************/
   evel_json_buffer_init(jbuf, json, max_size, throttle_spec);
+  evel_json_encode_event_object(jbuf, event);
+  evel_throttle_unlock_specs();
+
+  EVEL_EXIT();
+
+  return jbuf->offset;
+}
+
+/**************************************************************************//**
+ * Encode the event as a JSON event object into a buffer of its exact size.
+ *
+ * The event is encoded once, into the calling thread's scratch buffer, and
+ * then copied out.
+ *
+ * @param event     Pointer to the ::EVENT_HEADER to encode.
+ * @param size      Where to store the number of bytes in the encoded event,
+ *                  excluding the NUL.
+ * @returns The encoded event, allocated with malloc.
+ * @retval  NULL  Failed to allocate memory for the encoded event.
+ *****************************************************************************/
+char * evel_json_encode_event_copy(EVENT_HEADER * event, int * const size)
+{
+  EVEL_JSON_BUFFER json_buffer;
+  EVEL_JSON_BUFFER * jbuf = &json_buffer;
+  char * json = NULL;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(size != NULL);
+
+  evel_throttle_lock_specs();
+  if (evel_json_buffer_init_scratch(
+                          jbuf, evel_get_throttle_spec(event->event_domain)))
+  {
+    evel_json_encode_event_object(jbuf, event);
+    json = evel_json_buffer_copy_scratch(jbuf);
+    *size = jbuf->offset;
+  }
+  evel_throttle_unlock_specs();
+
+  EVEL_EXIT();
+  return json;
+}
+
+/**************************************************************************//**
+ * Get the length of the encoded event, without encoding it.
+ *
+ * The event is sized without throttling, which can only remove fields, so
+ * this is an upper bound on the number of bytes ::evel_json_encode_event
+ * writes.  A buffer of one byte more than this holds the event in full.
+ *
+ * @param event     Pointer to the ::EVENT_HEADER to size.
+ * @returns Number of bytes in the encoded event, excluding the NUL.
+ *****************************************************************************/
+int evel_event_encoded_size(EVENT_HEADER * event)
+{
+  EVEL_JSON_BUFFER json_buffer;
+  EVEL_JSON_BUFFER * jbuf = &json_buffer;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+
+  evel_json_buffer_init_sizing(jbuf);
+  evel_json_encode_event_object(jbuf, event);
+
+  EVEL_EXIT();
+
+  return jbuf->offset;
+}
+
+/**************************************************************************//**
+ * Encode the event as a JSON event object into a ::EVEL_JSON_BUFFER.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to encode into.
+ * @param event         Pointer to the ::EVENT_HEADER to encode.
+ *****************************************************************************/
+void evel_json_encode_event_object(EVEL_JSON_BUFFER * jbuf,
+                                   EVENT_HEADER * event)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Open the top-level objects.                                             */
+  /***************************************************************************/
   evel_json_open_object(jbuf);
-  evel_json_open_named_object(jbuf, "event");
+  evel_json_open_named_object(jbuf, EVEL_KEY_EVENT);
 
   switch (event->event_domain)
   {
@@ -613,8 +1607,6 @@ int evel_json_encode_event(char * json,
   assert(jbuf->depth == 0);
 
   EVEL_EXIT();
-
-  return jbuf->offset;
 }
 
 
@@ -627,6 +1619,22 @@ int evel_json_encode_event(char * json,
  *****************************************************************************/
 void evel_init_vendor_field(VENDOR_VNFNAME_FIELD * const vfield,
                                  const char * const vendor_name)
+{
+  evel_arena_init_vendor_field(NULL, vfield, vendor_name);
+}
+
+/**************************************************************************//**
+ * Initialize the vendor field of an event, copying the vendor name into an
+ * arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to copy the name
+ *                      onto the heap.
+ * @param vfield        Pointer to the event vnfname field being initialized.
+ * @param vendor_name   The vendor name.
+ *****************************************************************************/
+void evel_arena_init_vendor_field(EVEL_ARENA * const arena,
+                                  VENDOR_VNFNAME_FIELD * const vfield,
+                                  const char * const vendor_name)
 {
   EVEL_ENTER();
 
@@ -639,7 +1647,7 @@ void evel_init_vendor_field(VENDOR_VNFNAME_FIELD * const vfield,
   /***************************************************************************/
   /* Store the mandatory parts.                                              */
   /***************************************************************************/
-  vfield->vendorname = strdup(vendor_name);
+  vfield->vendorname = evel_arena_strdup(arena, vendor_name);
   evel_init_option_string(&vfield->vfmodule);
   evel_init_option_string(&vfield->vnfname);
 
@@ -745,19 +1753,18 @@ void evel_json_encode_vendor_field(EVEL_JSON_BUFFER * jbuf,
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(jbuf->json != NULL);
   assert(jbuf->max_size > 0);
   assert(vfield != NULL);
   assert(vfield->vendorname != NULL);
 
-  evel_json_open_named_object(jbuf, "vendorVnfNameFields");
+  evel_json_open_named_object(jbuf, EVEL_KEY_VENDOR_VNF_NAME_FIELDS);
 
   /***************************************************************************/
   /* Mandatory fields.                                                       */
   /***************************************************************************/
-  evel_enc_kv_string(jbuf, "vendorName", vfield->vendorname);
-  evel_enc_kv_opt_string(jbuf, "vfModuleName", &vfield->vfmodule);
-  evel_enc_kv_opt_string(jbuf, "vnfName", &vfield->vnfname);
+  evel_enc_kv_string(jbuf, EVEL_KEY_VENDOR_NAME, vfield->vendorname);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_VF_MODULE_NAME, &vfield->vfmodule);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_VNF_NAME, &vfield->vnfname);
 
   /***************************************************************************/
   /* Optional fields.                                                        */
@@ -41,6 +41,7 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <pthread.h>
+#include <unistd.h>
 
 #include <curl/curl.h>
 
@@ -59,6 +60,18 @@ static const int EVEL_API_TIMEOUT = 5;
 /* Prototypes of locally scoped functions.                                   */
 /*****************************************************************************/
 static size_t read_callback(void *ptr, size_t size, size_t nmemb, void *userp);
+static size_t stream_read_callback(void *ptr,
+                                   size_t size,
+                                   size_t nmemb,
+                                   void *userp);
+static EVEL_ERR_CODES evel_post_api_transfer(size_t (*read_function)(void *,
+                                                                     size_t,
+                                                                     size_t,
+                                                                     void *),
+                                             void * read_data,
+                                             long size,
+                                             struct curl_slist * headers,
+                                             const char * const description);
 static void * event_handler(void *arg);
 static bool evel_handle_response_tokens(const MEMORY_CHUNK * const chunk,
                                         const jsmntok_t * const json_tokens,
@@ -82,10 +95,63 @@ static char curl_err_string[CURL_ERROR_SIZE] = "<NULL>";
 static CURL * curl_handle = NULL;
 
 /**************************************************************************//**
- * Special headers that we send.
+ * Special headers that we send with events, giving the content type of the
+ * configured encoding.
  *****************************************************************************/
 static struct curl_slist * hdr_chunk = NULL;
 
+/**************************************************************************//**
+ * Special headers that we send when streaming an event, which additionally
+ * ask for chunked transfer encoding since we don't know the size up front.
+ *****************************************************************************/
+static struct curl_slist * hdr_stream_chunk = NULL;
+
+/**************************************************************************//**
+ * Special headers that we send with priority posts, which are always JSON.
+ *****************************************************************************/
+static struct curl_slist * hdr_json_chunk = NULL;
+
+/**************************************************************************//**
+ * The Content-type header for each of the ::EVEL_ENCODINGS.
+ *****************************************************************************/
+static const char * const evel_content_types[EVEL_MAX_ENCODINGS] = {
+  "Content-type: application/json",
+  "Content-type: application/cbor"
+};
+
+/**************************************************************************//**
+ * The encoding in which events are sent to the API.
+ *****************************************************************************/
+EVEL_ENCODINGS event_encoding = EVEL_ENCODING_JSON;
+
+/**************************************************************************//**
+ * Whether events are streamed to the API as they are encoded, rather than
+ * being encoded in full before being posted.
+ *****************************************************************************/
+static bool evel_stream_events = false;
+
+/**************************************************************************//**
+ * The stream used to encode events while they are being posted.
+ *****************************************************************************/
+static EVEL_JSON_STREAM event_stream;
+
+/**************************************************************************//**
+ * Whether events are encoded by the threads posting them, leaving the event
+ * handler thread only to send them.
+ *****************************************************************************/
+static bool evel_producer_encoding = false;
+
+/**************************************************************************//**
+ * The number of encoder threads between the ring-buffer and the event
+ * handler thread, or 0 for the event handler thread to encode events itself.
+ *****************************************************************************/
+static int evel_encoder_threads = 0;
+
+/**************************************************************************//**
+ * The pool of encoder threads, if there are any.
+ *****************************************************************************/
+static EVEL_ENCODER_POOL encoder_pool;
+
 /**************************************************************************//**
  * Message queue for sending events to the API.
  *****************************************************************************/
@@ -287,14 +353,24 @@ EVEL_ERR_CODES event_handler_initialize(const char * const event_api_url,
   }
 
   /***************************************************************************/
-  /* All of our events are JSON encoded.  We also suppress the               */
+  /* Our events are in the configured encoding, and priority posts are JSON  */
+  /* encoded.  We also suppress the                                          */
   /* Expect: 100-continue   header that we would otherwise get since it      */
   /* confuses some servers.                                                  */
   /*                                                                         */
   /* @TODO: do AT&T want this behavior?                                      */
   /***************************************************************************/
-  hdr_chunk = curl_slist_append(hdr_chunk, "Content-type: application/json");
+  hdr_chunk = curl_slist_append(hdr_chunk,
+                                evel_content_types[event_encoding]);
   hdr_chunk = curl_slist_append(hdr_chunk, "Expect:");
+  hdr_stream_chunk = curl_slist_append(hdr_stream_chunk,
+                                       evel_content_types[event_encoding]);
+  hdr_stream_chunk = curl_slist_append(hdr_stream_chunk, "Expect:");
+  hdr_stream_chunk = curl_slist_append(hdr_stream_chunk,
+                                       "Transfer-Encoding: chunked");
+  hdr_json_chunk = curl_slist_append(hdr_json_chunk,
+                                     "Content-type: application/json");
+  hdr_json_chunk = curl_slist_append(hdr_json_chunk, "Expect:");
 
   /***************************************************************************/
   /* set our custom set of headers.                                         */
@@ -385,6 +461,34 @@ EVEL_ERR_CODES event_handler_run()
 
   EVEL_ENTER();
 
+  /***************************************************************************/
+  /* If streaming, start the stream encoder thread first so it is ready for  */
+  /* the first event.                                                        */
+  /***************************************************************************/
+  if (evel_stream_events)
+  {
+    rc = evel_json_stream_initialize(&event_stream);
+    if (rc != EVEL_SUCCESS)
+    {
+      goto exit_label;
+    }
+  }
+
+  /***************************************************************************/
+  /* Likewise start any encoder threads, which begin reading the ring-buffer */
+  /* straight away.                                                          */
+  /***************************************************************************/
+  if (evel_encoder_threads > 0)
+  {
+    rc = evel_encoder_pool_initialize(&encoder_pool,
+                                      &event_buffer,
+                                      evel_encoder_threads);
+    if (rc != EVEL_SUCCESS)
+    {
+      goto exit_label;
+    }
+  }
+
   /***************************************************************************/
   /* Start the event handler thread.                                         */
   /***************************************************************************/
@@ -397,6 +501,7 @@ EVEL_ERR_CODES event_handler_run()
                     "Error code=%d", pthread_rc);
   }
 
+exit_label:
   EVEL_EXIT()
   return rc;
 }
@@ -418,6 +523,7 @@ EVEL_ERR_CODES event_handler_run()
 EVEL_ERR_CODES event_handler_terminate()
 {
   EVEL_ERR_CODES rc = EVEL_SUCCESS;
+  EVEL_ERR_CODES post_rc;
 
   EVEL_ENTER();
   EVENT_INTERNAL *event = NULL;
@@ -449,9 +555,40 @@ EVEL_ERR_CODES event_handler_terminate()
       /***********************************************************************/
       EVEL_DEBUG("Sending event to Event Hander to request it to exit.");
       evt_handler_state = EVT_HANDLER_REQUEST_TERMINATE;
-      evel_post_event((EVENT_HEADER *) event);
+      post_rc = evel_post_event((EVENT_HEADER *) event);
+
+      /***********************************************************************/
+      /* Encoder threads only stop when they read the event, so if there are */
+      /* any then keep trying while the Event Handler empties the buffer.    */
+      /***********************************************************************/
+      while ((post_rc == EVEL_EVENT_BUFFER_FULL) && (evel_encoder_threads > 0))
+      {
+        usleep(1000);
+        event = evel_new_internal_event(EVT_CMD_TERMINATE,
+                                        "EVELinternal",
+                                        "EVELid");
+        post_rc = (event == NULL) ? EVEL_OUT_OF_MEMORY :
+                                    evel_post_event((EVENT_HEADER *) event);
+      }
       pthread_join(evt_handler_thread, NULL);
       EVEL_DEBUG("Event Handler thread has exited.");
+
+      /***********************************************************************/
+      /* The encoder threads exit once the terminate event has passed them.  */
+      /***********************************************************************/
+      if (evel_encoder_threads > 0)
+      {
+        evel_encoder_pool_terminate(&encoder_pool);
+        EVEL_DEBUG("Encoder threads have exited.");
+      }
+    }
+
+    /*************************************************************************/
+    /* Stop the stream encoder thread too, now nothing else can use it.      */
+    /*************************************************************************/
+    if (evel_stream_events)
+    {
+      evel_json_stream_terminate(&event_stream);
     }
   }
   else
@@ -472,6 +609,16 @@ EVEL_ERR_CODES event_handler_terminate()
     curl_slist_free_all(hdr_chunk);
     hdr_chunk = NULL;
   }
+  if (hdr_stream_chunk != NULL)
+  {
+    curl_slist_free_all(hdr_stream_chunk);
+    hdr_stream_chunk = NULL;
+  }
+  if (hdr_json_chunk != NULL)
+  {
+    curl_slist_free_all(hdr_json_chunk);
+    hdr_json_chunk = NULL;
+  }
 
   /***************************************************************************/
   /* Free off the stored API URL strings.                                    */
@@ -491,6 +638,153 @@ EVEL_ERR_CODES event_handler_terminate()
   return rc;
 }
 
+/**************************************************************************//**
+ * Enable or disable streaming of events to the API.
+ *
+ * @param enable        Whether to stream events.
+ *****************************************************************************/
+void evel_set_streaming(const bool enable)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* The stream encoder thread is started with the event handler, so this    */
+  /* can only be changed before the library is initialized.                  */
+  /***************************************************************************/
+  if (evt_handler_state == EVT_HANDLER_UNINITIALIZED)
+  {
+    evel_stream_events = enable;
+  }
+  else
+  {
+    EVEL_ERROR("Streaming can only be changed before initialization");
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Enable or disable encoding of events in the threads which post them.
+ *
+ * @param enable        Whether to encode events when they are posted.
+ *****************************************************************************/
+void evel_set_producer_encoding(const bool enable)
+{
+  EVEL_ENTER();
+
+  if (evt_handler_state == EVT_HANDLER_UNINITIALIZED)
+  {
+    evel_producer_encoding = enable;
+  }
+  else
+  {
+    EVEL_ERROR("Producer encoding can only be changed before initialization");
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the number of threads used to encode events before they are sent.
+ *
+ * @param threads       The number of encoder threads, or 0 for none.
+ *****************************************************************************/
+void evel_set_encoder_threads(const int threads)
+{
+  EVEL_ENTER();
+
+  if (threads < 0)
+  {
+    EVEL_ERROR("Invalid number of encoder threads: %d", threads);
+  }
+  else if (evt_handler_state == EVT_HANDLER_UNINITIALIZED)
+  {
+    evel_encoder_threads = threads;
+  }
+  else
+  {
+    EVEL_ERROR("Encoder threads can only be changed before initialization");
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the encoding in which events are sent to the API.
+ *
+ * @param encoding      The encoding to use.
+ *****************************************************************************/
+void evel_set_encoding(const EVEL_ENCODINGS encoding)
+{
+  EVEL_ENTER();
+
+  if ((encoding < 0) || (encoding >= EVEL_MAX_ENCODINGS))
+  {
+    EVEL_ERROR("Invalid encoding: %d", encoding);
+  }
+  else if (evt_handler_state == EVT_HANDLER_UNINITIALIZED)
+  {
+    event_encoding = encoding;
+  }
+  else
+  {
+    EVEL_ERROR("Encoding can only be changed before initialization");
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Encode an event, ready for the event handler to send.
+ *
+ * @note  The event is freed, whether or not it is successfully encoded.
+ *
+ * @param event   The event to be encoded.
+ *
+ * @returns Pointer to the ::EVENT_INTERNAL carrying the encoded event.
+ * @retval  NULL  Failed to allocate memory for the encoded event.
+ *****************************************************************************/
+EVENT_HEADER * evel_encode_posted_event(EVENT_HEADER * event)
+{
+  EVENT_INTERNAL * encoded = NULL;
+  char * json_body = NULL;
+  int json_size;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Encode the event just once, so that it is never truncated, into a       */
+  /* buffer which, since it may sit in the ring-buffer a while, is no bigger */
+  /* than it need be.                                                        */
+  /***************************************************************************/
+  json_body = evel_json_encode_event_copy(event, &json_size);
+  if (json_body == NULL)
+  {
+    log_error_state("Out of memory encoding event - event dropped!");
+    goto exit_label;
+  }
+
+  encoded = evel_new_encoded_internal_event(json_body,
+                                            json_size,
+                                            event->event_id);
+  if (encoded == NULL)
+  {
+    free(json_body);
+  }
+  else if (event->memory_charged > 0)
+  {
+    /*************************************************************************/
+    /* The event was already queued, so its encoding takes over its charge.  */
+    /*************************************************************************/
+    evel_memory_charge(&encoded->header, event->memory_domain, false);
+  }
+
+exit_label:
+  evel_free_event(event);
+  EVEL_EXIT();
+  return (encoded == NULL) ? NULL : &encoded->header;
+}
+
 /**************************************************************************//**
  * Post an event.
  *
@@ -507,6 +801,7 @@ EVEL_ERR_CODES event_handler_terminate()
 EVEL_ERR_CODES evel_post_event(EVENT_HEADER * event)
 {
   int rc = EVEL_SUCCESS;
+  EVEL_EVENT_DOMAINS domain;
 
   EVEL_ENTER();
 
@@ -515,6 +810,32 @@ EVEL_ERR_CODES evel_post_event(EVENT_HEADER * event)
   /***************************************************************************/
   assert(event != NULL);
 
+  /***************************************************************************/
+  /* Memory is charged to the domain of the event, or for events already     */
+  /* encoded the domain they were encoded from.  Only the library's own      */
+  /* commands are charged to the internal domain, and they are never limited.*/
+  /***************************************************************************/
+  domain = (event->event_domain == EVEL_DOMAIN_INTERNAL) ?
+                                   event->memory_domain : event->event_domain;
+
+  /***************************************************************************/
+  /* Encode the event here if asked to, so that encoding work is spread over */
+  /* the posting threads.  What gets queued is then just the JSON.           */
+  /***************************************************************************/
+  if (evel_producer_encoding &&
+      (event->event_domain != EVEL_DOMAIN_INTERNAL) &&
+      ((evt_handler_state == EVT_HANDLER_ACTIVE) ||
+       (evt_handler_state == EVT_HANDLER_INACTIVE) ||
+       (evt_handler_state == EVT_HANDLER_REQUEST_TERMINATE)))
+  {
+    event = evel_encode_posted_event(event);
+    if (event == NULL)
+    {
+      rc = EVEL_OUT_OF_MEMORY;
+      goto exit_label;
+    }
+  }
+
   /***************************************************************************/
   /* We need to make sure that we are either initializing or running         */
   /* normally before writing the event into the buffer so that we can        */
@@ -524,7 +845,13 @@ EVEL_ERR_CODES evel_post_event(EVENT_HEADER * event)
       (evt_handler_state == EVT_HANDLER_INACTIVE) ||
       (evt_handler_state == EVT_HANDLER_REQUEST_TERMINATE))
   {
-    if (ring_buffer_write(&event_buffer, event) == 0)
+    if (!evel_memory_charge(event, domain, (domain != EVEL_DOMAIN_INTERNAL)))
+    {
+      log_error_state("Memory limit reached - event dropped!");
+      rc = EVEL_MEMORY_LIMIT_REACHED;
+      evel_free_event(event);
+    }
+    else if (ring_buffer_write(&event_buffer, event) == 0)
     {
       log_error_state("Failed to write event to buffer - event dropped!");
       rc = EVEL_EVENT_BUFFER_FULL;
@@ -541,6 +868,7 @@ EVEL_ERR_CODES evel_post_event(EVENT_HEADER * event)
     evel_free_event(event);
   }
 
+exit_label:
   EVEL_EXIT();
   return (rc);
 }
@@ -548,16 +876,96 @@ EVEL_ERR_CODES evel_post_event(EVENT_HEADER * event)
 /**************************************************************************//**
  * Post an event to the Vendor Event Listener API.
  *
+ * @param msg           The body of the post.
+ * @param size          The size of the body.
+ * @param headers       The headers to send, giving the body's content type.
+ * @param description   Description of the post for logs.
+ *
  * @returns Status code
  * @retval  EVEL_SUCCESS On success
  * @retval  "One of ::EVEL_ERR_CODES" On failure.
  *****************************************************************************/
-static EVEL_ERR_CODES evel_post_api(char * msg, size_t size)
+static EVEL_ERR_CODES evel_post_api(char * msg,
+                                    size_t size,
+                                    struct curl_slist * headers,
+                                    const char * const description)
+{
+  EVEL_ERR_CODES rc = EVEL_SUCCESS;
+  MEMORY_CHUNK tx_chunk;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Create the memory chunk to be sent as the body of the post.             */
+  /***************************************************************************/
+  tx_chunk.memory = msg;
+  tx_chunk.size = size;
+  EVEL_DEBUG("Sending chunk of size %d", tx_chunk.size);
+
+  rc = evel_post_api_transfer(read_callback,
+                              &tx_chunk,
+                              size,
+                              headers,
+                              description);
+
+  EVEL_EXIT();
+  return rc;
+}
+
+/**************************************************************************//**
+ * Stream an event to the Vendor Event Listener API, encoding it as it goes.
+ *
+ * @param event   The event to be posted.
+ *
+ * @returns Status code
+ * @retval  EVEL_SUCCESS On success
+ * @retval  "One of ::EVEL_ERR_CODES" On failure.
+ *****************************************************************************/
+static EVEL_ERR_CODES evel_post_api_stream(EVENT_HEADER * event)
+{
+  EVEL_ERR_CODES rc = EVEL_SUCCESS;
+
+  EVEL_ENTER();
+
+  evel_json_stream_start(&event_stream, event);
+  rc = evel_post_api_transfer(stream_read_callback,
+                              &event_stream,
+                              -1,
+                              hdr_stream_chunk,
+                              event->event_id);
+  evel_json_stream_finish(&event_stream);
+
+  EVEL_EXIT();
+  return rc;
+}
+
+/**************************************************************************//**
+ * Transfer a post to the API, reading the body through a cURL read callback.
+ *
+ * @param read_function The cURL read callback supplying the body.
+ * @param read_data     The data to pass to the read callback.
+ * @param size          The size of the body, or -1 if not known, in which
+ *                      case it is sent with chunked transfer encoding.
+ * @param headers       The headers to send, which must ask for chunked
+ *                      transfer encoding if the size is not known.
+ * @param description   Description of the post for logs.
+ *
+ * @returns Status code
+ * @retval  EVEL_SUCCESS On success
+ * @retval  "One of ::EVEL_ERR_CODES" On failure.
+ *****************************************************************************/
+static EVEL_ERR_CODES evel_post_api_transfer(size_t (*read_function)(void *,
+                                                                     size_t,
+                                                                     size_t,
+                                                                     void *),
+                                             void * read_data,
+                                             long size,
+                                             struct curl_slist * headers,
+                                             const char * const description)
 {
   int rc = EVEL_SUCCESS;
   CURLcode curl_rc = CURLE_OK;
   MEMORY_CHUNK rx_chunk;
-  MEMORY_CHUNK tx_chunk;
   int http_response_code = 0;
 
   EVEL_ENTER();
@@ -570,13 +978,6 @@ static EVEL_ERR_CODES evel_post_api(char * msg, size_t size)
   assert(rx_chunk.memory != NULL);
   rx_chunk.size = 0;
 
-  /***************************************************************************/
-  /* Create the memory chunk to be sent as the body of the post.             */
-  /***************************************************************************/
-  tx_chunk.memory = msg;
-  tx_chunk.size = size;
-  EVEL_DEBUG("Sending chunk of size %d", tx_chunk.size);
-
   /***************************************************************************/
   /* Point to the data to be received.                                       */
   /***************************************************************************/
@@ -591,9 +992,17 @@ static EVEL_ERR_CODES evel_post_api(char * msg, size_t size)
   EVEL_DEBUG("Initialized data to receive");
 
   /***************************************************************************/
-  /* Pointer to pass to our read function                                    */
+  /* The read function and pointer to pass to it.                            */
   /***************************************************************************/
-  curl_rc = curl_easy_setopt(curl_handle, CURLOPT_READDATA, &tx_chunk);
+  curl_rc = curl_easy_setopt(curl_handle, CURLOPT_READFUNCTION, read_function);
+  if (curl_rc != CURLE_OK)
+  {
+    rc = EVEL_CURL_LIBRARY_FAIL;
+    log_error_state("Failed to set read function for libCURL to upload. "
+                    "Error code=%d (%s)", curl_rc, curl_err_string);
+    goto exit_label;
+  }
+  curl_rc = curl_easy_setopt(curl_handle, CURLOPT_READDATA, read_data);
   if (curl_rc != CURLE_OK)
   {
     rc = EVEL_CURL_LIBRARY_FAIL;
@@ -604,11 +1013,9 @@ static EVEL_ERR_CODES evel_post_api(char * msg, size_t size)
   EVEL_DEBUG("Initialized data to send");
 
   /***************************************************************************/
-  /* Size of the data to transmit.                                           */
+  /* Size of the data to transmit, and the matching headers.                 */
   /***************************************************************************/
-  curl_rc = curl_easy_setopt(curl_handle,
-                             CURLOPT_POSTFIELDSIZE,
-                             tx_chunk.size);
+  curl_rc = curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDSIZE, size);
   if (curl_rc != CURLE_OK)
   {
     rc = EVEL_CURL_LIBRARY_FAIL;
@@ -616,6 +1023,14 @@ static EVEL_ERR_CODES evel_post_api(char * msg, size_t size)
                     "upload.  Error code=%d (%s)", curl_rc, curl_err_string);
     goto exit_label;
   }
+  curl_rc = curl_easy_setopt(curl_handle, CURLOPT_HTTPHEADER, headers);
+  if (curl_rc != CURLE_OK)
+  {
+    rc = EVEL_CURL_LIBRARY_FAIL;
+    log_error_state("Failed to set headers for libCURL to upload. "
+                    "Error code=%d (%s)", curl_rc, curl_err_string);
+    goto exit_label;
+  }
   EVEL_DEBUG("Initialized length of data to send");
 
   /***************************************************************************/
@@ -627,7 +1042,7 @@ static EVEL_ERR_CODES evel_post_api(char * msg, size_t size)
     rc = EVEL_CURL_LIBRARY_FAIL;
     log_error_state("Failed to transfer an event to Vendor Event Listener! "
                     "Error code=%d (%s)", curl_rc, curl_err_string);
-    EVEL_ERROR("Dropped event: %s", msg);
+    EVEL_ERROR("Dropped event: %s", description);
     goto exit_label;
   }
 
@@ -667,7 +1082,7 @@ static EVEL_ERR_CODES evel_post_api(char * msg, size_t size)
                 http_response_code,
                 rx_chunk.size,
                 rx_chunk.size > 0 ? rx_chunk.memory : "NONE");
-    EVEL_ERROR("Potentially dropped event: %s", msg);
+    EVEL_ERROR("Potentially dropped event: %s", description);
   }
 
 exit_label:
@@ -697,7 +1112,7 @@ static size_t read_callback(void *ptr, size_t size, size_t nmemb, void *userp)
   if (bytes_to_write > 0)
   {
     EVEL_DEBUG("Going to try to write %d bytes", bytes_to_write);
-    strncpy((char *)ptr, tx_chunk->memory, bytes_to_write);
+    memcpy(ptr, tx_chunk->memory, bytes_to_write);
     tx_chunk->memory += bytes_to_write;
     tx_chunk->size -= bytes_to_write;
     rtn = bytes_to_write;
@@ -711,6 +1126,24 @@ static size_t read_callback(void *ptr, size_t size, size_t nmemb, void *userp)
   return rtn;
 }
 
+/**************************************************************************//**
+ * Callback function to provide streamed data to send.
+ *
+ * Copy the next piece of the event being encoded into the supplied buffer,
+ * stream_read_callback::ptr, waiting for the encoder if necessary.
+ *
+ * @returns   Number of bytes placed into stream_read_callback::ptr. 0 for EOF.
+ *****************************************************************************/
+static size_t stream_read_callback(void *ptr,
+                                   size_t size,
+                                   size_t nmemb,
+                                   void *userp)
+{
+  return evel_json_stream_read((EVEL_JSON_STREAM *) userp,
+                               (char *) ptr,
+                               size * nmemb);
+}
+
 /**************************************************************************//**
  * Callback function to provide returned data.
  *
@@ -767,6 +1200,7 @@ static void * event_handler(void * arg __attribute__ ((unused)))
   char json_body[EVEL_MAX_JSON_BODY];
   int rc = EVEL_SUCCESS;
   CURLcode curl_rc;
+  bool terminate_received = false;
 
   EVEL_INFO("Event handler thread started");
 
@@ -796,7 +1230,14 @@ static void * event_handler(void * arg __attribute__ ((unused)))
     /* Wait for a message to be received.                                    */
     /*************************************************************************/
     EVEL_DEBUG("Event handler getting any messages");
-    msg = ring_buffer_read(&event_buffer);
+    if (evel_encoder_threads > 0)
+    {
+      msg = evel_encoder_pool_read(&encoder_pool);
+    }
+    else
+    {
+      msg = ring_buffer_read(&event_buffer);
+    }
 
     /*************************************************************************/
     /* Internal events get special treatment while regular events get posted */
@@ -806,16 +1247,36 @@ static void * event_handler(void * arg __attribute__ ((unused)))
     {
       EVEL_DEBUG("External event received");
 
-      /***********************************************************************/
-      /* Encode the event in JSON.                                           */
-      /***********************************************************************/
-      json_size = evel_json_encode_event(json_body, EVEL_MAX_JSON_BODY, msg);
+      if (evel_stream_events)
+      {
+        /*********************************************************************/
+        /* Encode the event in JSON as it is sent across the API.            */
+        /*********************************************************************/
+        EVEL_DEBUG("Streaming event %s", msg->event_id);
+        rc = evel_post_api_stream(msg);
+      }
+      else
+      {
+        /*********************************************************************/
+        /* Encode the event in JSON.                                         */
+        /*********************************************************************/
+        json_size = evel_json_encode_event(json_body, EVEL_MAX_JSON_BODY, msg);
 
-      /***********************************************************************/
-      /* Send the JSON across the API.                                       */
-      /***********************************************************************/
-      EVEL_DEBUG("Sending JSON of size %d is: %s", json_size, json_body);
-      rc = evel_post_api(json_body, json_size);
+        /*********************************************************************/
+        /* Send the JSON across the API.  Other encodings are binary, so are */
+        /* described by the event's ID instead.                              */
+        /*********************************************************************/
+        if (event_encoding == EVEL_ENCODING_JSON)
+        {
+          EVEL_DEBUG("Sending JSON of size %d is: %s", json_size, json_body);
+          rc = evel_post_api(json_body, json_size, hdr_chunk, json_body);
+        }
+        else
+        {
+          EVEL_DEBUG("Sending event %s of size %d", msg->event_id, json_size);
+          rc = evel_post_api(json_body, json_size, hdr_chunk, msg->event_id);
+        }
+      }
       if (rc != EVEL_SUCCESS)
       {
         EVEL_ERROR("Failed to transfer the data. Error code=%d", rc);
@@ -825,8 +1286,31 @@ static void * event_handler(void * arg __attribute__ ((unused)))
     {
       EVEL_DEBUG("Internal event received");
       internal_msg = (EVENT_INTERNAL *) msg;
-      assert(internal_msg->command == EVT_CMD_TERMINATE);
-      evt_handler_state = EVT_HANDLER_TERMINATING;
+      switch (internal_msg->command)
+      {
+        case EVT_CMD_POST_ENCODED:
+          /*******************************************************************/
+          /* Already encoded by the thread which posted it, so just send it. */
+          /*******************************************************************/
+          EVEL_DEBUG("Sending pre-encoded event %s of size %d",
+                     internal_msg->header.event_id,
+                     internal_msg->encoded.size);
+          rc = evel_post_api(internal_msg->encoded.memory,
+                             internal_msg->encoded.size,
+                             hdr_chunk,
+                             internal_msg->header.event_id);
+          if (rc != EVEL_SUCCESS)
+          {
+            EVEL_ERROR("Failed to transfer the data. Error code=%d", rc);
+          }
+          break;
+
+        default:
+          assert(internal_msg->command == EVT_CMD_TERMINATE);
+          evt_handler_state = EVT_HANDLER_TERMINATING;
+          terminate_received = true;
+          break;
+      }
     }
 
     /*************************************************************************/
@@ -856,7 +1340,10 @@ static void * event_handler(void * arg __attribute__ ((unused)))
       }
       else
       {
-        rc = evel_post_api(priority_post.memory, priority_post.size);
+        rc = evel_post_api(priority_post.memory,
+                           priority_post.size,
+                           hdr_json_chunk,
+                           priority_post.memory);
         if (rc != EVEL_SUCCESS)
         {
           EVEL_ERROR("Failed to transfer priority post. Error code=%d", rc);
@@ -882,6 +1369,11 @@ static void * event_handler(void * arg __attribute__ ((unused)))
       free(priority_post.memory);
       priority_post.memory = NULL;
     }
+
+    /*************************************************************************/
+    /* Report any errors held back by rate limits whose intervals are over.  */
+    /*************************************************************************/
+    log_limit_flush(false);
   }
 
   /***************************************************************************/
@@ -891,6 +1383,22 @@ static void * event_handler(void * arg __attribute__ ((unused)))
   /* sending events in so we know that this process will conclude!           */
   /***************************************************************************/
   evt_handler_state = EVT_HANDLER_TERMINATING;
+
+  /***************************************************************************/
+  /* Any encoder threads are still reading the ring-buffer until they get    */
+  /* the terminate event, so deplete what they have first.                   */
+  /***************************************************************************/
+  while ((evel_encoder_threads > 0) && (!terminate_received))
+  {
+    EVEL_DEBUG("Reading event from encoder threads");
+    msg = evel_encoder_pool_read(&encoder_pool);
+    if (msg->event_domain == EVEL_DOMAIN_INTERNAL)
+    {
+      internal_msg = (EVENT_INTERNAL *) msg;
+      terminate_received = (internal_msg->command == EVT_CMD_TERMINATE);
+    }
+    evel_free_event(msg);
+  }
   while (!ring_buffer_is_empty(&event_buffer))
   {
     EVEL_DEBUG("Reading event from buffer");
@@ -0,0 +1,371 @@
+/**************************************************************************//**
+ * @file
+ * Pools of free event structures, one per domain, so that the structures
+ * freed as events are sent are reused for new events rather than going back
+ * through the allocator each time.
+ *
+ * License
+ * -------
+ *
+ * Copyright(c) <2016>, AT&T Intellectual Property.  All other rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:  This product includes
+ *    software developed by the AT&T.
+ * 4. Neither the name of AT&T nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific
+ *    prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AT&T INTELLECTUAL PROPERTY ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AT&T INTELLECTUAL PROPERTY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "evel.h"
+#include "evel_internal.h"
+
+/*****************************************************************************/
+/* Number of free structures each thread keeps for each domain.              */
+/*****************************************************************************/
+#define EVEL_POOL_CACHE_SIZE 32
+
+/*****************************************************************************/
+/* Number of free structures moved between a thread's cache and the shared   */
+/* pool at once.                                                             */
+/*****************************************************************************/
+#define EVEL_POOL_BATCH_SIZE (EVEL_POOL_CACHE_SIZE / 2)
+
+/*****************************************************************************/
+/* Most free structures kept in the shared pool for each domain, beyond      */
+/* which they are freed.                                                     */
+/*****************************************************************************/
+#define EVEL_POOL_MAX_FREE 512
+
+/**************************************************************************//**
+ * A free structure in the shared pool, which links to the next.  Free
+ * structures are kept zeroed apart from this link.
+ *****************************************************************************/
+typedef struct evel_pool_free {
+  struct evel_pool_free * next;
+} EVEL_POOL_FREE;
+
+/**************************************************************************//**
+ * The shared pool of free structures for a domain.
+ *****************************************************************************/
+typedef struct evel_pool {
+  pthread_mutex_t mutex;
+  EVEL_POOL_FREE * free;
+  int count;
+} EVEL_POOL;
+
+/**************************************************************************//**
+ * The free structures for a domain kept by a thread.
+ *****************************************************************************/
+typedef struct evel_pool_cache {
+  void * free[EVEL_POOL_CACHE_SIZE];
+  int count;
+} EVEL_POOL_CACHE;
+
+/*****************************************************************************/
+/* The size of the structure for each domain, indexed by                     */
+/* ::EVEL_EVENT_DOMAINS.                                                     */
+/*****************************************************************************/
+static const size_t evel_pool_sizes[EVEL_MAX_DOMAINS] = {
+  [EVEL_DOMAIN_INTERNAL] = sizeof(EVENT_INTERNAL),
+  [EVEL_DOMAIN_HEARTBEAT] = sizeof(EVENT_HEADER),
+  [EVEL_DOMAIN_FAULT] = sizeof(EVENT_FAULT),
+  [EVEL_DOMAIN_MEASUREMENT] = sizeof(EVENT_MEASUREMENT),
+  [EVEL_DOMAIN_MOBILE_FLOW] = sizeof(EVENT_MOBILE_FLOW),
+  [EVEL_DOMAIN_REPORT] = sizeof(EVENT_REPORT),
+  [EVEL_DOMAIN_HEARTBEAT_FIELD] = sizeof(EVENT_HEARTBEAT_FIELD),
+  [EVEL_DOMAIN_SIPSIGNALING] = sizeof(EVENT_SIGNALING),
+  [EVEL_DOMAIN_STATE_CHANGE] = sizeof(EVENT_STATE_CHANGE),
+  [EVEL_DOMAIN_SYSLOG] = sizeof(EVENT_SYSLOG),
+  [EVEL_DOMAIN_OTHER] = sizeof(EVENT_OTHER),
+  [EVEL_DOMAIN_THRESHOLD_CROSS] = sizeof(EVENT_THRESHOLD_CROSS),
+  [EVEL_DOMAIN_VOICE_QUALITY] = sizeof(EVENT_VOICE_QUALITY),
+};
+
+/*****************************************************************************/
+/* The shared pools, indexed by ::EVEL_EVENT_DOMAINS.                        */
+/*****************************************************************************/
+static EVEL_POOL evel_pools[EVEL_MAX_DOMAINS] = {
+  [0 ... EVEL_MAX_DOMAINS - 1] = { PTHREAD_MUTEX_INITIALIZER, NULL, 0 }
+};
+
+/*****************************************************************************/
+/* Each thread's caches, indexed by ::EVEL_EVENT_DOMAINS, and the key whose  */
+/* destructor returns them to the shared pools when the thread exits.        */
+/*****************************************************************************/
+static __thread EVEL_POOL_CACHE evel_pool_caches[EVEL_MAX_DOMAINS];
+static __thread bool evel_pool_thread_registered = false;
+static __thread bool evel_pool_thread_exited = false;
+static pthread_key_t evel_pool_key;
+static pthread_once_t evel_pool_key_once = PTHREAD_ONCE_INIT;
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void evel_pool_key_create(void);
+static void evel_pool_thread_register(void);
+static void evel_pool_thread_exit(void * arg);
+static void evel_pool_put(const EVEL_EVENT_DOMAINS domain,
+                          EVEL_POOL_CACHE * cache,
+                          const int count);
+
+/**************************************************************************//**
+ * Allocate the structure for a new event.
+ *
+ * The structure comes from the calling thread's cache for the domain if it
+ * can, refilling that from the shared pool if empty.  Only if both are empty
+ * is a new structure allocated.
+ *
+ * The structure is zeroed.  Released structures are zeroed by the thread
+ * freeing them, so this is not done again here.
+ *
+ * @param domain        The domain of the event.
+ * @returns Pointer to the structure, the size of the domain's event.
+ * @retval  NULL  Failed to allocate the structure.
+ *****************************************************************************/
+void * evel_event_alloc(const EVEL_EVENT_DOMAINS domain)
+{
+  EVEL_POOL_CACHE * cache;
+  EVEL_POOL * pool;
+  EVEL_POOL_FREE * structure;
+  void * event;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(domain < EVEL_MAX_DOMAINS);
+
+  cache = &evel_pool_caches[domain];
+  if ((cache->count == 0) && !evel_pool_thread_exited)
+  {
+    pool = &evel_pools[domain];
+    pthread_mutex_lock(&pool->mutex);
+    while ((cache->count < EVEL_POOL_BATCH_SIZE) && (pool->free != NULL))
+    {
+      structure = pool->free;
+      pool->free = structure->next;
+      pool->count--;
+      structure->next = NULL;
+      cache->free[cache->count++] = structure;
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    /*************************************************************************/
+    /* A thread which only allocates must still return what it has cached.  */
+    /*************************************************************************/
+    if (cache->count > 0)
+    {
+      evel_pool_thread_register();
+    }
+  }
+
+  if (cache->count > 0)
+  {
+    event = cache->free[--cache->count];
+  }
+  else
+  {
+    event = calloc(1, evel_pool_sizes[domain]);
+  }
+
+  EVEL_EXIT();
+  return event;
+}
+
+/**************************************************************************//**
+ * Release the structure of a freed event, for reuse.
+ *
+ * The structure goes in the calling thread's cache for the domain, half of
+ * which is moved to the shared pool if full.
+ *
+ * @param domain        The domain of the event.
+ * @param event         Pointer to the structure, whose contents have been
+ *                      freed.
+ *****************************************************************************/
+void evel_event_release(const EVEL_EVENT_DOMAINS domain, void * event)
+{
+  EVEL_POOL_CACHE * cache;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(domain < EVEL_MAX_DOMAINS);
+  assert(event != NULL);
+
+  /***************************************************************************/
+  /* Once a thread's cache has been returned as it exits, it can't have any  */
+  /* more.                                                                   */
+  /***************************************************************************/
+  if (evel_pool_thread_exited)
+  {
+    free(event);
+    goto exit_label;
+  }
+
+  evel_pool_thread_register();
+
+  /***************************************************************************/
+  /* Zero the structure now, off the allocating thread's path.               */
+  /***************************************************************************/
+  memset(event, 0, evel_pool_sizes[domain]);
+
+  cache = &evel_pool_caches[domain];
+  if (cache->count == EVEL_POOL_CACHE_SIZE)
+  {
+    evel_pool_put(domain, cache, EVEL_POOL_BATCH_SIZE);
+  }
+  cache->free[cache->count++] = event;
+
+exit_label:
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Get the size of the structure for a domain's events.
+ *
+ * @param domain        The domain.
+ * @returns The size in bytes.
+ *****************************************************************************/
+size_t evel_event_size(const EVEL_EVENT_DOMAINS domain)
+{
+  assert(domain < EVEL_MAX_DOMAINS);
+
+  return evel_pool_sizes[domain];
+}
+
+/**************************************************************************//**
+ * Free the structures in the shared pools.
+ *
+ * Called from ::evel_terminate.  Structures cached by threads are kept.
+ *****************************************************************************/
+void evel_event_pool_terminate(void)
+{
+  EVEL_POOL * pool;
+  EVEL_POOL_FREE * structure;
+  int domain;
+
+  EVEL_ENTER();
+
+  for (domain = 0; domain < EVEL_MAX_DOMAINS; domain++)
+  {
+    pool = &evel_pools[domain];
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->free != NULL)
+    {
+      structure = pool->free;
+      pool->free = structure->next;
+      free(structure);
+    }
+    pool->count = 0;
+    pthread_mutex_unlock(&pool->mutex);
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Create the key whose destructor returns a thread's caches.
+ *****************************************************************************/
+static void evel_pool_key_create(void)
+{
+  pthread_key_create(&evel_pool_key, evel_pool_thread_exit);
+}
+
+/**************************************************************************//**
+ * Make sure the calling thread's caches are returned to the shared pools
+ * when it exits.
+ *****************************************************************************/
+static void evel_pool_thread_register(void)
+{
+  if (!evel_pool_thread_registered)
+  {
+    pthread_once(&evel_pool_key_once, evel_pool_key_create);
+    pthread_setspecific(evel_pool_key, evel_pool_caches);
+    evel_pool_thread_registered = true;
+  }
+}
+
+/**************************************************************************//**
+ * Return a thread's caches to the shared pools as the thread exits.
+ *
+ * @param arg           Not used.
+ *****************************************************************************/
+static void evel_pool_thread_exit(void * arg)
+{
+  int domain;
+
+  (void) arg;
+
+  evel_pool_thread_exited = true;
+  for (domain = 0; domain < EVEL_MAX_DOMAINS; domain++)
+  {
+    evel_pool_put(domain,
+                  &evel_pool_caches[domain],
+                  evel_pool_caches[domain].count);
+  }
+}
+
+/**************************************************************************//**
+ * Move structures from a thread's cache to the shared pool, freeing any for
+ * which the pool has no room.
+ *
+ * @param domain        The domain of the cache.
+ * @param cache         Pointer to the ::EVEL_POOL_CACHE.
+ * @param count         The number of structures to move.
+ *****************************************************************************/
+static void evel_pool_put(const EVEL_EVENT_DOMAINS domain,
+                          EVEL_POOL_CACHE * cache,
+                          const int count)
+{
+  EVEL_POOL * pool = &evel_pools[domain];
+  EVEL_POOL_FREE * structure;
+  int index;
+
+  assert(count <= cache->count);
+
+  pthread_mutex_lock(&pool->mutex);
+  for (index = 0; index < count; index++)
+  {
+    structure = cache->free[--cache->count];
+    if (pool->count < EVEL_POOL_MAX_FREE)
+    {
+      structure->next = pool->free;
+      pool->free = structure;
+      pool->count++;
+    }
+    else
+    {
+      free(structure);
+    }
+  }
+  pthread_mutex_unlock(&pool->mutex);
+}
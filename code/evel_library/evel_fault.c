@@ -42,6 +42,13 @@
 #include "evel_internal.h"
 #include "evel_throttle.h"
 
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void evel_fault_addl_info_push(EVENT_FAULT * fault,
+                                      char * name,
+                                      char * value);
+
 /**************************************************************************//**
  * Create a new fault event.
  *
@@ -85,13 +92,13 @@ EVENT_FAULT * evel_new_fault(const char * ev_name,
   /***************************************************************************/
   /* Allocate the fault.                                                     */
   /***************************************************************************/
-  fault = malloc(sizeof(EVENT_FAULT));
+  fault = evel_event_alloc(EVEL_DOMAIN_FAULT);
   if (fault == NULL)
   {
     log_error_state("Out of memory");
     goto exit_label;
   }
-  memset(fault, 0, sizeof(EVENT_FAULT));
+  fault->header.arena = evel_new_event_arena();
   EVEL_DEBUG("New fault is at %lp", fault);
 
   /***************************************************************************/
@@ -106,8 +113,9 @@ EVENT_FAULT * evel_new_fault(const char * ev_name,
   fault->event_severity = severity;
   fault->event_source_type = ev_source_type;
   fault->vf_status = status;
-  fault->alarm_condition = strdup(condition);
-  fault->specific_problem = strdup(specific_problem);
+  fault->alarm_condition = evel_arena_strdup(fault->header.arena, condition);
+  fault->specific_problem = evel_arena_strdup(fault->header.arena,
+                                              specific_problem);
   evel_init_option_string(&fault->category);
   evel_init_option_string(&fault->alarm_interface_a);
   dlist_initialize(&fault->additional_info);
@@ -117,6 +125,37 @@ exit_label:
   return fault;
 }
 
+/**************************************************************************//**
+ * Create a new Fault event from a prototype.
+ *
+ * @param prototype   Pointer to the ::EVEL_PROTOTYPE, made from a Fault.
+ * @param ev_id       The eventId of the new event.  The caller does not need
+ *                    to preserve the value once the function returns.
+ *
+ * @returns pointer to the newly manufactured ::EVENT_FAULT.  If the event is
+ *          not used (i.e. posted) it must be released using ::evel_free_event.
+ * @retval  NULL  Failed to create the event.
+ *****************************************************************************/
+EVENT_FAULT * evel_new_fault_from_prototype(EVEL_PROTOTYPE * prototype,
+                                            const char * const ev_id)
+{
+  EVENT_FAULT * fault = NULL;
+  EVEL_ENTER();
+
+  fault = (EVENT_FAULT *) evel_new_event_from_prototype(prototype,
+                                                        EVEL_DOMAIN_FAULT,
+                                                        sizeof(EVENT_FAULT),
+                                                        ev_id);
+  if (fault != NULL)
+  {
+    EVEL_DEBUG("New fault from prototype is at %lp", fault);
+    dlist_share_slots(&fault->additional_info);
+  }
+
+  EVEL_EXIT();
+  return fault;
+}
+
 /**************************************************************************//**
  * Add an additional value name/value pair to the Fault.
  *
@@ -134,29 +173,81 @@ exit_label:
  *****************************************************************************/
 void evel_fault_addl_info_add(EVENT_FAULT * fault, char * name, char * value)
 {
-  FAULT_ADDL_INFO * addl_info = NULL;
   EVEL_ENTER();
 
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(fault != NULL);
+  assert(name != NULL);
+  assert(value != NULL);
+
+  evel_fault_addl_info_push(fault,
+                            evel_arena_strdup(fault->header.arena, name),
+                            evel_arena_strdup(fault->header.arena, value));
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Add an additional value name/value pair to the Fault, without copying it.
+ *
+ * @param fault     Pointer to the fault.
+ * @param name      ASCIIZ string with the attribute's name, allocated with
+ *                  malloc.  The Fault takes ownership of it, so the caller
+ *                  must not use or free it after the function returns.
+ * @param value     ASCIIZ string with the attribute's value, allocated with
+ *                  malloc.  The Fault takes ownership of it, as for name.
+ *****************************************************************************/
+void evel_fault_addl_info_add_take(EVENT_FAULT * fault,
+                                   char * name,
+                                   char * value)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(fault != NULL);
+  assert(fault->header.event_domain == EVEL_DOMAIN_FAULT);
+  assert(name != NULL);
+  assert(value != NULL);
+
+  evel_fault_addl_info_push(fault,
+                            evel_arena_take_string(fault->header.arena, name),
+                            evel_arena_take_string(fault->header.arena, value));
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Push an additional value name/value pair, whose strings the Fault already
+ * owns, onto the Fault.
+ *
+ * @param fault     Pointer to the fault.
+ * @param name      ASCIIZ string with the attribute's name.
+ * @param value     ASCIIZ string with the attribute's value.
+ *****************************************************************************/
+static void evel_fault_addl_info_push(EVENT_FAULT * fault,
+                                      char * name,
+                                      char * value)
+{
+  FAULT_ADDL_INFO * addl_info = NULL;
+
   assert(fault->header.event_domain == EVEL_DOMAIN_FAULT);
   assert(name != NULL);
   assert(value != NULL);
 
   EVEL_DEBUG("Adding name=%s value=%s", name, value);
-  addl_info = malloc(sizeof(FAULT_ADDL_INFO));
+  addl_info = evel_arena_alloc(fault->header.arena, sizeof(FAULT_ADDL_INFO));
   assert(addl_info != NULL);
   memset(addl_info, 0, sizeof(FAULT_ADDL_INFO));
-  addl_info->name = strdup(name);
-  addl_info->value = strdup(value);
-  assert(addl_info->name != NULL);
-  assert(addl_info->value != NULL);
-
-  dlist_push_last(&fault->additional_info, addl_info);
+  addl_info->name = name;
+  addl_info->value = value;
 
-  EVEL_EXIT();
+  evel_arena_list_push(fault->header.arena,
+                       &fault->additional_info,
+                       addl_info);
 }
 
 /**************************************************************************//**
@@ -184,9 +275,43 @@ void evel_fault_category_set(EVENT_FAULT * fault,
   assert(fault->header.event_domain == EVEL_DOMAIN_FAULT);
   assert(category != NULL);
 
-  evel_set_option_string(&fault->category,
-                         category,
-                         "Fault Category set");
+  evel_uninherit_option_string(&fault->header, &fault->category);
+  evel_arena_set_option_string(fault->header.arena,
+                               &fault->category,
+                               category,
+                               "Fault Category set");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Fault Category property of the Fault, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param fault      Pointer to the fault.
+ * @param category   The Fault Category to be set.  ASCIIZ string allocated
+ *                   with malloc.  The Fault takes ownership of it, so the
+ *                   caller must not use or free it after the function
+ *                   returns.
+ *****************************************************************************/
+void evel_fault_category_set_take(EVENT_FAULT * fault, char * const category)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(fault != NULL);
+  assert(fault->header.event_domain == EVEL_DOMAIN_FAULT);
+  assert(category != NULL);
+
+  evel_uninherit_option_string(&fault->header, &fault->category);
+  evel_arena_take_option_string(fault->header.arena,
+                                &fault->category,
+                                category,
+                                "Fault Category set");
   EVEL_EXIT();
 }
 
@@ -214,9 +339,43 @@ void evel_fault_interface_set(EVENT_FAULT * fault,
   assert(fault->header.event_domain == EVEL_DOMAIN_FAULT);
   assert(interface != NULL);
 
-  evel_set_option_string(&fault->alarm_interface_a,
-                         interface,
-                         "Alarm Interface A");
+  evel_uninherit_option_string(&fault->header, &fault->alarm_interface_a);
+  evel_arena_set_option_string(fault->header.arena,
+                               &fault->alarm_interface_a,
+                               interface,
+                               "Alarm Interface A");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Alarm Interface A property of the Fault, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param fault      Pointer to the fault.
+ * @param interface  The Alarm Interface A to be set.  ASCIIZ string allocated
+ *                   with malloc.  The Fault takes ownership of it, so the
+ *                   caller must not use or free it after the function
+ *                   returns.
+ *****************************************************************************/
+void evel_fault_interface_set_take(EVENT_FAULT * fault, char * const interface)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(fault != NULL);
+  assert(fault->header.event_domain == EVEL_DOMAIN_FAULT);
+  assert(interface != NULL);
+
+  evel_uninherit_option_string(&fault->header, &fault->alarm_interface_a);
+  evel_arena_take_option_string(fault->header.arena,
+                                &fault->alarm_interface_a,
+                                interface,
+                                "Alarm Interface A");
   EVEL_EXIT();
 }
 
@@ -274,32 +433,28 @@ void evel_json_encode_fault(EVEL_JSON_BUFFER * jbuf,
   fault_vf_status = evel_vf_status(event->vf_status);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "faultFields");
+  evel_json_open_named_object(jbuf, EVEL_KEY_FAULT_FIELDS);
 
   /***************************************************************************/
   /* Mandatory fields.                                                       */
   /***************************************************************************/
-  evel_enc_kv_string(jbuf, "alarmCondition", event->alarm_condition);
-  evel_enc_kv_opt_string(jbuf, "eventCategory", &event->category);
-  evel_enc_kv_string(jbuf, "eventSeverity", fault_severity);
-  evel_enc_kv_string(jbuf, "eventSourceType", fault_source_type);
-  evel_enc_kv_string(jbuf, "specificProblem", event->specific_problem);
-  evel_enc_kv_string(jbuf, "vfStatus", fault_vf_status);
+  evel_enc_kv_string(jbuf, EVEL_KEY_ALARM_CONDITION, event->alarm_condition);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_EVENT_CATEGORY, &event->category);
+  evel_enc_kv_string(jbuf, EVEL_KEY_EVENT_SEVERITY, fault_severity);
+  evel_enc_kv_string(jbuf, EVEL_KEY_EVENT_SOURCE_TYPE, fault_source_type);
+  evel_enc_kv_string(jbuf, EVEL_KEY_SPECIFIC_PROBLEM, event->specific_problem);
+  evel_enc_kv_string(jbuf, EVEL_KEY_VF_STATUS, fault_vf_status);
   evel_enc_version(
-    jbuf, "faultFieldsVersion", event->major_version, event->minor_version);
+    jbuf, EVEL_KEY_FAULT_FIELDS_VERSION,
+    event->major_version, event->minor_version);
 
   /***************************************************************************/
   /* Optional fields.                                                        */
   /***************************************************************************/
 
-  /***************************************************************************/
-  /* Checkpoint, so that we can wind back if all fields are suppressed.      */
-  /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "alarmAdditionalInformation"))
+  if (evel_json_open_opt_named_list(jbuf,
+                                    EVEL_KEY_ALARM_ADDITIONAL_INFORMATION))
   {
-    bool item_added = false;
-
     addl_info_item = dlist_get_first(&event->additional_info);
     while (addl_info_item != NULL)
     {
@@ -307,28 +462,20 @@ void evel_json_encode_fault(EVEL_JSON_BUFFER * jbuf,
       assert(addl_info != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "alarmAdditionalInformation",
+                                          EVEL_KEY_ALARM_ADDITIONAL_INFORMATION,
                                           addl_info->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", addl_info->name);
-        evel_enc_kv_string(jbuf, "value", addl_info->value);
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, addl_info->name);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, addl_info->value);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       addl_info_item = dlist_get_next(addl_info_item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
-  evel_enc_kv_opt_string(jbuf, "alarmInterfaceA", &event->alarm_interface_a);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_ALARM_INTERFACE_A, &event->alarm_interface_a);
 
   evel_json_close_object(jbuf);
 
@@ -67,13 +67,13 @@ EVENT_HEARTBEAT_FIELD * evel_new_heartbeat_field(int interval,const char* ev_nam
   /***************************************************************************/
   /* Allocate the Heartbeat fields event.                                           */
   /***************************************************************************/
-  event = malloc(sizeof(EVENT_HEARTBEAT_FIELD));
+  event = evel_event_alloc(EVEL_DOMAIN_HEARTBEAT_FIELD);
   if (event == NULL)
   {
     log_error_state("Out of memory");
     goto exit_label;
   }
-  memset(event, 0, sizeof(EVENT_HEARTBEAT_FIELD));
+  event->header.arena = evel_new_event_arena();
   EVEL_DEBUG("New Heartbeat fields event is at %lp", event);
 
   /***************************************************************************/
@@ -123,14 +123,14 @@ void evel_hrtbt_field_addl_field_add(EVENT_HEARTBEAT_FIELD * const event,
   assert(value != NULL);
 
   EVEL_DEBUG("Adding name=%s value=%s", name, value);
-  nv_pair = malloc(sizeof(OTHER_FIELD));
+  nv_pair = evel_arena_alloc(event->header.arena, sizeof(OTHER_FIELD));
   assert(nv_pair != NULL);
-  nv_pair->name = strdup(name);
-  nv_pair->value = strdup(value);
+  nv_pair->name = evel_arena_strdup(event->header.arena, name);
+  nv_pair->value = evel_arena_strdup(event->header.arena, value);
   assert(nv_pair->name != NULL);
   assert(nv_pair->value != NULL);
 
-  dlist_push_last(&event->additional_info, nv_pair);
+  evel_arena_list_push(event->header.arena, &event->additional_info, nv_pair);
 
   EVEL_EXIT();
 }
@@ -186,26 +186,20 @@ void evel_json_encode_hrtbt_field(EVEL_JSON_BUFFER * const jbuf,
   assert(event->header.event_domain == EVEL_DOMAIN_HEARTBEAT_FIELD);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "heartbeatField");
+  evel_json_open_named_object(jbuf, EVEL_KEY_HEARTBEAT_FIELD);
 
   /***************************************************************************/
   /* Mandatory fields                                                        */
   /***************************************************************************/
-  evel_enc_version(jbuf, "heartbeatFieldsVersion", event->major_version,event->minor_version);
-  evel_enc_kv_int(jbuf, "heartbeatInterval", event->heartbeat_interval);
+  evel_enc_version(jbuf, EVEL_KEY_HEARTBEAT_FIELDS_VERSION, event->major_version,event->minor_version);
+  evel_enc_kv_int(jbuf, EVEL_KEY_HEARTBEAT_INTERVAL, event->heartbeat_interval);
 
   /***************************************************************************/
   /* Optional fields                                                         */
   /***************************************************************************/
 
-  /***************************************************************************/
-  /* Checkpoint, so that we can wind back if all fields are suppressed.      */
-  /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "additionalFields"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_ADDITIONAL_FIELDS))
   {
-    bool added = false;
-
     dlist_item = dlist_get_first(&event->additional_info);
     while (dlist_item != NULL)
     {
@@ -213,26 +207,17 @@ void evel_json_encode_hrtbt_field(EVEL_JSON_BUFFER * const jbuf,
       assert(nv_pair != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "additionalFields",
+                                          EVEL_KEY_ADDITIONAL_FIELDS,
                                           nv_pair->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", nv_pair->name);
-        evel_enc_kv_string(jbuf, "value", nv_pair->value);
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, nv_pair->name);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, nv_pair->value);
         evel_json_close_object(jbuf);
-        added = true;
       }
       dlist_item = dlist_get_next(dlist_item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   evel_json_close_object(jbuf);
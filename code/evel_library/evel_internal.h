@@ -40,7 +40,10 @@
  * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *****************************************************************************/
 
+#include <pthread.h>
+
 #include "evel.h"
+#include "evel_json_keys.h"
 
 /*****************************************************************************/
 /* Define some type-safe min/max macros.                                     */
@@ -71,6 +74,11 @@ extern char * functional_role;
  *****************************************************************************/
 extern EVEL_SOURCE_TYPES event_source_type;
 
+/**************************************************************************//**
+ * The encoding in which events are sent to the API.
+ *****************************************************************************/
+extern EVEL_ENCODINGS event_encoding;
+
 /**************************************************************************//**
  * A chunk of memory used in the cURL functions.
  *****************************************************************************/
@@ -84,6 +92,7 @@ typedef struct memory_chunk {
  *****************************************************************************/
 typedef enum {
   EVT_CMD_TERMINATE,
+  EVT_CMD_POST_ENCODED,
   EVT_CMD_MAX_COMMANDS
 } EVT_HANDLER_COMMAND;
 
@@ -107,8 +116,32 @@ typedef enum {
 typedef struct event_internal {
   EVENT_HEADER header;
   EVT_HANDLER_COMMAND command;
+  MEMORY_CHUNK encoded;           /** JSON for ::EVT_CMD_POST_ENCODED.       */
 } EVENT_INTERNAL;
 
+/*****************************************************************************/
+/* Number of words in a bitmap holding one bit per ::EVEL_JSON_KEY_ID.       */
+/*****************************************************************************/
+#define EVEL_THROTTLE_FIELD_WORDS ((EVEL_MAX_JSON_KEYS + 31) / 32)
+
+/**************************************************************************//**
+ * Set of names compiled into an open-addressed hash table, at most half
+ * full, so that a lookup costs a single hash and a short run of probes.
+ *****************************************************************************/
+typedef struct evel_throttle_name_set {
+
+  /***************************************************************************/
+  /* Mask reducing a hash to a slot index; there are (mask + 1) slots.       */
+  /***************************************************************************/
+  unsigned int mask;
+
+  /***************************************************************************/
+  /* The slots, each holding a name or NULL.  NULL if the set is empty.      */
+  /***************************************************************************/
+  const char ** slots;
+
+} EVEL_THROTTLE_NAME_SET;
+
 /**************************************************************************//**
  * Suppressed NV pairs list entry.
  * JSON equivalent field: suppressedNvPairs
@@ -129,9 +162,9 @@ typedef struct evel_suppressed_nv_pairs {
   DLIST suppressed_nv_pair_names;
 
   /***************************************************************************/
-  /* Hash table containing suppressed_nv_pair_names as keys.                 */
+  /* suppressed_nv_pair_names compiled into a perfect hash set.              */
   /***************************************************************************/
-  struct hsearch_data * hash_nv_pair_names;
+  EVEL_THROTTLE_NAME_SET nv_pair_names;
 
 } EVEL_SUPPRESSED_NV_PAIRS;
 
@@ -156,15 +189,21 @@ typedef struct evel_throttle_spec {
   DLIST suppressed_nv_pairs_list;
 
   /***************************************************************************/
-  /* Hash table containing suppressed_nv_pair_names as keys.                 */
+  /* suppressed_field_names compiled into a bitmap with one bit for each     */
+  /* ::EVEL_JSON_KEY_ID.  Names which are not known keys are ignored.        */
   /***************************************************************************/
-  struct hsearch_data * hash_field_names;
+  unsigned int suppressed_fields[EVEL_THROTTLE_FIELD_WORDS];
 
   /***************************************************************************/
-  /* Hash table containing nv_pair_field_name as keys, and                   */
-  /* suppressed_nv_pairs_list as values.                                     */
+  /* suppressed_nv_pairs_list entries indexed by the ::EVEL_JSON_KEY_ID of   */
+  /* their nv_pair_field_name, or NULL where there is no entry for the key.  */
   /***************************************************************************/
-  struct hsearch_data * hash_nv_pairs_list;
+  EVEL_SUPPRESSED_NV_PAIRS * suppressed_nv_pairs[EVEL_MAX_JSON_KEYS];
+
+  /***************************************************************************/
+  /* Bytes held by the specification, charged to its domain while in force.  */
+  /***************************************************************************/
+  size_t memory_size;
 
 } EVEL_THROTTLE_SPEC;
 
@@ -173,11 +212,21 @@ typedef struct evel_throttle_spec {
 /*****************************************************************************/
 #define EVEL_RFC2822_STRFTIME_FORMAT "%a, %d %b %Y %T %z"
 
+/*****************************************************************************/
+/* Space to allow for a time formatted with the RFC2822 format string.       */
+/*****************************************************************************/
+#define EVEL_MAX_TIME_STRING_LEN 64
+
 /*****************************************************************************/
 /* EVEL_JSON_BUFFER depth at which we throttle fields.                       */
 /*****************************************************************************/
 #define EVEL_THROTTLE_FIELD_DEPTH 3
 
+/*****************************************************************************/
+/* Maximum nesting of optional lists and objects awaiting their first item.  */
+/*****************************************************************************/
+#define EVEL_JSON_MAX_PENDING 8
+
 /**************************************************************************//**
  * Initialize the event handler.
  *
@@ -242,6 +291,24 @@ EVEL_ERR_CODES event_handler_run();
  *****************************************************************************/
 EVENT_INTERNAL * evel_new_internal_event(EVT_HANDLER_COMMAND command,const char* ev_name, const char *ev_id);
 
+/**************************************************************************//**
+ * Create a new internal event carrying an event already encoded as JSON.
+ *
+ * @note    Unlike ::evel_new_internal_event this does not take an event
+ *          sequence number, since the encoded event already has one.
+ * @param   json      The encoded event.  Ownership passes to the new event.
+ * @param   size      The size of the encoded event.
+ * @param   event_id  The ID of the encoded event, for logs.
+ * @returns pointer to the newly manufactured ::EVENT_INTERNAL.  If the event
+ *          is not used (i.e. posted) it must be released using
+ *          ::evel_free_event.
+ * @retval  NULL  Failed to create the event, in which case the caller keeps
+ *                ownership of json.
+ *****************************************************************************/
+EVENT_INTERNAL * evel_new_encoded_internal_event(char * json,
+                                                 size_t size,
+                                                 const char * const event_id);
+
 /**************************************************************************//**
  * Free an internal event.
  *
@@ -252,6 +319,35 @@ EVENT_INTERNAL * evel_new_internal_event(EVT_HANDLER_COMMAND command,const char*
  *****************************************************************************/
 void evel_free_internal_event(EVENT_INTERNAL * event);
 
+/*****************************************************************************/
+/* Types of the values which can be replaced in an ::EVEL_TEMPLATE.          */
+/*****************************************************************************/
+typedef enum {
+  EVEL_TEMPLATE_SLOT_STRING,
+  EVEL_TEMPLATE_SLOT_INT,
+  EVEL_TEMPLATE_SLOT_ULL,
+  EVEL_TEMPLATE_SLOT_DOUBLE
+} EVEL_TEMPLATE_SLOT_TYPES;
+
+/*****************************************************************************/
+/* An optional list or object which has been opened but not yet written.    */
+/*****************************************************************************/
+typedef struct evel_json_pending
+{
+  EVEL_JSON_KEY_ID key;
+  bool is_list;
+
+} EVEL_JSON_PENDING;
+
+/*****************************************************************************/
+/* How a ::EVEL_JSON_BUFFER makes sure there is space for its output.        */
+/*****************************************************************************/
+typedef enum {
+  EVEL_JSON_SPACE_CHECKED,    /** Checked on every write, and truncated.     */
+  EVEL_JSON_SPACE_SIZED,      /** Sized to hold all the output beforehand.   */
+  EVEL_JSON_SPACE_GROWN       /** Grown with realloc as needed.              */
+} EVEL_JSON_SPACE;
+
 /*****************************************************************************/
 /* Structure to hold JSON buffer and associated tracking, as it is written.  */
 /*****************************************************************************/
@@ -260,6 +356,18 @@ typedef struct evel_json_buffer
   char * json;
   int offset;
   int max_size;
+  EVEL_JSON_SPACE space;
+
+  /***************************************************************************/
+  /* When only sizing the output, json is NULL and the offset just counts    */
+  /* the bytes, with the last one kept here for placing commas.              */
+  /***************************************************************************/
+  char last;
+
+  /***************************************************************************/
+  /* The encoding being written, which despite the name may not be JSON.     */
+  /***************************************************************************/
+  EVEL_ENCODINGS encoding;
 
   /***************************************************************************/
   /* The working throttle specification, which can be NULL.                  */
@@ -272,12 +380,477 @@ typedef struct evel_json_buffer
   int depth;
 
   /***************************************************************************/
-  /* The checkpoint.                                                         */
+  /* Optional lists and objects opened but with nothing yet added to them,   */
+  /* outermost first.  They are always the innermost of the open ones, and   */
+  /* their keys and brackets are written only when the first item is.        */
+  /***************************************************************************/
+  EVEL_JSON_PENDING pending[EVEL_JSON_MAX_PENDING];
+  int pending_count;
+
+  /***************************************************************************/
+  /* The stream to hand full buffers on to, or NULL if not streaming.        */
   /***************************************************************************/
-  int checkpoint;
+  struct evel_json_stream * stream;
+
+  /***************************************************************************/
+  /* The template whose values are being noted, or NULL if not making one.   */
+  /***************************************************************************/
+  EVEL_TEMPLATE * tmpl;
 
 } EVEL_JSON_BUFFER;
 
+/*****************************************************************************/
+/* Initial size of each of the windows used when streaming encoded events.   */
+/*****************************************************************************/
+#define EVEL_JSON_STREAM_WINDOW 16384
+
+/**************************************************************************//**
+ * Stream of encoded JSON from an encoder thread to the cURL upload.
+ *
+ * The encoder thread writes into one window while the other is drained by
+ * the cURL read callback, so encoding overlaps with transmission.
+ *****************************************************************************/
+typedef struct evel_json_stream
+{
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  pthread_t encoder_thread;
+
+  /***************************************************************************/
+  /* The two windows and the index of the one currently being encoded into.  */
+  /***************************************************************************/
+  char * window[2];
+  int window_size[2];
+  int encode_window;
+
+  /***************************************************************************/
+  /* Encoded data handed on to, and not yet consumed by, the cURL upload.    */
+  /***************************************************************************/
+  const char * drain;
+  int drain_length;
+
+  /***************************************************************************/
+  /* The event being encoded, or NULL when the encoder is idle.              */
+  /***************************************************************************/
+  EVENT_HEADER * event;
+  bool encoding_done;
+  bool aborted;
+  bool terminate;
+
+} EVEL_JSON_STREAM;
+
+/**************************************************************************//**
+ * Initialize a ::EVEL_JSON_STREAM and start its encoder thread.
+ *
+ * @param stream        Pointer to the ::EVEL_JSON_STREAM to initialize.
+ * @returns Status code
+ * @retval  EVEL_SUCCESS      On success
+ * @retval  ::EVEL_ERR_CODES  On failure.
+ *****************************************************************************/
+EVEL_ERR_CODES evel_json_stream_initialize(EVEL_JSON_STREAM * stream);
+
+/**************************************************************************//**
+ * Stop the encoder thread of a ::EVEL_JSON_STREAM and free its windows.
+ *
+ * @param stream        Pointer to the ::EVEL_JSON_STREAM to terminate.
+ *****************************************************************************/
+void evel_json_stream_terminate(EVEL_JSON_STREAM * stream);
+
+/**************************************************************************//**
+ * Start encoding an event into a ::EVEL_JSON_STREAM.
+ *
+ * The event must not be freed until ::evel_json_stream_finish has returned.
+ *
+ * @param stream        Pointer to the idle ::EVEL_JSON_STREAM.
+ * @param event         Pointer to the ::EVENT_HEADER to encode.
+ *****************************************************************************/
+void evel_json_stream_start(EVEL_JSON_STREAM * stream, EVENT_HEADER * event);
+
+/**************************************************************************//**
+ * Read the next piece of encoded JSON from a ::EVEL_JSON_STREAM.
+ *
+ * Blocks until the encoder thread has handed on more data or has finished.
+ *
+ * @param stream        Pointer to the ::EVEL_JSON_STREAM.
+ * @param buffer        Where to copy the data.
+ * @param max_size      Size of storage available in the buffer.
+ * @returns Number of bytes copied.  0 once the whole event has been read.
+ *****************************************************************************/
+size_t evel_json_stream_read(EVEL_JSON_STREAM * stream,
+                             char * buffer,
+                             size_t max_size);
+
+/**************************************************************************//**
+ * Finish with the current event on a ::EVEL_JSON_STREAM.
+ *
+ * Any unread data is discarded and the call waits for the encoder thread to
+ * be done with the event, after which the event may be freed.
+ *
+ * @param stream        Pointer to the ::EVEL_JSON_STREAM.
+ *****************************************************************************/
+void evel_json_stream_finish(EVEL_JSON_STREAM * stream);
+
+/**************************************************************************//**
+ * Hand the completed part of a JSON buffer on to its stream.
+ *
+ * On return there is room for at least the required number of bytes.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param required      Number of bytes needed in the buffer.
+ *****************************************************************************/
+void evel_json_stream_flush(EVEL_JSON_BUFFER * jbuf, const int required);
+
+/**************************************************************************//**
+ * Pool of encoder threads between the event ring-buffer and the sender.
+ *
+ * Each worker takes the next event from the ring-buffer along with a ticket
+ * giving its place in the queue, encodes it, and puts the result in the
+ * reorder slot for that ticket.  The sender takes results from the slots in
+ * ticket order, so events are sent in the order they were posted.
+ *****************************************************************************/
+typedef struct evel_encoder_pool
+{
+  int num_threads;
+  pthread_t * threads;
+
+  /***************************************************************************/
+  /* The ring-buffer the workers read from.  The read mutex makes taking an  */
+  /* event and its ticket atomic, and guards the ticket and terminate flag.  */
+  /***************************************************************************/
+  struct ring_buffer * source;
+  pthread_mutex_t read_mutex;
+  unsigned long next_ticket;
+  bool terminate;
+
+  /***************************************************************************/
+  /* The reorder slots, indexed by ticket modulo the number of slots.        */
+  /***************************************************************************/
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  int num_slots;
+  EVENT_HEADER ** slots;
+  bool * slot_filled;
+  unsigned long next_delivery;
+
+} EVEL_ENCODER_POOL;
+
+/**************************************************************************//**
+ * Initialize a ::EVEL_ENCODER_POOL and start its worker threads.
+ *
+ * @param pool          Pointer to the ::EVEL_ENCODER_POOL to initialize.
+ * @param source        The ring-buffer from which to take events.
+ * @param num_threads   The number of worker threads to start.
+ * @returns Status code
+ * @retval  EVEL_SUCCESS      On success
+ * @retval  ::EVEL_ERR_CODES  On failure.
+ *****************************************************************************/
+EVEL_ERR_CODES evel_encoder_pool_initialize(EVEL_ENCODER_POOL * pool,
+                                            struct ring_buffer * source,
+                                            const int num_threads);
+
+/**************************************************************************//**
+ * Wait for the worker threads of a ::EVEL_ENCODER_POOL to exit and free it.
+ *
+ * The workers exit once one of them has taken an ::EVT_CMD_TERMINATE event
+ * from the ring-buffer, so that must have been posted and read back.
+ *
+ * @param pool          Pointer to the ::EVEL_ENCODER_POOL to terminate.
+ *****************************************************************************/
+void evel_encoder_pool_terminate(EVEL_ENCODER_POOL * pool);
+
+/**************************************************************************//**
+ * Read the next event from a ::EVEL_ENCODER_POOL, in the order posted.
+ *
+ * Regular events are returned as ::EVT_CMD_POST_ENCODED internal events,
+ * and other internal events are returned as they were posted.
+ *
+ * @param pool          Pointer to the ::EVEL_ENCODER_POOL.
+ * @returns Pointer to the next event, which the caller must free.
+ *****************************************************************************/
+EVENT_HEADER * evel_encoder_pool_read(EVEL_ENCODER_POOL * pool);
+
+/**************************************************************************//**
+ * Encode an event, ready for the event handler to send.
+ *
+ * @note  The event is freed, whether or not it is successfully encoded.
+ *
+ * @param event   The event to be encoded.
+ *
+ * @returns Pointer to the ::EVENT_INTERNAL carrying the encoded event.
+ * @retval  NULL  Failed to allocate memory for the encoded event.
+ *****************************************************************************/
+EVENT_HEADER * evel_encode_posted_event(EVENT_HEADER * event);
+
+/**************************************************************************//**
+ * Allocate the structure for a new event.
+ *
+ * The structure comes from the calling thread's cache for the domain if it
+ * can, refilling that from the shared pool if empty.  Only if both are empty
+ * is a new structure allocated.
+ *
+ * @note  The structure is not initialized.
+ *
+ * @param domain        The domain of the event.
+ * @returns Pointer to the structure, the size of the domain's event.
+ * @retval  NULL  Failed to allocate the structure.
+ *****************************************************************************/
+void * evel_event_alloc(const EVEL_EVENT_DOMAINS domain);
+
+/**************************************************************************//**
+ * Release the structure of a freed event, for reuse.
+ *
+ * @param domain        The domain of the event.
+ * @param event         Pointer to the structure, whose contents have been
+ *                      freed.
+ *****************************************************************************/
+void evel_event_release(const EVEL_EVENT_DOMAINS domain, void * event);
+
+/**************************************************************************//**
+ * Free the structures in the shared pools.
+ *****************************************************************************/
+void evel_event_pool_terminate(void);
+
+/**************************************************************************//**
+ * Get the size of the structure for a domain's events.
+ *
+ * @param domain        The domain.
+ * @returns The size in bytes.
+ *****************************************************************************/
+size_t evel_event_size(const EVEL_EVENT_DOMAINS domain);
+
+/**************************************************************************//**
+ * Create the arena for a new event, if event arenas are enabled.
+ *
+ * @returns Pointer to the new ::EVEL_ARENA.
+ * @retval  NULL  Event arenas are disabled, or the arena could not be
+ *                allocated, so the event should use the heap.
+ *****************************************************************************/
+EVEL_ARENA * evel_new_event_arena(void);
+
+/**************************************************************************//**
+ * Create an arena, whether or not event arenas are enabled.
+ *
+ * @returns Pointer to the new ::EVEL_ARENA.
+ * @retval  NULL  The arena could not be allocated.
+ *****************************************************************************/
+EVEL_ARENA * evel_new_arena(void);
+
+/**************************************************************************//**
+ * Allocate memory from an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to allocate from
+ *                      the heap.
+ * @param size          Number of bytes to allocate.
+ * @returns Pointer to the memory, which is not initialized.
+ * @retval  NULL  Failed to allocate the memory.
+ *****************************************************************************/
+void * evel_arena_alloc(EVEL_ARENA * const arena, const size_t size);
+
+/**************************************************************************//**
+ * Copy a string into an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to copy onto the
+ *                      heap.
+ * @param string        The ASCIIZ string to copy.
+ * @returns Pointer to the copy.
+ * @retval  NULL  Failed to allocate memory for the copy.
+ *****************************************************************************/
+char * evel_arena_strdup(EVEL_ARENA * const arena, const char * const string);
+
+/**************************************************************************//**
+ * Take ownership of a string allocated on the heap, for an arena.
+ *
+ * If there is an arena, it frees the string when it is itself freed;
+ * otherwise the string is freed with the rest of its event as normal.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL.
+ * @param string        The ASCIIZ string, allocated with malloc.
+ * @returns The string.
+ * @retval  NULL  Failed to allocate memory for the arena to free the string,
+ *                which has been freed already.
+ *****************************************************************************/
+char * evel_arena_take_string(EVEL_ARENA * const arena, char * const string);
+
+/**************************************************************************//**
+ * Add an item to the end of a list, allocating any larger slots the list
+ * needs from an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to allocate the
+ *                      slots from the heap.
+ * @param list          Pointer to the list.
+ * @param item          The item to add.
+ *****************************************************************************/
+void evel_arena_list_push(EVEL_ARENA * const arena,
+                          DLIST * const list,
+                          void * const item);
+
+/**************************************************************************//**
+ * Have an arena free memory from the heap when it is itself freed.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA.
+ * @param free_fn       Function to free the memory.
+ * @param data          The memory to pass to @p free_fn.
+ * @returns Whether the arena will free the memory.
+ *****************************************************************************/
+bool evel_arena_adopt(EVEL_ARENA * const arena,
+                      void (*free_fn)(void *),
+                      void * const data);
+
+/**************************************************************************//**
+ * Get the memory held by an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA.
+ * @returns The total size of its chunks, in bytes.
+ *****************************************************************************/
+size_t evel_arena_size(EVEL_ARENA * const arena);
+
+/**************************************************************************//**
+ * Free an arena and everything allocated from, or adopted by, it.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA.
+ *****************************************************************************/
+void evel_free_arena(EVEL_ARENA * const arena);
+
+/**************************************************************************//**
+ * Create an event from a prototype.
+ *
+ * @note  Lists in the new event still use the prototype's slots, so must be
+ *        passed to ::dlist_share_slots by the caller.
+ *
+ * @param prototype     Pointer to the ::EVEL_PROTOTYPE.
+ * @param domain        The domain the prototype must be of.
+ * @param size          The size of the domain's event structure.
+ * @param ev_id         The eventId of the new event.
+ *
+ * @returns Pointer to the new event.
+ * @retval  NULL  Failed to allocate memory for the event.
+ *****************************************************************************/
+EVENT_HEADER * evel_new_event_from_prototype(EVEL_PROTOTYPE * const prototype,
+                                             const EVEL_EVENT_DOMAINS domain,
+                                             const size_t size,
+                                             const char * const ev_id);
+
+/**************************************************************************//**
+ * Forget the value of an ::EVEL_OPTION_STRING which an event inherited from
+ * its prototype, so that it can be set on the event.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER of the event.
+ * @param option        Pointer to the ::EVEL_OPTION_STRING in the event.
+ *****************************************************************************/
+void evel_uninherit_option_string(EVENT_HEADER * const header,
+                                  EVEL_OPTION_STRING * const option);
+
+/**************************************************************************//**
+ * Take the next event sequence number.
+ *
+ * @returns The sequence number for the new event.
+ *****************************************************************************/
+int evel_next_event_sequence(void);
+
+/**************************************************************************//**
+ * Format an event sequence number as the default eventId.
+ *
+ * @param buffer        Where to write the ASCIIZ number, of at least
+ *                      ::EVEL_SEQUENCE_ID_LEN characters.
+ * @param sequence      The sequence number.
+ * @returns The length of the number written.
+ *****************************************************************************/
+int evel_format_sequence(char * const buffer, const int sequence);
+
+/**************************************************************************//**
+ * Start the clock asked for with ::evel_set_clock_source.
+ *****************************************************************************/
+void evel_clock_initialize(void);
+
+/**************************************************************************//**
+ * Go back to the system clock, stopping the cached clock's thread.
+ *****************************************************************************/
+void evel_clock_terminate(void);
+
+/**************************************************************************//**
+ * Get the time for an event epoch.
+ *
+ * @returns Microseconds since the UNIX epoch.
+ *****************************************************************************/
+unsigned long long evel_time_microsec(void);
+
+/**************************************************************************//**
+ * Charge an event being queued to a domain's memory usage.
+ *
+ * @param event         Pointer to the event.
+ * @param domain        The domain to charge.
+ * @param limited       Whether the event is subject to the memory limit.
+ * @returns Whether the event was charged.  If not, it is over the limit and
+ *          must be dropped.
+ *****************************************************************************/
+bool evel_memory_charge(EVENT_HEADER * const event,
+                        const EVEL_EVENT_DOMAINS domain,
+                        const bool limited);
+
+/**************************************************************************//**
+ * Release the memory charged for an event as it is freed.
+ *
+ * @param event         Pointer to the event, which may not have been charged.
+ *****************************************************************************/
+void evel_memory_release(EVENT_HEADER * const event);
+
+/**************************************************************************//**
+ * Charge memory held for a domain other than by queued events, such as its
+ * throttle specification.
+ *
+ * @param domain        The domain to charge.
+ * @param bytes         The number of bytes.
+ *****************************************************************************/
+void evel_memory_charge_bytes(const EVEL_EVENT_DOMAINS domain,
+                              const size_t bytes);
+
+/**************************************************************************//**
+ * Release memory charged with ::evel_memory_charge_bytes.
+ *
+ * @param domain        The domain charged.
+ * @param bytes         The number of bytes charged.
+ *****************************************************************************/
+void evel_memory_release_bytes(const EVEL_EVENT_DOMAINS domain,
+                               const size_t bytes);
+
+/**************************************************************************//**
+ * Note a value in the encoding of a template, which can be replaced in the
+ * events posted from it.
+ *
+ * Slots must be added in the order they are encoded.
+ *
+ * @param tmpl          Pointer to the ::EVEL_TEMPLATE.
+ * @param key           Identifier of the key of the value.
+ * @param type          The type of the value.
+ * @param offset        Offset of the value in the encoding.
+ * @param length        Length of the encoded value.
+ *****************************************************************************/
+void evel_template_add_slot(EVEL_TEMPLATE * tmpl,
+                            const EVEL_JSON_KEY_ID key,
+                            const EVEL_TEMPLATE_SLOT_TYPES type,
+                            const int offset,
+                            const int length);
+
+/**************************************************************************//**
+ * Encode the event as a JSON event object into a buffer of its exact size.
+ *
+ * @param event     Pointer to the ::EVENT_HEADER to encode.
+ * @param size      Where to store the number of bytes in the encoded event,
+ *                  excluding the NUL.
+ * @returns The encoded event, allocated with malloc.
+ * @retval  NULL  Failed to allocate memory for the encoded event.
+ *****************************************************************************/
+char * evel_json_encode_event_copy(EVENT_HEADER * event, int * const size);
+
+/**************************************************************************//**
+ * Encode the event as a JSON event object into a ::EVEL_JSON_BUFFER.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to encode into.
+ * @param event         Pointer to the ::EVENT_HEADER to encode.
+ *****************************************************************************/
+void evel_json_encode_event_object(EVEL_JSON_BUFFER * jbuf,
+                                   EVENT_HEADER * event);
+
 /**************************************************************************//**
  * Encode the event as a JSON event object according to AT&T's schema.
  *
@@ -370,6 +943,35 @@ void evel_json_encode_syslog(EVEL_JSON_BUFFER * jbuf,
 void evel_json_encode_other(EVEL_JSON_BUFFER * jbuf,
                             EVENT_OTHER * event);
 
+/**************************************************************************//**
+ * Note that the identity given to new event headers has changed.
+ *
+ * Called when the metadata is (re)loaded, so that JSON cached for the
+ * headers of earlier events is not used for later ones.
+ *****************************************************************************/
+void evel_header_identity_changed(void);
+
+/**************************************************************************//**
+ * Free the shared identity given to event headers, and those it replaced.
+ *
+ * Headers refer to the identities without counting references, so events
+ * must have been freed first.
+ *****************************************************************************/
+void evel_free_header_identity(void);
+
+/**************************************************************************//**
+ * Initialize the vendor field of an event, copying the vendor name into an
+ * arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to copy the name
+ *                      onto the heap.
+ * @param vfield        Pointer to the event vnfname field being initialized.
+ * @param vendor_name   The vendor name.
+ *****************************************************************************/
+void evel_arena_init_vendor_field(EVEL_ARENA * const arena,
+                                  VENDOR_VNFNAME_FIELD * const vfield,
+                                  const char * const vendor_name);
+
 /**************************************************************************//**
  * Set the next event_sequence to use.
  *
@@ -401,217 +1003,368 @@ void evel_json_buffer_init(EVEL_JSON_BUFFER * jbuf,
                            const int max_size,
                            EVEL_THROTTLE_SPEC * throttle_spec);
 
+/**************************************************************************//**
+ * Initialize a ::EVEL_JSON_BUFFER which only sizes the output.
+ *
+ * Nothing is stored, and the offset just counts the bytes which would have
+ * been written, so encoding into the buffer gives the encoded length.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to initialise.
+ *****************************************************************************/
+void evel_json_buffer_init_sizing(EVEL_JSON_BUFFER * jbuf);
+
+/**************************************************************************//**
+ * Initialize a ::EVEL_JSON_BUFFER sized to hold all that is written to it,
+ * so that writes need not check for space.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to initialise.
+ * @param json          Pointer to the underlying working buffer to use.
+ * @param max_size      Size of storage available in the JSON buffer, at least
+ *                      one more than ::evel_event_encoded_size gives for
+ *                      what is encoded.
+ * @param throttle_spec Pointer to throttle specification. Can be NULL.
+ *****************************************************************************/
+void evel_json_buffer_init_sized(EVEL_JSON_BUFFER * jbuf,
+                                 char * const json,
+                                 const int max_size,
+                                 EVEL_THROTTLE_SPEC * throttle_spec);
+
+/**************************************************************************//**
+ * Initialize a ::EVEL_JSON_BUFFER writing into the calling thread's scratch
+ * buffer, which grows as needed.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to initialise.
+ * @param throttle_spec Pointer to throttle specification. Can be NULL.
+ * @returns Whether the scratch buffer could be allocated.
+ *****************************************************************************/
+bool evel_json_buffer_init_scratch(EVEL_JSON_BUFFER * jbuf,
+                                   EVEL_THROTTLE_SPEC * throttle_spec);
+
+/**************************************************************************//**
+ * Copy the output from a ::EVEL_JSON_BUFFER initialized with
+ * ::evel_json_buffer_init_scratch, handing the scratch buffer back.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER.
+ * @returns The ASCIIZ output, allocated with malloc at its exact size.
+ * @retval  NULL  Out of memory, either for the copy or to grow the scratch
+ *                buffer while writing.
+ *****************************************************************************/
+char * evel_json_buffer_copy_scratch(EVEL_JSON_BUFFER * jbuf);
+
+/**************************************************************************//**
+ * Encode a pre-encoded key and value to a ::EVEL_JSON_BUFFER.
+ *
+ * The fragment is copied verbatim, so must already be valid JSON for one or
+ * more comma-separated key-value pairs.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param fragment      Pointer to the encoded key-value pairs.
+ * @param length        Length of the fragment.
+ *****************************************************************************/
+void evel_enc_kv_fragment(EVEL_JSON_BUFFER * jbuf,
+                          const char * const fragment,
+                          const int length);
+
+/**************************************************************************//**
+ * Encode an integer value to a JSON buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         The integer to add to it.
+ *****************************************************************************/
+void evel_enc_int(EVEL_JSON_BUFFER * jbuf,
+                  const int value);
+
+/**************************************************************************//**
+ * Encode a string value to a JSON buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         Pointer to the string to add to it.
+ *****************************************************************************/
+void evel_enc_string(EVEL_JSON_BUFFER * jbuf,
+                     const char * const value);
+
+/**************************************************************************//**
+ * Encode a double value to a JSON buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         The double to add to it.
+ *****************************************************************************/
+void evel_enc_double(EVEL_JSON_BUFFER * jbuf,
+                     const double value);
+
+/**************************************************************************//**
+ * Encode an unsigned long long value to a JSON buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         The integer to add to it.
+ *****************************************************************************/
+void evel_enc_ull(EVEL_JSON_BUFFER * jbuf,
+                  const unsigned long long value);
+
 /**************************************************************************//**
  * Encode a string key and string value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param option        Pointer to holder of the corresponding value to encode.
  * @return true if the key, value was added, false if it was suppressed.
  *****************************************************************************/
 bool evel_enc_kv_opt_string(EVEL_JSON_BUFFER * jbuf,
-                            const char * const key,
+                            const EVEL_JSON_KEY_ID key,
                             const EVEL_OPTION_STRING * const option);
 
 /**************************************************************************//**
  * Encode a string key and string value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param value         Pointer to the corresponding value to encode.
  *****************************************************************************/
 void evel_enc_kv_string(EVEL_JSON_BUFFER * jbuf,
-                        const char * const key,
+                        const EVEL_JSON_KEY_ID key,
                         const char * const value);
 
 /**************************************************************************//**
  * Encode a string key and integer value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param option        Pointer to holder of the corresponding value to encode.
  * @return true if the key, value was added, false if it was suppressed.
  *****************************************************************************/
 bool evel_enc_kv_opt_int(EVEL_JSON_BUFFER * jbuf,
-                         const char * const key,
+                         const EVEL_JSON_KEY_ID key,
                          const EVEL_OPTION_INT * const option);
 
+/**************************************************************************//**
+ * Encode a structure's packed optional int fields to a
+ * ::EVEL_JSON_BUFFER, in field order.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param keys          Identifiers of the keys to encode, indexed by field.
+ * @param present       ::EVEL_OPTION_BITMAP of the fields which are set.
+ * @param values        The structure's array of packed values.
+ * @return true if any key, value was added, false if none were.
+ *****************************************************************************/
+bool evel_enc_kv_packed_ints(EVEL_JSON_BUFFER * jbuf,
+                             const EVEL_JSON_KEY_ID * const keys,
+                             EVEL_OPTION_BITMAP present,
+                             const int * const values);
+
 /**************************************************************************//**
  * Encode a string key and integer value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param value         The corresponding value to encode.
  *****************************************************************************/
 void evel_enc_kv_int(EVEL_JSON_BUFFER * jbuf,
-                     const char * const key,
+                     const EVEL_JSON_KEY_ID key,
                      const int value);
 
+/**************************************************************************//**
+ * Encode a string key and json object value to a ::EVEL_JSON_BUFFER.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Identifier of the key to encode.
+ * @param value         The corresponding json string to encode.
+ *****************************************************************************/
+void evel_enc_kv_object(EVEL_JSON_BUFFER * jbuf,
+                        const EVEL_JSON_KEY_ID key,
+                        const char * value);
+
 /**************************************************************************//**
  * Encode a string key and double value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param option        Pointer to holder of the corresponding value to encode.
  * @return true if the key, value was added, false if it was suppressed.
  *****************************************************************************/
 bool evel_enc_kv_opt_double(EVEL_JSON_BUFFER * jbuf,
-                            const char * const key,
+                            const EVEL_JSON_KEY_ID key,
                             const EVEL_OPTION_DOUBLE * const option);
 
+/**************************************************************************//**
+ * Encode a structure's packed optional double fields to a
+ * ::EVEL_JSON_BUFFER, in field order.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param keys          Identifiers of the keys to encode, indexed by field.
+ * @param present       ::EVEL_OPTION_BITMAP of the fields which are set.
+ * @param values        The structure's array of packed values.
+ * @return true if any key, value was added, false if none were.
+ *****************************************************************************/
+bool evel_enc_kv_packed_doubles(EVEL_JSON_BUFFER * jbuf,
+                                const EVEL_JSON_KEY_ID * const keys,
+                                EVEL_OPTION_BITMAP present,
+                                const double * const values);
+
 /**************************************************************************//**
  * Encode a string key and double value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param value         The corresponding value to encode.
  *****************************************************************************/
 void evel_enc_kv_double(EVEL_JSON_BUFFER * jbuf,
-                        const char * const key,
+                        const EVEL_JSON_KEY_ID key,
                         const double value);
 
 /**************************************************************************//**
  * Encode a string key and unsigned long long value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param option        Pointer to holder of the corresponding value to encode.
  * @return true if the key, value was added, false if it was suppressed.
  *****************************************************************************/
 bool evel_enc_kv_opt_ull(EVEL_JSON_BUFFER * jbuf,
-                         const char * const key,
+                         const EVEL_JSON_KEY_ID key,
                          const EVEL_OPTION_ULL * const option);
 
 /**************************************************************************//**
  * Encode a string key and unsigned long long value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param value         The corresponding value to encode.
  *****************************************************************************/
 void evel_enc_kv_ull(EVEL_JSON_BUFFER * jbuf,
-                     const char * const key,
+                     const EVEL_JSON_KEY_ID key,
                      const unsigned long long value);
 
 /**************************************************************************//**
  * Encode a string key and time value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param option        Pointer to holder of the corresponding value to encode.
  * @return true if the key, value was added, false if it was suppressed.
  *****************************************************************************/
 bool evel_enc_kv_opt_time(EVEL_JSON_BUFFER * jbuf,
-                          const char * const key,
+                          const EVEL_JSON_KEY_ID key,
                           const EVEL_OPTION_TIME * const option);
 
 /**************************************************************************//**
  * Encode a string key and time value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param time          Pointer to the time to encode.
  *****************************************************************************/
 void evel_enc_kv_time(EVEL_JSON_BUFFER * jbuf,
-                      const char * const key,
+                      const EVEL_JSON_KEY_ID key,
                       const time_t * time);
 
 /**************************************************************************//**
  * Encode a key and version.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param major_version The major version to encode.
  * @param minor_version The minor version to encode.
  *****************************************************************************/
 void evel_enc_version(EVEL_JSON_BUFFER * jbuf,
-                      const char * const key,
+                      const EVEL_JSON_KEY_ID key,
                       const int major_version,
                       const int minor_version);
 
 /**************************************************************************//**
- * Add the key and opening bracket of an optional named list to a JSON buffer.
+ * Open an optional named list in a JSON buffer.
+ *
+ * The key and opening bracket are only written when the first item is added,
+ * so a list which ends up empty is left out altogether.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @return true if the list was opened, false if it was suppressed.
  *****************************************************************************/
 bool evel_json_open_opt_named_list(EVEL_JSON_BUFFER * jbuf,
-                                   const char * const key);
+                                   const EVEL_JSON_KEY_ID key);
 
 /**************************************************************************//**
  * Add the key and opening bracket of a named list to a JSON buffer.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  *****************************************************************************/
 void evel_json_open_named_list(EVEL_JSON_BUFFER * jbuf,
-                               const char * const key);
+                               const EVEL_JSON_KEY_ID key);
 
 /**************************************************************************//**
- * Add the closing bracket of a list to a JSON buffer.
+ * Add a key supplied at run time and the opening bracket of a named list to a
+ * JSON buffer.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Pointer to the key to encode.
  *****************************************************************************/
-void evel_json_close_list(EVEL_JSON_BUFFER * jbuf);
+void evel_json_open_user_named_list(EVEL_JSON_BUFFER * jbuf,
+                                    const char * const key);
 
 /**************************************************************************//**
- * Encode a list item with format and param list to a ::EVEL_JSON_BUFFER.
+ * Add the closing bracket of a list to a JSON buffer.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param format        Format string in standard printf format.
- * @param ...           Variable parameters for format string.
  *****************************************************************************/
-void evel_enc_list_item(EVEL_JSON_BUFFER * jbuf,
-                        const char * const format,
-                        ...);
+void evel_json_close_list(EVEL_JSON_BUFFER * jbuf);
 
 /**************************************************************************//**
- * Add the opening bracket of an optional named object to a JSON buffer.
+ * Encode a string list item to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param value         Pointer to the string to encode.
  *****************************************************************************/
-bool evel_json_open_opt_named_object(EVEL_JSON_BUFFER * jbuf,
-                                     const char * const key);
+void evel_enc_list_string(EVEL_JSON_BUFFER * jbuf,
+                          const char * const value);
 
 /**************************************************************************//**
- * Add the opening bracket of an object to a JSON buffer.
+ * Encode a list item which is a pair of a name and a count, as in
+ * <tt>["name", count]</tt>, to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
- * @return true if the object was opened, false if it was suppressed.
+ * @param name          Pointer to the name to encode.
+ * @param count         The count to encode.
  *****************************************************************************/
-void evel_json_open_named_object(EVEL_JSON_BUFFER * jbuf,
-                                 const char * const key);
+void evel_enc_list_counter(EVEL_JSON_BUFFER * jbuf,
+                           const char * const name,
+                           const int count);
 
 /**************************************************************************//**
- * Add the opening bracket of an object to a JSON buffer.
+ * Open an optional named object in a JSON buffer.
+ *
+ * The key and opening bracket are only written when the first member is
+ * added, so an object which ends up empty is left out altogether.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Identifier of the key to encode.
+ * @return true if the object was opened, false if it was suppressed.
  *****************************************************************************/
-void evel_json_open_object(EVEL_JSON_BUFFER * jbuf);
+bool evel_json_open_opt_named_object(EVEL_JSON_BUFFER * jbuf,
+                                     const EVEL_JSON_KEY_ID key);
 
 /**************************************************************************//**
- * Add the closing bracket of an object to a JSON buffer.
+ * Add the opening bracket of an object to a JSON buffer.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Identifier of the key to encode.
  *****************************************************************************/
-void evel_json_close_object(EVEL_JSON_BUFFER * jbuf);
+void evel_json_open_named_object(EVEL_JSON_BUFFER * jbuf,
+                                 const EVEL_JSON_KEY_ID key);
 
 /**************************************************************************//**
- * Add a checkpoint - a stake in the ground to which we can rewind.
+ * Add the opening bracket of an object to a JSON buffer.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
  *****************************************************************************/
-void evel_json_checkpoint(EVEL_JSON_BUFFER * jbuf);
+void evel_json_open_object(EVEL_JSON_BUFFER * jbuf);
 
 /**************************************************************************//**
- * Rewind to the latest checkoint.
+ * Add the closing bracket of an object to a JSON buffer.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
  *****************************************************************************/
-void evel_json_rewind(EVEL_JSON_BUFFER * jbuf);
+void evel_json_close_object(EVEL_JSON_BUFFER * jbuf);
 
 /**************************************************************************//**
  * Free the underlying resources of an ::EVEL_OPTION_STRING.
@@ -638,6 +1391,48 @@ void evel_set_option_string(EVEL_OPTION_STRING * const option,
                             const char * const value,
                             const char * const description);
 
+/**************************************************************************//**
+ * Set the value of an ::EVEL_OPTION_STRING, copying it into an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to copy the value
+ *                      onto the heap.
+ * @param option        Pointer to the ::EVEL_OPTION_STRING.
+ * @param value         The value to set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_arena_set_option_string(EVEL_ARENA * const arena,
+                                  EVEL_OPTION_STRING * const option,
+                                  const char * const value,
+                                  const char * const description);
+
+/**************************************************************************//**
+ * Set the value of an ::EVEL_OPTION_STRING, taking ownership of it.
+ *
+ * @param option        Pointer to the ::EVEL_OPTION_STRING.
+ * @param value         The value to set, allocated with malloc.  It is freed
+ *                      straight away if the option is already set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_take_option_string(EVEL_OPTION_STRING * const option,
+                             char * const value,
+                             const char * const description);
+
+/**************************************************************************//**
+ * Set the value of an ::EVEL_OPTION_STRING, taking ownership of it for an
+ * arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL if the value is
+ *                      to be freed with the option.
+ * @param option        Pointer to the ::EVEL_OPTION_STRING.
+ * @param value         The value to set, allocated with malloc.  It is freed
+ *                      straight away if the option is already set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_arena_take_option_string(EVEL_ARENA * const arena,
+                                   EVEL_OPTION_STRING * const option,
+                                   char * const value,
+                                   const char * const description);
+
 /**************************************************************************//**
  * Force the value of an ::EVEL_OPTION_STRING.
  *
@@ -647,6 +1442,18 @@ void evel_set_option_string(EVEL_OPTION_STRING * const option,
 void evel_force_option_string(EVEL_OPTION_STRING * const option,
                               const char * const value);
 
+/**************************************************************************//**
+ * Force the value of an ::EVEL_OPTION_STRING, copying it into an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to copy the value
+ *                      onto the heap.
+ * @param option        Pointer to the ::EVEL_OPTION_STRING.
+ * @param value         The value to set.
+ *****************************************************************************/
+void evel_arena_force_option_string(EVEL_ARENA * const arena,
+                                    EVEL_OPTION_STRING * const option,
+                                    const char * const value);
+
 /**************************************************************************//**
  * Initialize an ::EVEL_OPTION_INT to a not-set state.
  *
@@ -674,6 +1481,51 @@ void evel_set_option_int(EVEL_OPTION_INT * const option,
                          const int value,
                          const char * const description);
 
+/**************************************************************************//**
+ * Set the value of a packed optional integer field.
+ *
+ * @param present       Pointer to the structure's ::EVEL_OPTION_BITMAP.
+ * @param values        The structure's array of packed values.
+ * @param field         Index of the field to set.
+ * @param value         The value to set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_set_packed_int(EVEL_OPTION_BITMAP * const present,
+                         int * const values,
+                         const int field,
+                         const int value,
+                         const char * const description);
+
+/**************************************************************************//**
+ * Initialize an ::EVEL_OPTION_SPARSE_INT to a state with no values set.
+ *
+ * @param option        Pointer to the ::EVEL_OPTION_SPARSE_INT.
+ *****************************************************************************/
+void evel_init_option_sparse_int(EVEL_OPTION_SPARSE_INT * const option);
+
+/**************************************************************************//**
+ * Set the value at an index of an ::EVEL_OPTION_SPARSE_INT.
+ *
+ * The value is inserted in order of index, so that the values are encoded
+ * in the same order as they would be from a dense array.
+ *
+ * @param option        Pointer to the ::EVEL_OPTION_SPARSE_INT.
+ * @param index         The index to set.
+ * @param value         The value to set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_set_option_sparse_int(EVEL_OPTION_SPARSE_INT * const option,
+                                const int index,
+                                const int value,
+                                const char * const description);
+
+/**************************************************************************//**
+ * Free the underlying resources of an ::EVEL_OPTION_SPARSE_INT.
+ *
+ * @param option        Pointer to the ::EVEL_OPTION_SPARSE_INT.
+ *****************************************************************************/
+void evel_free_option_sparse_int(EVEL_OPTION_SPARSE_INT * const option);
+
 /**************************************************************************//**
  * Initialize an ::EVEL_OPTION_DOUBLE to a not-set state.
  *
@@ -701,6 +1553,21 @@ void evel_set_option_double(EVEL_OPTION_DOUBLE * const option,
                             const double value,
                             const char * const description);
 
+/**************************************************************************//**
+ * Set the value of a packed optional double field.
+ *
+ * @param present       Pointer to the structure's ::EVEL_OPTION_BITMAP.
+ * @param values        The structure's array of packed values.
+ * @param field         Index of the field to set.
+ * @param value         The value to set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_set_packed_double(EVEL_OPTION_BITMAP * const present,
+                            double * const values,
+                            const int field,
+                            const double value,
+                            const char * const description);
+
 /**************************************************************************//**
  * Initialize an ::EVEL_OPTION_ULL to a not-set state.
  *
@@ -76,13 +76,12 @@ EVENT_INTERNAL * evel_new_internal_event(EVT_HANDLER_COMMAND command,const char*
   /***************************************************************************/
   /* Allocate the fault.                                                     */
   /***************************************************************************/
-  event = malloc(sizeof(EVENT_INTERNAL));
+  event = evel_event_alloc(EVEL_DOMAIN_INTERNAL);
   if (event == NULL)
   {
     log_error_state("Out of memory");
     goto exit_label;
   }
-  memset(event, 0, sizeof(EVENT_INTERNAL));
   EVEL_DEBUG("New internal event is at %lp", event);
 
   /***************************************************************************/
@@ -97,6 +96,61 @@ exit_label:
   return event;
 }
 
+/**************************************************************************//**
+ * Create a new internal event carrying an event already encoded as JSON.
+ *
+ * @note    Unlike ::evel_new_internal_event this does not take an event
+ *          sequence number, since the encoded event already has one.
+ * @param   json      The encoded event.  Ownership passes to the new event.
+ * @param   size      The size of the encoded event.
+ * @param   event_id  The ID of the encoded event, for logs.
+ * @returns pointer to the newly manufactured ::EVENT_INTERNAL.  If the event
+ *          is not used (i.e. posted) it must be released using
+ *          ::evel_free_event.
+ * @retval  NULL  Failed to create the event, in which case the caller keeps
+ *                ownership of json.
+ *****************************************************************************/
+EVENT_INTERNAL * evel_new_encoded_internal_event(char * json,
+                                                 size_t size,
+                                                 const char * const event_id)
+{
+  EVENT_INTERNAL * event = NULL;
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(json != NULL);
+
+  /***************************************************************************/
+  /* Allocate the event.                                                     */
+  /***************************************************************************/
+  event = evel_event_alloc(EVEL_DOMAIN_INTERNAL);
+  if (event == NULL)
+  {
+    log_error_state("Out of memory");
+    goto exit_label;
+  }
+  EVEL_DEBUG("New encoded internal event is at %lp", event);
+
+  /***************************************************************************/
+  /* Only the domain and ID of the header are needed.  The rest is left      */
+  /* empty, which evel_free_header copes with.                               */
+  /***************************************************************************/
+  event->header.event_domain = EVEL_DOMAIN_INTERNAL;
+  if (event_id != NULL)
+  {
+    event->header.event_id = strdup(event_id);
+  }
+  event->command = EVT_CMD_POST_ENCODED;
+  event->encoded.memory = json;
+  event->encoded.size = size;
+
+exit_label:
+  EVEL_EXIT();
+  return event;
+}
+
 /**************************************************************************//**
  * Free an internal event.
  *
@@ -118,8 +172,9 @@ void evel_free_internal_event(EVENT_INTERNAL * event)
   assert(event->header.event_domain == EVEL_DOMAIN_INTERNAL);
 
   /***************************************************************************/
-  /* Free the header itself.                                                 */
+  /* Free any encoded event, then the header itself.                         */
   /***************************************************************************/
+  free(event->encoded.memory);
   evel_free_header(&event->header);
 
   EVEL_EXIT();
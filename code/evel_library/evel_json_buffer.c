@@ -35,14 +35,142 @@
  *****************************************************************************/
 
 #include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 
 #include "evel_throttle.h"
 
 /*****************************************************************************/
 /* Local prototypes.                                                         */
 /*****************************************************************************/
-static char * evel_json_kv_comma(EVEL_JSON_BUFFER * jbuf);
+static void evel_json_write_kv_comma(EVEL_JSON_BUFFER * jbuf);
+static void evel_json_write_key(EVEL_JSON_BUFFER * jbuf,
+                                const EVEL_JSON_KEY_ID key);
+static void evel_json_write_integer(EVEL_JSON_BUFFER * jbuf,
+                                    unsigned long long magnitude,
+                                    const bool negative);
+static void evel_json_write_int(EVEL_JSON_BUFFER * jbuf, const int value);
+static void evel_json_write_string(EVEL_JSON_BUFFER * jbuf,
+                                   const char * const value);
+static void evel_json_write_list_comma(EVEL_JSON_BUFFER * jbuf);
+static void evel_json_write_pending(EVEL_JSON_BUFFER * jbuf);
+static void evel_json_defer_open(EVEL_JSON_BUFFER * jbuf,
+                                 const EVEL_JSON_KEY_ID key,
+                                 const bool is_list);
+static bool evel_json_drop_pending(EVEL_JSON_BUFFER * jbuf);
+static void evel_cbor_write_byte(EVEL_JSON_BUFFER * jbuf,
+                                 const unsigned char byte);
+static void evel_cbor_write_head(EVEL_JSON_BUFFER * jbuf,
+                                 const unsigned char major_type,
+                                 unsigned long long argument);
+static void evel_cbor_write_int(EVEL_JSON_BUFFER * jbuf, const int value);
+static void evel_cbor_write_text(EVEL_JSON_BUFFER * jbuf,
+                                 const char * const text,
+                                 const int length);
+static void evel_cbor_write_key(EVEL_JSON_BUFFER * jbuf,
+                                const EVEL_JSON_KEY_ID key);
+static void evel_cbor_write_double(EVEL_JSON_BUFFER * jbuf,
+                                   const double value);
+static char evel_json_last_byte(const EVEL_JSON_BUFFER * const jbuf);
+static void evel_json_note_slot(EVEL_JSON_BUFFER * jbuf,
+                                const EVEL_JSON_KEY_ID key,
+                                const EVEL_TEMPLATE_SLOT_TYPES type,
+                                const int start);
+static void evel_json_reserve(EVEL_JSON_BUFFER * jbuf, const int length);
+static void evel_json_grow(EVEL_JSON_BUFFER * jbuf, const int required);
+static void evel_json_write(EVEL_JSON_BUFFER * jbuf,
+                            const char * const data,
+                            const int length);
+static void evel_json_scratch_key_create(void);
+static void evel_json_scratch_free(void * scratch);
+
+/*****************************************************************************/
+/* Initial size of each thread's scratch buffer.                             */
+/*****************************************************************************/
+#define EVEL_JSON_SCRATCH_SIZE 16384
+
+/*****************************************************************************/
+/* Each thread's scratch buffer and its size, and the key whose destructor   */
+/* frees it when the thread exits.                                           */
+/*****************************************************************************/
+static __thread char * evel_json_scratch = NULL;
+static __thread int evel_json_scratch_size = 0;
+static pthread_key_t evel_json_scratch_key;
+static pthread_once_t evel_json_scratch_key_once = PTHREAD_ONCE_INIT;
+
+/*****************************************************************************/
+/* The name of each ::EVEL_JSON_KEY_ID, indexed by identifier.               */
+/*****************************************************************************/
+const char * const evel_json_key_names[EVEL_MAX_JSON_KEYS] = {
+#define EVEL_JSON_KEY_NAME(id, name) name,
+  EVEL_JSON_KEYS(EVEL_JSON_KEY_NAME)
+#undef EVEL_JSON_KEY_NAME
+};
+
+/**************************************************************************//**
+ * A key pre-quoted for output, as in <tt>"key": </tt>, with its length.
+ *****************************************************************************/
+typedef struct evel_json_key_fragment {
+  const char * const text;
+  const int length;
+} EVEL_JSON_KEY_FRAGMENT;
+
+/*****************************************************************************/
+/* The pre-quoted fragment for each ::EVEL_JSON_KEY_ID, indexed by           */
+/* identifier, built at compile time so that writing a key is one memcpy.    */
+/*****************************************************************************/
+static const EVEL_JSON_KEY_FRAGMENT
+                                 evel_json_key_fragments[EVEL_MAX_JSON_KEYS] = {
+#define EVEL_JSON_KEY_FRAGMENT(id, name) { "\"" name "\": ", sizeof(name) + 3 },
+  EVEL_JSON_KEYS(EVEL_JSON_KEY_FRAGMENT)
+#undef EVEL_JSON_KEY_FRAGMENT
+};
+
+/*****************************************************************************/
+/* The quotes, colon and space around a key in its pre-quoted fragment.      */
+/*****************************************************************************/
+#define EVEL_JSON_KEY_QUOTING_LEN 4
+
+/*****************************************************************************/
+/* Space for the decimal digits and sign of a 64-bit integer.                */
+/*****************************************************************************/
+#define EVEL_JSON_MAX_INTEGER_LEN 21
+
+/*****************************************************************************/
+/* Space for a version formatted as a decimal, as in "12.3".                 */
+/*****************************************************************************/
+#define EVEL_JSON_MAX_VERSION_LEN 24
+
+/*****************************************************************************/
+/* Space for any double formatted with "%1f", the largest having 309 digits  */
+/* before the decimal point.                                                 */
+/*****************************************************************************/
+#define EVEL_JSON_MAX_DOUBLE_LEN 320
+
+/*****************************************************************************/
+/* CBOR major types, in the top three bits of the initial byte of each item. */
+/*****************************************************************************/
+#define EVEL_CBOR_UNSIGNED 0x00
+#define EVEL_CBOR_NEGATIVE 0x20
+#define EVEL_CBOR_BYTES    0x40
+#define EVEL_CBOR_TEXT     0x60
+#define EVEL_CBOR_ARRAY    0x80
+#define EVEL_CBOR_TAG      0xc0
+
+/*****************************************************************************/
+/* CBOR initial bytes with fixed meanings.                                   */
+/*****************************************************************************/
+#define EVEL_CBOR_INDEFINITE_ARRAY 0x9f
+#define EVEL_CBOR_INDEFINITE_MAP   0xbf
+#define EVEL_CBOR_DOUBLE           0xfb
+#define EVEL_CBOR_BREAK            0xff
+
+/*****************************************************************************/
+/* CBOR tag for a byte string holding JSON text.                             */
+/*****************************************************************************/
+#define EVEL_CBOR_TAG_EMBEDDED_JSON 262
 
 /**************************************************************************//**
  * Initialize a ::EVEL_JSON_BUFFER.
@@ -63,120 +191,480 @@ void evel_json_buffer_init(EVEL_JSON_BUFFER * jbuf,
   assert(json != NULL);
   jbuf->json = json;
   jbuf->max_size = max_size;
+  jbuf->space = EVEL_JSON_SPACE_CHECKED;
   jbuf->offset = 0;
+  jbuf->encoding = event_encoding;
   jbuf->throttle_spec = throttle_spec;
   jbuf->depth = 0;
-  jbuf->checkpoint = -1;
+  jbuf->pending_count = 0;
+  jbuf->stream = NULL;
+  jbuf->tmpl = NULL;
 
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Encode an integer value to a JSON buffer.
+ * Initialize a ::EVEL_JSON_BUFFER which only sizes the output.
  *
- * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param value         The integer to add to it.
+ * Nothing is stored, and the offset just counts the bytes which would have
+ * been written, so encoding into the buffer gives the encoded length.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to initialise.
  *****************************************************************************/
-void evel_enc_int(EVEL_JSON_BUFFER * jbuf,
-                  const int value)
+void evel_json_buffer_init_sizing(EVEL_JSON_BUFFER * jbuf)
+{
+  EVEL_ENTER();
+
+  assert(jbuf != NULL);
+  jbuf->json = NULL;
+  jbuf->max_size = INT_MAX;
+  jbuf->space = EVEL_JSON_SPACE_CHECKED;
+  jbuf->offset = 0;
+  jbuf->last = '\0';
+  jbuf->encoding = event_encoding;
+  jbuf->throttle_spec = NULL;
+  jbuf->depth = 0;
+  jbuf->pending_count = 0;
+  jbuf->stream = NULL;
+  jbuf->tmpl = NULL;
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Initialize a ::EVEL_JSON_BUFFER sized to hold all that is written to it,
+ * so that writes need not check for space.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to initialise.
+ * @param json          Pointer to the underlying working buffer to use.
+ * @param max_size      Size of storage available in the JSON buffer, at least
+ *                      one more than ::evel_event_encoded_size gives for
+ *                      what is encoded.
+ * @param throttle_spec Pointer to throttle specification. Can be NULL.
+ *****************************************************************************/
+void evel_json_buffer_init_sized(EVEL_JSON_BUFFER * jbuf,
+                                 char * const json,
+                                 const int max_size,
+                                 EVEL_THROTTLE_SPEC * throttle_spec)
+{
+  EVEL_ENTER();
+
+  evel_json_buffer_init(jbuf, json, max_size, throttle_spec);
+  jbuf->space = EVEL_JSON_SPACE_SIZED;
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Initialize a ::EVEL_JSON_BUFFER writing into the calling thread's scratch
+ * buffer, which grows as needed.
+ *
+ * The buffer must be handed back with ::evel_json_buffer_copy_scratch.
+ *
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to initialise.
+ * @param throttle_spec Pointer to throttle specification. Can be NULL.
+ * @returns Whether the scratch buffer could be allocated.
+ *****************************************************************************/
+bool evel_json_buffer_init_scratch(EVEL_JSON_BUFFER * jbuf,
+                                   EVEL_THROTTLE_SPEC * throttle_spec)
 {
+  bool initialized = false;
+
   EVEL_ENTER();
 
   /***************************************************************************/
-  /* Check preconditions.                                                    */
+  /* Allocate the scratch buffer on first use, making sure it is freed when  */
+  /* we exit.                                                                */
   /***************************************************************************/
-  assert(jbuf != NULL);
+  if (evel_json_scratch == NULL)
+  {
+    evel_json_scratch = malloc(EVEL_JSON_SCRATCH_SIZE);
+    if (evel_json_scratch == NULL)
+    {
+      log_error_state("Out of memory");
+      goto exit_label;
+    }
+    evel_json_scratch_size = EVEL_JSON_SCRATCH_SIZE;
+    pthread_once(&evel_json_scratch_key_once, evel_json_scratch_key_create);
+    pthread_setspecific(evel_json_scratch_key, evel_json_scratch);
+  }
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "%d", value);
+  evel_json_buffer_init(jbuf,
+                        evel_json_scratch,
+                        evel_json_scratch_size,
+                        throttle_spec);
+  jbuf->space = EVEL_JSON_SPACE_GROWN;
+  initialized = true;
 
+exit_label:
   EVEL_EXIT();
+  return initialized;
 }
 
 /**************************************************************************//**
- * Encode a string key and string value to a ::EVEL_JSON_BUFFER.
+ * Copy the output from a ::EVEL_JSON_BUFFER initialized with
+ * ::evel_json_buffer_init_scratch, handing the scratch buffer back.
  *
- * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
- * @param option        Pointer to holder of the corresponding value to encode.
- * @return true if the key, value was added, false if it was suppressed.
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER.
+ * @returns The ASCIIZ output, allocated with malloc at its exact size.
+ * @retval  NULL  Out of memory, either for the copy or to grow the scratch
+ *                buffer while writing.
  *****************************************************************************/
-bool evel_enc_kv_opt_string(EVEL_JSON_BUFFER * jbuf,
-                            const char * const key,
-                            const EVEL_OPTION_STRING * const option)
+char * evel_json_buffer_copy_scratch(EVEL_JSON_BUFFER * jbuf)
 {
-  bool added = false;
+  char * copy = NULL;
 
   EVEL_ENTER();
 
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
-  assert(option != NULL);
+  assert(jbuf != NULL);
+  assert(jbuf->stream == NULL);
 
-  if (option->is_set)
+  /***************************************************************************/
+  /* Keep the buffer, which may have been grown, for the thread's next use.  */
+  /***************************************************************************/
+  if (jbuf->json != evel_json_scratch)
   {
-    if ((jbuf->depth == EVEL_THROTTLE_FIELD_DEPTH) &&
-        (jbuf->throttle_spec != NULL) &&
-        evel_throttle_suppress_field(jbuf->throttle_spec, key))
+    evel_json_scratch = jbuf->json;
+    evel_json_scratch_size = jbuf->max_size;
+    pthread_setspecific(evel_json_scratch_key, evel_json_scratch);
+  }
+
+  /***************************************************************************/
+  /* If the buffer could not grow then the output was truncated.             */
+  /***************************************************************************/
+  if (jbuf->space != EVEL_JSON_SPACE_GROWN)
+  {
+    goto exit_label;
+  }
+
+  copy = malloc(jbuf->offset + 1);
+  if (copy == NULL)
+  {
+    log_error_state("Out of memory");
+    goto exit_label;
+  }
+  memcpy(copy, jbuf->json, jbuf->offset);
+  copy[jbuf->offset] = '\0';
+
+exit_label:
+  EVEL_EXIT();
+  return copy;
+}
+
+/**************************************************************************//**
+ * Make sure there is space for some output in a streaming or growing JSON
+ * buffer.
+ *
+ * This is a no-op for other buffers, where the caller is expected to check
+ * the space remaining itself.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param length        Number of bytes of output, excluding the NUL.
+ *****************************************************************************/
+static void evel_json_reserve(EVEL_JSON_BUFFER * jbuf, const int length)
+{
+  if (jbuf->max_size - jbuf->offset <= length)
+  {
+    if (jbuf->stream != NULL)
     {
-      EVEL_INFO("Suppressed: %s, %s", key, option->value);
+      evel_json_stream_flush(jbuf, length + 1);
     }
-    else
+    else if (jbuf->space == EVEL_JSON_SPACE_GROWN)
     {
-      EVEL_DEBUG("Encoded: %s, %s", key, option->value);
-      evel_enc_kv_string(jbuf, key, option->value);
-      added = true;
+      evel_json_grow(jbuf, length + 1);
     }
   }
+}
 
-  EVEL_EXIT();
+/**************************************************************************//**
+ * Grow a growing JSON buffer.
+ *
+ * If it cannot grow then the buffer goes back to checking the space on each
+ * write, truncating the rest of the output.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param required      Number of bytes needed beyond the output so far.
+ *****************************************************************************/
+static void evel_json_grow(EVEL_JSON_BUFFER * jbuf, const int required)
+{
+  char * json;
+  int size = jbuf->max_size;
 
-  return added;
+  while (size - jbuf->offset < required)
+  {
+    size *= 2;
+  }
+
+  EVEL_DEBUG("Growing JSON buffer to %d bytes", size);
+  json = realloc(jbuf->json, size);
+  if (json == NULL)
+  {
+    log_error_state("Out of memory");
+    jbuf->space = EVEL_JSON_SPACE_CHECKED;
+    return;
+  }
+  jbuf->json = json;
+  jbuf->max_size = size;
 }
 
 /**************************************************************************//**
- * Encode a string key and string value to a ::EVEL_JSON_BUFFER.
+ * Create the key whose destructor frees a thread's scratch buffer.
+ *****************************************************************************/
+static void evel_json_scratch_key_create(void)
+{
+  pthread_key_create(&evel_json_scratch_key, evel_json_scratch_free);
+}
+
+/**************************************************************************//**
+ * Free a thread's scratch buffer as the thread exits.
+ *
+ * @param scratch       The scratch buffer.
+ *****************************************************************************/
+static void evel_json_scratch_free(void * scratch)
+{
+  free(scratch);
+  evel_json_scratch = NULL;
+  evel_json_scratch_size = 0;
+}
+
+/**************************************************************************//**
+ * Write raw data to a JSON buffer.
+ *
+ * If the data does not fit then, when streaming, the buffer is handed on to
+ * the stream first.  Otherwise the data is truncated.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
- * @param value         Pointer to the corresponding value to encode.
+ * @param data          Pointer to the data to write.
+ * @param length        Number of bytes of data.
  *****************************************************************************/
-void evel_enc_kv_string(EVEL_JSON_BUFFER * jbuf,
-                        const char * const key,
-                        const char * const value)
+static void evel_json_write(EVEL_JSON_BUFFER * jbuf,
+                            const char * const data,
+                            const int length)
 {
-  int index;
-  int length;
+  int bytes_to_write;
 
-  EVEL_ENTER();
+  if (jbuf->json == NULL)
+  {
+    if (length > 0)
+    {
+      jbuf->offset += length;
+      jbuf->last = data[length - 1];
+    }
+    return;
+  }
+
+  evel_json_reserve(jbuf, length);
 
   /***************************************************************************/
-  /* Check preconditions.                                                    */
+  /* Only a buffer which may run out of space needs to check the length.     */
   /***************************************************************************/
-  assert(jbuf != NULL);
-  assert(key != NULL);
+  if (jbuf->space == EVEL_JSON_SPACE_CHECKED)
+  {
+    bytes_to_write = min(length, jbuf->max_size - jbuf->offset - 1);
+  }
+  else
+  {
+    assert(jbuf->max_size - jbuf->offset > length);
+    bytes_to_write = length;
+  }
+  if (bytes_to_write > 0)
+  {
+    memcpy(jbuf->json + jbuf->offset, data, bytes_to_write);
+    jbuf->offset += bytes_to_write;
+    jbuf->json[jbuf->offset] = '\0';
+  }
+}
+
+/**************************************************************************//**
+ * Get the last byte written to a JSON buffer, which decides the punctuation
+ * needed before the next item.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @returns The last byte written, or NUL if nothing has been.
+ *****************************************************************************/
+static char evel_json_last_byte(const EVEL_JSON_BUFFER * const jbuf)
+{
+  if (jbuf->offset == 0)
+  {
+    return '\0';
+  }
+  return (jbuf->json == NULL) ? jbuf->last : jbuf->json[jbuf->offset - 1];
+}
+
+/**************************************************************************//**
+ * Note a value just written as a slot of the template being built, if any.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Identifier of the key the value was written for.
+ * @param type          The type of the value.
+ * @param start         Offset at which the value starts.
+ *****************************************************************************/
+static void evel_json_note_slot(EVEL_JSON_BUFFER * jbuf,
+                                const EVEL_JSON_KEY_ID key,
+                                const EVEL_TEMPLATE_SLOT_TYPES type,
+                                const int start)
+{
+  if (jbuf->tmpl != NULL)
+  {
+    evel_template_add_slot(jbuf->tmpl, key, type, start, jbuf->offset - start);
+  }
+}
+
+/**************************************************************************//**
+ * Write a comma to a JSON buffer if one is required before a key-value pair.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ *****************************************************************************/
+static void evel_json_write_kv_comma(EVEL_JSON_BUFFER * jbuf)
+{
+  const char last = evel_json_last_byte(jbuf);
+
+  if ((last != '\0') && (last != '{') && (last != '['))
+  {
+    evel_json_write(jbuf, ", ", 2);
+  }
+}
+
+/**************************************************************************//**
+ * Write the comma, if required, and a pre-quoted key to a JSON buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Identifier of the key to write.
+ *****************************************************************************/
+static void evel_json_write_key(EVEL_JSON_BUFFER * jbuf,
+                                const EVEL_JSON_KEY_ID key)
+{
+  assert(key < EVEL_MAX_JSON_KEYS);
+
+  evel_json_write_kv_comma(jbuf);
+  evel_json_write(jbuf,
+                  evel_json_key_fragments[key].text,
+                  evel_json_key_fragments[key].length);
+}
+
+/**************************************************************************//**
+ * Write an integer to a JSON buffer in decimal, as printf's %d or %llu would.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param magnitude     The absolute value of the integer.
+ * @param negative      Whether the integer is negative.
+ *****************************************************************************/
+static void evel_json_write_integer(EVEL_JSON_BUFFER * jbuf,
+                                    unsigned long long magnitude,
+                                    const bool negative)
+{
+  char digits[EVEL_JSON_MAX_INTEGER_LEN];
+  char * digit = digits + sizeof(digits);
+
+  do
+  {
+    *--digit = '0' + (magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+
+  if (negative)
+  {
+    *--digit = '-';
+  }
+
+  evel_json_write(jbuf, digit, digits + sizeof(digits) - digit);
+}
+
+/**************************************************************************//**
+ * Write an int to a JSON buffer in decimal.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         The integer to write.
+ *****************************************************************************/
+static void evel_json_write_int(EVEL_JSON_BUFFER * jbuf, const int value)
+{
+  if (value < 0)
+  {
+    evel_json_write_integer(jbuf, -(unsigned long long) value, true);
+  }
+  else
+  {
+    evel_json_write_integer(jbuf, value, false);
+  }
+}
+
+/**************************************************************************//**
+ * Write a string to a JSON buffer, quoted and with quotation marks and
+ * backslashes escaped.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         Pointer to the string to write.
+ *****************************************************************************/
+static void evel_json_write_string(EVEL_JSON_BUFFER * jbuf,
+                                   const char * const value)
+{
+  char * output;
+  int index;
+  int length;
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "%s\"%s\": \"",
-                           evel_json_kv_comma(jbuf),
-                           key);
+  evel_json_write(jbuf, "\"", 1);
 
   /***************************************************************************/
   /* We need to escape quotation marks and backslashes in the value.         */
   /***************************************************************************/
   length = strlen(value);
 
+  /***************************************************************************/
+  /* If only sizing the output then just count the escapes needed.          */
+  /***************************************************************************/
+  if (jbuf->json == NULL)
+  {
+    for (index = 0; index < length; index++)
+    {
+      if ((value[index] == '\"') || (value[index] == '\\'))
+      {
+        jbuf->offset++;
+      }
+    }
+    jbuf->offset += length;
+    length = 0;
+  }
+  else if (jbuf->space != EVEL_JSON_SPACE_CHECKED)
+  {
+    /*************************************************************************/
+    /* There is sure to be space, even were every character escaped, so copy */
+    /* without checking.                                                     */
+    /*************************************************************************/
+    evel_json_reserve(jbuf, 2 * length);
+    if (jbuf->space != EVEL_JSON_SPACE_CHECKED)
+    {
+      assert((jbuf->space == EVEL_JSON_SPACE_SIZED) ||
+             (jbuf->max_size - jbuf->offset > 2 * length));
+      output = jbuf->json + jbuf->offset;
+      for (index = 0; index < length; index++)
+      {
+        if ((value[index] == '\"') || (value[index] == '\\'))
+        {
+          *output++ = '\\';
+        }
+        *output++ = value[index];
+      }
+      jbuf->offset = output - jbuf->json;
+      length = 0;
+    }
+  }
+
   for (index = 0; index < length; index++)
   {
     /*************************************************************************/
-    /* Drop out if no more space.                                            */
+    /* Drop out if no more space, unless we are streaming in which case we   */
+    /* hand the buffer on and carry on into the next window.                 */
     /*************************************************************************/
     if (jbuf->max_size - jbuf->offset < 2)
     {
-      break;
+      if (jbuf->stream == NULL)
+      {
+        break;
+      }
+      evel_json_stream_flush(jbuf, 2);
     }
 
     /*************************************************************************/
@@ -193,47 +681,482 @@ void evel_enc_kv_string(EVEL_JSON_BUFFER * jbuf,
     jbuf->offset++;
   }
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "\"");
+  evel_json_write(jbuf, "\"", 1);
+}
+
+/**************************************************************************//**
+ * Write a single byte to a CBOR buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param byte          The byte to write.
+ *****************************************************************************/
+static void evel_cbor_write_byte(EVEL_JSON_BUFFER * jbuf,
+                                 const unsigned char byte)
+{
+  const char data = (char) byte;
+
+  evel_json_write(jbuf, &data, 1);
+}
+
+/**************************************************************************//**
+ * Write the head of a CBOR data item: the initial byte, giving the major
+ * type, followed by the argument in as few big-endian bytes as it needs.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param major_type    One of the EVEL_CBOR_ major types.
+ * @param argument      The value, length or tag number of the item.
+ *****************************************************************************/
+static void evel_cbor_write_head(EVEL_JSON_BUFFER * jbuf,
+                                 const unsigned char major_type,
+                                 unsigned long long argument)
+{
+  char head[9];
+  int length;
+  int index;
+
+  if (argument < 24)
+  {
+    head[0] = (char) (major_type | argument);
+    length = 1;
+  }
+  else if (argument <= 0xff)
+  {
+    head[0] = (char) (major_type | 24);
+    length = 2;
+  }
+  else if (argument <= 0xffff)
+  {
+    head[0] = (char) (major_type | 25);
+    length = 3;
+  }
+  else if (argument <= 0xffffffff)
+  {
+    head[0] = (char) (major_type | 26);
+    length = 5;
+  }
+  else
+  {
+    head[0] = (char) (major_type | 27);
+    length = 9;
+  }
+
+  for (index = length - 1; index > 0; index--)
+  {
+    head[index] = (char) (argument & 0xff);
+    argument >>= 8;
+  }
+
+  evel_json_write(jbuf, head, length);
+}
+
+/**************************************************************************//**
+ * Write an int to a CBOR buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         The integer to write.
+ *****************************************************************************/
+static void evel_cbor_write_int(EVEL_JSON_BUFFER * jbuf, const int value)
+{
+  if (value < 0)
+  {
+    evel_cbor_write_head(jbuf,
+                         EVEL_CBOR_NEGATIVE,
+                         (unsigned long long) (-(value + 1)));
+  }
+  else
+  {
+    evel_cbor_write_head(jbuf, EVEL_CBOR_UNSIGNED, value);
+  }
+}
+
+/**************************************************************************//**
+ * Write a text string to a CBOR buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param text          Pointer to the UTF-8 text to write.
+ * @param length        Number of bytes of text.
+ *****************************************************************************/
+static void evel_cbor_write_text(EVEL_JSON_BUFFER * jbuf,
+                                 const char * const text,
+                                 const int length)
+{
+  evel_cbor_write_head(jbuf, EVEL_CBOR_TEXT, length);
+  evel_json_write(jbuf, text, length);
+}
+
+/**************************************************************************//**
+ * Write a key to a CBOR buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Identifier of the key to write.
+ *****************************************************************************/
+static void evel_cbor_write_key(EVEL_JSON_BUFFER * jbuf,
+                                const EVEL_JSON_KEY_ID key)
+{
+  assert(key < EVEL_MAX_JSON_KEYS);
+
+  evel_cbor_write_text(jbuf,
+                       evel_json_key_names[key],
+                       evel_json_key_fragments[key].length -
+                                                    EVEL_JSON_KEY_QUOTING_LEN);
+}
+
+/**************************************************************************//**
+ * Write a double to a CBOR buffer, as a big-endian IEEE 754 double.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         The double to write.
+ *****************************************************************************/
+static void evel_cbor_write_double(EVEL_JSON_BUFFER * jbuf,
+                                   const double value)
+{
+  unsigned long long bits;
+  char data[8];
+  int index;
+
+  EVEL_CT_ASSERT(sizeof(bits) == sizeof(value));
+  memcpy(&bits, &value, sizeof(bits));
+  for (index = sizeof(data) - 1; index >= 0; index--)
+  {
+    data[index] = (char) (bits & 0xff);
+    bits >>= 8;
+  }
+
+  evel_cbor_write_byte(jbuf, EVEL_CBOR_DOUBLE);
+  evel_json_write(jbuf, data, sizeof(data));
+}
+
+/**************************************************************************//**
+ * Encode a pre-encoded key and value to a ::EVEL_JSON_BUFFER.
+ *
+ * The fragment is copied verbatim, so must already be one or more key-value
+ * pairs in the buffer's encoding: comma-separated, if JSON.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param fragment      Pointer to the encoded key-value pairs.
+ * @param length        Length of the fragment.
+ *****************************************************************************/
+void evel_enc_kv_fragment(EVEL_JSON_BUFFER * jbuf,
+                          const char * const fragment,
+                          const int length)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(jbuf != NULL);
+  assert(fragment != NULL);
+
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_JSON)
+  {
+    evel_json_write_kv_comma(jbuf);
+  }
+  evel_json_write(jbuf, fragment, length);
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Encode an integer value to a JSON buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         The integer to add to it.
+ *****************************************************************************/
+void evel_enc_int(EVEL_JSON_BUFFER * jbuf,
+                  const int value)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(jbuf != NULL);
+
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_int(jbuf, value);
+  }
+  else
+  {
+    evel_json_write_int(jbuf, value);
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Encode a string value to a JSON buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         Pointer to the string to add to it.
+ *****************************************************************************/
+void evel_enc_string(EVEL_JSON_BUFFER * jbuf,
+                     const char * const value)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(jbuf != NULL);
+  assert(value != NULL);
+
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_text(jbuf, value, strlen(value));
+  }
+  else
+  {
+    evel_json_write_string(jbuf, value);
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Encode a double value to a JSON buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         The double to add to it.
+ *****************************************************************************/
+void evel_enc_double(EVEL_JSON_BUFFER * jbuf,
+                     const double value)
+{
+  char number[EVEL_JSON_MAX_DOUBLE_LEN];
+  int length;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(jbuf != NULL);
+
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_double(jbuf, value);
+  }
+  else
+  {
+    length = snprintf(number, sizeof(number), "%1f", value);
+    evel_json_write(jbuf, number, min(length, (int) sizeof(number) - 1));
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Encode an unsigned long long value to a JSON buffer.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         The integer to add to it.
+ *****************************************************************************/
+void evel_enc_ull(EVEL_JSON_BUFFER * jbuf,
+                  const unsigned long long value)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(jbuf != NULL);
+
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_head(jbuf, EVEL_CBOR_UNSIGNED, value);
+  }
+  else
+  {
+    evel_json_write_integer(jbuf, value, false);
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Encode a string key and string value to a ::EVEL_JSON_BUFFER.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Identifier of the key to encode.
+ * @param option        Pointer to holder of the corresponding value to encode.
+ * @return true if the key, value was added, false if it was suppressed.
+ *****************************************************************************/
+bool evel_enc_kv_opt_string(EVEL_JSON_BUFFER * jbuf,
+                            const EVEL_JSON_KEY_ID key,
+                            const EVEL_OPTION_STRING * const option)
+{
+  bool added = false;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(option != NULL);
+
+  if (option->is_set)
+  {
+    if ((jbuf->depth == EVEL_THROTTLE_FIELD_DEPTH) &&
+        (jbuf->throttle_spec != NULL) &&
+        evel_throttle_suppress_field(jbuf->throttle_spec, key))
+    {
+      EVEL_INFO("Suppressed: %s, %s", evel_json_key_names[key], option->value);
+    }
+    else
+    {
+      EVEL_DEBUG("Encoded: %s, %s", evel_json_key_names[key], option->value);
+      evel_enc_kv_string(jbuf, key, option->value);
+      added = true;
+    }
+  }
+
+  EVEL_EXIT();
+
+  return added;
+}
+
+/**************************************************************************//**
+ * Encode a string key and string value to a ::EVEL_JSON_BUFFER.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Identifier of the key to encode.
+ * @param value         Pointer to the corresponding value to encode.
+ *****************************************************************************/
+void evel_enc_kv_string(EVEL_JSON_BUFFER * jbuf,
+                        const EVEL_JSON_KEY_ID key,
+                        const char * const value)
+{
+  int start;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(jbuf != NULL);
+  assert(value != NULL);
+
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_key(jbuf, key);
+  }
+  else
+  {
+    evel_json_write_key(jbuf, key);
+  }
+  start = jbuf->offset;
+  evel_enc_string(jbuf, value);
+  if (key == EVEL_KEY_EVENT_ID)
+  {
+    evel_json_note_slot(jbuf, key, EVEL_TEMPLATE_SLOT_STRING, start);
+  }
+
+  EVEL_EXIT();
+}
+
+
+/**************************************************************************//**
+ * Encode a string key and integer value to a ::EVEL_JSON_BUFFER.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Identifier of the key to encode.
+ * @param option        Pointer to holder of the corresponding value to encode.
+ * @return true if the key, value was added, false if it was suppressed.
+ *****************************************************************************/
+bool evel_enc_kv_opt_int(EVEL_JSON_BUFFER * jbuf,
+                         const EVEL_JSON_KEY_ID key,
+                         const EVEL_OPTION_INT * const option)
+{
+  bool added = false;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(option != NULL);
+
+  if (option->is_set)
+  {
+    if ((jbuf->depth == EVEL_THROTTLE_FIELD_DEPTH) &&
+        (jbuf->throttle_spec != NULL) &&
+        evel_throttle_suppress_field(jbuf->throttle_spec, key))
+    {
+      EVEL_INFO("Suppressed: %s, %d", evel_json_key_names[key], option->value);
+    }
+    else
+    {
+      EVEL_DEBUG("Encoded: %s, %d", evel_json_key_names[key], option->value);
+      evel_enc_kv_int(jbuf, key, option->value);
+      added = true;
+    }
+  }
 
   EVEL_EXIT();
-}
 
+  return added;
+}
 
 /**************************************************************************//**
- * Encode a string key and integer value to a ::EVEL_JSON_BUFFER.
+ * Encode a structure's packed optional int fields to a
+ * ::EVEL_JSON_BUFFER, in field order.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
- * @param option        Pointer to holder of the corresponding value to encode.
- * @return true if the key, value was added, false if it was suppressed.
+ * @param keys          Identifiers of the keys to encode, indexed by field.
+ * @param present       ::EVEL_OPTION_BITMAP of the fields which are set.
+ * @param values        The structure's array of packed values.
+ * @return true if any key, value was added, false if none were.
  *****************************************************************************/
-bool evel_enc_kv_opt_int(EVEL_JSON_BUFFER * jbuf,
-                         const char * const key,
-                         const EVEL_OPTION_INT * const option)
+bool evel_enc_kv_packed_ints(EVEL_JSON_BUFFER * jbuf,
+                             const EVEL_JSON_KEY_ID * const keys,
+                             EVEL_OPTION_BITMAP present,
+                             const int * const values)
 {
   bool added = false;
+  EVEL_JSON_KEY_ID key;
+  int field;
 
   EVEL_ENTER();
 
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
-  assert(option != NULL);
+  assert(jbuf != NULL);
+  assert(keys != NULL);
+  assert(values != NULL);
 
-  if (option->is_set)
+  /***************************************************************************/
+  /* Visit only the fields which are set, lowest first.                      */
+  /***************************************************************************/
+  while (present != 0)
   {
+    field = __builtin_ctzll(present);
+    present &= present - 1;
+    key = keys[field];
+
     if ((jbuf->depth == EVEL_THROTTLE_FIELD_DEPTH) &&
         (jbuf->throttle_spec != NULL) &&
         evel_throttle_suppress_field(jbuf->throttle_spec, key))
     {
-      EVEL_INFO("Suppressed: %s, %d", key, option->value);
+      EVEL_INFO("Suppressed: %s, %d", evel_json_key_names[key], values[field]);
     }
     else
     {
-      EVEL_DEBUG("Encoded: %s, %d", key, option->value);
-      evel_enc_kv_int(jbuf, key, option->value);
+      EVEL_DEBUG("Encoded: %s, %d", evel_json_key_names[key], values[field]);
+      evel_enc_kv_int(jbuf, key, values[field]);
       added = true;
     }
   }
@@ -247,27 +1170,38 @@ bool evel_enc_kv_opt_int(EVEL_JSON_BUFFER * jbuf,
  * Encode a string key and integer value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param value         The corresponding value to encode.
  *****************************************************************************/
 void evel_enc_kv_int(EVEL_JSON_BUFFER * jbuf,
-                     const char * const key,
+                     const EVEL_JSON_KEY_ID key,
                      const int value)
 {
+  int start;
+
   EVEL_ENTER();
 
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(key != NULL);
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "%s\"%s\": %d",
-                           evel_json_kv_comma(jbuf),
-                           key,
-                           value);
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_key(jbuf, key);
+  }
+  else
+  {
+    evel_json_write_key(jbuf, key);
+  }
+  start = jbuf->offset;
+  evel_enc_int(jbuf, value);
+  if (key == EVEL_KEY_SEQUENCE)
+  {
+    evel_json_note_slot(jbuf, key, EVEL_TEMPLATE_SLOT_INT, start);
+  }
 
   EVEL_EXIT();
 }
@@ -275,13 +1209,16 @@ void evel_enc_kv_int(EVEL_JSON_BUFFER * jbuf,
 /**************************************************************************//**
  * Encode a string key and json object value to a ::EVEL_JSON_BUFFER.
  *
+ * In CBOR the object is written as a byte string holding the JSON text,
+ * tagged as embedded JSON.
+ *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param value         The corresponding json string to encode.
  *****************************************************************************/
 void evel_enc_kv_object(EVEL_JSON_BUFFER * jbuf,
-                     const char * const key,
-                     const char * value)
+                        const EVEL_JSON_KEY_ID key,
+                        const char * value)
 {
   EVEL_ENTER();
 
@@ -289,14 +1226,21 @@ void evel_enc_kv_object(EVEL_JSON_BUFFER * jbuf,
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(key != NULL);
+  assert(value != NULL);
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "%s\"%s\": %s",
-                           evel_json_kv_comma(jbuf),
-                           key,
-                           value);
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_key(jbuf, key);
+    evel_cbor_write_head(jbuf, EVEL_CBOR_TAG, EVEL_CBOR_TAG_EMBEDDED_JSON);
+    evel_cbor_write_head(jbuf, EVEL_CBOR_BYTES, strlen(value));
+  }
+  else
+  {
+    evel_json_write_key(jbuf, key);
+  }
+  evel_json_write(jbuf, value, strlen(value));
 
   EVEL_EXIT();
 }
@@ -305,12 +1249,12 @@ void evel_enc_kv_object(EVEL_JSON_BUFFER * jbuf,
  * Encode a string key and double value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param option        Pointer to holder of the corresponding value to encode.
  * @return true if the key, value was added, false if it was suppressed.
  *****************************************************************************/
 bool evel_enc_kv_opt_double(EVEL_JSON_BUFFER * jbuf,
-                            const char * const key,
+                            const EVEL_JSON_KEY_ID key,
                             const EVEL_OPTION_DOUBLE * const option)
 {
   bool added = false;
@@ -328,11 +1272,11 @@ bool evel_enc_kv_opt_double(EVEL_JSON_BUFFER * jbuf,
         (jbuf->throttle_spec != NULL) &&
         evel_throttle_suppress_field(jbuf->throttle_spec, key))
     {
-      EVEL_INFO("Suppressed: %s, %1f", key, option->value);
+      EVEL_INFO("Suppressed: %s, %1f", evel_json_key_names[key], option->value);
     }
     else
     {
-      EVEL_DEBUG("Encoded: %s, %1f", key, option->value);
+      EVEL_DEBUG("Encoded: %s, %1f", evel_json_key_names[key], option->value);
       evel_enc_kv_double(jbuf, key, option->value);
       added = true;
     }
@@ -343,31 +1287,95 @@ bool evel_enc_kv_opt_double(EVEL_JSON_BUFFER * jbuf,
   return added;
 }
 
+/**************************************************************************//**
+ * Encode a structure's packed optional double fields to a
+ * ::EVEL_JSON_BUFFER, in field order.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param keys          Identifiers of the keys to encode, indexed by field.
+ * @param present       ::EVEL_OPTION_BITMAP of the fields which are set.
+ * @param values        The structure's array of packed values.
+ * @return true if any key, value was added, false if none were.
+ *****************************************************************************/
+bool evel_enc_kv_packed_doubles(EVEL_JSON_BUFFER * jbuf,
+                                const EVEL_JSON_KEY_ID * const keys,
+                                EVEL_OPTION_BITMAP present,
+                                const double * const values)
+{
+  bool added = false;
+  EVEL_JSON_KEY_ID key;
+  int field;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(jbuf != NULL);
+  assert(keys != NULL);
+  assert(values != NULL);
+
+  /***************************************************************************/
+  /* Visit only the fields which are set, lowest first.                      */
+  /***************************************************************************/
+  while (present != 0)
+  {
+    field = __builtin_ctzll(present);
+    present &= present - 1;
+    key = keys[field];
+
+    if ((jbuf->depth == EVEL_THROTTLE_FIELD_DEPTH) &&
+        (jbuf->throttle_spec != NULL) &&
+        evel_throttle_suppress_field(jbuf->throttle_spec, key))
+    {
+      EVEL_INFO("Suppressed: %s, %1f", evel_json_key_names[key], values[field]);
+    }
+    else
+    {
+      EVEL_DEBUG("Encoded: %s, %1f", evel_json_key_names[key], values[field]);
+      evel_enc_kv_double(jbuf, key, values[field]);
+      added = true;
+    }
+  }
+
+  EVEL_EXIT();
+
+  return added;
+}
+
 /**************************************************************************//**
  * Encode a string key and double value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param value         The corresponding value to encode.
  *****************************************************************************/
 void evel_enc_kv_double(EVEL_JSON_BUFFER * jbuf,
-                        const char * const key,
+                        const EVEL_JSON_KEY_ID key,
                         const double value)
 {
+  int start;
+
   EVEL_ENTER();
 
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(key != NULL);
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "%s\"%s\": %1f",
-                           evel_json_kv_comma(jbuf),
-                           key,
-                           value);
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_key(jbuf, key);
+  }
+  else
+  {
+    evel_json_write_key(jbuf, key);
+  }
+  start = jbuf->offset;
+  evel_enc_double(jbuf, value);
+  evel_json_note_slot(jbuf, key, EVEL_TEMPLATE_SLOT_DOUBLE, start);
 
   EVEL_EXIT();
 }
@@ -376,12 +1384,12 @@ void evel_enc_kv_double(EVEL_JSON_BUFFER * jbuf,
  * Encode a string key and unsigned long long value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param option        Pointer to holder of the corresponding value to encode.
  * @return true if the key, value was added, false if it was suppressed.
  *****************************************************************************/
 bool evel_enc_kv_opt_ull(EVEL_JSON_BUFFER * jbuf,
-                         const char * const key,
+                         const EVEL_JSON_KEY_ID key,
                          const EVEL_OPTION_ULL * const option)
 {
   bool added = false;
@@ -399,11 +1407,12 @@ bool evel_enc_kv_opt_ull(EVEL_JSON_BUFFER * jbuf,
         (jbuf->throttle_spec != NULL) &&
         evel_throttle_suppress_field(jbuf->throttle_spec, key))
     {
-      EVEL_INFO("Suppressed: %s, %1lu", key, option->value);
+      EVEL_INFO("Suppressed: %s, %1lu",
+                evel_json_key_names[key], option->value);
     }
     else
     {
-      EVEL_DEBUG("Encoded: %s, %1lu", key, option->value);
+      EVEL_DEBUG("Encoded: %s, %1lu", evel_json_key_names[key], option->value);
       evel_enc_kv_ull(jbuf, key, option->value);
       added = true;
     }
@@ -418,27 +1427,35 @@ bool evel_enc_kv_opt_ull(EVEL_JSON_BUFFER * jbuf,
  * Encode a string key and unsigned long long value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param value         The corresponding value to encode.
  *****************************************************************************/
 void evel_enc_kv_ull(EVEL_JSON_BUFFER * jbuf,
-                     const char * const key,
+                     const EVEL_JSON_KEY_ID key,
                      const unsigned long long value)
 {
+  int start;
+
   EVEL_ENTER();
 
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(key != NULL);
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "%s\"%s\": %llu",
-                           evel_json_kv_comma(jbuf),
-                           key,
-                           value);
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_key(jbuf, key);
+  }
+  else
+  {
+    evel_json_write_key(jbuf, key);
+  }
+  start = jbuf->offset;
+  evel_enc_ull(jbuf, value);
+  evel_json_note_slot(jbuf, key, EVEL_TEMPLATE_SLOT_ULL, start);
 
   EVEL_EXIT();
 }
@@ -447,12 +1464,12 @@ void evel_enc_kv_ull(EVEL_JSON_BUFFER * jbuf,
  * Encode a string key and time value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param option        Pointer to holder of the corresponding value to encode.
  * @return true if the key, value was added, false if it was suppressed.
  *****************************************************************************/
 bool evel_enc_kv_opt_time(EVEL_JSON_BUFFER * jbuf,
-                          const char * const key,
+                          const EVEL_JSON_KEY_ID key,
                           const EVEL_OPTION_TIME * const option)
 {
   bool added = false;
@@ -470,11 +1487,11 @@ bool evel_enc_kv_opt_time(EVEL_JSON_BUFFER * jbuf,
         (jbuf->throttle_spec != NULL) &&
         evel_throttle_suppress_field(jbuf->throttle_spec, key))
     {
-      EVEL_INFO("Suppressed time: %s", key);
+      EVEL_INFO("Suppressed time: %s", evel_json_key_names[key]);
     }
     else
     {
-      EVEL_DEBUG("Encoded time: %s", key);
+      EVEL_DEBUG("Encoded time: %s", evel_json_key_names[key]);
       evel_enc_kv_time(jbuf, key, &option->value);
       added = true;
     }
@@ -489,79 +1506,101 @@ bool evel_enc_kv_opt_time(EVEL_JSON_BUFFER * jbuf,
  * Encode a string key and time value to a ::EVEL_JSON_BUFFER.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param time          Pointer to the time to encode.
  *****************************************************************************/
 void evel_enc_kv_time(EVEL_JSON_BUFFER * jbuf,
-                      const char * const key,
+                      const EVEL_JSON_KEY_ID key,
                       const time_t * time)
 {
+  char time_string[EVEL_MAX_TIME_STRING_LEN];
+  int time_length;
+
   EVEL_ENTER();
 
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(key != NULL);
   assert(time != NULL);
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "%s\"%s\": \"",
-                           evel_json_kv_comma(jbuf),
-                           key);
-  jbuf->offset += strftime(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           EVEL_RFC2822_STRFTIME_FORMAT,
-                           localtime(time));
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "\"");
+  evel_json_write_pending(jbuf);
+
+  time_length = strftime(time_string,
+                         sizeof(time_string),
+                         EVEL_RFC2822_STRFTIME_FORMAT,
+                         localtime(time));
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_key(jbuf, key);
+    evel_cbor_write_text(jbuf, time_string, time_length);
+  }
+  else
+  {
+    evel_json_write_key(jbuf, key);
+    evel_json_write(jbuf, "\"", 1);
+    evel_json_write(jbuf, time_string, time_length);
+    evel_json_write(jbuf, "\"", 1);
+  }
+
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
  * Encode a key and version.
  *
+ * The version is a number with the minor version after the decimal point, so
+ * in CBOR it is a double unless there is no minor version.
+ *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @param major_version The major version to encode.
  * @param minor_version The minor version to encode.
  *****************************************************************************/
 void evel_enc_version(EVEL_JSON_BUFFER * jbuf,
-                      const char * const key,
+                      const EVEL_JSON_KEY_ID key,
                       const int major_version,
                       const int minor_version)
 {
+  char version[EVEL_JSON_MAX_VERSION_LEN];
+
   EVEL_ENTER();
 
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(key != NULL);
 
-  evel_enc_kv_int(jbuf, key, major_version);
-  if (minor_version != 0)
+  if ((jbuf->encoding == EVEL_ENCODING_CBOR) && (minor_version != 0))
+  {
+    snprintf(version, sizeof(version), "%d.%d", major_version, minor_version);
+    evel_enc_kv_double(jbuf, key, strtod(version, NULL));
+  }
+  else
   {
-    jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                             jbuf->max_size - jbuf->offset,
-                             ".%d",
-                             minor_version);
+    evel_enc_kv_int(jbuf, key, major_version);
+    if (minor_version != 0)
+    {
+      evel_json_write(jbuf, ".", 1);
+      evel_enc_int(jbuf, minor_version);
+    }
   }
 
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Add the key and opening bracket of an optional named list to a JSON buffer.
+ * Open an optional named list in a JSON buffer.
+ *
+ * The key and opening bracket are only written when the first item is added,
+ * so a list which ends up empty is left out altogether.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  * @return true if the list was opened, false if it was suppressed.
  *****************************************************************************/
 bool evel_json_open_opt_named_list(EVEL_JSON_BUFFER * jbuf,
-                                   const char * const key)
+                                   const EVEL_JSON_KEY_ID key)
 {
   bool opened = false;
 
@@ -571,18 +1610,18 @@ bool evel_json_open_opt_named_list(EVEL_JSON_BUFFER * jbuf,
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(key != NULL);
+  assert(key < EVEL_MAX_JSON_KEYS);
 
   if ((jbuf->depth == EVEL_THROTTLE_FIELD_DEPTH) &&
       (jbuf->throttle_spec != NULL) &&
       evel_throttle_suppress_field(jbuf->throttle_spec, key))
   {
-    EVEL_INFO("Suppressed: %s", key);
+    EVEL_INFO("Suppressed: %s", evel_json_key_names[key]);
     opened = false;
   }
   else
   {
-    evel_json_open_named_list(jbuf, key);
+    evel_json_defer_open(jbuf, key, true);
     opened = true;
   }
 
@@ -595,10 +1634,47 @@ bool evel_json_open_opt_named_list(EVEL_JSON_BUFFER * jbuf,
  * Add the key and opening bracket of a named list to a JSON buffer.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
  *****************************************************************************/
 void evel_json_open_named_list(EVEL_JSON_BUFFER * jbuf,
-                               const char * const key)
+                               const EVEL_JSON_KEY_ID key)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(jbuf != NULL);
+
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_key(jbuf, key);
+    evel_cbor_write_byte(jbuf, EVEL_CBOR_INDEFINITE_ARRAY);
+  }
+  else
+  {
+    evel_json_write_key(jbuf, key);
+    evel_json_write(jbuf, "[", 1);
+  }
+  jbuf->depth++;
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Add a key supplied at run time and the opening bracket of a named list to a
+ * JSON buffer.
+ *
+ * This is slower than ::evel_json_open_named_list, and only for keys such as
+ * user-supplied array names which cannot be in the ::EVEL_JSON_KEY_ID table.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param key           Pointer to the key to encode.
+ *****************************************************************************/
+void evel_json_open_user_named_list(EVEL_JSON_BUFFER * jbuf,
+                                    const char * const key)
 {
   EVEL_ENTER();
 
@@ -608,11 +1684,19 @@ void evel_json_open_named_list(EVEL_JSON_BUFFER * jbuf,
   assert(jbuf != NULL);
   assert(key != NULL);
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "%s\"%s\": [",
-                           evel_json_kv_comma(jbuf),
-                           key);
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_text(jbuf, key, strlen(key));
+    evel_cbor_write_byte(jbuf, EVEL_CBOR_INDEFINITE_ARRAY);
+  }
+  else
+  {
+    evel_json_write_kv_comma(jbuf);
+    evel_json_write_string(jbuf, key);
+    evel_json_write(jbuf, ": [", 3);
+  }
   jbuf->depth++;
 
   EVEL_EXIT();
@@ -631,64 +1715,123 @@ void evel_json_close_list(EVEL_JSON_BUFFER * jbuf)
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
+  assert(jbuf->depth > 0);
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "]");
+  if (evel_json_drop_pending(jbuf))
+  {
+    EVEL_DEBUG("Empty list left out");
+  }
+  else if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_byte(jbuf, EVEL_CBOR_BREAK);
+  }
+  else
+  {
+    evel_json_write(jbuf, "]", 1);
+  }
   jbuf->depth--;
 
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Encode a list item with format and param list to a ::EVEL_JSON_BUFFER.
+ * Write a comma to a JSON buffer unless at the start of a list.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param format        Format string in standard printf format.
- * @param ...           Variable parameters for format string.
  *****************************************************************************/
-void evel_enc_list_item(EVEL_JSON_BUFFER * jbuf,
-                        const char * const format,
-                        ...)
+static void evel_json_write_list_comma(EVEL_JSON_BUFFER * jbuf)
 {
-  va_list largs;
+  if (evel_json_last_byte(jbuf) != '[')
+  {
+    evel_json_write(jbuf, ", ", 2);
+  }
+}
 
+/**************************************************************************//**
+ * Encode a string list item to a ::EVEL_JSON_BUFFER.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param value         Pointer to the string to encode.
+ *****************************************************************************/
+void evel_enc_list_string(EVEL_JSON_BUFFER * jbuf,
+                          const char * const value)
+{
   EVEL_ENTER();
 
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(format != NULL);
+  assert(value != NULL);
+
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_text(jbuf, value, strlen(value));
+  }
+  else
+  {
+    evel_json_write_list_comma(jbuf);
+    evel_json_write_string(jbuf, value);
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Encode a list item which is a pair of a name and a count, as in
+ * <tt>["name", count]</tt>, to a ::EVEL_JSON_BUFFER.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param name          Pointer to the name to encode.
+ * @param count         The count to encode.
+ *****************************************************************************/
+void evel_enc_list_counter(EVEL_JSON_BUFFER * jbuf,
+                           const char * const name,
+                           const int count)
+{
+  EVEL_ENTER();
 
   /***************************************************************************/
-  /* Add a comma unless we're at the start of the list.                      */
+  /* Check preconditions.                                                    */
   /***************************************************************************/
-  if (jbuf->json[jbuf->offset - 1] != '[')
+  assert(jbuf != NULL);
+  assert(name != NULL);
+
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
   {
-    jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                             jbuf->max_size - jbuf->offset,
-                             ", ");
+    evel_cbor_write_head(jbuf, EVEL_CBOR_ARRAY, 2);
+    evel_cbor_write_text(jbuf, name, strlen(name));
+    evel_cbor_write_int(jbuf, count);
+  }
+  else
+  {
+    evel_json_write_list_comma(jbuf);
+    evel_json_write(jbuf, "[", 1);
+    evel_json_write_string(jbuf, name);
+    evel_json_write(jbuf, ", ", 2);
+    evel_json_write_int(jbuf, count);
+    evel_json_write(jbuf, "]", 1);
   }
-
-  va_start(largs, format);
-  jbuf->offset += vsnprintf(jbuf->json + jbuf->offset,
-                            jbuf->max_size - jbuf->offset,
-                            format,
-                            largs);
-  va_end(largs);
 
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Add the opening bracket of an optional named object to a JSON buffer.
+ * Open an optional named object in a JSON buffer.
+ *
+ * The key and opening bracket are only written when the first member is
+ * added, so an object which ends up empty is left out altogether.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
+ * @param key           Identifier of the key to encode.
+ * @return true if the object was opened, false if it was suppressed.
  *****************************************************************************/
 bool evel_json_open_opt_named_object(EVEL_JSON_BUFFER * jbuf,
-                                     const char * const key)
+                                     const EVEL_JSON_KEY_ID key)
 {
   bool opened = false;
 
@@ -698,18 +1841,18 @@ bool evel_json_open_opt_named_object(EVEL_JSON_BUFFER * jbuf,
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(key != NULL);
+  assert(key < EVEL_MAX_JSON_KEYS);
 
   if ((jbuf->depth == EVEL_THROTTLE_FIELD_DEPTH) &&
       (jbuf->throttle_spec != NULL) &&
       evel_throttle_suppress_field(jbuf->throttle_spec, key))
   {
-    EVEL_INFO("Suppressed: %s", key);
+    EVEL_INFO("Suppressed: %s", evel_json_key_names[key]);
     opened = false;
   }
   else
   {
-    evel_json_open_named_object(jbuf, key);
+    evel_json_defer_open(jbuf, key, false);
     opened = true;
   }
 
@@ -722,11 +1865,10 @@ bool evel_json_open_opt_named_object(EVEL_JSON_BUFFER * jbuf,
  * Add the opening bracket of an object to a JSON buffer.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @param key           Pointer to the key to encode.
- * @return true if the object was opened, false if it was suppressed.
+ * @param key           Identifier of the key to encode.
  *****************************************************************************/
 void evel_json_open_named_object(EVEL_JSON_BUFFER * jbuf,
-                                 const char * const key)
+                                 const EVEL_JSON_KEY_ID key)
 {
   EVEL_ENTER();
 
@@ -734,13 +1876,19 @@ void evel_json_open_named_object(EVEL_JSON_BUFFER * jbuf,
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
-  assert(key != NULL);
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "%s\"%s\": {",
-                           evel_json_kv_comma(jbuf),
-                           key);
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_key(jbuf, key);
+    evel_cbor_write_byte(jbuf, EVEL_CBOR_INDEFINITE_MAP);
+  }
+  else
+  {
+    evel_json_write_key(jbuf, key);
+    evel_json_write(jbuf, "{", 1);
+  }
   jbuf->depth++;
 
   EVEL_EXIT();
@@ -753,8 +1901,6 @@ void evel_json_open_named_object(EVEL_JSON_BUFFER * jbuf,
  *****************************************************************************/
 void evel_json_open_object(EVEL_JSON_BUFFER * jbuf)
 {
-  char * comma;
-
   EVEL_ENTER();
 
   /***************************************************************************/
@@ -762,19 +1908,20 @@ void evel_json_open_object(EVEL_JSON_BUFFER * jbuf)
   /***************************************************************************/
   assert(jbuf != NULL);
 
-  if ((jbuf->offset != 0) && (jbuf->json[jbuf->offset-1] == '}'))
+  evel_json_write_pending(jbuf);
+
+  if (jbuf->encoding == EVEL_ENCODING_CBOR)
   {
-    comma = ", ";
+    evel_cbor_write_byte(jbuf, EVEL_CBOR_INDEFINITE_MAP);
+  }
+  else if (evel_json_last_byte(jbuf) == '}')
+  {
+    evel_json_write(jbuf, ", {", 3);
   }
   else
   {
-    comma = "";
+    evel_json_write(jbuf, "{", 1);
   }
-
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "%s{",
-                           comma);
   jbuf->depth++;
 
   EVEL_EXIT();
@@ -793,91 +1940,88 @@ void evel_json_close_object(EVEL_JSON_BUFFER * jbuf)
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(jbuf != NULL);
+  assert(jbuf->depth > 0);
 
-  jbuf->offset += snprintf(jbuf->json + jbuf->offset,
-                           jbuf->max_size - jbuf->offset,
-                           "}");
+  if (evel_json_drop_pending(jbuf))
+  {
+    EVEL_DEBUG("Empty object left out");
+  }
+  else if (jbuf->encoding == EVEL_ENCODING_CBOR)
+  {
+    evel_cbor_write_byte(jbuf, EVEL_CBOR_BREAK);
+  }
+  else
+  {
+    evel_json_write(jbuf, "}", 1);
+  }
   jbuf->depth--;
 
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Determine whether to add a comma when adding a key-value pair.
+ * Note an optional list or object as opened, without writing anything yet.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
- * @returns A string containing the comma if it is required.
+ * @param key           Identifier of the key of the list or object.
+ * @param is_list       Whether it is a list, rather than an object.
  *****************************************************************************/
-char * evel_json_kv_comma(EVEL_JSON_BUFFER * jbuf)
+static void evel_json_defer_open(EVEL_JSON_BUFFER * jbuf,
+                                 const EVEL_JSON_KEY_ID key,
+                                 const bool is_list)
 {
-  char * result;
-
-  EVEL_ENTER();
-
-  /***************************************************************************/
-  /* Check preconditions.                                                    */
-  /***************************************************************************/
-  assert(jbuf != NULL);
-
-  if ((jbuf->offset == 0) ||
-      (jbuf->json[jbuf->offset-1] == '{') ||
-      (jbuf->json[jbuf->offset-1] == '['))
-  {
-    result = "";
-  }
-  else
-  {
-    result = ", ";
-  }
-
-  EVEL_EXIT();
+  assert(jbuf->pending_count < EVEL_JSON_MAX_PENDING);
 
-  return result;
+  jbuf->pending[jbuf->pending_count].key = key;
+  jbuf->pending[jbuf->pending_count].is_list = is_list;
+  jbuf->pending_count++;
+  jbuf->depth++;
 }
 
 /**************************************************************************//**
- * Add a checkpoint - a stake in the ground to which we can rewind.
+ * Write the keys and opening brackets of any optional lists and objects which
+ * are waiting for their first item, ready for something to be added.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
  *****************************************************************************/
-void evel_json_checkpoint(EVEL_JSON_BUFFER * jbuf)
+static void evel_json_write_pending(EVEL_JSON_BUFFER * jbuf)
 {
-  EVEL_ENTER();
-
-  /***************************************************************************/
-  /* Check preconditions.                                                    */
-  /***************************************************************************/
-  assert(jbuf != NULL);
-
-  /***************************************************************************/
-  /* Store the current offset.                                               */
-  /***************************************************************************/
-  jbuf->checkpoint = jbuf->offset;
+  int index;
+  EVEL_JSON_PENDING * pending;
 
-  EVEL_EXIT();
+  for (index = 0; index < jbuf->pending_count; index++)
+  {
+    pending = &jbuf->pending[index];
+    if (jbuf->encoding == EVEL_ENCODING_CBOR)
+    {
+      evel_cbor_write_key(jbuf, pending->key);
+      evel_cbor_write_byte(jbuf,
+                           pending->is_list ? EVEL_CBOR_INDEFINITE_ARRAY :
+                                              EVEL_CBOR_INDEFINITE_MAP);
+    }
+    else
+    {
+      evel_json_write_key(jbuf, pending->key);
+      evel_json_write(jbuf, pending->is_list ? "[" : "{", 1);
+    }
+  }
+  jbuf->pending_count = 0;
 }
 
 /**************************************************************************//**
- * Rewind to the latest checkoint.
+ * Drop the innermost list or object if it is still waiting for its first
+ * item, in which case nothing at all is written for it.
  *
  * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @returns Whether the list or object was dropped.
  *****************************************************************************/
-void evel_json_rewind(EVEL_JSON_BUFFER * jbuf)
+static bool evel_json_drop_pending(EVEL_JSON_BUFFER * jbuf)
 {
-  EVEL_ENTER();
-
-  /***************************************************************************/
-  /* Check preconditions.                                                    */
-  /***************************************************************************/
-  assert(jbuf != NULL);
-  assert(jbuf->checkpoint >= 0);
-  assert(jbuf->checkpoint <= jbuf->offset);
-
-  /***************************************************************************/
-  /* Reinstate the offset from the last checkpoint.                          */
-  /***************************************************************************/
-  jbuf->offset = jbuf->checkpoint;
-  jbuf->checkpoint = -1;
+  if (jbuf->pending_count == 0)
+  {
+    return false;
+  }
 
-  EVEL_EXIT();
+  jbuf->pending_count--;
+  return true;
 }
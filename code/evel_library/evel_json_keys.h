@@ -0,0 +1,439 @@
+#ifndef EVEL_JSON_KEYS_INCLUDED
+#define EVEL_JSON_KEYS_INCLUDED
+
+/**************************************************************************//**
+ * @file
+ * EVEL JSON key definitions.
+ *
+ * Every key which the encoders write is listed here.  The encoders copy a
+ * pre-quoted fragment for each key rather than formatting it at run time,
+ * and a throttling specification is compiled into a bitmap indexed by
+ * ::EVEL_JSON_KEY_ID rather than looked up by name as each field is encoded.
+ * The list must be kept in strcmp() order, since it is binary searched when
+ * the throttling specification is compiled.
+ *
+ * License
+ * -------
+ *
+ * Copyright(c) <2016>, AT&T Intellectual Property.  All other rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:  This product includes
+ *    software developed by the AT&T.
+ * 4. Neither the name of AT&T nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific
+ *    prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AT&T INTELLECTUAL PROPERTY ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AT&T INTELLECTUAL PROPERTY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+/**************************************************************************//**
+ * The JSON keys, as X(id, name) pairs.
+ *****************************************************************************/
+#define EVEL_JSON_KEYS(X) \
+  X(EVEL_KEY_ADDITIONAL_FIELDS, "additionalFields") \
+  X(EVEL_KEY_ADDITIONAL_INFORMATION, "additionalInformation") \
+  X(EVEL_KEY_ADDITIONAL_MEASUREMENTS, "additionalMeasurements") \
+  X(EVEL_KEY_ADDITIONAL_PARAMETERS, "additionalParameters") \
+  X(EVEL_KEY_ADJACENCY_NAME, "adjacencyName") \
+  X(EVEL_KEY_ALARM_ADDITIONAL_INFORMATION, "alarmAdditionalInformation") \
+  X(EVEL_KEY_ALARM_CONDITION, "alarmCondition") \
+  X(EVEL_KEY_ALARM_INTERFACE_A, "alarmInterfaceA") \
+  X(EVEL_KEY_ALERT_ACTION, "alertAction") \
+  X(EVEL_KEY_ALERT_DESCRIPTION, "alertDescription") \
+  X(EVEL_KEY_ALERT_TYPE, "alertType") \
+  X(EVEL_KEY_ALERT_VALUE, "alertValue") \
+  X(EVEL_KEY_APP_PROTOCOL_TYPE, "appProtocolType") \
+  X(EVEL_KEY_APP_PROTOCOL_VERSION, "appProtocolVersion") \
+  X(EVEL_KEY_APPLICATION_TYPE, "applicationType") \
+  X(EVEL_KEY_AVG_BIT_ERROR_RATE, "avgBitErrorRate") \
+  X(EVEL_KEY_AVG_PACKET_DELAY_VARIATION, "avgPacketDelayVariation") \
+  X(EVEL_KEY_AVG_PACKET_LATENCY, "avgPacketLatency") \
+  X(EVEL_KEY_AVG_RECEIVE_THROUGHPUT, "avgReceiveThroughput") \
+  X(EVEL_KEY_AVG_TRANSMIT_THROUGHPUT, "avgTransmitThroughput") \
+  X(EVEL_KEY_BLOCK_CONFIGURED, "blockConfigured") \
+  X(EVEL_KEY_BLOCK_IOPS, "blockIops") \
+  X(EVEL_KEY_BLOCK_USED, "blockUsed") \
+  X(EVEL_KEY_CALLEE_SIDE_CODEC, "calleeSideCodec") \
+  X(EVEL_KEY_CALLER_SIDE_CODEC, "callerSideCodec") \
+  X(EVEL_KEY_CID, "cid") \
+  X(EVEL_KEY_CODEC, "codec") \
+  X(EVEL_KEY_CODEC_IDENTIFIER, "codecIdentifier") \
+  X(EVEL_KEY_CODEC_SELECTED, "codecSelected") \
+  X(EVEL_KEY_CODEC_SELECTED_TRANSCODING, "codecSelectedTranscoding") \
+  X(EVEL_KEY_CODEC_USAGE_ARRAY, "codecUsageArray") \
+  X(EVEL_KEY_COLLECTION_TIMESTAMP, "collectionTimestamp") \
+  X(EVEL_KEY_COMMON_EVENT_HEADER, "commonEventHeader") \
+  X(EVEL_KEY_COMPRESSED_SIP, "compressedSip") \
+  X(EVEL_KEY_CONCURRENT_SESSIONS, "concurrentSessions") \
+  X(EVEL_KEY_CONFIGURED_ENTITIES, "configuredEntities") \
+  X(EVEL_KEY_CONNECTION_TYPE, "connectionType") \
+  X(EVEL_KEY_CORRELATOR, "correlator") \
+  X(EVEL_KEY_COUNTS_IN_THE_BUCKET, "countsInTheBucket") \
+  X(EVEL_KEY_CPU_IDENTIFIER, "cpuIdentifier") \
+  X(EVEL_KEY_CPU_IDLE, "cpuIdle") \
+  X(EVEL_KEY_CPU_USAGE_ARRAY, "cpuUsageArray") \
+  X(EVEL_KEY_CPU_USAGE_INTERRUPT, "cpuUsageInterrupt") \
+  X(EVEL_KEY_CPU_USAGE_NICE, "cpuUsageNice") \
+  X(EVEL_KEY_CPU_USAGE_SOFT_IRQ, "cpuUsageSoftIrq") \
+  X(EVEL_KEY_CPU_USAGE_STEAL, "cpuUsageSteal") \
+  X(EVEL_KEY_CPU_USAGE_SYSTEM, "cpuUsageSystem") \
+  X(EVEL_KEY_CPU_USAGE_USER, "cpuUsageUser") \
+  X(EVEL_KEY_CPU_WAIT, "cpuWait") \
+  X(EVEL_KEY_CRITICALITY, "criticality") \
+  X(EVEL_KEY_DATA_COLLECTOR, "dataCollector") \
+  X(EVEL_KEY_DISK_IDENTIFIER, "diskIdentifier") \
+  X(EVEL_KEY_DISK_IO_TIME_AVG, "diskIoTimeAvg") \
+  X(EVEL_KEY_DISK_IO_TIME_LAST, "diskIoTimeLast") \
+  X(EVEL_KEY_DISK_IO_TIME_MAX, "diskIoTimeMax") \
+  X(EVEL_KEY_DISK_IO_TIME_MIN, "diskIoTimeMin") \
+  X(EVEL_KEY_DISK_MERGED_READ_AVG, "diskMergedReadAvg") \
+  X(EVEL_KEY_DISK_MERGED_READ_LAST, "diskMergedReadLast") \
+  X(EVEL_KEY_DISK_MERGED_READ_MAX, "diskMergedReadMax") \
+  X(EVEL_KEY_DISK_MERGED_READ_MIN, "diskMergedReadMin") \
+  X(EVEL_KEY_DISK_MERGED_WRITE_AVG, "diskMergedWriteAvg") \
+  X(EVEL_KEY_DISK_MERGED_WRITE_LAST, "diskMergedWriteLast") \
+  X(EVEL_KEY_DISK_MERGED_WRITE_MAX, "diskMergedWriteMax") \
+  X(EVEL_KEY_DISK_MERGED_WRITE_MIN, "diskMergedWriteMin") \
+  X(EVEL_KEY_DISK_OCTETS_READ_AVG, "diskOctetsReadAvg") \
+  X(EVEL_KEY_DISK_OCTETS_READ_LAST, "diskOctetsReadLast") \
+  X(EVEL_KEY_DISK_OCTETS_READ_MAX, "diskOctetsReadMax") \
+  X(EVEL_KEY_DISK_OCTETS_READ_MIN, "diskOctetsReadMin") \
+  X(EVEL_KEY_DISK_OCTETS_WRITE_AVG, "diskOctetsWriteAvg") \
+  X(EVEL_KEY_DISK_OCTETS_WRITE_LAST, "diskOctetsWriteLast") \
+  X(EVEL_KEY_DISK_OCTETS_WRITE_MAX, "diskOctetsWriteMax") \
+  X(EVEL_KEY_DISK_OCTETS_WRITE_MIN, "diskOctetsWriteMin") \
+  X(EVEL_KEY_DISK_OPS_READ_AVG, "diskOpsReadAvg") \
+  X(EVEL_KEY_DISK_OPS_READ_LAST, "diskOpsReadLast") \
+  X(EVEL_KEY_DISK_OPS_READ_MAX, "diskOpsReadMax") \
+  X(EVEL_KEY_DISK_OPS_READ_MIN, "diskOpsReadMin") \
+  X(EVEL_KEY_DISK_OPS_WRITE_AVG, "diskOpsWriteAvg") \
+  X(EVEL_KEY_DISK_OPS_WRITE_LAST, "diskOpsWriteLast") \
+  X(EVEL_KEY_DISK_OPS_WRITE_MAX, "diskOpsWriteMax") \
+  X(EVEL_KEY_DISK_OPS_WRITE_MIN, "diskOpsWriteMin") \
+  X(EVEL_KEY_DISK_PENDING_OPERATIONS_AVG, "diskPendingOperationsAvg") \
+  X(EVEL_KEY_DISK_PENDING_OPERATIONS_LAST, "diskPendingOperationsLast") \
+  X(EVEL_KEY_DISK_PENDING_OPERATIONS_MAX, "diskPendingOperationsMax") \
+  X(EVEL_KEY_DISK_PENDING_OPERATIONS_MIN, "diskPendingOperationsMin") \
+  X(EVEL_KEY_DISK_TIME_READ_AVG, "diskTimeReadAvg") \
+  X(EVEL_KEY_DISK_TIME_READ_LAST, "diskTimeReadLast") \
+  X(EVEL_KEY_DISK_TIME_READ_MAX, "diskTimeReadMax") \
+  X(EVEL_KEY_DISK_TIME_READ_MIN, "diskTimeReadMin") \
+  X(EVEL_KEY_DISK_TIME_WRITE_AVG, "diskTimeWriteAvg") \
+  X(EVEL_KEY_DISK_TIME_WRITE_LAST, "diskTimeWriteLast") \
+  X(EVEL_KEY_DISK_TIME_WRITE_MAX, "diskTimeWriteMax") \
+  X(EVEL_KEY_DISK_TIME_WRITE_MIN, "diskTimeWriteMin") \
+  X(EVEL_KEY_DISK_USAGE_ARRAY, "diskUsageArray") \
+  X(EVEL_KEY_DOMAIN, "domain") \
+  X(EVEL_KEY_DUR_CONNECTION_FAILED_STATUS, "durConnectionFailedStatus") \
+  X(EVEL_KEY_DUR_TUNNEL_FAILED_STATUS, "durTunnelFailedStatus") \
+  X(EVEL_KEY_ECGI, "ecgi") \
+  X(EVEL_KEY_ELEMENT_TYPE, "elementType") \
+  X(EVEL_KEY_END_OF_CALL_VQM_SUMMARIES, "endOfCallVqmSummaries") \
+  X(EVEL_KEY_ENDPOINT_DESCRIPTION, "endpointDescription") \
+  X(EVEL_KEY_ENDPOINT_JITTER, "endpointJitter") \
+  X(EVEL_KEY_ENDPOINT_RTP_OCTETS_DISCARDED, "endpointRtpOctetsDiscarded") \
+  X(EVEL_KEY_ENDPOINT_RTP_OCTETS_RECEIVED, "endpointRtpOctetsReceived") \
+  X(EVEL_KEY_ENDPOINT_RTP_OCTETS_SENT, "endpointRtpOctetsSent") \
+  X(EVEL_KEY_ENDPOINT_RTP_PACKETS_DISCARDED, "endpointRtpPacketsDiscarded") \
+  X(EVEL_KEY_ENDPOINT_RTP_PACKETS_RECEIVED, "endpointRtpPacketsReceived") \
+  X(EVEL_KEY_ENDPOINT_RTP_PACKETS_SENT, "endpointRtpPacketsSent") \
+  X(EVEL_KEY_EPHEMERAL_CONFIGURED, "ephemeralConfigured") \
+  X(EVEL_KEY_EPHEMERAL_IOPS, "ephemeralIops") \
+  X(EVEL_KEY_EPHEMERAL_USED, "ephemeralUsed") \
+  X(EVEL_KEY_ERRORS, "errors") \
+  X(EVEL_KEY_EVENT, "event") \
+  X(EVEL_KEY_EVENT_CATEGORY, "eventCategory") \
+  X(EVEL_KEY_EVENT_ID, "eventId") \
+  X(EVEL_KEY_EVENT_NAME, "eventName") \
+  X(EVEL_KEY_EVENT_SEVERITY, "eventSeverity") \
+  X(EVEL_KEY_EVENT_SOURCE_HOST, "eventSourceHost") \
+  X(EVEL_KEY_EVENT_SOURCE_TYPE, "eventSourceType") \
+  X(EVEL_KEY_EVENT_START_TIMESTAMP, "eventStartTimestamp") \
+  X(EVEL_KEY_EVENT_TYPE, "eventType") \
+  X(EVEL_KEY_FAULT_FIELDS, "faultFields") \
+  X(EVEL_KEY_FAULT_FIELDS_VERSION, "faultFieldsVersion") \
+  X(EVEL_KEY_FEATURE_IDENTIFIER, "featureIdentifier") \
+  X(EVEL_KEY_FEATURE_USAGE_ARRAY, "featureUsageArray") \
+  X(EVEL_KEY_FEATURE_UTILIZATION, "featureUtilization") \
+  X(EVEL_KEY_FILESYSTEM_NAME, "filesystemName") \
+  X(EVEL_KEY_FILESYSTEM_USAGE_ARRAY, "filesystemUsageArray") \
+  X(EVEL_KEY_FLOW_ACTIVATED_BY, "flowActivatedBy") \
+  X(EVEL_KEY_FLOW_ACTIVATION_EPOCH, "flowActivationEpoch") \
+  X(EVEL_KEY_FLOW_ACTIVATION_MICROSEC, "flowActivationMicrosec") \
+  X(EVEL_KEY_FLOW_ACTIVATION_TIME, "flowActivationTime") \
+  X(EVEL_KEY_FLOW_DEACTIVATED_BY, "flowDeactivatedBy") \
+  X(EVEL_KEY_FLOW_DEACTIVATION_EPOCH, "flowDeactivationEpoch") \
+  X(EVEL_KEY_FLOW_DEACTIVATION_MICROSEC, "flowDeactivationMicrosec") \
+  X(EVEL_KEY_FLOW_DEACTIVATION_TIME, "flowDeactivationTime") \
+  X(EVEL_KEY_FLOW_DIRECTION, "flowDirection") \
+  X(EVEL_KEY_FLOW_STATUS, "flowStatus") \
+  X(EVEL_KEY_GTP_CONNECTION_STATUS, "gtpConnectionStatus") \
+  X(EVEL_KEY_GTP_PER_FLOW_METRICS, "gtpPerFlowMetrics") \
+  X(EVEL_KEY_GTP_PROTOCOL_TYPE, "gtpProtocolType") \
+  X(EVEL_KEY_GTP_TUNNEL_STATUS, "gtpTunnelStatus") \
+  X(EVEL_KEY_GTP_VERSION, "gtpVersion") \
+  X(EVEL_KEY_HASH_OF_NAME_VALUE_PAIR_ARRAYS, "hashOfNameValuePairArrays") \
+  X(EVEL_KEY_HEARTBEAT_FIELD, "heartbeatField") \
+  X(EVEL_KEY_HEARTBEAT_FIELDS_VERSION, "heartbeatFieldsVersion") \
+  X(EVEL_KEY_HEARTBEAT_INTERVAL, "heartbeatInterval") \
+  X(EVEL_KEY_HIGH_END_OF_LATENCY_BUCKET, "highEndOfLatencyBucket") \
+  X(EVEL_KEY_HTTP_HEADER, "httpHeader") \
+  X(EVEL_KEY_IMEI, "imei") \
+  X(EVEL_KEY_IMSI, "imsi") \
+  X(EVEL_KEY_INTERFACE_NAME, "interfaceName") \
+  X(EVEL_KEY_IP_PROTOCOL_TYPE, "ipProtocolType") \
+  X(EVEL_KEY_IP_TOS_COUNT_LIST, "ipTosCountList") \
+  X(EVEL_KEY_IP_TOS_LIST, "ipTosList") \
+  X(EVEL_KEY_IP_VERSION, "ipVersion") \
+  X(EVEL_KEY_JSON_OBJECTS, "jsonObjects") \
+  X(EVEL_KEY_KEY_NAME, "keyName") \
+  X(EVEL_KEY_KEY_ORDER, "keyOrder") \
+  X(EVEL_KEY_KEY_VALUE, "keyValue") \
+  X(EVEL_KEY_LAC, "lac") \
+  X(EVEL_KEY_LARGE_PACKET_RTT, "largePacketRtt") \
+  X(EVEL_KEY_LARGE_PACKET_THRESHOLD, "largePacketThreshold") \
+  X(EVEL_KEY_LAST_EPOCH_MICROSEC, "lastEpochMicrosec") \
+  X(EVEL_KEY_LATENCY_DISTRIBUTION, "latencyDistribution") \
+  X(EVEL_KEY_LOCAL_IP_ADDRESS, "localIpAddress") \
+  X(EVEL_KEY_LOCAL_JITTER, "localJitter") \
+  X(EVEL_KEY_LOCAL_PORT, "localPort") \
+  X(EVEL_KEY_LOCAL_RTP_OCTETS_DISCARDED, "localRtpOctetsDiscarded") \
+  X(EVEL_KEY_LOCAL_RTP_OCTETS_RECEIVED, "localRtpOctetsReceived") \
+  X(EVEL_KEY_LOCAL_RTP_OCTETS_SENT, "localRtpOctetsSent") \
+  X(EVEL_KEY_LOCAL_RTP_PACKETS_DISCARDED, "localRtpPacketsDiscarded") \
+  X(EVEL_KEY_LOCAL_RTP_PACKETS_RECEIVED, "localRtpPacketsReceived") \
+  X(EVEL_KEY_LOCAL_RTP_PACKETS_SENT, "localRtpPacketsSent") \
+  X(EVEL_KEY_LOW_END_OF_LATENCY_BUCKET, "lowEndOfLatencyBucket") \
+  X(EVEL_KEY_MARKER, "marker") \
+  X(EVEL_KEY_MAX_PACKET_DELAY_VARIATION, "maxPacketDelayVariation") \
+  X(EVEL_KEY_MAX_RECEIVE_BIT_RATE, "maxReceiveBitRate") \
+  X(EVEL_KEY_MAX_TRANSMIT_BIT_RATE, "maxTransmitBitRate") \
+  X(EVEL_KEY_MCC, "mcc") \
+  X(EVEL_KEY_MEAN_REQUEST_LATENCY, "meanRequestLatency") \
+  X(EVEL_KEY_MEASUREMENT_FIELDS_VERSION, "measurementFieldsVersion") \
+  X(EVEL_KEY_MEASUREMENT_INTERVAL, "measurementInterval") \
+  X(EVEL_KEY_MEASUREMENTS, "measurements") \
+  X(EVEL_KEY_MEASUREMENTS_FOR_VF_REPORTING_FIELDS, \
+    "measurementsForVfReportingFields") \
+  X(EVEL_KEY_MEASUREMENTS_FOR_VF_SCALING_FIELDS, \
+    "measurementsForVfScalingFields") \
+  X(EVEL_KEY_MEASUREMENTS_FOR_VF_SCALING_VERSION, \
+    "measurementsForVfScalingVersion") \
+  X(EVEL_KEY_MEMORY_BUFFERED, "memoryBuffered") \
+  X(EVEL_KEY_MEMORY_CACHED, "memoryCached") \
+  X(EVEL_KEY_MEMORY_CONFIGURED, "memoryConfigured") \
+  X(EVEL_KEY_MEMORY_FREE, "memoryFree") \
+  X(EVEL_KEY_MEMORY_SLAB_RECL, "memorySlabRecl") \
+  X(EVEL_KEY_MEMORY_SLAB_UNRECL, "memorySlabUnrecl") \
+  X(EVEL_KEY_MEMORY_USAGE_ARRAY, "memoryUsageArray") \
+  X(EVEL_KEY_MEMORY_USED, "memoryUsed") \
+  X(EVEL_KEY_MID_CALL_RTCP, "midCallRtcp") \
+  X(EVEL_KEY_MNC, "mnc") \
+  X(EVEL_KEY_MOBILE_FLOW_FIELDS, "mobileFlowFields") \
+  X(EVEL_KEY_MOBILE_FLOW_FIELDS_VERSION, "mobileFlowFieldsVersion") \
+  X(EVEL_KEY_MOBILE_QCI_COS_COUNT_LIST, "mobileQciCosCountList") \
+  X(EVEL_KEY_MOBILE_QCI_COS_LIST, "mobileQciCosList") \
+  X(EVEL_KEY_MOS_CQE, "mosCqe") \
+  X(EVEL_KEY_MSISDN, "msisdn") \
+  X(EVEL_KEY_NAME, "name") \
+  X(EVEL_KEY_NAME_VALUE_PAIRS, "nameValuePairs") \
+  X(EVEL_KEY_NETWORK_SERVICE, "networkService") \
+  X(EVEL_KEY_NEW_STATE, "newState") \
+  X(EVEL_KEY_NF_NAMING_CODE, "nfNamingCode") \
+  X(EVEL_KEY_NF_SUBSCRIBED_OBJECT_NAME, "nfSubscribedObjectName") \
+  X(EVEL_KEY_NF_SUBSCRIPTION_ID, "nfSubscriptionId") \
+  X(EVEL_KEY_NFC_NAMING_CODE, "nfcNamingCode") \
+  X(EVEL_KEY_NUM_ACTIVATION_FAILURES, "numActivationFailures") \
+  X(EVEL_KEY_NUM_BIT_ERRORS, "numBitErrors") \
+  X(EVEL_KEY_NUM_BYTES_RECEIVED, "numBytesReceived") \
+  X(EVEL_KEY_NUM_BYTES_TRANSMITTED, "numBytesTransmitted") \
+  X(EVEL_KEY_NUM_DROPPED_PACKETS, "numDroppedPackets") \
+  X(EVEL_KEY_NUM_GTP_ECHO_FAILURES, "numGtpEchoFailures") \
+  X(EVEL_KEY_NUM_GTP_TUNNEL_ERRORS, "numGtpTunnelErrors") \
+  X(EVEL_KEY_NUM_HTTP_ERRORS, "numHttpErrors") \
+  X(EVEL_KEY_NUM_L7_BYTES_RECEIVED, "numL7BytesReceived") \
+  X(EVEL_KEY_NUM_L7_BYTES_TRANSMITTED, "numL7BytesTransmitted") \
+  X(EVEL_KEY_NUM_LOST_PACKETS, "numLostPackets") \
+  X(EVEL_KEY_NUM_OUT_OF_ORDER_PACKETS, "numOutOfOrderPackets") \
+  X(EVEL_KEY_NUM_PACKET_ERRORS, "numPacketErrors") \
+  X(EVEL_KEY_NUM_PACKETS_RECEIVED_EXCL_RETRANS, \
+    "numPacketsReceivedExclRetrans") \
+  X(EVEL_KEY_NUM_PACKETS_RECEIVED_INCL_RETRANS, \
+    "numPacketsReceivedInclRetrans") \
+  X(EVEL_KEY_NUM_PACKETS_TRANSMITTED_INCL_RETRANS, \
+    "numPacketsTransmittedInclRetrans") \
+  X(EVEL_KEY_NUM_RETRIES, "numRetries") \
+  X(EVEL_KEY_NUM_TIMEOUTS, "numTimeouts") \
+  X(EVEL_KEY_NUM_TUNNELED_L7_BYTES_RECEIVED, "numTunneledL7BytesReceived") \
+  X(EVEL_KEY_NUMBER_IN_USE, "numberInUse") \
+  X(EVEL_KEY_NUMBER_OF_MEDIA_PORTS_IN_USE, "numberOfMediaPortsInUse") \
+  X(EVEL_KEY_OBJECT_INSTANCE, "objectInstance") \
+  X(EVEL_KEY_OBJECT_INSTANCE_EPOCH_MICROSEC, "objectInstanceEpochMicrosec") \
+  X(EVEL_KEY_OBJECT_INSTANCES, "objectInstances") \
+  X(EVEL_KEY_OBJECT_KEYS, "objectKeys") \
+  X(EVEL_KEY_OBJECT_NAME, "objectName") \
+  X(EVEL_KEY_OBJECT_SCHEMA, "objectSchema") \
+  X(EVEL_KEY_OBJECT_SCHEMA_URL, "objectSchemaUrl") \
+  X(EVEL_KEY_OLD_STATE, "oldState") \
+  X(EVEL_KEY_OTHER_ENDPOINT_IP_ADDRESS, "otherEndpointIpAddress") \
+  X(EVEL_KEY_OTHER_ENDPOINT_PORT, "otherEndpointPort") \
+  X(EVEL_KEY_OTHER_FIELDS, "otherFields") \
+  X(EVEL_KEY_OTHER_FIELDS_VERSION, "otherFieldsVersion") \
+  X(EVEL_KEY_OTHER_FUNCTIONAL_ROLE, "otherFunctionalRole") \
+  X(EVEL_KEY_PACKET_LOSS_PERCENT, "packetLossPercent") \
+  X(EVEL_KEY_PACKETS_LOST, "packetsLost") \
+  X(EVEL_KEY_PERCENT_USAGE, "percentUsage") \
+  X(EVEL_KEY_PHONE_NUMBER, "phoneNumber") \
+  X(EVEL_KEY_POSSIBLE_ROOT_CAUSE, "possibleRootCause") \
+  X(EVEL_KEY_PRIORITY, "priority") \
+  X(EVEL_KEY_R_FACTOR, "rFactor") \
+  X(EVEL_KEY_RAC, "rac") \
+  X(EVEL_KEY_RADIO_ACCESS_TECHNOLOGY, "radioAccessTechnology") \
+  X(EVEL_KEY_RECEIVE_DISCARDS, "receiveDiscards") \
+  X(EVEL_KEY_RECEIVE_ERRORS, "receiveErrors") \
+  X(EVEL_KEY_RECEIVED_BROADCAST_PACKETS_ACCUMULATED, \
+    "receivedBroadcastPacketsAccumulated") \
+  X(EVEL_KEY_RECEIVED_BROADCAST_PACKETS_DELTA, \
+    "receivedBroadcastPacketsDelta") \
+  X(EVEL_KEY_RECEIVED_DISCARDED_PACKETS_ACCUMULATED, \
+    "receivedDiscardedPacketsAccumulated") \
+  X(EVEL_KEY_RECEIVED_DISCARDED_PACKETS_DELTA, \
+    "receivedDiscardedPacketsDelta") \
+  X(EVEL_KEY_RECEIVED_ERROR_PACKETS_ACCUMULATED, \
+    "receivedErrorPacketsAccumulated") \
+  X(EVEL_KEY_RECEIVED_ERROR_PACKETS_DELTA, "receivedErrorPacketsDelta") \
+  X(EVEL_KEY_RECEIVED_MULTICAST_PACKETS_ACCUMULATED, \
+    "receivedMulticastPacketsAccumulated") \
+  X(EVEL_KEY_RECEIVED_MULTICAST_PACKETS_DELTA, \
+    "receivedMulticastPacketsDelta") \
+  X(EVEL_KEY_RECEIVED_OCTETS_ACCUMULATED, "receivedOctetsAccumulated") \
+  X(EVEL_KEY_RECEIVED_OCTETS_DELTA, "receivedOctetsDelta") \
+  X(EVEL_KEY_RECEIVED_TOTAL_PACKETS_ACCUMULATED, \
+    "receivedTotalPacketsAccumulated") \
+  X(EVEL_KEY_RECEIVED_TOTAL_PACKETS_DELTA, "receivedTotalPacketsDelta") \
+  X(EVEL_KEY_RECEIVED_UNICAST_PACKETS_ACCUMULATED, \
+    "receivedUnicastPacketsAccumulated") \
+  X(EVEL_KEY_RECEIVED_UNICAST_PACKETS_DELTA, "receivedUnicastPacketsDelta") \
+  X(EVEL_KEY_REMOTE_IP_ADDRESS, "remoteIpAddress") \
+  X(EVEL_KEY_REMOTE_PORT, "remotePort") \
+  X(EVEL_KEY_REPORTING_ENDPOINT_IP_ADDR, "reportingEndpointIpAddr") \
+  X(EVEL_KEY_REPORTING_ENDPOINT_PORT, "reportingEndpointPort") \
+  X(EVEL_KEY_REPORTING_ENTITY_ID, "reportingEntityId") \
+  X(EVEL_KEY_REPORTING_ENTITY_NAME, "reportingEntityName") \
+  X(EVEL_KEY_REQUEST_RATE, "requestRate") \
+  X(EVEL_KEY_ROUND_TRIP_DELAY, "roundTripDelay") \
+  X(EVEL_KEY_ROUND_TRIP_TIME, "roundTripTime") \
+  X(EVEL_KEY_RTCP_DATA, "rtcpData") \
+  X(EVEL_KEY_SAC, "sac") \
+  X(EVEL_KEY_SAMPLING_ALGORITHM, "samplingAlgorithm") \
+  X(EVEL_KEY_SEQUENCE, "sequence") \
+  X(EVEL_KEY_SERVICE_EVENTS_FIELDS, "serviceEventsFields") \
+  X(EVEL_KEY_SERVICE_EVENTS_FIELDS_VERSION, "serviceEventsFieldsVersion") \
+  X(EVEL_KEY_SIGNALING_FIELDS, "signalingFields") \
+  X(EVEL_KEY_SIGNALING_FIELDS_VERSION, "signalingFieldsVersion") \
+  X(EVEL_KEY_SOURCE_ID, "sourceId") \
+  X(EVEL_KEY_SOURCE_NAME, "sourceName") \
+  X(EVEL_KEY_SPECIFIC_PROBLEM, "specificProblem") \
+  X(EVEL_KEY_START_EPOCH_MICROSEC, "startEpochMicrosec") \
+  X(EVEL_KEY_STATE_CHANGE_FIELDS, "stateChangeFields") \
+  X(EVEL_KEY_STATE_CHANGE_FIELDS_VERSION, "stateChangeFieldsVersion") \
+  X(EVEL_KEY_STATE_INTERFACE, "stateInterface") \
+  X(EVEL_KEY_SUMMARY_SIP, "summarySip") \
+  X(EVEL_KEY_SYSLOG_FACILITY, "syslogFacility") \
+  X(EVEL_KEY_SYSLOG_FIELDS, "syslogFields") \
+  X(EVEL_KEY_SYSLOG_FIELDS_VERSION, "syslogFieldsVersion") \
+  X(EVEL_KEY_SYSLOG_MSG, "syslogMsg") \
+  X(EVEL_KEY_SYSLOG_PRI, "syslogPri") \
+  X(EVEL_KEY_SYSLOG_PROC, "syslogProc") \
+  X(EVEL_KEY_SYSLOG_PROC_ID, "syslogProcId") \
+  X(EVEL_KEY_SYSLOG_S_DATA, "syslogSData") \
+  X(EVEL_KEY_SYSLOG_SD_ID, "syslogSdId") \
+  X(EVEL_KEY_SYSLOG_SEV, "syslogSev") \
+  X(EVEL_KEY_SYSLOG_TAG, "syslogTag") \
+  X(EVEL_KEY_SYSLOG_VER, "syslogVer") \
+  X(EVEL_KEY_TAC, "tac") \
+  X(EVEL_KEY_TCP_FLAG_COUNT_LIST, "tcpFlagCountList") \
+  X(EVEL_KEY_TCP_FLAG_LIST, "tcpFlagList") \
+  X(EVEL_KEY_THRESHOLD_CROSSED, "thresholdCrossed") \
+  X(EVEL_KEY_THRESHOLD_CROSSING_ALERT, "thresholdCrossingAlert") \
+  X(EVEL_KEY_THRESHOLD_CROSSING_FIELDS_VERSION, \
+    "thresholdCrossingFieldsVersion") \
+  X(EVEL_KEY_TIME_TO_FIRST_BYTE, "timeToFirstByte") \
+  X(EVEL_KEY_TRANSMIT_DISCARDS, "transmitDiscards") \
+  X(EVEL_KEY_TRANSMIT_ERRORS, "transmitErrors") \
+  X(EVEL_KEY_TRANSMITTED_BROADCAST_PACKETS_ACCUMULATED, \
+    "transmittedBroadcastPacketsAccumulated") \
+  X(EVEL_KEY_TRANSMITTED_BROADCAST_PACKETS_DELTA, \
+    "transmittedBroadcastPacketsDelta") \
+  X(EVEL_KEY_TRANSMITTED_DISCARDED_PACKETS_ACCUMULATED, \
+    "transmittedDiscardedPacketsAccumulated") \
+  X(EVEL_KEY_TRANSMITTED_DISCARDED_PACKETS_DELTA, \
+    "transmittedDiscardedPacketsDelta") \
+  X(EVEL_KEY_TRANSMITTED_ERROR_PACKETS_ACCUMULATED, \
+    "transmittedErrorPacketsAccumulated") \
+  X(EVEL_KEY_TRANSMITTED_ERROR_PACKETS_DELTA, "transmittedErrorPacketsDelta") \
+  X(EVEL_KEY_TRANSMITTED_MULTICAST_PACKETS_ACCUMULATED, \
+    "transmittedMulticastPacketsAccumulated") \
+  X(EVEL_KEY_TRANSMITTED_MULTICAST_PACKETS_DELTA, \
+    "transmittedMulticastPacketsDelta") \
+  X(EVEL_KEY_TRANSMITTED_OCTETS_ACCUMULATED, "transmittedOctetsAccumulated") \
+  X(EVEL_KEY_TRANSMITTED_OCTETS_DELTA, "transmittedOctetsDelta") \
+  X(EVEL_KEY_TRANSMITTED_TOTAL_PACKETS_ACCUMULATED, \
+    "transmittedTotalPacketsAccumulated") \
+  X(EVEL_KEY_TRANSMITTED_TOTAL_PACKETS_DELTA, "transmittedTotalPacketsDelta") \
+  X(EVEL_KEY_TRANSMITTED_UNICAST_PACKETS_ACCUMULATED, \
+    "transmittedUnicastPacketsAccumulated") \
+  X(EVEL_KEY_TRANSMITTED_UNICAST_PACKETS_DELTA, \
+    "transmittedUnicastPacketsDelta") \
+  X(EVEL_KEY_TUNNEL_ID, "tunnelId") \
+  X(EVEL_KEY_V_NIC_IDENTIFIER, "vNicIdentifier") \
+  X(EVEL_KEY_V_NIC_PERFORMANCE_ARRAY, "vNicPerformanceArray") \
+  X(EVEL_KEY_V_NIC_USAGE_ARRAY, "vNicUsageArray") \
+  X(EVEL_KEY_VALUE, "value") \
+  X(EVEL_KEY_VALUES_ARE_SUSPECT, "valuesAreSuspect") \
+  X(EVEL_KEY_VENDOR_NAME, "vendorName") \
+  X(EVEL_KEY_VENDOR_VNF_NAME_FIELDS, "vendorVnfNameFields") \
+  X(EVEL_KEY_VERSION, "version") \
+  X(EVEL_KEY_VF_MODULE_NAME, "vfModuleName") \
+  X(EVEL_KEY_VF_STATUS, "vfStatus") \
+  X(EVEL_KEY_VLAN_ID, "vlanId") \
+  X(EVEL_KEY_VM_IDENTIFIER, "vmIdentifier") \
+  X(EVEL_KEY_VNF_NAME, "vnfName") \
+  X(EVEL_KEY_VNFC_SCALING_METRIC, "vnfcScalingMetric") \
+  X(EVEL_KEY_VOICE_QUALITY_FIELDS, "voiceQualityFields") \
+  X(EVEL_KEY_VOICE_QUALITY_FIELDS_VERSION, "voiceQualityFieldsVersion")
+
+/**************************************************************************//**
+ * Identifiers for the JSON keys.
+ *****************************************************************************/
+typedef enum {
+#define EVEL_JSON_KEY_ENUM(id, name) id,
+  EVEL_JSON_KEYS(EVEL_JSON_KEY_ENUM)
+#undef EVEL_JSON_KEY_ENUM
+  EVEL_MAX_JSON_KEYS
+} EVEL_JSON_KEY_ID;
+
+/*****************************************************************************/
+/* The name of each ::EVEL_JSON_KEY_ID, indexed by identifier.               */
+/*****************************************************************************/
+extern const char * const evel_json_key_names[EVEL_MAX_JSON_KEYS];
+
+#endif
@@ -0,0 +1,436 @@
+/**************************************************************************//**
+ * @file
+ * Streaming of encoded JSON events to the cURL upload.
+ *
+ * An encoder thread encodes each event into a pair of windows which are
+ * handed on in turn to the cURL read callback, so that the first bytes of a
+ * large event are on the wire before the last are encoded and the whole
+ * event never has to be held in memory at once.
+ *
+ * License
+ * -------
+ *
+ * Copyright(c) <2016>, AT&T Intellectual Property.  All other rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:  This product includes
+ *    software developed by the AT&T.
+ * 4. Neither the name of AT&T nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific
+ *    prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AT&T INTELLECTUAL PROPERTY ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AT&T INTELLECTUAL PROPERTY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "evel.h"
+#include "evel_internal.h"
+#include "evel_throttle.h"
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void * evel_json_stream_encoder(void * arg);
+static void evel_json_stream_hand_on(EVEL_JSON_STREAM * stream,
+                                     const int length);
+
+/**************************************************************************//**
+ * Initialize a ::EVEL_JSON_STREAM and start its encoder thread.
+ *
+ * @param stream        Pointer to the ::EVEL_JSON_STREAM to initialize.
+ * @returns Status code
+ * @retval  EVEL_SUCCESS      On success
+ * @retval  ::EVEL_ERR_CODES  On failure.
+ *****************************************************************************/
+EVEL_ERR_CODES evel_json_stream_initialize(EVEL_JSON_STREAM * stream)
+{
+  EVEL_ERR_CODES rc = EVEL_SUCCESS;
+  int pthread_rc = 0;
+  int index;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(stream != NULL);
+
+  memset(stream, 0, sizeof(EVEL_JSON_STREAM));
+  pthread_mutex_init(&stream->mutex, NULL);
+  pthread_cond_init(&stream->cond, NULL);
+
+  /***************************************************************************/
+  /* Allocate the windows.  They grow later if an event needs them to.       */
+  /***************************************************************************/
+  for (index = 0; index < 2; index++)
+  {
+    stream->window[index] = malloc(EVEL_JSON_STREAM_WINDOW);
+    if (stream->window[index] == NULL)
+    {
+      rc = EVEL_OUT_OF_MEMORY;
+      log_error_state("Out of memory allocating stream window");
+      goto exit_label;
+    }
+    stream->window_size[index] = EVEL_JSON_STREAM_WINDOW;
+  }
+
+  /***************************************************************************/
+  /* Start the encoder thread.                                               */
+  /***************************************************************************/
+  pthread_rc = pthread_create(&stream->encoder_thread,
+                              NULL,
+                              evel_json_stream_encoder,
+                              stream);
+  if (pthread_rc != 0)
+  {
+    rc = EVEL_PTHREAD_LIBRARY_FAIL;
+    log_error_state("Failed to start stream encoder thread. "
+                    "Error code=%d", pthread_rc);
+  }
+
+exit_label:
+  EVEL_EXIT();
+  return rc;
+}
+
+/**************************************************************************//**
+ * Stop the encoder thread of a ::EVEL_JSON_STREAM and free its windows.
+ *
+ * @param stream        Pointer to the ::EVEL_JSON_STREAM to terminate.
+ *****************************************************************************/
+void evel_json_stream_terminate(EVEL_JSON_STREAM * stream)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(stream != NULL);
+  assert(stream->event == NULL);
+
+  pthread_mutex_lock(&stream->mutex);
+  stream->terminate = true;
+  pthread_cond_broadcast(&stream->cond);
+  pthread_mutex_unlock(&stream->mutex);
+  pthread_join(stream->encoder_thread, NULL);
+
+  free(stream->window[0]);
+  free(stream->window[1]);
+  stream->window[0] = NULL;
+  stream->window[1] = NULL;
+  pthread_cond_destroy(&stream->cond);
+  pthread_mutex_destroy(&stream->mutex);
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Start encoding an event into a ::EVEL_JSON_STREAM.
+ *
+ * The event must not be freed until ::evel_json_stream_finish has returned.
+ *
+ * @param stream        Pointer to the idle ::EVEL_JSON_STREAM.
+ * @param event         Pointer to the ::EVENT_HEADER to encode.
+ *****************************************************************************/
+void evel_json_stream_start(EVEL_JSON_STREAM * stream, EVENT_HEADER * event)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(stream != NULL);
+  assert(event != NULL);
+
+  pthread_mutex_lock(&stream->mutex);
+  assert(stream->event == NULL);
+  stream->drain = NULL;
+  stream->drain_length = 0;
+  stream->encoding_done = false;
+  stream->aborted = false;
+  stream->event = event;
+  pthread_cond_broadcast(&stream->cond);
+  pthread_mutex_unlock(&stream->mutex);
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Read the next piece of encoded JSON from a ::EVEL_JSON_STREAM.
+ *
+ * Blocks until the encoder thread has handed on more data or has finished.
+ *
+ * @param stream        Pointer to the ::EVEL_JSON_STREAM.
+ * @param buffer        Where to copy the data.
+ * @param max_size      Size of storage available in the buffer.
+ * @returns Number of bytes copied.  0 once the whole event has been read.
+ *****************************************************************************/
+size_t evel_json_stream_read(EVEL_JSON_STREAM * stream,
+                             char * buffer,
+                             size_t max_size)
+{
+  size_t bytes_to_copy = 0;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(stream != NULL);
+  assert(buffer != NULL);
+
+  pthread_mutex_lock(&stream->mutex);
+  while ((stream->drain_length == 0) && (!stream->encoding_done))
+  {
+    pthread_cond_wait(&stream->cond, &stream->mutex);
+  }
+
+  bytes_to_copy = min(max_size, (size_t) stream->drain_length);
+  if (bytes_to_copy > 0)
+  {
+    memcpy(buffer, stream->drain, bytes_to_copy);
+    stream->drain += bytes_to_copy;
+    stream->drain_length -= bytes_to_copy;
+
+    /*************************************************************************/
+    /* Let the encoder have the window back once it is drained.              */
+    /*************************************************************************/
+    if (stream->drain_length == 0)
+    {
+      pthread_cond_broadcast(&stream->cond);
+    }
+  }
+  else
+  {
+    EVEL_DEBUG("Reached end of streamed event");
+  }
+  pthread_mutex_unlock(&stream->mutex);
+
+  EVEL_EXIT();
+  return bytes_to_copy;
+}
+
+/**************************************************************************//**
+ * Finish with the current event on a ::EVEL_JSON_STREAM.
+ *
+ * Any unread data is discarded and the call waits for the encoder thread to
+ * be done with the event, after which the event may be freed.
+ *
+ * @param stream        Pointer to the ::EVEL_JSON_STREAM.
+ *****************************************************************************/
+void evel_json_stream_finish(EVEL_JSON_STREAM * stream)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(stream != NULL);
+
+  pthread_mutex_lock(&stream->mutex);
+  stream->aborted = true;
+  stream->drain_length = 0;
+  pthread_cond_broadcast(&stream->cond);
+  while (stream->event != NULL)
+  {
+    pthread_cond_wait(&stream->cond, &stream->mutex);
+  }
+  pthread_mutex_unlock(&stream->mutex);
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Hand the completed part of a JSON buffer on to its stream.
+ *
+ * On return there is room for at least the required number of bytes.  The
+ * last byte written is retained since the encoder looks back at it to place
+ * commas.
+ *
+ * @param jbuf          Pointer to working ::EVEL_JSON_BUFFER.
+ * @param required      Number of bytes needed in the buffer.
+ *****************************************************************************/
+void evel_json_stream_flush(EVEL_JSON_BUFFER * jbuf, const int required)
+{
+  EVEL_JSON_STREAM * stream;
+  int flush_length;
+  int retained;
+  int next;
+  int next_size;
+  char * next_window;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(jbuf != NULL);
+  assert(jbuf->stream != NULL);
+  assert(required > 0);
+
+  stream = jbuf->stream;
+  flush_length = max(jbuf->offset - 1, 0);
+  retained = jbuf->offset - flush_length;
+
+  pthread_mutex_lock(&stream->mutex);
+
+  /***************************************************************************/
+  /* Wait for the cURL upload to drain the other window before handing this  */
+  /* one on and switching to encoding into the other one.  If the upload has */
+  /* been abandoned then just discard what we've encoded so far.             */
+  /***************************************************************************/
+  while ((stream->drain_length > 0) && (!stream->aborted))
+  {
+    pthread_cond_wait(&stream->cond, &stream->mutex);
+  }
+  next = stream->encode_window;
+  if ((flush_length > 0) && (!stream->aborted))
+  {
+    stream->drain = jbuf->json;
+    stream->drain_length = flush_length;
+    pthread_cond_broadcast(&stream->cond);
+    next = 1 - stream->encode_window;
+  }
+
+  /***************************************************************************/
+  /* Make sure the window we're moving to is large enough for the retained   */
+  /* data and the new output, then move the retained data into it.  This is  */
+  /* safe outside the lock as the upload only reads the flushed data.        */
+  /***************************************************************************/
+  pthread_mutex_unlock(&stream->mutex);
+  next_size = stream->window_size[next];
+  while (next_size - retained <= required)
+  {
+    next_size *= 2;
+  }
+  if (next_size != stream->window_size[next])
+  {
+    EVEL_DEBUG("Growing stream window %d to %d bytes", next, next_size);
+    next_window = malloc(next_size);
+    assert(next_window != NULL);
+    memcpy(next_window, jbuf->json + flush_length, retained);
+    free(stream->window[next]);
+    stream->window[next] = next_window;
+    stream->window_size[next] = next_size;
+  }
+  else
+  {
+    memmove(stream->window[next], jbuf->json + flush_length, retained);
+  }
+
+  jbuf->json = stream->window[next];
+  jbuf->max_size = next_size;
+  jbuf->offset = retained;
+  stream->encode_window = next;
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Hand the final part of an encoded event on to the cURL upload.
+ *
+ * @param stream        Pointer to the ::EVEL_JSON_STREAM.
+ * @param length        Number of bytes at the start of the encode window.
+ *****************************************************************************/
+static void evel_json_stream_hand_on(EVEL_JSON_STREAM * stream,
+                                     const int length)
+{
+  EVEL_ENTER();
+
+  pthread_mutex_lock(&stream->mutex);
+  while ((stream->drain_length > 0) && (!stream->aborted))
+  {
+    pthread_cond_wait(&stream->cond, &stream->mutex);
+  }
+  if (!stream->aborted)
+  {
+    stream->drain = stream->window[stream->encode_window];
+    stream->drain_length = length;
+    stream->encode_window = 1 - stream->encode_window;
+  }
+
+  /***************************************************************************/
+  /* The encoder is done with the event now, so mark it so.                  */
+  /***************************************************************************/
+  stream->encoding_done = true;
+  stream->event = NULL;
+  pthread_cond_broadcast(&stream->cond);
+  pthread_mutex_unlock(&stream->mutex);
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Stream encoder thread.
+ *
+ * Wait for events to be started on the stream and encode them into it.
+ *
+ * @param arg           The ::EVEL_JSON_STREAM.
+ *****************************************************************************/
+static void * evel_json_stream_encoder(void * arg)
+{
+  EVEL_JSON_STREAM * stream = (EVEL_JSON_STREAM *) arg;
+  EVEL_JSON_BUFFER json_buffer;
+  EVEL_JSON_BUFFER * jbuf = &json_buffer;
+  EVENT_HEADER * event;
+
+  EVEL_INFO("Stream encoder thread started");
+
+  while (true)
+  {
+    /*************************************************************************/
+    /* Wait to be given an event, or to be told to exit.                     */
+    /*************************************************************************/
+    pthread_mutex_lock(&stream->mutex);
+    while ((stream->event == NULL) && (!stream->terminate))
+    {
+      pthread_cond_wait(&stream->cond, &stream->mutex);
+    }
+    event = stream->event;
+    pthread_mutex_unlock(&stream->mutex);
+
+    if (event == NULL)
+    {
+      break;
+    }
+
+    /*************************************************************************/
+    /* Encode the event into the current window, handing the buffer on as it */
+    /* fills, then hand on whatever is left.                                 */
+    /*************************************************************************/
+    evel_throttle_lock_specs();
+    evel_json_buffer_init(jbuf,
+                          stream->window[stream->encode_window],
+                          stream->window_size[stream->encode_window],
+                          evel_get_throttle_spec(event->event_domain));
+    jbuf->stream = stream;
+    evel_json_encode_event_object(jbuf, event);
+    evel_throttle_unlock_specs();
+    evel_json_stream_hand_on(stream, jbuf->offset);
+  }
+
+  EVEL_INFO("Stream encoder thread stopped");
+
+  return NULL;
+}
@@ -91,6 +91,67 @@ exit_label:
 }
 
 
+/**************************************************************************//**
+ * Check that a string is a valid JSON object.
+ *
+ * @param   yourjson       json string.
+ * @returns Whether the string is a JSON object.
+ *****************************************************************************/
+static bool evel_jsonobjinst_is_valid(const char * const yourjson)
+{
+  int resultCode;
+  jsmn_parser p;
+  jsmntok_t tokens[MAX_JSON_TOKENS]; // a number >= total number of tokens
+
+  jsmn_init(&p);
+  resultCode = jsmn_parse(&p, yourjson, strlen(yourjson) + 1,
+                          tokens, sizeof(tokens)/sizeof(tokens[0]));
+  if( resultCode < 0 ){
+    log_error_state("Failed to parse json for object");
+    return false;
+  }
+
+  if (resultCode < 1 || tokens[0].type != JSMN_OBJECT) {
+    log_error_state("Error json object expected");
+    return false;
+  }
+
+  return true;
+}
+
+/**************************************************************************//**
+ * Allocate a json object instance around a json string.
+ *
+ * @param   yourjson       json string, which the instance takes ownership of.
+ * @returns pointer to the newly manufactured ::EVEL_JSON_OBJECT_INSTANCE.
+ * @retval  NULL  Failed to create the json object instance, in which case
+ *                the caller keeps ownership of the json string.
+ *****************************************************************************/
+static EVEL_JSON_OBJECT_INSTANCE * evel_jsonobjinst_create(char * yourjson)
+{
+  EVEL_JSON_OBJECT_INSTANCE *jobjinst = NULL;
+
+  /***************************************************************************/
+  /* Allocate the json object.                                               */
+  /***************************************************************************/
+  jobjinst = malloc(sizeof(EVEL_JSON_OBJECT_INSTANCE));
+  if (jobjinst == NULL)
+  {
+    log_error_state("Out of memory");
+    return NULL;
+  }
+  memset(jobjinst, 0, sizeof(EVEL_JSON_OBJECT_INSTANCE));
+
+  /***************************************************************************/
+  /* Initialize the fields.  Optional key values are                         */
+  /* uninitialized (NULL).                                                   */
+  /***************************************************************************/
+  jobjinst->jsonstring = yourjson;
+  dlist_initialize(&jobjinst->object_keys);
+
+  return jobjinst;
+}
+
 /**************************************************************************//**
  * Create a new json object instance.
  *
@@ -106,12 +167,7 @@ exit_label:
 EVEL_JSON_OBJECT_INSTANCE * evel_new_jsonobjinstance(const char *const yourjson)
 {
   EVEL_JSON_OBJECT_INSTANCE *jobjinst = NULL;
-  jsmntok_t *key;
-  int resultCode;
-  jsmn_parser p;
-  jsmntok_t tokens[MAX_JSON_TOKENS]; // a number >= total number of tokens
-  int len=0;
-
+  char * json_copy;
 
   EVEL_ENTER();
 
@@ -119,48 +175,64 @@ EVEL_JSON_OBJECT_INSTANCE * evel_new_jsonobjinstance(const char *const yourjson)
   /* Check preconditions.                                                    */
   /***************************************************************************/
   assert(yourjson != NULL);
-  len = strlen(yourjson)+1;
-  assert(len > 0);
 
   /***************************************************************************/
   /*  Validate JSON for json object                                          */
   /***************************************************************************/
-  jsmn_init(&p);
-  resultCode = jsmn_parse(&p, yourjson, len, tokens, sizeof(tokens)/sizeof(tokens[0]));
-  if( resultCode < 0 ){
-    log_error_state("Failed to parse json for object");
+  if (!evel_jsonobjinst_is_valid(yourjson))
+  {
     goto exit_label;
   }
 
-  if (resultCode < 1 || tokens[0].type != JSMN_OBJECT) {
-    log_error_state("Error json object expected");
+  json_copy = strdup(yourjson);
+  if (json_copy == NULL)
+  {
+    log_error_state("Out of memory");
     goto exit_label;
   }
-
-  /***************************************************************************/
-  /* Allocate the json object.                                                     */
-  /***************************************************************************/
-  jobjinst = malloc(sizeof(EVEL_JSON_OBJECT_INSTANCE));
+  jobjinst = evel_jsonobjinst_create(json_copy);
   if (jobjinst == NULL)
   {
-    log_error_state("Out of memory");
-    goto exit_label;
+    free(json_copy);
   }
-  memset(jobjinst, 0, sizeof(EVEL_JSON_OBJECT_INSTANCE));
+
+exit_label:
+  EVEL_EXIT();
+  return jobjinst;
+}
+
+/**************************************************************************//**
+ * Create a new json object instance from trusted json, taking ownership of it.
+ *
+ * Unlike ::evel_new_jsonobjinstance the json is neither parsed nor copied, so
+ * it must already be a valid json object, and must have been allocated with
+ * malloc since it is freed along with the instance.  It is only checked in
+ * debug builds, where invalid json fails an assertion.
+ *
+ * @param   yourjson       json string, which the instance takes ownership of.
+ * @returns pointer to the newly manufactured ::EVEL_JSON_OBJECT_INSTANCE.
+ *          not used (i.e. posted) it must be released using ::evel_free_jsonobjectinstance.
+ * @retval  NULL  Failed to create the json object instance, in which case
+ *                the caller keeps ownership of the json string.
+ *****************************************************************************/
+EVEL_JSON_OBJECT_INSTANCE * evel_new_jsonobjinstance_take(char * yourjson)
+{
+  EVEL_JSON_OBJECT_INSTANCE *jobjinst = NULL;
+
+  EVEL_ENTER();
 
   /***************************************************************************/
-  /* Initialize the fields.  Optional key values are   */
-  /* uninitialized (NULL).                                                   */
+  /* Check preconditions.                                                    */
   /***************************************************************************/
-  jobjinst->jsonstring = strdup(yourjson);
-  dlist_initialize(&jobjinst->object_keys);
+  assert(yourjson != NULL);
+  assert(evel_jsonobjinst_is_valid(yourjson));
+
+  jobjinst = evel_jsonobjinst_create(yourjson);
 
-exit_label:
   EVEL_EXIT();
   return jobjinst;
 }
 
-
 /**************************************************************************//**
  * Create a new internal key.
  *
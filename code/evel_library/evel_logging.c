@@ -35,10 +35,14 @@
  *****************************************************************************/
 
 #include <string.h>
+#include <stdint.h>
 #include <assert.h>
 #include <syslog.h>
 #include <stdlib.h>
 #include <sys/time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
 
 #include <curl/curl.h>
 
@@ -51,13 +55,151 @@
 /*****************************************************************************/
 EVEL_LOG_LEVELS debug_level = EVEL_LOG_DEBUG;
 //static char *syslog_ident = "evel";
-int debug_indent = 0;
+
+/*****************************************************************************/
+/* Nesting of the traced functions, which is per thread since each thread    */
+/* has its own call stack.                                                   */
+/*****************************************************************************/
+__thread int debug_indent = 0;
 
 /*****************************************************************************/
 /* Buffers for error strings from this library.                              */
 /*****************************************************************************/
 static char evel_err_string[EVEL_MAX_ERROR_STRING_LEN] = "<NULL>";
 
+/*****************************************************************************/
+/* Rate limit for errors: how many may be logged from one place in each      */
+/* interval of so many seconds.                                              */
+/*****************************************************************************/
+static unsigned int log_limit_burst = 10;
+static time_t log_limit_interval = 60;
+
+/*****************************************************************************/
+/* Rate limits which have suppressed errors, pushed on without a lock and    */
+/* never taken off, as they are all static, and when they were last checked */
+/* for intervals which are over.                                             */
+/*****************************************************************************/
+static EVEL_LOG_LIMIT * log_limits_listed = NULL;
+static time_t log_limit_flushed = 0;
+
+/*****************************************************************************/
+/* Number of keys which can be rate limited separately, across all places,   */
+/* and the longest key told apart, including the NUL.                        */
+/*****************************************************************************/
+#define LOG_LIMIT_KEYS 256
+#define LOG_LIMIT_KEY_LEN 64
+
+/**************************************************************************//**
+ * The rate limiting state for a key at a place errors are logged.
+ *****************************************************************************/
+typedef struct log_limit_key {
+  const EVEL_LOG_LIMIT * site;
+  char key[LOG_LIMIT_KEY_LEN];
+  EVEL_LOG_LIMIT limit;
+} LOG_LIMIT_KEY;
+
+/*****************************************************************************/
+/* Hash table of keyed rate limits.  Entries are never removed, and are only */
+/* looked up when an error is made, so a lock will do.                       */
+/*****************************************************************************/
+static LOG_LIMIT_KEY log_limit_keys[LOG_LIMIT_KEYS];
+static pthread_mutex_t log_limit_keys_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/*****************************************************************************/
+/* Longest log written when logging asynchronously, including the NUL.       */
+/*****************************************************************************/
+#define EVEL_LOG_RECORD_LEN 512
+
+/*****************************************************************************/
+/* Number of logs each thread can have waiting to be written.                */
+/*****************************************************************************/
+#define EVEL_LOG_RING_SIZE 256
+
+/*****************************************************************************/
+/* How long the logging thread sleeps when there is nothing to write.        */
+/*****************************************************************************/
+#define EVEL_LOG_IDLE_NSEC 10000000
+
+/**************************************************************************//**
+ * A log waiting to be written.
+ *****************************************************************************/
+typedef struct evel_log_record {
+  int priority;
+  char text[EVEL_LOG_RECORD_LEN];
+} EVEL_LOG_RECORD;
+
+/**************************************************************************//**
+ * The logs from one thread waiting to be written.
+ *
+ * Only the thread adds logs, and only the logging thread takes them, so the
+ * ring needs no lock: each side just publishes its own index.
+ *****************************************************************************/
+typedef struct evel_log_ring {
+  EVEL_LOG_RECORD records[EVEL_LOG_RING_SIZE];
+
+  /***************************************************************************/
+  /* Count of logs added, and of logs dropped because the ring was full, as  */
+  /* updated by the thread.                                                  */
+  /***************************************************************************/
+  unsigned int head;
+  unsigned int dropped;
+
+  /***************************************************************************/
+  /* Count of logs written, and of dropped logs reported, as updated by the  */
+  /* logging thread.                                                         */
+  /***************************************************************************/
+  unsigned int tail;
+  unsigned int dropped_reported;
+
+  /***************************************************************************/
+  /* Set when the thread exits, so the ring can be freed once empty.         */
+  /***************************************************************************/
+  bool orphaned;
+
+  struct evel_log_ring * next;
+} EVEL_LOG_RING;
+
+/*****************************************************************************/
+/* Asynchronous logging state.  Threads push their rings onto the list       */
+/* without a lock, and only the logging thread, or ::log_terminate once it   */
+/* has stopped, takes them off.  The writers count is of threads between     */
+/* seeing that the logging thread is running and finishing with their ring,  */
+/* which ::log_terminate waits to reach zero before the last drain.  The     */
+/* generation moves on each time the rings are freed, so that a thread does  */
+/* not use a ring from before.                                               */
+/*****************************************************************************/
+static bool evel_log_async = false;
+static bool evel_log_async_running = false;
+static bool evel_log_async_stop = false;
+static unsigned int evel_log_async_writers = 0;
+static unsigned int evel_log_generation = 1;
+static pthread_t evel_log_thread;
+static EVEL_LOG_RING * evel_log_rings = NULL;
+static pthread_key_t evel_log_ring_key;
+static pthread_once_t evel_log_ring_key_once = PTHREAD_ONCE_INIT;
+static __thread EVEL_LOG_RING * evel_log_thread_ring = NULL;
+static __thread unsigned int evel_log_thread_generation = 0;
+static __thread bool evel_log_thread_exited = false;
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void evel_log_ring_key_create(void);
+static bool evel_log_writer_enter(void);
+static void evel_log_writer_exit(void);
+static void evel_log_ring_orphan(void * ring);
+static EVEL_LOG_RING * evel_log_ring_get(void);
+static bool evel_log_async_write(const int priority,
+                                 const char * const format,
+                                 va_list largs);
+static bool evel_log_drain(void);
+static void evel_log_rings_free(void);
+static void log_limit_roll(EVEL_LOG_LIMIT * limit,
+                           const char * const format,
+                           const time_t now,
+                           const bool all);
+static void * evel_log_thread_main(void * arg);
+
 
 /**************************************************************************//**
  * Initialize logging
@@ -72,6 +214,73 @@ void log_initialize(EVEL_LOG_LEVELS level, const char * ident)
 
   debug_level = level;
   openlog(ident, LOG_PID, LOG_USER);
+
+  /***************************************************************************/
+  /* Start the logging thread if asked to.  If it can't be started then we   */
+  /* just carry on logging from the calling threads.                         */
+  /***************************************************************************/
+  if (evel_log_async && !evel_log_async_running)
+  {
+    pthread_once(&evel_log_ring_key_once, evel_log_ring_key_create);
+    evel_log_async_stop = false;
+    if (pthread_create(&evel_log_thread,
+                       NULL,
+                       evel_log_thread_main,
+                       NULL) == 0)
+    {
+      __atomic_store_n(&evel_log_async_running, true, __ATOMIC_RELEASE);
+    }
+  }
+}
+
+/**************************************************************************//**
+ * Stop logging asynchronously, writing any logs still waiting.
+ *
+ * Called from ::evel_terminate.
+ *****************************************************************************/
+void log_terminate(void)
+{
+  log_limit_flush(true);
+
+  if (evel_log_async_running)
+  {
+    /*************************************************************************/
+    /* Once no thread is still adding a log, all later logs are written      */
+    /* directly, so nothing more can arrive in the rings.                    */
+    /*************************************************************************/
+    __atomic_store_n(&evel_log_async_running, false, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&evel_log_async_writers, __ATOMIC_SEQ_CST) != 0)
+    {
+      sched_yield();
+    }
+    __atomic_store_n(&evel_log_async_stop, true, __ATOMIC_RELEASE);
+    pthread_join(evel_log_thread, NULL);
+
+    /*************************************************************************/
+    /* Pick up anything added while the logging thread was stopping, then    */
+    /* free the rings, including those of threads still running.             */
+    /*************************************************************************/
+    evel_log_drain();
+    evel_log_rings_free();
+  }
+}
+
+/**************************************************************************//**
+ * Enable or disable asynchronous logging.
+ *
+ * When enabled, logs are formatted by the threads making them but written
+ * to syslog by a separate logging thread, so that a slow syslog never holds
+ * up the library.  Each thread has its own ring of waiting logs, and if it
+ * fills the logs are dropped, and the number dropped logged, rather than
+ * waiting for space.  Logs longer than 511 characters are truncated.
+ *
+ * @note  This must be called before ::evel_initialize.
+ *
+ * @param enable        Whether to log asynchronously.
+ *****************************************************************************/
+void evel_set_async_logging(const bool enable)
+{
+  evel_log_async = enable;
 }
 
 /**************************************************************************//**
@@ -92,10 +301,35 @@ const char * evel_error_string(void)
 /***************************************************************************//*
  * Store the formatted string into the static error string and log the error.
  *
+ * Calls are made through the macro of the same name, which rate limits the
+ * logs from each call separately using ::log_error_state_limited.
+ *
+ * @param format  Error string in standard printf format.
+ * @param ...     Variable parameters to be substituted into the format string.
+ *****************************************************************************/
+void (log_error_state)(char * format, ...)
+{
+  va_list largs;
+
+  assert(format != NULL);
+  va_start(largs, format);
+  vsnprintf(evel_err_string, EVEL_MAX_ERROR_STRING_LEN, format, largs);
+  va_end(largs);
+  log_debug(EVEL_LOG_ERROR, "ERROR: %s", evel_err_string);
+}
+
+/***************************************************************************//*
+ * Store the formatted string into the static error string and log the error,
+ * if the rate limit allows.
+ *
+ * The error string is always stored, so ::evel_error_string still returns
+ * the latest error.
+ *
+ * @param limit   The rate limiting state for the caller, or NULL for none.
  * @param format  Error string in standard printf format.
  * @param ...     Variable parameters to be substituted into the format string.
  *****************************************************************************/
-void log_error_state(char * format, ...)
+void log_error_state_limited(EVEL_LOG_LIMIT * limit, char * format, ...)
 {
   va_list largs;
 
@@ -103,7 +337,224 @@ void log_error_state(char * format, ...)
   va_start(largs, format);
   vsnprintf(evel_err_string, EVEL_MAX_ERROR_STRING_LEN, format, largs);
   va_end(largs);
-  EVEL_ERROR("%s", evel_err_string);
+  if (EVEL_LOG_ON(EVEL_LOG_ERROR) &&
+      ((limit == NULL) || log_limit_allow(limit, format)))
+  {
+    log_debug(EVEL_LOG_ERROR, "ERROR: %s", evel_err_string);
+  }
+}
+
+/**************************************************************************//**
+ * Decide whether an error may be logged under its rate limit.
+ *
+ * The first errors in each interval are logged, and the rest counted.  The
+ * count of those suppressed is logged by ::log_limit_flush once the interval
+ * is over, or first if one is made in a later interval.
+ *
+ * The state is shared by all threads logging from the same place, so is
+ * updated atomically.  Races at the end of an interval can only let an
+ * extra error or two through.
+ *
+ * @param limit   The rate limiting state for where the error is made.
+ * @param format  The format of the error, used to describe it in the count.
+ * @returns true if the error should be logged, false if suppressed.
+ *****************************************************************************/
+bool log_limit_allow(EVEL_LOG_LIMIT * limit, const char * const format)
+{
+  const unsigned int burst = __atomic_load_n(&log_limit_burst,
+                                             __ATOMIC_RELAXED);
+
+  assert(limit != NULL);
+
+  if (burst == 0)
+  {
+    return true;
+  }
+
+  log_limit_roll(limit, format, time(NULL), false);
+
+  if (__atomic_add_fetch(&limit->count, 1, __ATOMIC_RELAXED) <= burst)
+  {
+    return true;
+  }
+  __atomic_add_fetch(&limit->suppressed, 1, __ATOMIC_RELAXED);
+
+  /***************************************************************************/
+  /* List the limit the first time it suppresses an error, so the count is   */
+  /* reported even if the error is not made again.                           */
+  /***************************************************************************/
+  if (!__atomic_exchange_n(&limit->listed, true, __ATOMIC_RELAXED))
+  {
+    limit->format = format;
+    limit->next = __atomic_load_n(&log_limits_listed, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&log_limits_listed,
+                                        &limit->next,
+                                        limit,
+                                        true,
+                                        __ATOMIC_RELEASE,
+                                        __ATOMIC_RELAXED))
+    {
+    }
+  }
+  return false;
+}
+
+/**************************************************************************//**
+ * Get the rate limiting state for a key at a place errors are logged.
+ *
+ * Once too many keys are in use, further keys share the state of the place.
+ *
+ * @param site    The rate limiting state for the place.
+ * @param key     The key, such as the description of a field.
+ * @returns The rate limiting state to use.
+ *****************************************************************************/
+EVEL_LOG_LIMIT * log_limit_keyed(EVEL_LOG_LIMIT * site, const char * key)
+{
+  EVEL_LOG_LIMIT * limit = site;
+  LOG_LIMIT_KEY * entry;
+  unsigned int hash = 2166136261u;
+  const char * next;
+  int probe;
+
+  assert(site != NULL);
+  assert(key != NULL);
+
+  /***************************************************************************/
+  /* FNV-1a hash of the place and as much of the key as is told apart.       */
+  /***************************************************************************/
+  hash = (hash ^ (unsigned int) ((uintptr_t) site >> 4)) * 16777619u;
+  for (next = key; (*next != '\0') && (next - key < LOG_LIMIT_KEY_LEN - 1);
+       next++)
+  {
+    hash = (hash ^ (unsigned char) *next) * 16777619u;
+  }
+
+  pthread_mutex_lock(&log_limit_keys_mutex);
+  for (probe = 0; probe < LOG_LIMIT_KEYS; probe++)
+  {
+    entry = &log_limit_keys[(hash + probe) % LOG_LIMIT_KEYS];
+    if (entry->site == NULL)
+    {
+      entry->site = site;
+      strncpy(entry->key, key, LOG_LIMIT_KEY_LEN - 1);
+      entry->limit.key = entry->key;
+      limit = &entry->limit;
+      break;
+    }
+    if ((entry->site == site) &&
+        (strncmp(entry->key, key, LOG_LIMIT_KEY_LEN - 1) == 0))
+    {
+      limit = &entry->limit;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&log_limit_keys_mutex);
+
+  return limit;
+}
+
+/**************************************************************************//**
+ * Log the counts of suppressed errors whose intervals are over.
+ *
+ * Called at intervals by the logging and event handler threads, and from
+ * ::log_terminate to log all the counts, over or not.  Unless logging all
+ * the counts, this does nothing if called again within the same second.
+ *
+ * @param all     Whether to log the counts of intervals not yet over.
+ *****************************************************************************/
+void log_limit_flush(const bool all)
+{
+  EVEL_LOG_LIMIT * limit;
+  time_t now;
+
+  limit = __atomic_load_n(&log_limits_listed, __ATOMIC_ACQUIRE);
+  if (limit == NULL)
+  {
+    return;
+  }
+
+  now = time(NULL);
+  if (!all &&
+      (__atomic_exchange_n(&log_limit_flushed, now, __ATOMIC_RELAXED) == now))
+  {
+    return;
+  }
+
+  for (; limit != NULL; limit = limit->next)
+  {
+    if (__atomic_load_n(&limit->suppressed, __ATOMIC_RELAXED) > 0)
+    {
+      log_limit_roll(limit, limit->format, now, all);
+    }
+  }
+}
+
+/**************************************************************************//**
+ * Start a new rate limiting interval if this one is over, logging the count
+ * of errors suppressed in it.
+ *
+ * Only one of the threads racing to start the new interval does so.
+ *
+ * @param limit   The rate limiting state.
+ * @param format  The format of the error, used to describe it in the count.
+ * @param now     The time now.
+ * @param all     Whether to start a new interval even if this one is not
+ *                over.
+ *****************************************************************************/
+static void log_limit_roll(EVEL_LOG_LIMIT * limit,
+                           const char * const format,
+                           const time_t now,
+                           const bool all)
+{
+  const time_t interval = __atomic_load_n(&log_limit_interval,
+                                          __ATOMIC_RELAXED);
+  time_t start;
+  unsigned int suppressed;
+
+  start = __atomic_load_n(&limit->interval_start, __ATOMIC_RELAXED);
+  if ((all || (now - start >= interval)) &&
+      __atomic_compare_exchange_n(&limit->interval_start,
+                                  &start,
+                                  now,
+                                  false,
+                                  __ATOMIC_RELAXED,
+                                  __ATOMIC_RELAXED))
+  {
+    __atomic_store_n(&limit->count, 0, __ATOMIC_RELAXED);
+    suppressed = __atomic_exchange_n(&limit->suppressed, 0, __ATOMIC_RELAXED);
+    if (suppressed > 0)
+    {
+      log_debug(EVEL_LOG_ERROR,
+                "ERROR: Suppressed %u similar messages in the last %ld "
+                "seconds: %s%s%s",
+                suppressed,
+                (long) (now - start),
+                format,
+                (limit->key != NULL) ? " - " : "",
+                (limit->key != NULL) ? limit->key : "");
+    }
+  }
+}
+
+/**************************************************************************//**
+ * Set the rate limit for errors.
+ *
+ * Each place in the library which logs errors may log @p burst of them in
+ * each @p interval seconds.  Errors beyond that are counted, and the count
+ * logged in a summary once the interval is over.  The default is 10 errors
+ * in 60 seconds.
+ *
+ * @param burst     The number of errors to log in each interval, or 0 to log
+ *                  them all.
+ * @param interval  The length of the interval in seconds.
+ *****************************************************************************/
+void evel_set_error_log_limit(const int burst, const int interval)
+{
+  assert(burst >= 0);
+  assert(interval > 0);
+
+  __atomic_store_n(&log_limit_burst, burst, __ATOMIC_RELAXED);
+  __atomic_store_n(&log_limit_interval, interval, __ATOMIC_RELAXED);
 }
 
 
@@ -173,9 +624,291 @@ void log_debug(EVEL_LOG_LEVELS level, char * format, ...)
 
     /*************************************************************************/
     /* Write the log to the file next, which requires the var args list.     */
+    /* If logging asynchronously this just formats it into the thread's      */
+    /* ring, falling back on writing it here if the thread has no ring.      */
     /*************************************************************************/
     va_start(largs, format);
-    vsyslog(priority, syslog_fmt, largs);
+    if (!evel_log_async_write(priority, syslog_fmt, largs))
+    {
+      va_end(largs);
+      va_start(largs, format);
+      vsyslog(priority, syslog_fmt, largs);
+    }
     va_end(largs);
   }
-}
\ No newline at end of file
+}
+/**************************************************************************//**
+ * Create the key whose destructor marks a thread's ring as orphaned.
+ *****************************************************************************/
+static void evel_log_ring_key_create(void)
+{
+  pthread_key_create(&evel_log_ring_key, evel_log_ring_orphan);
+}
+
+/**************************************************************************//**
+ * Start using the calling thread's ring, if the logging thread is running.
+ *
+ * Each call that returns true must be matched by ::evel_log_writer_exit.
+ *
+ * @returns true if the logging thread is running, false if not.
+ *****************************************************************************/
+static bool evel_log_writer_enter(void)
+{
+  if (!__atomic_load_n(&evel_log_async_running, __ATOMIC_RELAXED))
+  {
+    return false;
+  }
+
+  /***************************************************************************/
+  /* Either ::log_terminate sees this writer and waits for it, or this       */
+  /* writer sees that the logging thread is stopping.                        */
+  /***************************************************************************/
+  __atomic_add_fetch(&evel_log_async_writers, 1, __ATOMIC_SEQ_CST);
+  if (!__atomic_load_n(&evel_log_async_running, __ATOMIC_SEQ_CST))
+  {
+    evel_log_writer_exit();
+    return false;
+  }
+
+  return true;
+}
+
+/**************************************************************************//**
+ * Finish using the calling thread's ring.
+ *****************************************************************************/
+static void evel_log_writer_exit(void)
+{
+  __atomic_sub_fetch(&evel_log_async_writers, 1, __ATOMIC_RELEASE);
+}
+
+/**************************************************************************//**
+ * Mark a thread's ring as orphaned when the thread exits.
+ *
+ * The logging thread frees it once it has written the logs in it.  Any logs
+ * made later in the thread's exit are written directly.  A ring left over
+ * from before ::log_terminate has already been freed, so is not touched.
+ *
+ * @param ring          Pointer to the ::EVEL_LOG_RING.
+ *****************************************************************************/
+static void evel_log_ring_orphan(void * ring)
+{
+  evel_log_thread_exited = true;
+  evel_log_thread_ring = NULL;
+  if (evel_log_writer_enter())
+  {
+    if (evel_log_thread_generation ==
+                  __atomic_load_n(&evel_log_generation, __ATOMIC_RELAXED))
+    {
+      __atomic_store_n(&((EVEL_LOG_RING *) ring)->orphaned,
+                       true,
+                       __ATOMIC_RELEASE);
+    }
+    evel_log_writer_exit();
+  }
+}
+
+/**************************************************************************//**
+ * Get the calling thread's ring, creating it on the first log.
+ *
+ * The new ring is pushed onto the list of rings without taking a lock.
+ *
+ * @returns Pointer to the ::EVEL_LOG_RING.
+ * @retval  NULL  The thread is exiting or the ring could not be created.
+ *****************************************************************************/
+static EVEL_LOG_RING * evel_log_ring_get(void)
+{
+  EVEL_LOG_RING * ring = evel_log_thread_ring;
+  const unsigned int generation =
+                  __atomic_load_n(&evel_log_generation, __ATOMIC_RELAXED);
+
+  if ((ring != NULL) && (evel_log_thread_generation != generation))
+  {
+    ring = NULL;
+  }
+
+  if ((ring == NULL) && !evel_log_thread_exited)
+  {
+    ring = calloc(1, sizeof(EVEL_LOG_RING));
+    if (ring != NULL)
+    {
+      ring->next = __atomic_load_n(&evel_log_rings, __ATOMIC_RELAXED);
+      while (!__atomic_compare_exchange_n(&evel_log_rings,
+                                          &ring->next,
+                                          ring,
+                                          true,
+                                          __ATOMIC_RELEASE,
+                                          __ATOMIC_RELAXED))
+      {
+      }
+      pthread_setspecific(evel_log_ring_key, ring);
+      evel_log_thread_ring = ring;
+      evel_log_thread_generation = generation;
+    }
+  }
+
+  return ring;
+}
+
+/**************************************************************************//**
+ * Format a log into the calling thread's ring, for the logging thread to
+ * write.
+ *
+ * If the ring is full the log is dropped and counted.  This never waits.
+ *
+ * @param priority      The syslog priority of the log.
+ * @param format        The output formatting in printf style.
+ * @param largs         The arguments specified in the format string.
+ * @returns true if the log was dealt with, false if it must be written
+ *          directly.
+ *****************************************************************************/
+static bool evel_log_async_write(const int priority,
+                                 const char * const format,
+                                 va_list largs)
+{
+  EVEL_LOG_RING * ring;
+  EVEL_LOG_RECORD * record;
+  unsigned int head;
+
+  if (!evel_log_writer_enter())
+  {
+    return false;
+  }
+
+  ring = evel_log_ring_get();
+  if (ring == NULL)
+  {
+    evel_log_writer_exit();
+    return false;
+  }
+
+  head = ring->head;
+  if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) ==
+                                                            EVEL_LOG_RING_SIZE)
+  {
+    __atomic_store_n(&ring->dropped, ring->dropped + 1, __ATOMIC_RELAXED);
+  }
+  else
+  {
+    record = &ring->records[head % EVEL_LOG_RING_SIZE];
+    record->priority = priority;
+    vsnprintf(record->text, sizeof(record->text), format, largs);
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+  }
+  evel_log_writer_exit();
+
+  return true;
+}
+
+/**************************************************************************//**
+ * Write all the logs waiting in the threads' rings, and free the rings of
+ * threads which have exited.
+ *
+ * Only one thread may drain the rings at once.  Threads may push new rings
+ * onto the list meanwhile, so the first ring is only unlinked if it is still
+ * first, and otherwise the list is walked again.
+ *
+ * @returns true if anything was written, false if there was nothing to do.
+ *****************************************************************************/
+static bool evel_log_drain(void)
+{
+  EVEL_LOG_RING ** link;
+  EVEL_LOG_RING * ring;
+  EVEL_LOG_RECORD * record;
+  unsigned int head;
+  unsigned int tail;
+  unsigned int dropped;
+  bool orphaned;
+  bool written = false;
+
+  link = &evel_log_rings;
+  while ((ring = __atomic_load_n(link, __ATOMIC_ACQUIRE)) != NULL)
+  {
+    orphaned = __atomic_load_n(&ring->orphaned, __ATOMIC_ACQUIRE);
+
+    head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    for (tail = ring->tail; tail != head; tail++)
+    {
+      record = &ring->records[tail % EVEL_LOG_RING_SIZE];
+      syslog(record->priority, "%s", record->text);
+      __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+      written = true;
+    }
+
+    dropped = __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED);
+    if (dropped != ring->dropped_reported)
+    {
+      syslog(LOG_ERR,
+             "ERROR: Dropped %u logs",
+             dropped - ring->dropped_reported);
+      ring->dropped_reported = dropped;
+      written = true;
+    }
+
+    if (!orphaned)
+    {
+      link = &ring->next;
+    }
+    else if (link != &evel_log_rings)
+    {
+      *link = ring->next;
+      free(ring);
+    }
+    else if (__atomic_compare_exchange_n(link,
+                                         &ring,
+                                         ring->next,
+                                         false,
+                                         __ATOMIC_ACQUIRE,
+                                         __ATOMIC_RELAXED))
+    {
+      free(ring);
+    }
+  }
+
+  return written;
+}
+
+/**************************************************************************//**
+ * Free all the rings once nothing can be adding to them.
+ *
+ * Threads still running get a new ring if they log after asynchronous
+ * logging starts again.
+ *****************************************************************************/
+static void evel_log_rings_free(void)
+{
+  EVEL_LOG_RING * ring;
+  EVEL_LOG_RING * next;
+
+  ring = __atomic_exchange_n(&evel_log_rings, NULL, __ATOMIC_ACQUIRE);
+  while (ring != NULL)
+  {
+    next = ring->next;
+    free(ring);
+    ring = next;
+  }
+  __atomic_add_fetch(&evel_log_generation, 1, __ATOMIC_RELEASE);
+}
+
+/**************************************************************************//**
+ * Logging thread, writing the logs from the other threads to syslog.
+ *
+ * @param arg           Not used.
+ * @returns NULL.
+ *****************************************************************************/
+static void * evel_log_thread_main(void * arg)
+{
+  const struct timespec idle = {0, EVEL_LOG_IDLE_NSEC};
+
+  (void) arg;
+
+  while (!__atomic_load_n(&evel_log_async_stop, __ATOMIC_ACQUIRE))
+  {
+    log_limit_flush(false);
+    if (!evel_log_drain())
+    {
+      nanosleep(&idle, NULL);
+    }
+  }
+  evel_log_drain();
+
+  return NULL;
+}
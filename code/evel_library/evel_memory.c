@@ -0,0 +1,386 @@
+/**************************************************************************//**
+ * @file
+ * Accounting of the memory held by queued events, per domain, and the limit
+ * applied to it when events are posted.
+ *
+ * License
+ * -------
+ *
+ * Copyright(c) <2016>, AT&T Intellectual Property.  All other rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:  This product includes
+ *    software developed by the AT&T.
+ * 4. Neither the name of AT&T nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific
+ *    prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AT&T INTELLECTUAL PROPERTY ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AT&T INTELLECTUAL PROPERTY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "evel.h"
+#include "evel_internal.h"
+
+/*****************************************************************************/
+/* Bytes held now and at most by each domain's queued events, indexed by     */
+/* ::EVEL_EVENT_DOMAINS, with the totals for all domains last.               */
+/*****************************************************************************/
+static size_t evel_memory_current[EVEL_MAX_DOMAINS + 1];
+static size_t evel_memory_high_water[EVEL_MAX_DOMAINS + 1];
+
+/*****************************************************************************/
+/* The limit on the total, or 0 for none, and what to do when it is reached. */
+/*****************************************************************************/
+static size_t evel_memory_limit = 0;
+static EVEL_MEMORY_LIMIT_ACTIONS evel_memory_limit_action =
+                                                        EVEL_MEMORY_LIMIT_SHED;
+
+/*****************************************************************************/
+/* Threads waiting for room under the limit, and the mutex and condition     */
+/* they wait on.                                                             */
+/*****************************************************************************/
+static int evel_memory_waiters = 0;
+static pthread_mutex_t evel_memory_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t evel_memory_cond = PTHREAD_COND_INITIALIZER;
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static size_t evel_memory_footprint(EVENT_HEADER * const event);
+static bool evel_memory_reserve(const size_t bytes);
+static void evel_memory_add(const int domain, const size_t bytes);
+static void evel_memory_raise_high_water(const int index, const size_t bytes);
+
+/**************************************************************************//**
+ * Set a limit on the memory held by queued events.
+ *
+ * @param limit         The limit in bytes, or 0 for none.
+ * @param action        What to do with events posted at the limit.
+ *****************************************************************************/
+void evel_set_memory_limit(const size_t limit,
+                           const EVEL_MEMORY_LIMIT_ACTIONS action)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(action < EVEL_MAX_MEMORY_LIMIT_ACTIONS);
+
+  /***************************************************************************/
+  /* Wake any waiters, who may now have room or no longer be allowed to wait.*/
+  /***************************************************************************/
+  pthread_mutex_lock(&evel_memory_mutex);
+  __atomic_store_n(&evel_memory_limit_action, action, __ATOMIC_SEQ_CST);
+  __atomic_store_n(&evel_memory_limit, limit, __ATOMIC_SEQ_CST);
+  pthread_cond_broadcast(&evel_memory_cond);
+  pthread_mutex_unlock(&evel_memory_mutex);
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Get the memory held by queued events of a domain.
+ *
+ * @param domain        The domain, or ::EVEL_MAX_DOMAINS for all domains.
+ * @param current       Where to store the bytes held now.
+ * @param high_water    Where to store the most bytes held at once.
+ *****************************************************************************/
+void evel_get_memory_usage(const EVEL_EVENT_DOMAINS domain,
+                           size_t * const current,
+                           size_t * const high_water)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(domain <= EVEL_MAX_DOMAINS);
+  assert(current != NULL);
+  assert(high_water != NULL);
+
+  *current = __atomic_load_n(&evel_memory_current[domain], __ATOMIC_RELAXED);
+  *high_water = __atomic_load_n(&evel_memory_high_water[domain],
+                                __ATOMIC_RELAXED);
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Charge an event being queued to a domain's memory usage.
+ *
+ * @param event         Pointer to the event.
+ * @param domain        The domain to charge.
+ * @param limited       Whether the event is subject to the memory limit.
+ *                      Events which are not are always charged.
+ * @returns Whether the event was charged.  If not, it is over the limit and
+ *          must be dropped.
+ *****************************************************************************/
+bool evel_memory_charge(EVENT_HEADER * const event,
+                        const EVEL_EVENT_DOMAINS domain,
+                        const bool limited)
+{
+  size_t bytes;
+  size_t total;
+  bool charged = true;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->memory_charged == 0);
+  assert(domain < EVEL_MAX_DOMAINS);
+
+  bytes = evel_memory_footprint(event);
+  if (limited)
+  {
+    charged = evel_memory_reserve(bytes);
+    if (!charged)
+    {
+      goto exit_label;
+    }
+    total = __atomic_add_fetch(&evel_memory_current[domain],
+                               bytes,
+                               __ATOMIC_RELAXED);
+    evel_memory_raise_high_water(domain, total);
+  }
+  else
+  {
+    evel_memory_add(domain, bytes);
+  }
+  event->memory_charged = bytes;
+  event->memory_domain = domain;
+
+exit_label:
+  EVEL_EXIT();
+  return charged;
+}
+
+/**************************************************************************//**
+ * Release the memory charged for an event as it is freed.
+ *
+ * @param event         Pointer to the event, which may not have been charged.
+ *****************************************************************************/
+void evel_memory_release(EVENT_HEADER * const event)
+{
+  if (event->memory_charged > 0)
+  {
+    evel_memory_release_bytes(event->memory_domain, event->memory_charged);
+    event->memory_charged = 0;
+  }
+}
+
+/**************************************************************************//**
+ * Charge memory held for a domain other than by queued events, such as its
+ * throttle specification.
+ *
+ * The memory is always charged, but counts towards the limit for events.
+ *
+ * @param domain        The domain to charge.
+ * @param bytes         The number of bytes.
+ *****************************************************************************/
+void evel_memory_charge_bytes(const EVEL_EVENT_DOMAINS domain,
+                              const size_t bytes)
+{
+  assert(domain < EVEL_MAX_DOMAINS);
+
+  evel_memory_add(domain, bytes);
+}
+
+/**************************************************************************//**
+ * Release memory charged with ::evel_memory_charge_bytes.
+ *
+ * @param domain        The domain charged.
+ * @param bytes         The number of bytes charged.
+ *****************************************************************************/
+void evel_memory_release_bytes(const EVEL_EVENT_DOMAINS domain,
+                               const size_t bytes)
+{
+  assert(domain < EVEL_MAX_DOMAINS);
+
+  __atomic_sub_fetch(&evel_memory_current[domain], bytes, __ATOMIC_RELAXED);
+  __atomic_sub_fetch(&evel_memory_current[EVEL_MAX_DOMAINS],
+                     bytes,
+                     __ATOMIC_SEQ_CST);
+
+  /***************************************************************************/
+  /* A waiter counted itself before checking for room, so either sees the    */
+  /* room now or is woken here.                                              */
+  /***************************************************************************/
+  if (__atomic_load_n(&evel_memory_waiters, __ATOMIC_SEQ_CST) > 0)
+  {
+    pthread_mutex_lock(&evel_memory_mutex);
+    pthread_cond_broadcast(&evel_memory_cond);
+    pthread_mutex_unlock(&evel_memory_mutex);
+  }
+}
+
+/**************************************************************************//**
+ * The memory held by an event: its structure, and its arena or its encoding.
+ *
+ * Only what is known without walking the event is counted, so the strings
+ * and lists of an event without an arena are not.
+ *
+ * @param event         Pointer to the event.
+ * @returns The size in bytes.
+ *****************************************************************************/
+static size_t evel_memory_footprint(EVENT_HEADER * const event)
+{
+  EVENT_INTERNAL * internal;
+  size_t bytes;
+
+  bytes = evel_event_size(event->event_domain);
+  if (event->event_domain == EVEL_DOMAIN_INTERNAL)
+  {
+    internal = (EVENT_INTERNAL *) event;
+    if (internal->command == EVT_CMD_POST_ENCODED)
+    {
+      bytes += internal->encoded.size;
+    }
+  }
+  else if (event->arena != NULL)
+  {
+    bytes += evel_arena_size(event->arena);
+  }
+
+  return bytes;
+}
+
+/**************************************************************************//**
+ * Add to the total held by queued events, if there is room under the limit.
+ *
+ * If there is no room and the limit's action is to block, wait until there
+ * is.
+ *
+ * @param bytes         The number of bytes to add.
+ * @returns Whether the bytes were added.
+ *****************************************************************************/
+static bool evel_memory_reserve(const size_t bytes)
+{
+  size_t * const total = &evel_memory_current[EVEL_MAX_DOMAINS];
+  size_t current;
+  size_t limit;
+  bool waiting = false;
+  bool reserved = false;
+
+  current = __atomic_load_n(total, __ATOMIC_SEQ_CST);
+  while (true)
+  {
+    limit = __atomic_load_n(&evel_memory_limit, __ATOMIC_SEQ_CST);
+    if ((limit == 0) || (current == 0) || (current + bytes <= limit))
+    {
+      if (__atomic_compare_exchange_n(total,
+                                      &current,
+                                      current + bytes,
+                                      false,
+                                      __ATOMIC_SEQ_CST,
+                                      __ATOMIC_SEQ_CST))
+      {
+        evel_memory_raise_high_water(EVEL_MAX_DOMAINS, current + bytes);
+        reserved = true;
+        break;
+      }
+      continue;
+    }
+
+    if (__atomic_load_n(&evel_memory_limit_action, __ATOMIC_SEQ_CST) !=
+        EVEL_MEMORY_LIMIT_BLOCK)
+    {
+      break;
+    }
+
+    /*************************************************************************/
+    /* Count ourselves as waiting before checking again under the mutex, so  */
+    /* that a release in between wakes us.                                   */
+    /*************************************************************************/
+    pthread_mutex_lock(&evel_memory_mutex);
+    if (!waiting)
+    {
+      __atomic_add_fetch(&evel_memory_waiters, 1, __ATOMIC_SEQ_CST);
+      waiting = true;
+    }
+    current = __atomic_load_n(total, __ATOMIC_SEQ_CST);
+    limit = __atomic_load_n(&evel_memory_limit, __ATOMIC_SEQ_CST);
+    if ((limit != 0) && (current != 0) && (current + bytes > limit) &&
+        (__atomic_load_n(&evel_memory_limit_action, __ATOMIC_SEQ_CST) ==
+         EVEL_MEMORY_LIMIT_BLOCK))
+    {
+      pthread_cond_wait(&evel_memory_cond, &evel_memory_mutex);
+      current = __atomic_load_n(total, __ATOMIC_SEQ_CST);
+    }
+    pthread_mutex_unlock(&evel_memory_mutex);
+  }
+
+  if (waiting)
+  {
+    __atomic_sub_fetch(&evel_memory_waiters, 1, __ATOMIC_SEQ_CST);
+  }
+
+  return reserved;
+}
+
+/**************************************************************************//**
+ * Add to the memory held by a domain and the total, regardless of the limit.
+ *
+ * @param domain        The domain.
+ * @param bytes         The number of bytes to add.
+ *****************************************************************************/
+static void evel_memory_add(const int domain, const size_t bytes)
+{
+  size_t total;
+
+  total = __atomic_add_fetch(&evel_memory_current[EVEL_MAX_DOMAINS],
+                             bytes,
+                             __ATOMIC_SEQ_CST);
+  evel_memory_raise_high_water(EVEL_MAX_DOMAINS, total);
+  total = __atomic_add_fetch(&evel_memory_current[domain],
+                             bytes,
+                             __ATOMIC_RELAXED);
+  evel_memory_raise_high_water(domain, total);
+}
+
+/**************************************************************************//**
+ * Raise a high-water mark to a new value, if that is higher.
+ *
+ * @param index         The domain, or ::EVEL_MAX_DOMAINS for the total.
+ * @param bytes         The new value.
+ *****************************************************************************/
+static void evel_memory_raise_high_water(const int index, const size_t bytes)
+{
+  size_t high_water;
+
+  high_water = __atomic_load_n(&evel_memory_high_water[index],
+                               __ATOMIC_RELAXED);
+  while ((bytes > high_water) &&
+         !__atomic_compare_exchange_n(&evel_memory_high_water[index],
+                                      &high_water,
+                                      bytes,
+                                      true,
+                                      __ATOMIC_RELAXED,
+                                      __ATOMIC_RELAXED))
+  {
+  }
+}
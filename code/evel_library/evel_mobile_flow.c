@@ -40,6 +40,11 @@
 #include "evel.h"
 #include "evel_internal.h"
 
+/*****************************************************************************/
+/* Space for an IP Type-of-Service formatted as a decimal string.            */
+/*****************************************************************************/
+#define EVEL_MAX_TOS_STRING_LEN 12
+
 /*****************************************************************************/
 /* Array of strings to use when encoding TCP flags.                          */
 /*****************************************************************************/
@@ -84,6 +89,7 @@ static char * evel_qci_cos_strings[EVEL_MAX_QCI_COS_TYPES] = {
 void evel_json_encode_mobile_flow_gtp_flow_metrics(
                                         EVEL_JSON_BUFFER * jbuf,
                                         MOBILE_GTP_PER_FLOW_METRICS * metrics);
+static void evel_free_adopted_gtp_flow_metrics(void * metrics);
 
 /**************************************************************************//**
  * Create a new Mobile Flow event.
@@ -133,13 +139,13 @@ EVENT_MOBILE_FLOW * evel_new_mobile_flow(const char* ev_name, const char *ev_id,
   /***************************************************************************/
   /* Allocate the Mobile Flow.                                               */
   /***************************************************************************/
-  mobile_flow = malloc(sizeof(EVENT_MOBILE_FLOW));
+  mobile_flow = evel_event_alloc(EVEL_DOMAIN_MOBILE_FLOW);
   if (mobile_flow == NULL)
   {
     log_error_state("Out of memory");
     goto exit_label;
   }
-  memset(mobile_flow, 0, sizeof(EVENT_MOBILE_FLOW));
+  mobile_flow->header.arena = evel_new_event_arena();
   EVEL_DEBUG("New Mobile Flow is at %lp", mobile_flow);
 
   /***************************************************************************/
@@ -150,13 +156,18 @@ EVENT_MOBILE_FLOW * evel_new_mobile_flow(const char* ev_name, const char *ev_id,
   mobile_flow->header.event_domain = EVEL_DOMAIN_MOBILE_FLOW;
   mobile_flow->major_version = EVEL_MOBILE_FLOW_MAJOR_VERSION;
   mobile_flow->minor_version = EVEL_MOBILE_FLOW_MINOR_VERSION;
-  mobile_flow->flow_direction = strdup(flow_direction);
+  mobile_flow->flow_direction = evel_arena_strdup(mobile_flow->header.arena,
+                                                  flow_direction);
   mobile_flow->gtp_per_flow_metrics = gtp_per_flow_metrics;
-  mobile_flow->ip_protocol_type = strdup(ip_protocol_type);
-  mobile_flow->ip_version = strdup(ip_version);
-  mobile_flow->other_endpoint_ip_address = strdup(other_endpoint_ip_address);
+  mobile_flow->ip_protocol_type = evel_arena_strdup(mobile_flow->header.arena,
+                                                    ip_protocol_type);
+  mobile_flow->ip_version = evel_arena_strdup(mobile_flow->header.arena,
+                                              ip_version);
+  mobile_flow->other_endpoint_ip_address =
+    evel_arena_strdup(mobile_flow->header.arena, other_endpoint_ip_address);
   mobile_flow->other_endpoint_port = other_endpoint_port;
-  mobile_flow->reporting_endpoint_ip_addr = strdup(reporting_endpoint_ip_addr);
+  mobile_flow->reporting_endpoint_ip_addr =
+    evel_arena_strdup(mobile_flow->header.arena, reporting_endpoint_ip_addr);
   mobile_flow->reporting_endpoint_port = reporting_endpoint_port;
   evel_init_option_string(&mobile_flow->application_type);
   evel_init_option_string(&mobile_flow->app_protocol_type);
@@ -183,6 +194,17 @@ EVENT_MOBILE_FLOW * evel_new_mobile_flow(const char* ev_name, const char *ev_id,
   evel_init_option_string(&mobile_flow->vlan_id);
   dlist_initialize(&mobile_flow->additional_info);
 
+  /***************************************************************************/
+  /* The metrics were allocated from the heap, so if the Mobile Flow has an  */
+  /* arena it must free the metrics along with everything else.              */
+  /***************************************************************************/
+  if (mobile_flow->header.arena != NULL)
+  {
+    evel_arena_adopt(mobile_flow->header.arena,
+                     evel_free_adopted_gtp_flow_metrics,
+                     gtp_per_flow_metrics);
+  }
+
 exit_label:
   EVEL_EXIT();
   return mobile_flow;
@@ -218,14 +240,14 @@ void evel_mobile_flow_addl_field_add(EVENT_MOBILE_FLOW * const event, char * nam
   assert(value != NULL);
 
   EVEL_DEBUG("Adding name=%s value=%s", name, value);
-  nv_pair = malloc(sizeof(OTHER_FIELD));
+  nv_pair = evel_arena_alloc(event->header.arena, sizeof(OTHER_FIELD));
   assert(nv_pair != NULL);
-  nv_pair->name = strdup(name);
-  nv_pair->value = strdup(value);
+  nv_pair->name = evel_arena_strdup(event->header.arena, name);
+  nv_pair->value = evel_arena_strdup(event->header.arena, value);
   assert(nv_pair->name != NULL);
   assert(nv_pair->value != NULL);
 
-  dlist_push_last(&event->additional_info, nv_pair);
+  evel_arena_list_push(event->header.arena, &event->additional_info, nv_pair);
 
   EVEL_EXIT();
 }
@@ -258,6 +280,34 @@ void evel_mobile_flow_type_set(EVENT_MOBILE_FLOW * mobile_flow,
   EVEL_EXIT();
 }
 
+/**************************************************************************//**
+ * Set the Event Type property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param type        The Event Type to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Mobile Flow takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_type_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                    char * const type)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions and call evel_header_type_set_take.                 */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  evel_header_type_set_take(&mobile_flow->header, type);
+
+  EVEL_EXIT();
+}
+
 /**************************************************************************//**
  * Set the Application Type property of the Mobile Flow.
  *
@@ -282,9 +332,42 @@ void evel_mobile_flow_app_type_set(EVENT_MOBILE_FLOW * mobile_flow,
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
   assert(type != NULL);
 
-  evel_set_option_string(&mobile_flow->application_type,
-                         type,
-                         "Application Type");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->application_type,
+                               type,
+                               "Application Type");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Application Type property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param type        The Application Type to be set.  ASCIIZ string allocated
+ *                    with malloc.  The Mobile Flow takes ownership of it, so
+ *                    the caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_app_type_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                        char * const type)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(type != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->application_type,
+                                type,
+                                "Application Type");
   EVEL_EXIT();
 }
 
@@ -312,9 +395,43 @@ void evel_mobile_flow_app_prot_type_set(EVENT_MOBILE_FLOW * mobile_flow,
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
   assert(type != NULL);
 
-  evel_set_option_string(&mobile_flow->app_protocol_type,
-                         type,
-                         "Application Protocol Type");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->app_protocol_type,
+                               type,
+                               "Application Protocol Type");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Application Protocol Type property of the Mobile Flow, without
+ * copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param type        The Application Protocol Type to be set.  ASCIIZ string
+ *                    allocated with malloc.  The Mobile Flow takes ownership
+ *                    of it, so the caller must not use or free it after the
+ *                    function returns.
+ *****************************************************************************/
+void evel_mobile_flow_app_prot_type_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                             char * const type)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(type != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->app_protocol_type,
+                                type,
+                                "Application Protocol Type");
   EVEL_EXIT();
 }
 
@@ -342,9 +459,43 @@ void evel_mobile_flow_app_prot_ver_set(EVENT_MOBILE_FLOW * mobile_flow,
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
   assert(version != NULL);
 
-  evel_set_option_string(&mobile_flow->app_protocol_version,
-                         version,
-                         "Application Protocol Version");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->app_protocol_version,
+                               version,
+                               "Application Protocol Version");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Application Protocol Version property of the Mobile Flow, without
+ * copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param version     The Application Protocol Version to be set.  ASCIIZ
+ *                    string allocated with malloc.  The Mobile Flow takes
+ *                    ownership of it, so the caller must not use or free it
+ *                    after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_app_prot_ver_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                            char * const version)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(version != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->app_protocol_version,
+                                version,
+                                "Application Protocol Version");
   EVEL_EXIT();
 }
 
@@ -371,9 +522,41 @@ void evel_mobile_flow_cid_set(EVENT_MOBILE_FLOW * mobile_flow,
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
   assert(cid != NULL);
 
-  evel_set_option_string(&mobile_flow->cid,
-                         cid,
-                         "CID");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->cid,
+                               cid,
+                               "CID");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the CID property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param cid         The CID to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_cid_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const cid)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(cid != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->cid,
+                                cid,
+                                "CID");
   EVEL_EXIT();
 }
 
@@ -401,9 +584,42 @@ void evel_mobile_flow_con_type_set(EVENT_MOBILE_FLOW * mobile_flow,
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
   assert(type != NULL);
 
-  evel_set_option_string(&mobile_flow->connection_type,
-                         type,
-                         "Connection Type");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->connection_type,
+                               type,
+                               "Connection Type");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Connection Type property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param type        The Connection Type to be set.  ASCIIZ string allocated
+ *                    with malloc.  The Mobile Flow takes ownership of it, so
+ *                    the caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_con_type_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                        char * const type)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(type != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->connection_type,
+                                type,
+                                "Connection Type");
   EVEL_EXIT();
 }
 
@@ -430,9 +646,41 @@ void evel_mobile_flow_ecgi_set(EVENT_MOBILE_FLOW * mobile_flow,
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
   assert(ecgi != NULL);
 
-  evel_set_option_string(&mobile_flow->ecgi,
-                         ecgi,
-                         "ECGI");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->ecgi,
+                               ecgi,
+                               "ECGI");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the ECGI property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param ecgi        The ECGI to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_ecgi_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                    char * const ecgi)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(ecgi != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->ecgi,
+                                ecgi,
+                                "ECGI");
   EVEL_EXIT();
 }
 
@@ -448,8 +696,410 @@ void evel_mobile_flow_ecgi_set(EVENT_MOBILE_FLOW * mobile_flow,
  *                    caller does not need to preserve the value once the
  *                    function returns.
  *****************************************************************************/
-void evel_mobile_flow_gtp_prot_type_set(EVENT_MOBILE_FLOW * mobile_flow,
-                                        const char * const type)
+void evel_mobile_flow_gtp_prot_type_set(EVENT_MOBILE_FLOW * mobile_flow,
+                                        const char * const type)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(type != NULL);
+
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->gtp_protocol_type,
+                               type,
+                               "GTP Protocol Type");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the GTP Protocol Type property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param type        The GTP Protocol Type to be set.  ASCIIZ string allocated
+ *                    with malloc.  The Mobile Flow takes ownership of it, so
+ *                    the caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_gtp_prot_type_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                             char * const type)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(type != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->gtp_protocol_type,
+                                type,
+                                "GTP Protocol Type");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the GTP Protocol Version property of the Mobile Flow.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param version     The GTP Protocol Version to be set. ASCIIZ string.  The
+ *                    caller does not need to preserve the value once the
+ *                    function returns.
+ *****************************************************************************/
+void evel_mobile_flow_gtp_prot_ver_set(EVENT_MOBILE_FLOW * mobile_flow,
+                                       const char * const version)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(version != NULL);
+
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->gtp_version,
+                               version,
+                               "GTP Protocol Version");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the GTP Protocol Version property of the Mobile Flow, without copying
+ * it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param version     The GTP Protocol Version to be set.  ASCIIZ string
+ *                    allocated with malloc.  The Mobile Flow takes ownership
+ *                    of it, so the caller must not use or free it after the
+ *                    function returns.
+ *****************************************************************************/
+void evel_mobile_flow_gtp_prot_ver_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                            char * const version)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(version != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->gtp_version,
+                                version,
+                                "GTP Protocol Version");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the HTTP Header property of the Mobile Flow.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param header      The HTTP header to be set. ASCIIZ string. The caller does
+ *                    not need to preserve the value once the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_http_header_set(EVENT_MOBILE_FLOW * mobile_flow,
+                                      const char * const header)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(header != NULL);
+
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->http_header,
+                               header,
+                               "HTTP Header");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the HTTP Header property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param header      The HTTP header to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Mobile Flow takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_http_header_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                           char * const header)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(header != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->http_header,
+                                header,
+                                "HTTP Header");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the IMEI property of the Mobile Flow.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param imei        The IMEI to be set. ASCIIZ string.  The caller does not
+ *                    need to preserve the value once the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_imei_set(EVENT_MOBILE_FLOW * mobile_flow,
+                               const char * const imei)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(imei != NULL);
+
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->imei,
+                               imei,
+                               "IMEI");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the IMEI property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param imei        The IMEI to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_imei_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                    char * const imei)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(imei != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->imei,
+                                imei,
+                                "IMEI");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the IMSI property of the Mobile Flow.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param imsi        The IMSI to be set. ASCIIZ string.  The caller does not
+ *                    need to preserve the value once the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_imsi_set(EVENT_MOBILE_FLOW * mobile_flow,
+                               const char * const imsi)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(imsi != NULL);
+
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->imsi,
+                               imsi,
+                               "IMSI");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the IMSI property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param imsi        The IMSI to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_imsi_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                    char * const imsi)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(imsi != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->imsi,
+                                imsi,
+                                "IMSI");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the LAC property of the Mobile Flow.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param lac         The LAC to be set. ASCIIZ string.  The caller does not
+ *                    need to preserve the value once the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_lac_set(EVENT_MOBILE_FLOW * mobile_flow,
+                              const char * const lac)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(lac != NULL);
+
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->lac,
+                               lac,
+                               "LAC");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the LAC property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param lac         The LAC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_lac_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const lac)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(lac != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->lac,
+                                lac,
+                                "LAC");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the MCC property of the Mobile Flow.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param mcc         The MCC to be set. ASCIIZ string.  The caller does not
+ *                    need to preserve the value once the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_mcc_set(EVENT_MOBILE_FLOW * mobile_flow,
+                              const char * const mcc)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(mcc != NULL);
+
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->mcc,
+                               mcc,
+                               "MCC");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the MCC property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param mcc         The MCC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_mcc_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const mcc)
 {
   EVEL_ENTER();
 
@@ -458,28 +1108,28 @@ void evel_mobile_flow_gtp_prot_type_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(type != NULL);
+  assert(mcc != NULL);
 
-  evel_set_option_string(&mobile_flow->gtp_protocol_type,
-                         type,
-                         "GTP Protocol Type");
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->mcc,
+                                mcc,
+                                "MCC");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the GTP Protocol Version property of the Mobile Flow.
+ * Set the MNC property of the Mobile Flow.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
  *        overwrite, just ignoring the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param version     The GTP Protocol Version to be set. ASCIIZ string.  The
- *                    caller does not need to preserve the value once the
- *                    function returns.
+ * @param mnc         The MNC to be set. ASCIIZ string.  The caller does not
+ *                    need to preserve the value once the function returns.
  *****************************************************************************/
-void evel_mobile_flow_gtp_prot_ver_set(EVENT_MOBILE_FLOW * mobile_flow,
-                                       const char * const version)
+void evel_mobile_flow_mnc_set(EVENT_MOBILE_FLOW * mobile_flow,
+                              const char * const mnc)
 {
   EVEL_ENTER();
 
@@ -488,27 +1138,29 @@ void evel_mobile_flow_gtp_prot_ver_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(version != NULL);
+  assert(mnc != NULL);
 
-  evel_set_option_string(&mobile_flow->gtp_version,
-                         version,
-                         "GTP Protocol Version");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->mnc,
+                               mnc,
+                               "MNC");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the HTTP Header property of the Mobile Flow.
+ * Set the MNC property of the Mobile Flow, without copying it.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
- *        overwrite, just ignoring the update instead.
+ *        overwrite, just ignoring (and freeing) the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param header      The HTTP header to be set. ASCIIZ string. The caller does
- *                    not need to preserve the value once the function returns.
+ * @param mnc         The MNC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
  *****************************************************************************/
-void evel_mobile_flow_http_header_set(EVENT_MOBILE_FLOW * mobile_flow,
-                                      const char * const header)
+void evel_mobile_flow_mnc_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const mnc)
 {
   EVEL_ENTER();
 
@@ -517,27 +1169,28 @@ void evel_mobile_flow_http_header_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(header != NULL);
+  assert(mnc != NULL);
 
-  evel_set_option_string(&mobile_flow->http_header,
-                         header,
-                         "HTTP Header");
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->mnc,
+                                mnc,
+                                "MNC");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the IMEI property of the Mobile Flow.
+ * Set the MSISDN property of the Mobile Flow.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
  *        overwrite, just ignoring the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param imei        The IMEI to be set. ASCIIZ string.  The caller does not
+ * @param msisdn      The MSISDN to be set. ASCIIZ string.  The caller does not
  *                    need to preserve the value once the function returns.
  *****************************************************************************/
-void evel_mobile_flow_imei_set(EVENT_MOBILE_FLOW * mobile_flow,
-                               const char * const imei)
+void evel_mobile_flow_msisdn_set(EVENT_MOBILE_FLOW * mobile_flow,
+                                 const char * const msisdn)
 {
   EVEL_ENTER();
 
@@ -546,27 +1199,30 @@ void evel_mobile_flow_imei_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(imei != NULL);
+  assert(msisdn != NULL);
 
-  evel_set_option_string(&mobile_flow->imei,
-                         imei,
-                         "IMEI");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->msisdn,
+                               msisdn,
+                               "MSISDN");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the IMSI property of the Mobile Flow.
+ * Set the MSISDN property of the Mobile Flow, without copying it.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
- *        overwrite, just ignoring the update instead.
+ *        overwrite, just ignoring (and freeing) the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param imsi        The IMSI to be set. ASCIIZ string.  The caller does not
- *                    need to preserve the value once the function returns.
+ * @param msisdn      The MSISDN to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Mobile Flow takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
  *****************************************************************************/
-void evel_mobile_flow_imsi_set(EVENT_MOBILE_FLOW * mobile_flow,
-                               const char * const imsi)
+void evel_mobile_flow_msisdn_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                      char * const msisdn)
 {
   EVEL_ENTER();
 
@@ -575,27 +1231,29 @@ void evel_mobile_flow_imsi_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(imsi != NULL);
+  assert(msisdn != NULL);
 
-  evel_set_option_string(&mobile_flow->imsi,
-                         imsi,
-                         "IMSI");
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->msisdn,
+                                msisdn,
+                                "MSISDN");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the LAC property of the Mobile Flow.
+ * Set the Other Functional Role property of the Mobile Flow.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
  *        overwrite, just ignoring the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param lac         The LAC to be set. ASCIIZ string.  The caller does not
- *                    need to preserve the value once the function returns.
+ * @param role        The Other Functional Role to be set. ASCIIZ string. The
+ *                    caller does not need to preserve the value once the
+ *                    function returns.
  *****************************************************************************/
-void evel_mobile_flow_lac_set(EVENT_MOBILE_FLOW * mobile_flow,
-                              const char * const lac)
+void evel_mobile_flow_other_func_role_set(EVENT_MOBILE_FLOW * mobile_flow,
+                                          const char * const role)
 {
   EVEL_ENTER();
 
@@ -604,27 +1262,31 @@ void evel_mobile_flow_lac_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(lac != NULL);
+  assert(role != NULL);
 
-  evel_set_option_string(&mobile_flow->lac,
-                         lac,
-                         "LAC");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->other_functional_role,
+                               role,
+                               "Other Functional Role");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the MCC property of the Mobile Flow.
+ * Set the Other Functional Role property of the Mobile Flow, without copying
+ * it.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
- *        overwrite, just ignoring the update instead.
+ *        overwrite, just ignoring (and freeing) the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param mcc         The MCC to be set. ASCIIZ string.  The caller does not
- *                    need to preserve the value once the function returns.
+ * @param role        The Other Functional Role to be set.  ASCIIZ string
+ *                    allocated with malloc.  The Mobile Flow takes ownership
+ *                    of it, so the caller must not use or free it after the
+ *                    function returns.
  *****************************************************************************/
-void evel_mobile_flow_mcc_set(EVENT_MOBILE_FLOW * mobile_flow,
-                              const char * const mcc)
+void evel_mobile_flow_other_func_role_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                               char * const role)
 {
   EVEL_ENTER();
 
@@ -633,27 +1295,28 @@ void evel_mobile_flow_mcc_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(mcc != NULL);
+  assert(role != NULL);
 
-  evel_set_option_string(&mobile_flow->mcc,
-                         mcc,
-                         "MCC");
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->other_functional_role,
+                                role,
+                                "Other Functional Role");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the MNC property of the Mobile Flow.
+ * Set the RAC property of the Mobile Flow.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
  *        overwrite, just ignoring the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param mnc         The MNC to be set. ASCIIZ string.  The caller does not
+ * @param rac         The RAC to be set. ASCIIZ string.  The caller does not
  *                    need to preserve the value once the function returns.
  *****************************************************************************/
-void evel_mobile_flow_mnc_set(EVENT_MOBILE_FLOW * mobile_flow,
-                              const char * const mnc)
+void evel_mobile_flow_rac_set(EVENT_MOBILE_FLOW * mobile_flow,
+                              const char * const rac)
 {
   EVEL_ENTER();
 
@@ -662,27 +1325,29 @@ void evel_mobile_flow_mnc_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(mnc != NULL);
+  assert(rac != NULL);
 
-  evel_set_option_string(&mobile_flow->mnc,
-                         mnc,
-                         "MNC");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->rac,
+                               rac,
+                               "RAC");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the MSISDN property of the Mobile Flow.
+ * Set the RAC property of the Mobile Flow, without copying it.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
- *        overwrite, just ignoring the update instead.
+ *        overwrite, just ignoring (and freeing) the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param msisdn      The MSISDN to be set. ASCIIZ string.  The caller does not
- *                    need to preserve the value once the function returns.
+ * @param rac         The RAC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
  *****************************************************************************/
-void evel_mobile_flow_msisdn_set(EVENT_MOBILE_FLOW * mobile_flow,
-                                 const char * const msisdn)
+void evel_mobile_flow_rac_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const rac)
 {
   EVEL_ENTER();
 
@@ -691,28 +1356,29 @@ void evel_mobile_flow_msisdn_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(msisdn != NULL);
+  assert(rac != NULL);
 
-  evel_set_option_string(&mobile_flow->msisdn,
-                         msisdn,
-                         "MSISDN");
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->rac,
+                                rac,
+                                "RAC");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the Other Functional Role property of the Mobile Flow.
+ * Set the Radio Access Technology property of the Mobile Flow.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
  *        overwrite, just ignoring the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param role        The Other Functional Role to be set. ASCIIZ string. The
+ * @param tech        The Radio Access Technology to be set. ASCIIZ string. The
  *                    caller does not need to preserve the value once the
  *                    function returns.
  *****************************************************************************/
-void evel_mobile_flow_other_func_role_set(EVENT_MOBILE_FLOW * mobile_flow,
-                                          const char * const role)
+void evel_mobile_flow_radio_acc_tech_set(EVENT_MOBILE_FLOW * mobile_flow,
+                                         const char * const tech)
 {
   EVEL_ENTER();
 
@@ -721,27 +1387,31 @@ void evel_mobile_flow_other_func_role_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(role != NULL);
+  assert(tech != NULL);
 
-  evel_set_option_string(&mobile_flow->other_functional_role,
-                         role,
-                         "Other Functional Role");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->radio_access_technology,
+                               tech,
+                               "Radio Access Technology");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the RAC property of the Mobile Flow.
+ * Set the Radio Access Technology property of the Mobile Flow, without copying
+ * it.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
- *        overwrite, just ignoring the update instead.
+ *        overwrite, just ignoring (and freeing) the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param rac         The RAC to be set. ASCIIZ string.  The caller does not
- *                    need to preserve the value once the function returns.
+ * @param tech        The Radio Access Technology to be set.  ASCIIZ string
+ *                    allocated with malloc.  The Mobile Flow takes ownership
+ *                    of it, so the caller must not use or free it after the
+ *                    function returns.
  *****************************************************************************/
-void evel_mobile_flow_rac_set(EVENT_MOBILE_FLOW * mobile_flow,
-                              const char * const rac)
+void evel_mobile_flow_radio_acc_tech_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                              char * const tech)
 {
   EVEL_ENTER();
 
@@ -750,28 +1420,28 @@ void evel_mobile_flow_rac_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(rac != NULL);
+  assert(tech != NULL);
 
-  evel_set_option_string(&mobile_flow->rac,
-                         rac,
-                         "RAC");
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->radio_access_technology,
+                                tech,
+                                "Radio Access Technology");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the Radio Access Technology property of the Mobile Flow.
+ * Set the SAC property of the Mobile Flow.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
  *        overwrite, just ignoring the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param tech        The Radio Access Technology to be set. ASCIIZ string. The
- *                    caller does not need to preserve the value once the
- *                    function returns.
+ * @param sac         The SAC to be set. ASCIIZ string.  The caller does not
+ *                    need to preserve the value once the function returns.
  *****************************************************************************/
-void evel_mobile_flow_radio_acc_tech_set(EVENT_MOBILE_FLOW * mobile_flow,
-                                         const char * const tech)
+void evel_mobile_flow_sac_set(EVENT_MOBILE_FLOW * mobile_flow,
+                              const char * const sac)
 {
   EVEL_ENTER();
 
@@ -780,27 +1450,29 @@ void evel_mobile_flow_radio_acc_tech_set(EVENT_MOBILE_FLOW * mobile_flow,
   /***************************************************************************/
   assert(mobile_flow != NULL);
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
-  assert(tech != NULL);
+  assert(sac != NULL);
 
-  evel_set_option_string(&mobile_flow->radio_access_technology,
-                         tech,
-                         "Radio Access Technology");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->sac,
+                               sac,
+                               "SAC");
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Set the SAC property of the Mobile Flow.
+ * Set the SAC property of the Mobile Flow, without copying it.
  *
  * @note  The property is treated as immutable: it is only valid to call
  *        the setter once.  However, we don't assert if the caller tries to
- *        overwrite, just ignoring the update instead.
+ *        overwrite, just ignoring (and freeing) the update instead.
  *
  * @param mobile_flow Pointer to the Mobile Flow.
- * @param sac         The SAC to be set. ASCIIZ string.  The caller does not
- *                    need to preserve the value once the function returns.
+ * @param sac         The SAC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
  *****************************************************************************/
-void evel_mobile_flow_sac_set(EVENT_MOBILE_FLOW * mobile_flow,
-                              const char * const sac)
+void evel_mobile_flow_sac_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const sac)
 {
   EVEL_ENTER();
 
@@ -811,9 +1483,10 @@ void evel_mobile_flow_sac_set(EVENT_MOBILE_FLOW * mobile_flow,
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
   assert(sac != NULL);
 
-  evel_set_option_string(&mobile_flow->sac,
-                         sac,
-                         "SAC");
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->sac,
+                                sac,
+                                "SAC");
   EVEL_EXIT();
 }
 
@@ -868,9 +1541,41 @@ void evel_mobile_flow_tac_set(EVENT_MOBILE_FLOW * mobile_flow,
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
   assert(tac != NULL);
 
-  evel_set_option_string(&mobile_flow->tac,
-                         tac,
-                         "TAC");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->tac,
+                               tac,
+                               "TAC");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the TAC property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param tac         The TAC to be set.  ASCIIZ string allocated with malloc.
+ *                    The Mobile Flow takes ownership of it, so the caller must
+ *                    not use or free it after the function returns.
+ *****************************************************************************/
+void evel_mobile_flow_tac_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                   char * const tac)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(tac != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->tac,
+                                tac,
+                                "TAC");
   EVEL_EXIT();
 }
 
@@ -897,9 +1602,42 @@ void evel_mobile_flow_tunnel_id_set(EVENT_MOBILE_FLOW * mobile_flow,
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
   assert(tunnel_id != NULL);
 
-  evel_set_option_string(&mobile_flow->tunnel_id,
-                         tunnel_id,
-                         "Tunnel ID");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->tunnel_id,
+                               tunnel_id,
+                               "Tunnel ID");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Tunnel ID property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param tunnel_id   The Tunnel ID to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Mobile Flow takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_tunnel_id_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                         char * const tunnel_id)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(tunnel_id != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->tunnel_id,
+                                tunnel_id,
+                                "Tunnel ID");
   EVEL_EXIT();
 }
 
@@ -926,9 +1664,42 @@ void evel_mobile_flow_vlan_id_set(EVENT_MOBILE_FLOW * mobile_flow,
   assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
   assert(vlan_id != NULL);
 
-  evel_set_option_string(&mobile_flow->vlan_id,
-                         vlan_id,
-                         "VLAN ID");
+  evel_arena_set_option_string(mobile_flow->header.arena,
+                               &mobile_flow->vlan_id,
+                               vlan_id,
+                               "VLAN ID");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the VLAN ID property of the Mobile Flow, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param mobile_flow Pointer to the Mobile Flow.
+ * @param vlan_id     The VLAN ID to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Mobile Flow takes ownership of it, so the
+ *                    caller must not use or free it after the function
+ *                    returns.
+ *****************************************************************************/
+void evel_mobile_flow_vlan_id_set_take(EVENT_MOBILE_FLOW * mobile_flow,
+                                       char * const vlan_id)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(mobile_flow != NULL);
+  assert(mobile_flow->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
+  assert(vlan_id != NULL);
+
+  evel_arena_take_option_string(mobile_flow->header.arena,
+                                &mobile_flow->vlan_id,
+                                vlan_id,
+                                "VLAN ID");
   EVEL_EXIT();
 }
 
@@ -954,17 +1725,11 @@ void evel_json_encode_mobile_flow(EVEL_JSON_BUFFER * jbuf,
   assert(event->header.event_domain == EVEL_DOMAIN_MOBILE_FLOW);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "mobileFlowFields");
+  evel_json_open_named_object(jbuf, EVEL_KEY_MOBILE_FLOW_FIELDS);
 
 
-  /***************************************************************************/
-  /* Checkpoint, so that we can wind back if all fields are suppressed.      */
-  /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "additionalFields"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_ADDITIONAL_FIELDS))
   {
-    bool added = false;
-
     dlist_item = dlist_get_first(&event->additional_info);
     while (dlist_item != NULL)
     {
@@ -972,76 +1737,74 @@ void evel_json_encode_mobile_flow(EVEL_JSON_BUFFER * jbuf,
       assert(nv_pair != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "additionalFields",
+                                          EVEL_KEY_ADDITIONAL_FIELDS,
                                           nv_pair->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", nv_pair->name);
-        evel_enc_kv_string(jbuf, "value", nv_pair->value);
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, nv_pair->name);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, nv_pair->value);
         evel_json_close_object(jbuf);
-        added = true;
       }
       dlist_item = dlist_get_next(dlist_item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
 
   /***************************************************************************/
   /* Mandatory parameters.                                                   */
   /***************************************************************************/
-  evel_enc_kv_string(jbuf, "flowDirection", event->flow_direction);
+  evel_enc_kv_string(jbuf, EVEL_KEY_FLOW_DIRECTION, event->flow_direction);
   evel_json_encode_mobile_flow_gtp_flow_metrics(
     jbuf, event->gtp_per_flow_metrics);
-  evel_enc_kv_string(jbuf, "ipProtocolType", event->ip_protocol_type);
-  evel_enc_kv_string(jbuf, "ipVersion", event->ip_version);
+  evel_enc_kv_string(jbuf, EVEL_KEY_IP_PROTOCOL_TYPE, event->ip_protocol_type);
+  evel_enc_kv_string(jbuf, EVEL_KEY_IP_VERSION, event->ip_version);
   evel_enc_kv_string(
-    jbuf, "otherEndpointIpAddress", event->other_endpoint_ip_address);
-  evel_enc_kv_int(jbuf, "otherEndpointPort", event->other_endpoint_port);
+    jbuf, EVEL_KEY_OTHER_ENDPOINT_IP_ADDRESS, event->other_endpoint_ip_address);
+  evel_enc_kv_int(
+    jbuf, EVEL_KEY_OTHER_ENDPOINT_PORT, event->other_endpoint_port);
   evel_enc_kv_string(
-    jbuf, "reportingEndpointIpAddr", event->reporting_endpoint_ip_addr);
+    jbuf, EVEL_KEY_REPORTING_ENDPOINT_IP_ADDR,
+    event->reporting_endpoint_ip_addr);
   evel_enc_kv_int(
-    jbuf, "reportingEndpointPort", event->reporting_endpoint_port);
+    jbuf, EVEL_KEY_REPORTING_ENDPOINT_PORT, event->reporting_endpoint_port);
 
   /***************************************************************************/
   /* Optional parameters.                                                    */
   /***************************************************************************/
-  evel_enc_kv_opt_string(jbuf, "applicationType", &event->application_type);
-  evel_enc_kv_opt_string(jbuf, "appProtocolType", &event->app_protocol_type);
   evel_enc_kv_opt_string(
-    jbuf, "appProtocolVersion", &event->app_protocol_version);
-  evel_enc_kv_opt_string(jbuf, "cid", &event->cid);
-  evel_enc_kv_opt_string(jbuf, "connectionType", &event->connection_type);
-  evel_enc_kv_opt_string(jbuf, "ecgi", &event->ecgi);
-  evel_enc_kv_opt_string(jbuf, "gtpProtocolType", &event->gtp_protocol_type);
-  evel_enc_kv_opt_string(jbuf, "gtpVersion", &event->gtp_version);
-  evel_enc_kv_opt_string(jbuf, "httpHeader", &event->http_header);
-  evel_enc_kv_opt_string(jbuf, "imei", &event->imei);
-  evel_enc_kv_opt_string(jbuf, "imsi", &event->imsi);
-  evel_enc_kv_opt_string(jbuf, "lac", &event->lac);
-  evel_enc_kv_opt_string(jbuf, "mcc", &event->mcc);
-  evel_enc_kv_opt_string(jbuf, "mnc", &event->mnc);
-  evel_enc_kv_opt_string(jbuf, "msisdn", &event->msisdn);
+    jbuf, EVEL_KEY_APPLICATION_TYPE, &event->application_type);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_APP_PROTOCOL_TYPE, &event->app_protocol_type);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_APP_PROTOCOL_VERSION, &event->app_protocol_version);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_CID, &event->cid);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_CONNECTION_TYPE, &event->connection_type);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_ECGI, &event->ecgi);
   evel_enc_kv_opt_string(
-    jbuf, "otherFunctionalRole", &event->other_functional_role);
-  evel_enc_kv_opt_string(jbuf, "rac", &event->rac);
+    jbuf, EVEL_KEY_GTP_PROTOCOL_TYPE, &event->gtp_protocol_type);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_GTP_VERSION, &event->gtp_version);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_HTTP_HEADER, &event->http_header);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_IMEI, &event->imei);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_IMSI, &event->imsi);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_LAC, &event->lac);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_MCC, &event->mcc);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_MNC, &event->mnc);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_MSISDN, &event->msisdn);
   evel_enc_kv_opt_string(
-    jbuf, "radioAccessTechnology", &event->radio_access_technology);
-  evel_enc_kv_opt_string(jbuf, "sac", &event->sac);
-  evel_enc_kv_opt_int(jbuf, "samplingAlgorithm", &event->sampling_algorithm);
-  evel_enc_kv_opt_string(jbuf, "tac", &event->tac);
-  evel_enc_kv_opt_string(jbuf, "tunnelId", &event->tunnel_id);
-  evel_enc_kv_opt_string(jbuf, "vlanId", &event->vlan_id);
+    jbuf, EVEL_KEY_OTHER_FUNCTIONAL_ROLE, &event->other_functional_role);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_RAC, &event->rac);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_RADIO_ACCESS_TECHNOLOGY, &event->radio_access_technology);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_SAC, &event->sac);
+  evel_enc_kv_opt_int(
+    jbuf, EVEL_KEY_SAMPLING_ALGORITHM, &event->sampling_algorithm);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_TAC, &event->tac);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_TUNNEL_ID, &event->tunnel_id);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_VLAN_ID, &event->vlan_id);
   evel_enc_version(jbuf,
-                   "mobileFlowFieldsVersion",
+                   EVEL_KEY_MOBILE_FLOW_FIELDS_VERSION,
                    event->major_version,
                    event->minor_version);
   evel_json_close_object(jbuf);
@@ -1209,7 +1972,6 @@ MOBILE_GTP_PER_FLOW_METRICS * evel_new_mobile_gtp_flow_metrics(
                                       int time_to_first_byte)
 {
   MOBILE_GTP_PER_FLOW_METRICS * metrics = NULL;
-  int ii;
 
   EVEL_ENTER();
 
@@ -1295,18 +2057,9 @@ MOBILE_GTP_PER_FLOW_METRICS * evel_new_mobile_gtp_flow_metrics(
   metrics->num_tunneled_l7_bytes_received = num_tunneled_l7_bytes_received;
   metrics->round_trip_time = round_trip_time;
   metrics->time_to_first_byte = time_to_first_byte;
-  for (ii = 0; ii < EVEL_TOS_SUPPORTED; ii++)
-  {
-    evel_init_option_int(&metrics->ip_tos_counts[ii]);
-  }
-  for (ii = 0; ii < EVEL_MAX_TCP_FLAGS; ii++)
-  {
-    evel_init_option_int(&metrics->tcp_flag_counts[ii]);
-  }
-  for (ii = 0; ii < EVEL_MAX_QCI_COS_TYPES; ii++)
-  {
-    evel_init_option_int(&metrics->qci_cos_counts[ii]);
-  }
+  evel_init_option_sparse_int(&metrics->ip_tos_counts);
+  metrics->tcp_flags_present = 0;
+  metrics->qci_cos_present = 0;
   evel_init_option_int(&metrics->dur_connection_failed_status);
   evel_init_option_int(&metrics->dur_tunnel_failed_status);
   evel_init_option_string(&metrics->flow_activated_by);
@@ -1557,9 +2310,10 @@ void evel_mobile_gtp_metrics_iptos_set(MOBILE_GTP_PER_FLOW_METRICS * metrics,
   assert(count <= 255);
 
   EVEL_DEBUG("IP Type-of-Service %d", index);
-  evel_set_option_int(&metrics->ip_tos_counts[index],
-                      count,
-                      "IP Type-of-Service");
+  evel_set_option_sparse_int(&metrics->ip_tos_counts,
+                             index,
+                             count,
+                             "IP Type-of-Service");
   EVEL_EXIT();
 }
 
@@ -1789,7 +2543,9 @@ void evel_mobile_gtp_metrics_tcp_flag_count_add(
   assert(count >= 0);
 
   EVEL_DEBUG("TCP Flag: %d", tcp_flag);
-  evel_set_option_int(&metrics->tcp_flag_counts[tcp_flag],
+  evel_set_packed_int(&metrics->tcp_flags_present,
+                      metrics->tcp_flag_counts,
+                      tcp_flag,
                       count,
                       "TCP flag");
   EVEL_EXIT();
@@ -1822,7 +2578,9 @@ void evel_mobile_gtp_metrics_qci_cos_count_add(
   assert(count >= 0);
 
   EVEL_DEBUG("QCI COS: %d", qci_cos);
-  evel_set_option_int(&metrics->qci_cos_counts[qci_cos],
+  evel_set_packed_int(&metrics->qci_cos_present,
+                      metrics->qci_cos_counts,
+                      qci_cos,
                       count,
                       "QCI COS");
   EVEL_EXIT();
@@ -1840,9 +2598,9 @@ void evel_json_encode_mobile_flow_gtp_flow_metrics(
                                         MOBILE_GTP_PER_FLOW_METRICS * metrics)
 {
   int index;
-  bool found_ip_tos;
-  bool found_tcp_flag;
-  bool found_qci_cos;
+  char ip_tos[EVEL_MAX_TOS_STRING_LEN];
+  EVEL_OPTION_SPARSE_INT * ip_tos_counts;
+  EVEL_OPTION_BITMAP present;
 
   EVEL_ENTER();
 
@@ -1852,99 +2610,95 @@ void evel_json_encode_mobile_flow_gtp_flow_metrics(
   assert(jbuf != NULL);
   assert(metrics != NULL);
 
-  evel_json_open_named_object(jbuf, "gtpPerFlowMetrics");
+  evel_json_open_named_object(jbuf, EVEL_KEY_GTP_PER_FLOW_METRICS);
 
   /***************************************************************************/
   /* Mandatory parameters.                                                   */
   /***************************************************************************/
-  evel_enc_kv_double(jbuf, "avgBitErrorRate", metrics->avg_bit_error_rate);
   evel_enc_kv_double(
-    jbuf, "avgPacketDelayVariation", metrics->avg_packet_delay_variation);
-  evel_enc_kv_int(jbuf, "avgPacketLatency", metrics->avg_packet_latency);
+    jbuf, EVEL_KEY_AVG_BIT_ERROR_RATE, metrics->avg_bit_error_rate);
+  evel_enc_kv_double(
+    jbuf, EVEL_KEY_AVG_PACKET_DELAY_VARIATION,
+    metrics->avg_packet_delay_variation);
+  evel_enc_kv_int(
+    jbuf, EVEL_KEY_AVG_PACKET_LATENCY, metrics->avg_packet_latency);
+  evel_enc_kv_int(
+    jbuf, EVEL_KEY_AVG_RECEIVE_THROUGHPUT, metrics->avg_receive_throughput);
   evel_enc_kv_int(
-    jbuf, "avgReceiveThroughput", metrics->avg_receive_throughput);
+    jbuf, EVEL_KEY_AVG_TRANSMIT_THROUGHPUT, metrics->avg_transmit_throughput);
   evel_enc_kv_int(
-    jbuf, "avgTransmitThroughput", metrics->avg_transmit_throughput);
-  evel_enc_kv_int(jbuf, "flowActivationEpoch", metrics->flow_activation_epoch);
+    jbuf, EVEL_KEY_FLOW_ACTIVATION_EPOCH, metrics->flow_activation_epoch);
   evel_enc_kv_int(
-    jbuf, "flowActivationMicrosec", metrics->flow_activation_microsec);
+    jbuf, EVEL_KEY_FLOW_ACTIVATION_MICROSEC, metrics->flow_activation_microsec);
   evel_enc_kv_int(
-    jbuf, "flowDeactivationEpoch", metrics->flow_deactivation_epoch);
+    jbuf, EVEL_KEY_FLOW_DEACTIVATION_EPOCH, metrics->flow_deactivation_epoch);
   evel_enc_kv_int(
-    jbuf, "flowDeactivationMicrosec", metrics->flow_deactivation_microsec);
+    jbuf, EVEL_KEY_FLOW_DEACTIVATION_MICROSEC,
+    metrics->flow_deactivation_microsec);
   evel_enc_kv_time(
-    jbuf, "flowDeactivationTime", &metrics->flow_deactivation_time);
-  evel_enc_kv_string(jbuf, "flowStatus", metrics->flow_status);
+    jbuf, EVEL_KEY_FLOW_DEACTIVATION_TIME, &metrics->flow_deactivation_time);
+  evel_enc_kv_string(jbuf, EVEL_KEY_FLOW_STATUS, metrics->flow_status);
   evel_enc_kv_int(
-    jbuf, "maxPacketDelayVariation", metrics->max_packet_delay_variation);
+    jbuf, EVEL_KEY_MAX_PACKET_DELAY_VARIATION,
+    metrics->max_packet_delay_variation);
   evel_enc_kv_int(
-    jbuf, "numActivationFailures", metrics->num_activation_failures);
-  evel_enc_kv_int(jbuf, "numBitErrors", metrics->num_bit_errors);
-  evel_enc_kv_int(jbuf, "numBytesReceived", metrics->num_bytes_received);
-  evel_enc_kv_int(jbuf, "numBytesTransmitted", metrics->num_bytes_transmitted);
-  evel_enc_kv_int(jbuf, "numDroppedPackets", metrics->num_dropped_packets);
-  evel_enc_kv_int(jbuf, "numL7BytesReceived", metrics->num_l7_bytes_received);
+    jbuf, EVEL_KEY_NUM_ACTIVATION_FAILURES, metrics->num_activation_failures);
+  evel_enc_kv_int(jbuf, EVEL_KEY_NUM_BIT_ERRORS, metrics->num_bit_errors);
   evel_enc_kv_int(
-    jbuf, "numL7BytesTransmitted", metrics->num_l7_bytes_transmitted);
-  evel_enc_kv_int(jbuf, "numLostPackets", metrics->num_lost_packets);
+    jbuf, EVEL_KEY_NUM_BYTES_RECEIVED, metrics->num_bytes_received);
   evel_enc_kv_int(
-    jbuf, "numOutOfOrderPackets", metrics->num_out_of_order_packets);
-  evel_enc_kv_int(jbuf, "numPacketErrors", metrics->num_packet_errors);
+    jbuf, EVEL_KEY_NUM_BYTES_TRANSMITTED, metrics->num_bytes_transmitted);
+  evel_enc_kv_int(
+    jbuf, EVEL_KEY_NUM_DROPPED_PACKETS, metrics->num_dropped_packets);
+  evel_enc_kv_int(
+    jbuf, EVEL_KEY_NUM_L7_BYTES_RECEIVED, metrics->num_l7_bytes_received);
+  evel_enc_kv_int(
+    jbuf, EVEL_KEY_NUM_L7_BYTES_TRANSMITTED, metrics->num_l7_bytes_transmitted);
+  evel_enc_kv_int(jbuf, EVEL_KEY_NUM_LOST_PACKETS, metrics->num_lost_packets);
+  evel_enc_kv_int(
+    jbuf, EVEL_KEY_NUM_OUT_OF_ORDER_PACKETS, metrics->num_out_of_order_packets);
+  evel_enc_kv_int(jbuf, EVEL_KEY_NUM_PACKET_ERRORS, metrics->num_packet_errors);
   evel_enc_kv_int(jbuf,
-                  "numPacketsReceivedExclRetrans",
+                  EVEL_KEY_NUM_PACKETS_RECEIVED_EXCL_RETRANS,
                   metrics->num_packets_received_excl_retrans);
   evel_enc_kv_int(jbuf,
-                  "numPacketsReceivedInclRetrans",
+                  EVEL_KEY_NUM_PACKETS_RECEIVED_INCL_RETRANS,
                   metrics->num_packets_received_incl_retrans);
   evel_enc_kv_int(jbuf,
-                  "numPacketsTransmittedInclRetrans",
+                  EVEL_KEY_NUM_PACKETS_TRANSMITTED_INCL_RETRANS,
                   metrics->num_packets_transmitted_incl_retrans);
-  evel_enc_kv_int(jbuf, "numRetries", metrics->num_retries);
-  evel_enc_kv_int(jbuf, "numTimeouts", metrics->num_timeouts);
+  evel_enc_kv_int(jbuf, EVEL_KEY_NUM_RETRIES, metrics->num_retries);
+  evel_enc_kv_int(jbuf, EVEL_KEY_NUM_TIMEOUTS, metrics->num_timeouts);
   evel_enc_kv_int(jbuf,
-                  "numTunneledL7BytesReceived",
+                  EVEL_KEY_NUM_TUNNELED_L7_BYTES_RECEIVED,
                   metrics->num_tunneled_l7_bytes_received);
-  evel_enc_kv_int(jbuf, "roundTripTime", metrics->round_trip_time);
-  evel_enc_kv_int(jbuf, "timeToFirstByte", metrics->time_to_first_byte);
+  evel_enc_kv_int(jbuf, EVEL_KEY_ROUND_TRIP_TIME, metrics->round_trip_time);
+  evel_enc_kv_int(
+    jbuf, EVEL_KEY_TIME_TO_FIRST_BYTE, metrics->time_to_first_byte);
 
   /***************************************************************************/
   /* Optional parameters.                                                    */
   /***************************************************************************/
-  found_ip_tos = false;
-  for (index = 0; index < EVEL_TOS_SUPPORTED; index++)
-  {
-    if (metrics->ip_tos_counts[index].is_set)
-    {
-      found_ip_tos = true;
-      break;
-    }
-  }
-
-  if (found_ip_tos)
+  ip_tos_counts = &metrics->ip_tos_counts;
+  if (ip_tos_counts->count > 0)
   {
-    evel_json_open_named_list(jbuf, "ipTosCountList");
-    for (index = 0; index < EVEL_TOS_SUPPORTED; index++)
+    evel_json_open_named_list(jbuf, EVEL_KEY_IP_TOS_COUNT_LIST);
+    for (index = 0; index < ip_tos_counts->count; index++)
     {
-      if (metrics->ip_tos_counts[index].is_set)
-      {
-        evel_enc_list_item(jbuf,
-                           "[\"%d\", %d]",
-                           index,
-                           metrics->ip_tos_counts[index].value);
-      }
+      snprintf(ip_tos, sizeof(ip_tos), "%d",
+               ip_tos_counts->entries[index].index);
+      evel_enc_list_counter(jbuf,
+                            ip_tos,
+                            ip_tos_counts->entries[index].value);
     }
     evel_json_close_list(jbuf);
-  }
 
-  if (found_ip_tos)
-  {
-    evel_json_open_named_list(jbuf, "ipTosList");
-    for (index = 0; index < EVEL_TOS_SUPPORTED; index++)
+    evel_json_open_named_list(jbuf, EVEL_KEY_IP_TOS_LIST);
+    for (index = 0; index < ip_tos_counts->count; index++)
     {
-      if (metrics->ip_tos_counts[index].is_set)
-      {
-        evel_enc_list_item(jbuf, "\"%d\"", index);
-      }
+      snprintf(ip_tos, sizeof(ip_tos), "%d",
+               ip_tos_counts->entries[index].index);
+      evel_enc_list_string(jbuf, ip_tos);
     }
     evel_json_close_list(jbuf);
   }
@@ -1964,43 +2718,27 @@ void evel_json_encode_mobile_flow_gtp_flow_metrics(
   EVEL_CT_ASSERT(EVEL_TCP_FIN == 8);
   EVEL_CT_ASSERT(EVEL_MAX_TCP_FLAGS == 9);
 
-  found_tcp_flag = false;
-  for (index = 0; index < EVEL_MAX_TCP_FLAGS; index++)
+  if (metrics->tcp_flags_present != 0)
   {
-    if (metrics->tcp_flag_counts[index].is_set)
+    evel_json_open_named_list(jbuf, EVEL_KEY_TCP_FLAG_LIST);
+    present = metrics->tcp_flags_present;
+    while (present != 0)
     {
-      found_tcp_flag = true;
-      break;
-    }
-  }
-
-  if (found_tcp_flag)
-  {
-    evel_json_open_named_list(jbuf, "tcpFlagList");
-    for (index = 0; index < EVEL_MAX_TCP_FLAGS; index++)
-    {
-      if (metrics->tcp_flag_counts[index].is_set)
-      {
-        evel_enc_list_item(jbuf,
-                           "\"%s\"",
-                           evel_tcp_flag_strings[index]);
-      }
+      index = __builtin_ctzll(present);
+      present &= present - 1;
+      evel_enc_list_string(jbuf, evel_tcp_flag_strings[index]);
     }
     evel_json_close_list(jbuf);
-  }
 
-  if (found_tcp_flag)
-  {
-    evel_json_open_named_list(jbuf, "tcpFlagCountList");
-    for (index = 0; index < EVEL_MAX_TCP_FLAGS; index++)
+    evel_json_open_named_list(jbuf, EVEL_KEY_TCP_FLAG_COUNT_LIST);
+    present = metrics->tcp_flags_present;
+    while (present != 0)
     {
-      if (metrics->tcp_flag_counts[index].is_set)
-      {
-        evel_enc_list_item(jbuf,
-                           "[\"%s\", %d]",
-                           evel_tcp_flag_strings[index],
-                           metrics->tcp_flag_counts[index].value);
-      }
+      index = __builtin_ctzll(present);
+      present &= present - 1;
+      evel_enc_list_counter(jbuf,
+                            evel_tcp_flag_strings[index],
+                            metrics->tcp_flag_counts[index]);
     }
     evel_json_close_list(jbuf);
   }
@@ -2029,71 +2767,61 @@ void evel_json_encode_mobile_flow_gtp_flow_metrics(
   EVEL_CT_ASSERT(EVEL_QCI_COS_LTE_70 == 16);
   EVEL_CT_ASSERT(EVEL_MAX_QCI_COS_TYPES == 17);
 
-  found_qci_cos = false;
-  for (index = 0; index < EVEL_MAX_QCI_COS_TYPES; index++)
-  {
-    if (metrics->qci_cos_counts[index].is_set)
-    {
-      found_qci_cos = true;
-      break;
-    }
-  }
-
-  if (found_qci_cos)
+  if (metrics->qci_cos_present != 0)
   {
-    evel_json_open_named_list(jbuf, "mobileQciCosList");
-    for (index = 0; index < EVEL_MAX_QCI_COS_TYPES; index++)
+    evel_json_open_named_list(jbuf, EVEL_KEY_MOBILE_QCI_COS_LIST);
+    present = metrics->qci_cos_present;
+    while (present != 0)
     {
-      if (metrics->qci_cos_counts[index].is_set)
-      {
-        evel_enc_list_item(jbuf,
-                           "\"%s\"",
-                           evel_qci_cos_strings[index]);
-      }
+      index = __builtin_ctzll(present);
+      present &= present - 1;
+      evel_enc_list_string(jbuf, evel_qci_cos_strings[index]);
     }
     evel_json_close_list(jbuf);
-  }
 
-  if (found_qci_cos)
-  {
-    evel_json_open_named_list(jbuf, "mobileQciCosCountList");
-    for (index = 0; index < EVEL_MAX_QCI_COS_TYPES; index++)
+    evel_json_open_named_list(jbuf, EVEL_KEY_MOBILE_QCI_COS_COUNT_LIST);
+    present = metrics->qci_cos_present;
+    while (present != 0)
     {
-      if (metrics->qci_cos_counts[index].is_set)
-      {
-        evel_enc_list_item(jbuf,
-                           "[\"%s\", %d]",
-                           evel_qci_cos_strings[index],
-                           metrics->qci_cos_counts[index].value);
-      }
+      index = __builtin_ctzll(present);
+      present &= present - 1;
+      evel_enc_list_counter(jbuf,
+                            evel_qci_cos_strings[index],
+                            metrics->qci_cos_counts[index]);
     }
     evel_json_close_list(jbuf);
   }
 
   evel_enc_kv_opt_int(
-    jbuf, "durConnectionFailedStatus", &metrics->dur_connection_failed_status);
+    jbuf, EVEL_KEY_DUR_CONNECTION_FAILED_STATUS,
+    &metrics->dur_connection_failed_status);
   evel_enc_kv_opt_int(
-    jbuf, "durTunnelFailedStatus", &metrics->dur_tunnel_failed_status);
-  evel_enc_kv_opt_string(jbuf, "flowActivatedBy", &metrics->flow_activated_by);
+    jbuf, EVEL_KEY_DUR_TUNNEL_FAILED_STATUS,
+    &metrics->dur_tunnel_failed_status);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_FLOW_ACTIVATED_BY, &metrics->flow_activated_by);
   evel_enc_kv_opt_time(
-    jbuf, "flowActivationTime", &metrics->flow_activation_time);
+    jbuf, EVEL_KEY_FLOW_ACTIVATION_TIME, &metrics->flow_activation_time);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_FLOW_DEACTIVATED_BY, &metrics->flow_deactivated_by);
   evel_enc_kv_opt_string(
-    jbuf, "flowDeactivatedBy", &metrics->flow_deactivated_by);
+    jbuf, EVEL_KEY_GTP_CONNECTION_STATUS, &metrics->gtp_connection_status);
   evel_enc_kv_opt_string(
-    jbuf, "gtpConnectionStatus", &metrics->gtp_connection_status);
-  evel_enc_kv_opt_string(jbuf, "gtpTunnelStatus", &metrics->gtp_tunnel_status);
-  evel_enc_kv_opt_int(jbuf, "largePacketRtt", &metrics->large_packet_rtt);
+    jbuf, EVEL_KEY_GTP_TUNNEL_STATUS, &metrics->gtp_tunnel_status);
+  evel_enc_kv_opt_int(
+    jbuf, EVEL_KEY_LARGE_PACKET_RTT, &metrics->large_packet_rtt);
   evel_enc_kv_opt_double(
-    jbuf, "largePacketThreshold", &metrics->large_packet_threshold);
+    jbuf, EVEL_KEY_LARGE_PACKET_THRESHOLD, &metrics->large_packet_threshold);
+  evel_enc_kv_opt_int(
+    jbuf, EVEL_KEY_MAX_RECEIVE_BIT_RATE, &metrics->max_receive_bit_rate);
   evel_enc_kv_opt_int(
-    jbuf, "maxReceiveBitRate", &metrics->max_receive_bit_rate);
+    jbuf, EVEL_KEY_MAX_TRANSMIT_BIT_RATE, &metrics->max_transmit_bit_rate);
   evel_enc_kv_opt_int(
-    jbuf, "maxTransmitBitRate", &metrics->max_transmit_bit_rate);
+    jbuf, EVEL_KEY_NUM_GTP_ECHO_FAILURES, &metrics->num_gtp_echo_failures);
   evel_enc_kv_opt_int(
-    jbuf, "numGtpEchoFailures", &metrics->num_gtp_echo_failures);
+    jbuf, EVEL_KEY_NUM_GTP_TUNNEL_ERRORS, &metrics->num_gtp_tunnel_errors);
   evel_enc_kv_opt_int(
-    jbuf, "numGtpTunnelErrors", &metrics->num_gtp_tunnel_errors);
-  evel_enc_kv_opt_int(jbuf, "numHttpErrors", &metrics->num_http_errors);
+    jbuf, EVEL_KEY_NUM_HTTP_ERRORS, &metrics->num_http_errors);
 
   evel_json_close_object(jbuf);
 
@@ -2123,6 +2851,7 @@ void evel_free_mobile_gtp_flow_metrics(MOBILE_GTP_PER_FLOW_METRICS * metrics)
   /***************************************************************************/
   free(metrics->flow_status);
 
+  evel_free_option_sparse_int(&metrics->ip_tos_counts);
   evel_free_option_string(&metrics->flow_activated_by);
   evel_free_option_string(&metrics->flow_deactivated_by);
   evel_free_option_string(&metrics->gtp_connection_status);
@@ -2130,3 +2859,15 @@ void evel_free_mobile_gtp_flow_metrics(MOBILE_GTP_PER_FLOW_METRICS * metrics)
 
   EVEL_EXIT();
 }
+
+/**************************************************************************//**
+ * Free Mobile GTP Per Flow Metrics adopted by the arena of a Mobile Flow,
+ * including the metrics themselves.
+ *
+ * @param metrics       Pointer to the ::MOBILE_GTP_PER_FLOW_METRICS.
+ *****************************************************************************/
+static void evel_free_adopted_gtp_flow_metrics(void * metrics)
+{
+  evel_free_mobile_gtp_flow_metrics(metrics);
+  free(metrics);
+}
@@ -94,6 +94,23 @@ void evel_init_option_string(EVEL_OPTION_STRING * const option)
 void evel_set_option_string(EVEL_OPTION_STRING * const option,
                             const char * const value,
                             const char * const description)
+{
+  evel_arena_set_option_string(NULL, option, value, description);
+}
+
+/**************************************************************************//**
+ * Set the value of an ::EVEL_OPTION_STRING, copying it into an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to copy the value
+ *                      onto the heap.
+ * @param option        Pointer to the ::EVEL_OPTION_STRING.
+ * @param value         The value to set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_arena_set_option_string(EVEL_ARENA * const arena,
+                                  EVEL_OPTION_STRING * const option,
+                                  const char * const value,
+                                  const char * const description)
 {
   EVEL_ENTER();
 
@@ -106,13 +123,73 @@ void evel_set_option_string(EVEL_OPTION_STRING * const option,
 
   if (option->is_set)
   {
-    EVEL_ERROR("Ignoring attempt to update %s to %s. %s already set to %s",
-               description, value, description, option->value);
+    EVEL_ERROR_KEYED(description,
+                     "Ignoring attempt to update %s to %s. "
+                     "%s already set to %s",
+                     description, value, description, option->value);
   }
   else
   {
     EVEL_DEBUG("Setting %s to %s", description, value);
-    option->value = strdup(value);
+    option->value = evel_arena_strdup(arena, value);
+    option->is_set = EVEL_TRUE;
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the value of an ::EVEL_OPTION_STRING, taking ownership of it.
+ *
+ * @param option        Pointer to the ::EVEL_OPTION_STRING.
+ * @param value         The value to set, allocated with malloc.  It is freed
+ *                      straight away if the option is already set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_take_option_string(EVEL_OPTION_STRING * const option,
+                             char * const value,
+                             const char * const description)
+{
+  evel_arena_take_option_string(NULL, option, value, description);
+}
+
+/**************************************************************************//**
+ * Set the value of an ::EVEL_OPTION_STRING, taking ownership of it for an
+ * arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL if the value is
+ *                      to be freed with the option.
+ * @param option        Pointer to the ::EVEL_OPTION_STRING.
+ * @param value         The value to set, allocated with malloc.  It is freed
+ *                      straight away if the option is already set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_arena_take_option_string(EVEL_ARENA * const arena,
+                                   EVEL_OPTION_STRING * const option,
+                                   char * const value,
+                                   const char * const description)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(option != NULL);
+  assert(value != NULL);
+  assert(description != NULL);
+
+  if (option->is_set)
+  {
+    EVEL_ERROR_KEYED(description,
+                     "Ignoring attempt to update %s to %s. "
+                     "%s already set to %s",
+                     description, value, description, option->value);
+    free(value);
+  }
+  else
+  {
+    EVEL_DEBUG("Setting %s to %s", description, value);
+    option->value = evel_arena_take_string(arena, value);
     option->is_set = EVEL_TRUE;
   }
 
@@ -127,6 +204,21 @@ void evel_set_option_string(EVEL_OPTION_STRING * const option,
  *****************************************************************************/
 void evel_force_option_string(EVEL_OPTION_STRING * const option,
                               const char * const value)
+{
+  evel_arena_force_option_string(NULL, option, value);
+}
+
+/**************************************************************************//**
+ * Force the value of an ::EVEL_OPTION_STRING, copying it into an arena.
+ *
+ * @param arena         Pointer to the ::EVEL_ARENA, or NULL to copy the value
+ *                      onto the heap.
+ * @param option        Pointer to the ::EVEL_OPTION_STRING.
+ * @param value         The value to set.
+ *****************************************************************************/
+void evel_arena_force_option_string(EVEL_ARENA * const arena,
+                                    EVEL_OPTION_STRING * const option,
+                                    const char * const value)
 {
   EVEL_ENTER();
 
@@ -137,7 +229,7 @@ void evel_force_option_string(EVEL_OPTION_STRING * const option,
   assert(option->is_set == EVEL_FALSE);
   assert(option->value == NULL);
 
-  option->value = strdup(value);
+  option->value = evel_arena_strdup(arena, value);
   option->is_set = EVEL_TRUE;
 
   EVEL_EXIT();
@@ -206,8 +298,10 @@ void evel_set_option_int(EVEL_OPTION_INT * const option,
 
   if (option->is_set)
   {
-    EVEL_ERROR("Ignoring attempt to update %s to %d. %s already set to %d",
-               description, value, description, option->value);
+    EVEL_ERROR_KEYED(description,
+                     "Ignoring attempt to update %s to %d. "
+                     "%s already set to %d",
+                     description, value, description, option->value);
   }
   else
   {
@@ -219,6 +313,181 @@ void evel_set_option_int(EVEL_OPTION_INT * const option,
   EVEL_EXIT();
 }
 
+/**************************************************************************//**
+ * Set the value of a packed optional integer field.
+ *
+ * @param present       Pointer to the structure's ::EVEL_OPTION_BITMAP.
+ * @param values        The structure's array of packed values.
+ * @param field         Index of the field to set.
+ * @param value         The value to set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_set_packed_int(EVEL_OPTION_BITMAP * const present,
+                         int * const values,
+                         const int field,
+                         const int value,
+                         const char * const description)
+{
+  EVEL_OPTION_BITMAP bit;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(present != NULL);
+  assert(values != NULL);
+  assert(field >= 0 && field < (int) (8 * sizeof(EVEL_OPTION_BITMAP)));
+  assert(description != NULL);
+
+  bit = 1ULL << field;
+  if (*present & bit)
+  {
+    EVEL_ERROR_KEYED(description,
+                     "Ignoring attempt to update %s to %d. "
+                     "%s already set to %d",
+                     description, value, description, values[field]);
+  }
+  else
+  {
+    EVEL_DEBUG("Setting %s to %d", description, value);
+    values[field] = value;
+    *present |= bit;
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Initialize an ::EVEL_OPTION_SPARSE_INT to a state with no values set.
+ *
+ * @param option        Pointer to the ::EVEL_OPTION_SPARSE_INT.
+ *****************************************************************************/
+void evel_init_option_sparse_int(EVEL_OPTION_SPARSE_INT * const option)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(option != NULL);
+
+  option->entries = NULL;
+  option->count = 0;
+  option->capacity = 0;
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the value at an index of an ::EVEL_OPTION_SPARSE_INT.
+ *
+ * The value is inserted in order of index, so that the values are encoded
+ * in the same order as they would be from a dense array.
+ *
+ * @param option        Pointer to the ::EVEL_OPTION_SPARSE_INT.
+ * @param index         The index to set.
+ * @param value         The value to set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_set_option_sparse_int(EVEL_OPTION_SPARSE_INT * const option,
+                                const int index,
+                                const int value,
+                                const char * const description)
+{
+  EVEL_SPARSE_INT_ENTRY * entries;
+  int capacity;
+  int low;
+  int high;
+  int mid;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(option != NULL);
+  assert(index >= 0);
+  assert(description != NULL);
+
+  /***************************************************************************/
+  /* Find where the index is, or would go.                                   */
+  /***************************************************************************/
+  low = 0;
+  high = option->count;
+  while (low < high)
+  {
+    mid = (low + high) / 2;
+    if (option->entries[mid].index < index)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  if ((low < option->count) && (option->entries[low].index == index))
+  {
+    EVEL_ERROR_KEYED(description,
+                     "Ignoring attempt to update %s %d to %d. "
+                     "%s %d already set to %d",
+                     description, index, value,
+                     description, index, option->entries[low].value);
+    goto exit_label;
+  }
+
+  if (option->count == option->capacity)
+  {
+    capacity = (option->capacity == 0) ? 4 : 2 * option->capacity;
+    entries = realloc(option->entries,
+                      capacity * sizeof(EVEL_SPARSE_INT_ENTRY));
+    if (entries == NULL)
+    {
+      log_error_state_keyed(description,
+                            "Out of memory setting %s %d",
+                            description, index);
+      goto exit_label;
+    }
+    option->entries = entries;
+    option->capacity = capacity;
+  }
+
+  EVEL_DEBUG("Setting %s %d to %d", description, index, value);
+  memmove(&option->entries[low + 1],
+          &option->entries[low],
+          (option->count - low) * sizeof(EVEL_SPARSE_INT_ENTRY));
+  option->entries[low].index = index;
+  option->entries[low].value = value;
+  option->count++;
+
+exit_label:
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Free the underlying resources of an ::EVEL_OPTION_SPARSE_INT.
+ *
+ * @param option        Pointer to the ::EVEL_OPTION_SPARSE_INT.
+ *****************************************************************************/
+void evel_free_option_sparse_int(EVEL_OPTION_SPARSE_INT * const option)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(option != NULL);
+
+  free(option->entries);
+  option->entries = NULL;
+  option->count = 0;
+  option->capacity = 0;
+
+  EVEL_EXIT();
+}
+
 /**************************************************************************//**
  * Initialize an ::EVEL_OPTION_DOUBLE to a not-set state.
  *
@@ -282,8 +551,10 @@ void evel_set_option_double(EVEL_OPTION_DOUBLE * const option,
 
   if (option->is_set)
   {
-    EVEL_ERROR("Ignoring attempt to update %s to %lf. %s already set to %lf",
-               description, value, description, option->value);
+    EVEL_ERROR_KEYED(description,
+                     "Ignoring attempt to update %s to %lf. "
+                     "%s already set to %lf",
+                     description, value, description, option->value);
   }
   else
   {
@@ -295,6 +566,51 @@ void evel_set_option_double(EVEL_OPTION_DOUBLE * const option,
   EVEL_EXIT();
 }
 
+/**************************************************************************//**
+ * Set the value of a packed optional double field.
+ *
+ * @param present       Pointer to the structure's ::EVEL_OPTION_BITMAP.
+ * @param values        The structure's array of packed values.
+ * @param field         Index of the field to set.
+ * @param value         The value to set.
+ * @param description   Description to be used in logging.
+ *****************************************************************************/
+void evel_set_packed_double(EVEL_OPTION_BITMAP * const present,
+                            double * const values,
+                            const int field,
+                            const double value,
+                            const char * const description)
+{
+  EVEL_OPTION_BITMAP bit;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(present != NULL);
+  assert(values != NULL);
+  assert(field >= 0 && field < (int) (8 * sizeof(EVEL_OPTION_BITMAP)));
+  assert(description != NULL);
+
+  bit = 1ULL << field;
+  if (*present & bit)
+  {
+    EVEL_ERROR_KEYED(description,
+                     "Ignoring attempt to update %s to %lf. "
+                     "%s already set to %lf",
+                     description, value, description, values[field]);
+  }
+  else
+  {
+    EVEL_DEBUG("Setting %s to %lf", description, value);
+    values[field] = value;
+    *present |= bit;
+  }
+
+  EVEL_EXIT();
+}
+
 /**************************************************************************//**
  * Initialize an ::EVEL_OPTION_ULL to a not-set state.
  *
@@ -356,8 +672,10 @@ void evel_set_option_ull(EVEL_OPTION_ULL * const option,
 
   if (option->is_set)
   {
-    EVEL_ERROR("Ignoring attempt to update %s to %llu. %s already set to %llu",
-               description, value, description, option->value);
+    EVEL_ERROR_KEYED(description,
+                     "Ignoring attempt to update %s to %llu. "
+                     "%s already set to %llu",
+                     description, value, description, option->value);
   }
   else
   {
@@ -430,8 +748,10 @@ void evel_set_option_intheader(EVEL_OPTION_INTHEADER_FIELDS * const option,
 
   if (option->is_set)
   {
-    EVEL_ERROR("Ignoring attempt to update %s to %llu. %s already set to %llu",
-               description, value, description, option->object);
+    EVEL_ERROR_KEYED(description,
+                     "Ignoring attempt to update %s to %llu. "
+                     "%s already set to %llu",
+                     description, value, description, option->object);
   }
   else
   {
@@ -527,8 +847,10 @@ void evel_set_option_time(EVEL_OPTION_TIME * const option,
 
   if (option->is_set)
   {
-    EVEL_ERROR("Ignoring attempt to update %s to %d. %s already set to %d",
-               description, value, description, option->value);
+    EVEL_ERROR_KEYED(description,
+                     "Ignoring attempt to update %s to %d. "
+                     "%s already set to %d",
+                     description, value, description, option->value);
   }
   else
   {
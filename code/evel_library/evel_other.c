@@ -39,6 +39,13 @@
 #include "evel.h"
 #include "evel_internal.h"
 
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void evel_other_field_push(EVENT_OTHER * other,
+                                  char * name,
+                                  char * value);
+
 /**************************************************************************//**
  * Create a new Other event.
  *
@@ -62,13 +69,13 @@ EVENT_OTHER * evel_new_other(const char* ev_name, const char *ev_id)
   /***************************************************************************/
   /* Allocate the Other.                                                     */
   /***************************************************************************/
-  other = malloc(sizeof(EVENT_OTHER));
+  other = evel_event_alloc(EVEL_DOMAIN_OTHER);
   if (other == NULL)
   {
     log_error_state("Out of memory");
     goto exit_label;
   }
-  memset(other, 0, sizeof(EVENT_OTHER));
+  other->header.arena = evel_new_event_arena();
   EVEL_DEBUG("New Other is at %lp", other);
 
   /***************************************************************************/
@@ -172,11 +179,11 @@ void evel_other_field_add_namedarray(EVENT_OTHER * other, const char *hashname,
   EVEL_DEBUG("Adding values to Named array");
       
   EVEL_DEBUG("Adding name=%s value=%s", name, value);
-  other_field = malloc(sizeof(OTHER_FIELD));
+  other_field = evel_arena_alloc(other->header.arena, sizeof(OTHER_FIELD));
   assert(other_field != NULL);
   memset(other_field, 0, sizeof(OTHER_FIELD));
-  other_field->name = strdup(name);
-  other_field->value = strdup(value);
+  other_field->name = evel_arena_strdup(other->header.arena, name);
+  other_field->value = evel_arena_strdup(other->header.arena, value);
   assert(other_field->name != NULL);
   assert(other_field->value != NULL);
 
@@ -184,15 +191,15 @@ void evel_other_field_add_namedarray(EVENT_OTHER * other, const char *hashname,
   list = ht_get(other->namedarrays, hashname);
   if( list == NULL )
   {
-     DLIST * nlist = malloc(sizeof(DLIST));
+     DLIST * nlist = evel_arena_alloc(other->header.arena, sizeof(DLIST));
      dlist_initialize(nlist);
-     dlist_push_last(nlist, other_field);
+     evel_arena_list_push(other->header.arena, nlist, other_field);
      ht_set(other->namedarrays, hashname, nlist);
      EVEL_DEBUG("Created to new table table");
   }
   else
   {
-     dlist_push_last(list, other_field);
+     evel_arena_list_push(other->header.arena, list, other_field);
      EVEL_DEBUG("Adding to existing table");
   }
 
@@ -224,7 +231,7 @@ void evel_other_field_add_jsonobj(EVENT_OTHER * other, EVEL_JSON_OBJECT *jsonobj
 
   EVEL_DEBUG("Adding jsonObject");
 
-  dlist_push_last(&other->jsonobjects, jsonobj);
+  evel_arena_list_push(other->header.arena, &other->jsonobjects, jsonobj);
 
   EVEL_EXIT();
 }
@@ -244,7 +251,6 @@ void evel_other_field_add_jsonobj(EVENT_OTHER * other, EVEL_JSON_OBJECT *jsonobj
  *****************************************************************************/
 void evel_other_field_add(EVENT_OTHER * other, char * name, char * value)
 {
-  OTHER_FIELD * other_field = NULL;
   EVEL_ENTER();
 
   /***************************************************************************/
@@ -255,18 +261,67 @@ void evel_other_field_add(EVENT_OTHER * other, char * name, char * value)
   assert(name != NULL);
   assert(value != NULL);
 
+  evel_other_field_push(other,
+                        evel_arena_strdup(other->header.arena, name),
+                        evel_arena_strdup(other->header.arena, value));
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Add a field name/value pair to the Other, without copying it.
+ *
+ * @param other     Pointer to the Other.
+ * @param name      ASCIIZ string with the field's name, allocated with
+ *                  malloc.  The Other takes ownership of it, so the caller
+ *                  must not use or free it after the function returns.
+ * @param value     ASCIIZ string with the field's value, allocated with
+ *                  malloc.  The Other takes ownership of it, as for name.
+ *****************************************************************************/
+void evel_other_field_add_take(EVENT_OTHER * other, char * name, char * value)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(other != NULL);
+  assert(other->header.event_domain == EVEL_DOMAIN_OTHER);
+  assert(name != NULL);
+  assert(value != NULL);
+
+  evel_other_field_push(other,
+                        evel_arena_take_string(other->header.arena, name),
+                        evel_arena_take_string(other->header.arena, value));
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Push a field name/value pair, whose strings the Other already owns, onto
+ * the Other.
+ *
+ * @param other     Pointer to the Other.
+ * @param name      ASCIIZ string with the field's name.
+ * @param value     ASCIIZ string with the field's value.
+ *****************************************************************************/
+static void evel_other_field_push(EVENT_OTHER * other,
+                                  char * name,
+                                  char * value)
+{
+  OTHER_FIELD * other_field = NULL;
+
+  assert(name != NULL);
+  assert(value != NULL);
+
   EVEL_DEBUG("Adding name=%s value=%s", name, value);
-  other_field = malloc(sizeof(OTHER_FIELD));
+  other_field = evel_arena_alloc(other->header.arena, sizeof(OTHER_FIELD));
   assert(other_field != NULL);
   memset(other_field, 0, sizeof(OTHER_FIELD));
-  other_field->name = strdup(name);
-  other_field->value = strdup(value);
-  assert(other_field->name != NULL);
-  assert(other_field->value != NULL);
-
-  dlist_push_last(&other->namedvalues, other_field);
+  other_field->name = name;
+  other_field->value = value;
 
-  EVEL_EXIT();
+  evel_arena_list_push(other->header.arena, &other->namedvalues, other_field);
 }
 
 /**************************************************************************//**
@@ -299,7 +354,7 @@ void evel_json_encode_other(EVEL_JSON_BUFFER * jbuf,
   assert(event->header.event_domain == EVEL_DOMAIN_OTHER);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "otherFields");
+  evel_json_open_named_object(jbuf, EVEL_KEY_OTHER_FIELDS);
 
 // iterate through hashtable and print DLIST for each entry
 
@@ -317,29 +372,32 @@ void evel_json_encode_other(EVEL_JSON_BUFFER * jbuf,
         if( itm_added == true)
         {
 
-  if (evel_json_open_opt_named_list(jbuf, "hashOfNameValuePairArrays"))
+  if (evel_json_open_opt_named_list(jbuf,
+                                    EVEL_KEY_HASH_OF_NAME_VALUE_PAIR_ARRAYS))
   {
        for( i = 0; i < ht->size; i++ ) {
              if( ht->table[i] != NULL)
 	     {
 		itm_list = ht->table[i];
 
-  if(evel_json_open_opt_named_list(jbuf, ht->table[i]->key))
+  /***************************************************************************/
+  /* The named arrays sit below EVEL_THROTTLE_FIELD_DEPTH, so their          */
+  /* user-supplied names are never subject to suppression.                   */
+  /***************************************************************************/
+  evel_json_open_user_named_list(jbuf, ht->table[i]->key);
+  other_field_item = dlist_get_first(&itm_list);
+  while (other_field_item != NULL)
   {
-    other_field_item = dlist_get_first(&itm_list);
-    while (other_field_item != NULL)
-    {
-     other_field = (OTHER_FIELD *) other_field_item->item;
-     if(other_field != NULL){
-       evel_json_open_object(jbuf);
-       evel_enc_kv_string(jbuf, "name", other_field->name);
-       evel_enc_kv_string(jbuf, "value", other_field->value);
-       evel_json_close_object(jbuf);
-       other_field_item = dlist_get_next(other_field_item);
-     }
-    }
-    evel_json_close_list(jbuf);
+   other_field = (OTHER_FIELD *) other_field_item->item;
+   if(other_field != NULL){
+     evel_json_open_object(jbuf);
+     evel_enc_kv_string(jbuf, EVEL_KEY_NAME, other_field->name);
+     evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, other_field->value);
+     evel_json_close_object(jbuf);
+     other_field_item = dlist_get_next(other_field_item);
+   }
   }
+  evel_json_close_list(jbuf);
 
 	     }
        }
@@ -352,10 +410,8 @@ void evel_json_encode_other(EVEL_JSON_BUFFER * jbuf,
      }
    }
 
-  evel_json_checkpoint(jbuf);
-  if(evel_json_open_opt_named_list(jbuf, "jsonObjects"))
+  if(evel_json_open_opt_named_list(jbuf, EVEL_KEY_JSON_OBJECTS))
   {
-  bool item_added = false;
   other_field_item = dlist_get_first(&event->jsonobjects);
   while (other_field_item != NULL)
   {
@@ -364,9 +420,8 @@ void evel_json_encode_other(EVEL_JSON_BUFFER * jbuf,
     {
      evel_json_open_object(jbuf);
 
-       if( evel_json_open_opt_named_list(jbuf, "objectInstances"))
+       if( evel_json_open_opt_named_list(jbuf, EVEL_KEY_OBJECT_INSTANCES))
        {
-	bool item_added2 = false;
         jsobj_field_item = dlist_get_first(&jsonobjp->jsonobjectinstances);
 	while (jsobj_field_item != NULL)
 	{
@@ -374,13 +429,10 @@ void evel_json_encode_other(EVEL_JSON_BUFFER * jbuf,
 	   if( jsonobjinst != NULL )
 	   {
               evel_json_open_object(jbuf);
-              evel_enc_kv_object(jbuf, "objectInstance", jsonobjinst->jsonstring);
-              evel_enc_kv_ull(jbuf, "objectInstanceEpochMicrosec", jsonobjinst->objinst_epoch_microsec);
-  //evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "objectKeys"))
+              evel_enc_kv_object(jbuf, EVEL_KEY_OBJECT_INSTANCE, jsonobjinst->jsonstring);
+              evel_enc_kv_ull(jbuf, EVEL_KEY_OBJECT_INSTANCE_EPOCH_MICROSEC, jsonobjinst->objinst_epoch_microsec);
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_OBJECT_KEYS))
   {
-    bool item_added3 = false;
-
     keyinst_field_item = dlist_get_first(&jsonobjinst->object_keys);
     while (keyinst_field_item != NULL)
     {
@@ -388,56 +440,37 @@ void evel_json_encode_other(EVEL_JSON_BUFFER * jbuf,
       if(keyinst != NULL)
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "keyName", keyinst->keyname);
-        evel_enc_kv_opt_int(jbuf, "keyOrder", &keyinst->keyorder);
-        evel_enc_kv_opt_string(jbuf, "keyValue", &keyinst->keyvalue);
+        evel_enc_kv_string(jbuf, EVEL_KEY_KEY_NAME, keyinst->keyname);
+        evel_enc_kv_opt_int(jbuf, EVEL_KEY_KEY_ORDER, &keyinst->keyorder);
+        evel_enc_kv_opt_string(jbuf, EVEL_KEY_KEY_VALUE, &keyinst->keyvalue);
         evel_json_close_object(jbuf);
-	item_added3 = false;
       }
       keyinst_field_item = dlist_get_next(keyinst_field_item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    //if (!item_added3)
-    //{
-    //  evel_json_rewind(jbuf);
-    //}
   }
 	       evel_json_close_object(jbuf);
 	    }
-	    item_added2 = true;
             jsobj_field_item = dlist_get_next(jsobj_field_item);
 	}
         evel_json_close_list(jbuf);
-	if( !item_added2 )
-	{
-	  evel_json_rewind(jbuf);
-	}
        }
 
-    evel_enc_kv_string(jbuf, "objectName", jsonobjp->object_name);
-    evel_enc_kv_opt_string(jbuf, "objectSchema", &jsonobjp->objectschema);
-    evel_enc_kv_opt_string(jbuf, "objectSchemaUrl", &jsonobjp->objectschemaurl);
-    evel_enc_kv_opt_string(jbuf, "nfSubscribedObjectName", &jsonobjp->nfsubscribedobjname);
-    evel_enc_kv_opt_string(jbuf, "nfSubscriptionId", &jsonobjp->nfsubscriptionid);
+    evel_enc_kv_string(jbuf, EVEL_KEY_OBJECT_NAME, jsonobjp->object_name);
+    evel_enc_kv_opt_string(
+      jbuf, EVEL_KEY_OBJECT_SCHEMA, &jsonobjp->objectschema);
+    evel_enc_kv_opt_string(
+      jbuf, EVEL_KEY_OBJECT_SCHEMA_URL, &jsonobjp->objectschemaurl);
+    evel_enc_kv_opt_string(jbuf, EVEL_KEY_NF_SUBSCRIBED_OBJECT_NAME, &jsonobjp->nfsubscribedobjname);
+    evel_enc_kv_opt_string(jbuf, EVEL_KEY_NF_SUBSCRIPTION_ID, &jsonobjp->nfsubscriptionid);
     evel_json_close_object(jbuf);
-    item_added = true;
   }
   other_field_item = dlist_get_next(other_field_item);
   }
   evel_json_close_list(jbuf);
-
-  if (!item_added)
-  {
-     evel_json_rewind(jbuf);
   }
 
-  }
-
-  if( evel_json_open_opt_named_list(jbuf, "nameValuePairs"))
+  if( evel_json_open_opt_named_list(jbuf, EVEL_KEY_NAME_VALUE_PAIRS))
   {
   other_field_item = dlist_get_first(&event->namedvalues);
   while (other_field_item != NULL)
@@ -446,15 +479,15 @@ void evel_json_encode_other(EVEL_JSON_BUFFER * jbuf,
     assert(other_field != NULL);
 
     evel_json_open_object(jbuf);
-    evel_enc_kv_string(jbuf, "name", other_field->name);
-    evel_enc_kv_string(jbuf, "value", other_field->value);
+    evel_enc_kv_string(jbuf, EVEL_KEY_NAME, other_field->name);
+    evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, other_field->value);
     evel_json_close_object(jbuf);
     other_field_item = dlist_get_next(other_field_item);
   }
-  }
   evel_json_close_list(jbuf);
+  }
 
-  evel_enc_version(jbuf, "otherFieldsVersion", event->major_version,event->minor_version);
+  evel_enc_version(jbuf, EVEL_KEY_OTHER_FIELDS_VERSION, event->major_version,event->minor_version);
 
   evel_json_close_object(jbuf);
 
@@ -0,0 +1,239 @@
+/**************************************************************************//**
+ * @file
+ * Prototypes for creating many events of the same shape.
+ *
+ * A prototype is a complete event which is no longer changed.  Events created
+ * from it start as copies of its structure which point at its strings and
+ * lists rather than copying them, and which hold a reference to it through
+ * their arena.  Setting a field on such an event replaces the value it
+ * inherited, so only the fields which differ are allocated.
+ *
+ * License
+ * -------
+ *
+ * Copyright(c) <2016>, AT&T Intellectual Property.  All other rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:  This product includes
+ *    software developed by the AT&T.
+ * 4. Neither the name of AT&T nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific
+ *    prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AT&T INTELLECTUAL PROPERTY ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AT&T INTELLECTUAL PROPERTY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+
+#include "evel.h"
+#include "evel_internal.h"
+
+/**************************************************************************//**
+ * A prototype, which is freed once neither its creator nor any event created
+ * from it refers to it.
+ *****************************************************************************/
+struct evel_prototype {
+  int references;
+  EVENT_HEADER * event;
+};
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void evel_prototype_release(void * prototype);
+
+/**************************************************************************//**
+ * Create a prototype from an event.
+ *
+ * @param event         The event, which the prototype takes ownership of.
+ *
+ * @returns Pointer to the new ::EVEL_PROTOTYPE.
+ * @retval  NULL  Failed to allocate memory for the prototype, in which case
+ *                the event is freed.
+ *****************************************************************************/
+EVEL_PROTOTYPE * evel_new_prototype(EVENT_HEADER * event)
+{
+  EVEL_PROTOTYPE * prototype;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert((event->event_domain == EVEL_DOMAIN_FAULT) ||
+         (event->event_domain == EVEL_DOMAIN_SIPSIGNALING));
+
+  prototype = malloc(sizeof(EVEL_PROTOTYPE));
+  if (prototype == NULL)
+  {
+    log_error_state("Out of memory for prototype");
+    evel_free_event(event);
+    goto exit_label;
+  }
+  prototype->references = 1;
+  prototype->event = event;
+
+exit_label:
+  EVEL_EXIT();
+  return prototype;
+}
+
+/**************************************************************************//**
+ * Free a prototype.
+ *
+ * Events already created from it keep it until they are freed themselves.
+ *
+ * @note  It is safe to free a NULL pointer.
+ *
+ * @param prototype     Pointer to the ::EVEL_PROTOTYPE.
+ *****************************************************************************/
+void evel_free_prototype(EVEL_PROTOTYPE * prototype)
+{
+  EVEL_ENTER();
+
+  if (prototype != NULL)
+  {
+    evel_prototype_release(prototype);
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Create an event from a prototype.
+ *
+ * The event is a copy of the prototype's structure with its own arena, which
+ * holds a reference to the prototype, and its own eventId, sequence and
+ * epochs.
+ *
+ * @note  Lists in the new event still use the prototype's slots, so must be
+ *        passed to ::dlist_share_slots by the caller.
+ *
+ * @param prototype     Pointer to the ::EVEL_PROTOTYPE.
+ * @param domain        The domain the prototype must be of.
+ * @param size          The size of the domain's event structure.
+ * @param ev_id         The eventId of the new event.
+ *
+ * @returns Pointer to the new event.
+ * @retval  NULL  Failed to allocate memory for the event.
+ *****************************************************************************/
+EVENT_HEADER * evel_new_event_from_prototype(EVEL_PROTOTYPE * const prototype,
+                                             const EVEL_EVENT_DOMAINS domain,
+                                             const size_t size,
+                                             const char * const ev_id)
+{
+  EVENT_HEADER * event = NULL;
+  EVEL_ARENA * arena;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(prototype != NULL);
+  assert(prototype->event->event_domain == domain);
+  assert(ev_id != NULL);
+
+  arena = evel_new_arena();
+  if (arena == NULL)
+  {
+    goto exit_label;
+  }
+  event = evel_event_alloc(domain);
+  if (event == NULL)
+  {
+    log_error_state("Out of memory");
+    evel_free_arena(arena);
+    goto exit_label;
+  }
+  memcpy(event, prototype->event, size);
+
+  /***************************************************************************/
+  /* The arena drops the reference to the prototype when the event is freed. */
+  /***************************************************************************/
+  __atomic_add_fetch(&prototype->references, 1, __ATOMIC_RELAXED);
+  evel_arena_adopt(arena, evel_prototype_release, prototype);
+  event->arena = arena;
+  event->prototype = prototype;
+  event->memory_charged = 0;
+
+  /***************************************************************************/
+  /* Give the event its own identifiers and times.                           */
+  /***************************************************************************/
+  event->event_id = evel_arena_strdup(arena, ev_id);
+  event->sequence = evel_next_event_sequence();
+  event->last_epoch_microsec = evel_time_microsec();
+  event->start_epoch_microsec = event->last_epoch_microsec;
+
+exit_label:
+  EVEL_EXIT();
+  return event;
+}
+
+/**************************************************************************//**
+ * Forget the value of an ::EVEL_OPTION_STRING which an event inherited from
+ * its prototype, so that it can be set on the event.
+ *
+ * @param header        Pointer to the ::EVENT_HEADER of the event.
+ * @param option        Pointer to the ::EVEL_OPTION_STRING in the event.
+ *****************************************************************************/
+void evel_uninherit_option_string(EVENT_HEADER * const header,
+                                  EVEL_OPTION_STRING * const option)
+{
+  const EVEL_OPTION_STRING * inherited;
+
+  assert(header != NULL);
+  assert(option != NULL);
+
+  if (header->prototype != NULL)
+  {
+    /*************************************************************************/
+    /* The event is a copy of the prototype, so the same field is at the     */
+    /* same offset in it.                                                    */
+    /*************************************************************************/
+    inherited = (const EVEL_OPTION_STRING *)
+      ((const char *) header->prototype->event +
+       ((const char *) option - (const char *) header));
+    if (option->value == inherited->value)
+    {
+      evel_init_option_string(option);
+    }
+  }
+}
+
+/**************************************************************************//**
+ * Drop a reference to a prototype, freeing it and its event if it was the
+ * last.
+ *
+ * @param prototype     Pointer to the ::EVEL_PROTOTYPE.
+ *****************************************************************************/
+static void evel_prototype_release(void * prototype)
+{
+  EVEL_PROTOTYPE * shared = (EVEL_PROTOTYPE *) prototype;
+
+  if (__atomic_sub_fetch(&shared->references, 1, __ATOMIC_ACQ_REL) == 0)
+  {
+    evel_free_event(shared->event);
+    free(shared);
+  }
+}
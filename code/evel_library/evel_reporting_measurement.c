@@ -77,13 +77,13 @@ EVENT_REPORT * evel_new_report(double measurement_interval,const char *ev_name,
   /***************************************************************************/
   /* Allocate the report.                                                    */
   /***************************************************************************/
-  report = malloc(sizeof(EVENT_REPORT));
+  report = evel_event_alloc(EVEL_DOMAIN_REPORT);
   if (report == NULL)
   {
     log_error_state("Out of memory for Report");
     goto exit_label;
   }
-  memset(report, 0, sizeof(EVENT_REPORT));
+  report->header.arena = evel_new_event_arena();
   EVEL_DEBUG("New report is at %lp", report);
 
   /***************************************************************************/
@@ -160,14 +160,17 @@ void evel_report_feature_use_add(EVENT_REPORT * report,
   /* Allocate a container for the value and push onto the list.              */
   /***************************************************************************/
   EVEL_DEBUG("Adding Feature=%s Use=%d", feature, utilization);
-  feature_use = malloc(sizeof(MEASUREMENT_FEATURE_USE));
+  feature_use = evel_arena_alloc(report->header.arena,
+                                 sizeof(MEASUREMENT_FEATURE_USE));
   assert(feature_use != NULL);
   memset(feature_use, 0, sizeof(MEASUREMENT_FEATURE_USE));
-  feature_use->feature_id = strdup(feature);
+  feature_use->feature_id = evel_arena_strdup(report->header.arena, feature);
   assert(feature_use->feature_id != NULL);
   feature_use->feature_utilization = utilization;
 
-  dlist_push_last(&report->feature_usage, feature_use);
+  evel_arena_list_push(report->header.arena,
+                       &report->feature_usage,
+                       feature_use);
 
   EVEL_EXIT();
 }
@@ -208,12 +211,13 @@ void evel_report_custom_measurement_add(EVENT_REPORT * report,
   /***************************************************************************/
   EVEL_DEBUG("Adding Measurement Group=%s Name=%s Value=%s",
               group, name, value);
-  measurement = malloc(sizeof(CUSTOM_MEASUREMENT));
+  measurement = evel_arena_alloc(report->header.arena,
+                                 sizeof(CUSTOM_MEASUREMENT));
   assert(measurement != NULL);
   memset(measurement, 0, sizeof(CUSTOM_MEASUREMENT));
-  measurement->name = strdup(name);
+  measurement->name = evel_arena_strdup(report->header.arena, name);
   assert(measurement->name != NULL);
-  measurement->value = strdup(value);
+  measurement->value = evel_arena_strdup(report->header.arena, value);
   assert(measurement->value != NULL);
 
   /***************************************************************************/
@@ -240,19 +244,24 @@ void evel_report_custom_measurement_add(EVENT_REPORT * report,
   if (item == NULL)
   {
     EVEL_DEBUG("Creating new Measurement Group");
-    measurement_group = malloc(sizeof(MEASUREMENT_GROUP));
+    measurement_group = evel_arena_alloc(report->header.arena,
+                                         sizeof(MEASUREMENT_GROUP));
     assert(measurement_group != NULL);
     memset(measurement_group, 0, sizeof(MEASUREMENT_GROUP));
-    measurement_group->name = strdup(group);
+    measurement_group->name = evel_arena_strdup(report->header.arena, group);
     assert(measurement_group->name != NULL);
     dlist_initialize(&measurement_group->measurements);
-    dlist_push_last(&report->measurement_groups, measurement_group);
+    evel_arena_list_push(report->header.arena,
+                         &report->measurement_groups,
+                         measurement_group);
   }
 
   /***************************************************************************/
   /* If we didn't have the group already, create it.                         */
   /***************************************************************************/
-  dlist_push_last(&measurement_group->measurements, measurement);
+  evel_arena_list_push(report->header.arena,
+                       &measurement_group->measurements,
+                       measurement);
 
   EVEL_EXIT();
 }
@@ -281,17 +290,16 @@ void evel_json_encode_report(EVEL_JSON_BUFFER * jbuf,
   assert(event->header.event_domain == EVEL_DOMAIN_REPORT);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "measurementsForVfReportingFields");
-  evel_enc_kv_double(jbuf, "measurementInterval", event->measurement_interval);
+  evel_json_open_named_object(jbuf,
+                              EVEL_KEY_MEASUREMENTS_FOR_VF_REPORTING_FIELDS);
+  evel_enc_kv_double(
+    jbuf, EVEL_KEY_MEASUREMENT_INTERVAL, event->measurement_interval);
 
   /***************************************************************************/
   /* Feature Utilization list.                                               */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "featureUsageArray"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_FEATURE_USAGE_ARRAY))
   {
-    bool item_added = false;
-
     item = dlist_get_first(&event->feature_usage);
     while (item != NULL)
     {
@@ -299,37 +307,26 @@ void evel_json_encode_report(EVEL_JSON_BUFFER * jbuf,
       assert(feature_use != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "featureUsageArray",
+                                          EVEL_KEY_FEATURE_USAGE_ARRAY,
                                           feature_use->feature_id))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "featureIdentifier", feature_use->feature_id);
+        evel_enc_kv_string(
+          jbuf, EVEL_KEY_FEATURE_IDENTIFIER, feature_use->feature_id);
         evel_enc_kv_int(
-          jbuf, "featureUtilization", feature_use->feature_utilization);
+          jbuf, EVEL_KEY_FEATURE_UTILIZATION, feature_use->feature_utilization);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       item = dlist_get_next(item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
   /* Additional Measurement Groups list.                                     */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "additionalMeasurements"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_ADDITIONAL_MEASUREMENTS))
   {
-    bool item_added = false;
-
     item = dlist_get_first(&event->measurement_groups);
     while (item != NULL)
     {
@@ -337,12 +334,12 @@ void evel_json_encode_report(EVEL_JSON_BUFFER * jbuf,
       assert(measurement_group != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "additionalMeasurements",
+                                          EVEL_KEY_ADDITIONAL_MEASUREMENTS,
                                           measurement_group->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", measurement_group->name);
-        evel_json_open_named_list(jbuf, "measurements");
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, measurement_group->name);
+        evel_json_open_named_list(jbuf, EVEL_KEY_MEASUREMENTS);
 
         /*********************************************************************/
         /* Measurements list.                                                */
@@ -354,26 +351,17 @@ void evel_json_encode_report(EVEL_JSON_BUFFER * jbuf,
           assert(custom_measurement != NULL);
 
           evel_json_open_object(jbuf);
-          evel_enc_kv_string(jbuf, "name", custom_measurement->name);
-          evel_enc_kv_string(jbuf, "value", custom_measurement->value);
+          evel_enc_kv_string(jbuf, EVEL_KEY_NAME, custom_measurement->name);
+          evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, custom_measurement->value);
           evel_json_close_object(jbuf);
           nested_item = dlist_get_next(nested_item);
         }
         evel_json_close_list(jbuf);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       item = dlist_get_next(item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
@@ -381,7 +369,7 @@ void evel_json_encode_report(EVEL_JSON_BUFFER * jbuf,
   /* closes the object, too.                                                 */
   /***************************************************************************/
   evel_enc_version(jbuf,
-                   "measurementFieldsVersion",
+                   EVEL_KEY_MEASUREMENT_FIELDS_VERSION,
                    event->major_version,
                    event->minor_version);
   evel_json_close_object(jbuf);
@@ -42,6 +42,120 @@
 #include "evel_internal.h"
 #include "evel_throttle.h"
 
+/*****************************************************************************/
+/* The key of each disk usage field, indexed by ::EVEL_DISK_FIELDS.          */
+/*****************************************************************************/
+static const EVEL_JSON_KEY_ID evel_disk_keys[EVEL_MAX_DISK_FIELDS] = {
+  [EVEL_DISK_IO_TIME_AVG] = EVEL_KEY_DISK_IO_TIME_AVG,
+  [EVEL_DISK_IO_TIME_LAST] = EVEL_KEY_DISK_IO_TIME_LAST,
+  [EVEL_DISK_IO_TIME_MAX] = EVEL_KEY_DISK_IO_TIME_MAX,
+  [EVEL_DISK_IO_TIME_MIN] = EVEL_KEY_DISK_IO_TIME_MIN,
+  [EVEL_DISK_MERGED_READ_AVG] = EVEL_KEY_DISK_MERGED_READ_AVG,
+  [EVEL_DISK_MERGED_READ_LAST] = EVEL_KEY_DISK_MERGED_READ_LAST,
+  [EVEL_DISK_MERGED_READ_MAX] = EVEL_KEY_DISK_MERGED_READ_MAX,
+  [EVEL_DISK_MERGED_READ_MIN] = EVEL_KEY_DISK_MERGED_READ_MIN,
+  [EVEL_DISK_MERGED_WRITE_AVG] = EVEL_KEY_DISK_MERGED_WRITE_AVG,
+  [EVEL_DISK_MERGED_WRITE_LAST] = EVEL_KEY_DISK_MERGED_WRITE_LAST,
+  [EVEL_DISK_MERGED_WRITE_MAX] = EVEL_KEY_DISK_MERGED_WRITE_MAX,
+  [EVEL_DISK_MERGED_WRITE_MIN] = EVEL_KEY_DISK_MERGED_WRITE_MIN,
+  [EVEL_DISK_OCTETS_READ_AVG] = EVEL_KEY_DISK_OCTETS_READ_AVG,
+  [EVEL_DISK_OCTETS_READ_LAST] = EVEL_KEY_DISK_OCTETS_READ_LAST,
+  [EVEL_DISK_OCTETS_READ_MAX] = EVEL_KEY_DISK_OCTETS_READ_MAX,
+  [EVEL_DISK_OCTETS_READ_MIN] = EVEL_KEY_DISK_OCTETS_READ_MIN,
+  [EVEL_DISK_OCTETS_WRITE_AVG] = EVEL_KEY_DISK_OCTETS_WRITE_AVG,
+  [EVEL_DISK_OCTETS_WRITE_LAST] = EVEL_KEY_DISK_OCTETS_WRITE_LAST,
+  [EVEL_DISK_OCTETS_WRITE_MAX] = EVEL_KEY_DISK_OCTETS_WRITE_MAX,
+  [EVEL_DISK_OCTETS_WRITE_MIN] = EVEL_KEY_DISK_OCTETS_WRITE_MIN,
+  [EVEL_DISK_OPS_READ_AVG] = EVEL_KEY_DISK_OPS_READ_AVG,
+  [EVEL_DISK_OPS_READ_LAST] = EVEL_KEY_DISK_OPS_READ_LAST,
+  [EVEL_DISK_OPS_READ_MAX] = EVEL_KEY_DISK_OPS_READ_MAX,
+  [EVEL_DISK_OPS_READ_MIN] = EVEL_KEY_DISK_OPS_READ_MIN,
+  [EVEL_DISK_OPS_WRITE_AVG] = EVEL_KEY_DISK_OPS_WRITE_AVG,
+  [EVEL_DISK_OPS_WRITE_LAST] = EVEL_KEY_DISK_OPS_WRITE_LAST,
+  [EVEL_DISK_OPS_WRITE_MAX] = EVEL_KEY_DISK_OPS_WRITE_MAX,
+  [EVEL_DISK_OPS_WRITE_MIN] = EVEL_KEY_DISK_OPS_WRITE_MIN,
+  [EVEL_DISK_PENDING_OPERATIONS_AVG] = EVEL_KEY_DISK_PENDING_OPERATIONS_AVG,
+  [EVEL_DISK_PENDING_OPERATIONS_LAST] = EVEL_KEY_DISK_PENDING_OPERATIONS_LAST,
+  [EVEL_DISK_PENDING_OPERATIONS_MAX] = EVEL_KEY_DISK_PENDING_OPERATIONS_MAX,
+  [EVEL_DISK_PENDING_OPERATIONS_MIN] = EVEL_KEY_DISK_PENDING_OPERATIONS_MIN,
+  [EVEL_DISK_TIME_READ_AVG] = EVEL_KEY_DISK_TIME_READ_AVG,
+  [EVEL_DISK_TIME_READ_LAST] = EVEL_KEY_DISK_TIME_READ_LAST,
+  [EVEL_DISK_TIME_READ_MAX] = EVEL_KEY_DISK_TIME_READ_MAX,
+  [EVEL_DISK_TIME_READ_MIN] = EVEL_KEY_DISK_TIME_READ_MIN,
+  [EVEL_DISK_TIME_WRITE_AVG] = EVEL_KEY_DISK_TIME_WRITE_AVG,
+  [EVEL_DISK_TIME_WRITE_LAST] = EVEL_KEY_DISK_TIME_WRITE_LAST,
+  [EVEL_DISK_TIME_WRITE_MAX] = EVEL_KEY_DISK_TIME_WRITE_MAX,
+  [EVEL_DISK_TIME_WRITE_MIN] = EVEL_KEY_DISK_TIME_WRITE_MIN,
+};
+
+/*****************************************************************************/
+/* The key of each vNIC usage field, indexed by ::EVEL_VNIC_FIELDS.          */
+/*****************************************************************************/
+static const EVEL_JSON_KEY_ID evel_vnic_keys[EVEL_MAX_VNIC_FIELDS] = {
+  [EVEL_VNIC_RECEIVED_BROADCAST_PACKETS_ACCUMULATED] =
+    EVEL_KEY_RECEIVED_BROADCAST_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_RECEIVED_BROADCAST_PACKETS_DELTA] =
+    EVEL_KEY_RECEIVED_BROADCAST_PACKETS_DELTA,
+  [EVEL_VNIC_RECEIVED_DISCARDED_PACKETS_ACCUMULATED] =
+    EVEL_KEY_RECEIVED_DISCARDED_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_RECEIVED_DISCARDED_PACKETS_DELTA] =
+    EVEL_KEY_RECEIVED_DISCARDED_PACKETS_DELTA,
+  [EVEL_VNIC_RECEIVED_ERROR_PACKETS_ACCUMULATED] =
+    EVEL_KEY_RECEIVED_ERROR_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_RECEIVED_ERROR_PACKETS_DELTA] =
+    EVEL_KEY_RECEIVED_ERROR_PACKETS_DELTA,
+  [EVEL_VNIC_RECEIVED_MULTICAST_PACKETS_ACCUMULATED] =
+    EVEL_KEY_RECEIVED_MULTICAST_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_RECEIVED_MULTICAST_PACKETS_DELTA] =
+    EVEL_KEY_RECEIVED_MULTICAST_PACKETS_DELTA,
+  [EVEL_VNIC_RECEIVED_OCTETS_ACCUMULATED] =
+    EVEL_KEY_RECEIVED_OCTETS_ACCUMULATED,
+  [EVEL_VNIC_RECEIVED_OCTETS_DELTA] = EVEL_KEY_RECEIVED_OCTETS_DELTA,
+  [EVEL_VNIC_RECEIVED_TOTAL_PACKETS_ACCUMULATED] =
+    EVEL_KEY_RECEIVED_TOTAL_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_RECEIVED_TOTAL_PACKETS_DELTA] =
+    EVEL_KEY_RECEIVED_TOTAL_PACKETS_DELTA,
+  [EVEL_VNIC_RECEIVED_UNICAST_PACKETS_ACCUMULATED] =
+    EVEL_KEY_RECEIVED_UNICAST_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_RECEIVED_UNICAST_PACKETS_DELTA] =
+    EVEL_KEY_RECEIVED_UNICAST_PACKETS_DELTA,
+  [EVEL_VNIC_TRANSMITTED_BROADCAST_PACKETS_ACCUMULATED] =
+    EVEL_KEY_TRANSMITTED_BROADCAST_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_TRANSMITTED_BROADCAST_PACKETS_DELTA] =
+    EVEL_KEY_TRANSMITTED_BROADCAST_PACKETS_DELTA,
+  [EVEL_VNIC_TRANSMITTED_DISCARDED_PACKETS_ACCUMULATED] =
+    EVEL_KEY_TRANSMITTED_DISCARDED_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_TRANSMITTED_DISCARDED_PACKETS_DELTA] =
+    EVEL_KEY_TRANSMITTED_DISCARDED_PACKETS_DELTA,
+  [EVEL_VNIC_TRANSMITTED_ERROR_PACKETS_ACCUMULATED] =
+    EVEL_KEY_TRANSMITTED_ERROR_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_TRANSMITTED_ERROR_PACKETS_DELTA] =
+    EVEL_KEY_TRANSMITTED_ERROR_PACKETS_DELTA,
+  [EVEL_VNIC_TRANSMITTED_MULTICAST_PACKETS_ACCUMULATED] =
+    EVEL_KEY_TRANSMITTED_MULTICAST_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_TRANSMITTED_MULTICAST_PACKETS_DELTA] =
+    EVEL_KEY_TRANSMITTED_MULTICAST_PACKETS_DELTA,
+  [EVEL_VNIC_TRANSMITTED_OCTETS_ACCUMULATED] =
+    EVEL_KEY_TRANSMITTED_OCTETS_ACCUMULATED,
+  [EVEL_VNIC_TRANSMITTED_OCTETS_DELTA] = EVEL_KEY_TRANSMITTED_OCTETS_DELTA,
+  [EVEL_VNIC_TRANSMITTED_TOTAL_PACKETS_ACCUMULATED] =
+    EVEL_KEY_TRANSMITTED_TOTAL_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_TRANSMITTED_TOTAL_PACKETS_DELTA] =
+    EVEL_KEY_TRANSMITTED_TOTAL_PACKETS_DELTA,
+  [EVEL_VNIC_TRANSMITTED_UNICAST_PACKETS_ACCUMULATED] =
+    EVEL_KEY_TRANSMITTED_UNICAST_PACKETS_ACCUMULATED,
+  [EVEL_VNIC_TRANSMITTED_UNICAST_PACKETS_DELTA] =
+    EVEL_KEY_TRANSMITTED_UNICAST_PACKETS_DELTA,
+};
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void evel_free_adopted_vnic_performance(void * vnic_performance);
+static void evel_measurement_addl_info_push(EVENT_MEASUREMENT * measurement,
+                                            char * name,
+                                            char * value);
+
 /**************************************************************************//**
  * Create a new Measurement event.
  *
@@ -71,13 +185,13 @@ EVENT_MEASUREMENT * evel_new_measurement(double measurement_interval, const char
   /***************************************************************************/
   /* Allocate the measurement.                                               */
   /***************************************************************************/
-  measurement = malloc(sizeof(EVENT_MEASUREMENT));
+  measurement = evel_event_alloc(EVEL_DOMAIN_MEASUREMENT);
   if (measurement == NULL)
   {
     log_error_state("Out of memory for Measurement");
     goto exit_label;
   }
-  memset(measurement, 0, sizeof(EVENT_MEASUREMENT));
+  measurement->header.arena = evel_new_event_arena();
   EVEL_DEBUG("New measurement is at %lp", measurement);
 
   /***************************************************************************/
@@ -155,7 +269,6 @@ void evel_measurement_type_set(EVENT_MEASUREMENT * measurement,
  *****************************************************************************/
 void evel_measurement_addl_info_add(EVENT_MEASUREMENT * measurement, char * name, char * value)
 {
-  OTHER_FIELD * addl_info = NULL;
   EVEL_ENTER();
 
   /***************************************************************************/
@@ -166,18 +279,75 @@ void evel_measurement_addl_info_add(EVENT_MEASUREMENT * measurement, char * name
   assert(name != NULL);
   assert(value != NULL);
   
+  evel_measurement_addl_info_push(
+    measurement,
+    evel_arena_strdup(measurement->header.arena, name),
+    evel_arena_strdup(measurement->header.arena, value));
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Add an additional value name/value pair to the Measurement, without
+ * copying it.
+ *
+ * @param measurement     Pointer to the measurement.
+ * @param name      ASCIIZ string with the attribute's name, allocated with
+ *                  malloc.  The Measurement takes ownership of it, so the
+ *                  caller must not use or free it after the function returns.
+ * @param value     ASCIIZ string with the attribute's value, allocated with
+ *                  malloc.  The Measurement takes ownership of it, as for
+ *                  name.
+ *****************************************************************************/
+void evel_measurement_addl_info_add_take(EVENT_MEASUREMENT * measurement,
+                                         char * name,
+                                         char * value)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(measurement != NULL);
+  assert(measurement->header.event_domain == EVEL_DOMAIN_MEASUREMENT);
+  assert(name != NULL);
+  assert(value != NULL);
+
+  evel_measurement_addl_info_push(
+    measurement,
+    evel_arena_take_string(measurement->header.arena, name),
+    evel_arena_take_string(measurement->header.arena, value));
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Push an additional value name/value pair, whose strings the Measurement
+ * already owns, onto the Measurement.
+ *
+ * @param measurement     Pointer to the measurement.
+ * @param name      ASCIIZ string with the attribute's name.
+ * @param value     ASCIIZ string with the attribute's value.
+ *****************************************************************************/
+static void evel_measurement_addl_info_push(EVENT_MEASUREMENT * measurement,
+                                            char * name,
+                                            char * value)
+{
+  OTHER_FIELD * addl_info = NULL;
+
+  assert(name != NULL);
+  assert(value != NULL);
+
   EVEL_DEBUG("Adding name=%s value=%s", name, value);
-  addl_info = malloc(sizeof(OTHER_FIELD));
+  addl_info = evel_arena_alloc(measurement->header.arena, sizeof(OTHER_FIELD));
   assert(addl_info != NULL);
   memset(addl_info, 0, sizeof(OTHER_FIELD));
-  addl_info->name = strdup(name);
-  addl_info->value = strdup(value);
-  assert(addl_info->name != NULL);
-  assert(addl_info->value != NULL);
+  addl_info->name = name;
+  addl_info->value = value;
 
-  dlist_push_last(&measurement->additional_info, addl_info);
-
-  EVEL_EXIT();
+  evel_arena_list_push(measurement->header.arena,
+                       &measurement->additional_info,
+                       addl_info);
 }
 
 /**************************************************************************//**
@@ -275,7 +445,8 @@ void evel_measurement_errors_set(EVENT_MEASUREMENT * measurement,
                receive_errors,
                transmit_discards,
                transmit_errors);
-    errors = malloc(sizeof(MEASUREMENT_ERRORS));
+    errors = evel_arena_alloc(measurement->header.arena,
+                              sizeof(MEASUREMENT_ERRORS));
     assert(errors != NULL);
     memset(errors, 0, sizeof(MEASUREMENT_ERRORS));
     errors->receive_discards = receive_discards;
@@ -388,10 +559,11 @@ MEASUREMENT_CPU_USE *evel_measurement_new_cpu_use_add(EVENT_MEASUREMENT * measur
   /* Allocate a container for the value and push onto the list.              */
   /***************************************************************************/
   EVEL_DEBUG("Adding id=%s usage=%lf", id, usage);
-  cpu_use = malloc(sizeof(MEASUREMENT_CPU_USE));
+  cpu_use = evel_arena_alloc(measurement->header.arena,
+                             sizeof(MEASUREMENT_CPU_USE));
   assert(cpu_use != NULL);
   memset(cpu_use, 0, sizeof(MEASUREMENT_CPU_USE));
-  cpu_use->id    = strdup(id);
+  cpu_use->id    = evel_arena_strdup(measurement->header.arena, id);
   cpu_use->usage = usage;
   evel_init_option_double(&cpu_use->idle);
   evel_init_option_double(&cpu_use->intrpt);
@@ -402,7 +574,9 @@ MEASUREMENT_CPU_USE *evel_measurement_new_cpu_use_add(EVENT_MEASUREMENT * measur
   evel_init_option_double(&cpu_use->user);
   evel_init_option_double(&cpu_use->wait);
 
-  dlist_push_last(&measurement->cpu_usage, cpu_use);
+  evel_arena_list_push(measurement->header.arena,
+                       &measurement->cpu_usage,
+                       cpu_use);
 
   EVEL_EXIT();
   return cpu_use;
@@ -589,11 +763,12 @@ MEASUREMENT_MEM_USE * evel_measurement_new_mem_use_add(EVENT_MEASUREMENT * measu
   /* Allocate a container for the value and push onto the list.              */
   /***************************************************************************/
   EVEL_DEBUG("Adding id=%s buffer size=%lf", id, membuffsz);
-  mem_use = malloc(sizeof(MEASUREMENT_MEM_USE));
+  mem_use = evel_arena_alloc(measurement->header.arena,
+                             sizeof(MEASUREMENT_MEM_USE));
   assert(mem_use != NULL);
   memset(mem_use, 0, sizeof(MEASUREMENT_MEM_USE));
-  mem_use->id    = strdup(id);
-  mem_use->vmid  = strdup(vmidentifier);
+  mem_use->id    = evel_arena_strdup(measurement->header.arena, id);
+  mem_use->vmid  = evel_arena_strdup(measurement->header.arena, vmidentifier);
   mem_use->membuffsz = membuffsz;
   evel_init_option_double(&mem_use->memcache);
   evel_init_option_double(&mem_use->memconfig);
@@ -604,7 +779,9 @@ MEASUREMENT_MEM_USE * evel_measurement_new_mem_use_add(EVENT_MEASUREMENT * measu
 
   assert(mem_use->id != NULL);
 
-  dlist_push_last(&measurement->mem_usage, mem_use);
+  evel_arena_list_push(measurement->header.arena,
+                       &measurement->mem_usage,
+                       mem_use);
 
   EVEL_EXIT();
   return mem_use;
@@ -745,53 +922,15 @@ MEASUREMENT_DISK_USE * evel_measurement_new_disk_use_add(EVENT_MEASUREMENT * mea
   /* Allocate a container for the value and push onto the list.              */
   /***************************************************************************/
   EVEL_DEBUG("Adding id=%s disk usage", id);
-  disk_use = malloc(sizeof(MEASUREMENT_DISK_USE));
+  disk_use = evel_arena_alloc(measurement->header.arena,
+                              sizeof(MEASUREMENT_DISK_USE));
   assert(disk_use != NULL);
   memset(disk_use, 0, sizeof(MEASUREMENT_DISK_USE));
-  disk_use->id    = strdup(id);
+  disk_use->id    = evel_arena_strdup(measurement->header.arena, id);
   assert(disk_use->id != NULL);
-  dlist_push_last(&measurement->disk_usage, disk_use);
-
-  evel_init_option_double(&disk_use->iotimeavg );
-  evel_init_option_double(&disk_use->iotimelast );
-  evel_init_option_double(&disk_use->iotimemax );
-  evel_init_option_double(&disk_use->iotimemin );
-  evel_init_option_double(&disk_use->mergereadavg );
-  evel_init_option_double(&disk_use->mergereadlast );
-  evel_init_option_double(&disk_use->mergereadmax );
-  evel_init_option_double(&disk_use->mergereadmin );
-  evel_init_option_double(&disk_use->mergewriteavg );
-  evel_init_option_double(&disk_use->mergewritelast );
-  evel_init_option_double(&disk_use->mergewritemax );
-  evel_init_option_double(&disk_use->mergewritemin );
-  evel_init_option_double(&disk_use->octetsreadavg );
-  evel_init_option_double(&disk_use->octetsreadlast );
-  evel_init_option_double(&disk_use->octetsreadmax );
-  evel_init_option_double(&disk_use->octetsreadmin );
-  evel_init_option_double(&disk_use->octetswriteavg );
-  evel_init_option_double(&disk_use->octetswritelast );
-  evel_init_option_double(&disk_use->octetswritemax );
-  evel_init_option_double(&disk_use->octetswritemin );
-  evel_init_option_double(&disk_use->opsreadavg );
-  evel_init_option_double(&disk_use->opsreadlast );
-  evel_init_option_double(&disk_use->opsreadmax );
-  evel_init_option_double(&disk_use->opsreadmin );
-  evel_init_option_double(&disk_use->opswriteavg );
-  evel_init_option_double(&disk_use->opswritelast );
-  evel_init_option_double(&disk_use->opswritemax );
-  evel_init_option_double(&disk_use->opswritemin );
-  evel_init_option_double(&disk_use->pendingopsavg );
-  evel_init_option_double(&disk_use->pendingopslast );
-  evel_init_option_double(&disk_use->pendingopsmax );
-  evel_init_option_double(&disk_use->pendingopsmin );
-  evel_init_option_double(&disk_use->timereadavg );
-  evel_init_option_double(&disk_use->timereadlast );
-  evel_init_option_double(&disk_use->timereadmax );
-  evel_init_option_double(&disk_use->timereadmin );
-  evel_init_option_double(&disk_use->timewriteavg );
-  evel_init_option_double(&disk_use->timewritelast );
-  evel_init_option_double(&disk_use->timewritemax );
-  evel_init_option_double(&disk_use->timewritemin );
+  evel_arena_list_push(measurement->header.arena,
+                       &measurement->disk_usage,
+                       disk_use);
 
   EVEL_EXIT();
   return disk_use;
@@ -813,7 +952,8 @@ void evel_measurement_disk_use_iotimeavg_set(MEASUREMENT_DISK_USE * const disk_u
                                     const double val) 
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->iotimeavg, val, "Disk ioload set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_IO_TIME_AVG, val, "Disk ioload set");
   EVEL_EXIT();
 }
 
@@ -833,7 +973,8 @@ void evel_measurement_disk_use_iotimelast_set(MEASUREMENT_DISK_USE * const disk_
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->iotimelast, val, "Disk ioloadlast set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_IO_TIME_LAST, val, "Disk ioloadlast set");
   EVEL_EXIT();
 }
 
@@ -853,7 +994,8 @@ void evel_measurement_disk_use_iotimemax_set(MEASUREMENT_DISK_USE * const disk_u
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->iotimemax, val, "Disk ioloadmax set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_IO_TIME_MAX, val, "Disk ioloadmax set");
   EVEL_EXIT();
 }
 
@@ -873,7 +1015,8 @@ void evel_measurement_disk_use_iotimemin_set(MEASUREMENT_DISK_USE * const disk_u
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->iotimemin, val, "Disk ioloadmin set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_IO_TIME_MIN, val, "Disk ioloadmin set");
   EVEL_EXIT();
 }
 
@@ -893,7 +1036,9 @@ void evel_measurement_disk_use_mergereadavg_set(MEASUREMENT_DISK_USE * const dis
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->mergereadavg, val, "Disk Merged read average set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_MERGED_READ_AVG, val,
+                         "Disk Merged read average set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -912,7 +1057,9 @@ void evel_measurement_disk_use_mergereadlast_set(MEASUREMENT_DISK_USE * const di
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->mergereadlast, val, "Disk mergedload last set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_MERGED_READ_LAST, val,
+                         "Disk mergedload last set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -931,7 +1078,9 @@ void evel_measurement_disk_use_mergereadmax_set(MEASUREMENT_DISK_USE * const dis
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->mergereadmax, val, "Disk merged loadmax set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_MERGED_READ_MAX, val,
+                         "Disk merged loadmax set");
   EVEL_EXIT();
 }
 
@@ -951,7 +1100,9 @@ void evel_measurement_disk_use_mergereadmin_set(MEASUREMENT_DISK_USE * const dis
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->mergereadmin, val, "Disk merged loadmin set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_MERGED_READ_MIN, val,
+                         "Disk merged loadmin set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -970,7 +1121,9 @@ void evel_measurement_disk_use_mergewritelast_set(MEASUREMENT_DISK_USE * const d
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->mergewritelast, val, "Disk merged writelast set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_MERGED_WRITE_LAST, val,
+                         "Disk merged writelast set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -989,7 +1142,8 @@ void evel_measurement_disk_use_mergewritemax_set(MEASUREMENT_DISK_USE * const di
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->mergewritemax, val, "Disk writemax set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_MERGED_WRITE_MAX, val, "Disk writemax set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1008,7 +1162,8 @@ void evel_measurement_disk_use_mergewritemin_set(MEASUREMENT_DISK_USE * const di
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->mergewritemin, val, "Disk writemin set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_MERGED_WRITE_MIN, val, "Disk writemin set");
   EVEL_EXIT();
 }
 
@@ -1027,7 +1182,8 @@ void evel_measurement_disk_use_octetsreadavg_set(MEASUREMENT_DISK_USE * const di
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->octetsreadavg, val, "Octets readavg set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OCTETS_READ_AVG, val, "Octets readavg set");
   EVEL_EXIT();
 }
 
@@ -1046,7 +1202,9 @@ void evel_measurement_disk_use_octetsreadlast_set(MEASUREMENT_DISK_USE * const d
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->octetsreadlast, val, "Octets readlast set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OCTETS_READ_LAST, val,
+                         "Octets readlast set");
   EVEL_EXIT();
 }
 
@@ -1065,7 +1223,8 @@ void evel_measurement_disk_use_octetsreadmax_set(MEASUREMENT_DISK_USE * const di
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->octetsreadmax, val, "Octets readmax set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OCTETS_READ_MAX, val, "Octets readmax set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1083,7 +1242,8 @@ void evel_measurement_disk_use_octetsreadmin_set(MEASUREMENT_DISK_USE * const di
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->octetsreadmin, val, "Octets readmin set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OCTETS_READ_MIN, val, "Octets readmin set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1101,7 +1261,9 @@ void evel_measurement_disk_use_octetswriteavg_set(MEASUREMENT_DISK_USE * const d
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->octetswriteavg, val, "Octets writeavg set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OCTETS_WRITE_AVG, val,
+                         "Octets writeavg set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1119,7 +1281,9 @@ void evel_measurement_disk_use_octetswritelast_set(MEASUREMENT_DISK_USE * const
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->octetswritelast, val, "Octets writelast set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OCTETS_WRITE_LAST, val,
+                         "Octets writelast set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1137,7 +1301,9 @@ void evel_measurement_disk_use_octetswritemax_set(MEASUREMENT_DISK_USE * const d
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->octetswritemax, val, "Octets writemax set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OCTETS_WRITE_MAX, val,
+                         "Octets writemax set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1155,7 +1321,9 @@ void evel_measurement_disk_use_octetswritemin_set(MEASUREMENT_DISK_USE * const d
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->octetswritemin, val, "Octets writemin set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OCTETS_WRITE_MIN, val,
+                         "Octets writemin set");
   EVEL_EXIT();
 }
 
@@ -1174,7 +1342,9 @@ void evel_measurement_disk_use_opsreadavg_set(MEASUREMENT_DISK_USE * const disk_
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->opsreadavg, val, "Disk read operation average set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OPS_READ_AVG, val,
+                         "Disk read operation average set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1192,7 +1362,9 @@ void evel_measurement_disk_use_opsreadlast_set(MEASUREMENT_DISK_USE * const disk
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->opsreadlast, val, "Disk read operation last set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OPS_READ_LAST, val,
+                         "Disk read operation last set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1210,7 +1382,9 @@ void evel_measurement_disk_use_opsreadmax_set(MEASUREMENT_DISK_USE * const disk_
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->opsreadmax, val, "Disk read operation maximum set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OPS_READ_MAX, val,
+                         "Disk read operation maximum set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1228,7 +1402,9 @@ void evel_measurement_disk_use_opsreadmin_set(MEASUREMENT_DISK_USE * const disk_
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->opsreadmin, val, "Disk read operation minimum set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OPS_READ_MIN, val,
+                         "Disk read operation minimum set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1246,7 +1422,9 @@ void evel_measurement_disk_use_opswriteavg_set(MEASUREMENT_DISK_USE * const disk
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->opswriteavg, val, "Disk write operation average set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OPS_WRITE_AVG, val,
+                         "Disk write operation average set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1264,7 +1442,9 @@ void evel_measurement_disk_use_opswritelast_set(MEASUREMENT_DISK_USE * const dis
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->opswritelast, val, "Disk write operation last set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OPS_WRITE_LAST, val,
+                         "Disk write operation last set");
   EVEL_EXIT();
 }
 
@@ -1283,7 +1463,9 @@ void evel_measurement_disk_use_opswritemax_set(MEASUREMENT_DISK_USE * const disk
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->opswritemax, val, "Disk write operation maximum set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OPS_WRITE_MAX, val,
+                         "Disk write operation maximum set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1301,7 +1483,9 @@ void evel_measurement_disk_use_opswritemin_set(MEASUREMENT_DISK_USE * const disk
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->opswritemin, val, "Disk write operation minimum set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_OPS_WRITE_MIN, val,
+                         "Disk write operation minimum set");
   EVEL_EXIT();
 }
 
@@ -1320,7 +1504,9 @@ void evel_measurement_disk_use_pendingopsavg_set(MEASUREMENT_DISK_USE * const di
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->pendingopsavg, val, "Disk pending operation average set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_PENDING_OPERATIONS_AVG, val,
+                         "Disk pending operation average set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1338,7 +1524,9 @@ void evel_measurement_disk_use_pendingopslast_set(MEASUREMENT_DISK_USE * const d
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->pendingopslast, val, "Disk pending operation last set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_PENDING_OPERATIONS_LAST, val,
+                         "Disk pending operation last set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1356,7 +1544,9 @@ void evel_measurement_disk_use_pendingopsmax_set(MEASUREMENT_DISK_USE * const di
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->pendingopsmax, val, "Disk pending operation maximum set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_PENDING_OPERATIONS_MAX, val,
+                         "Disk pending operation maximum set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1374,7 +1564,9 @@ void evel_measurement_disk_use_pendingopsmin_set(MEASUREMENT_DISK_USE * const di
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->pendingopsmin, val, "Disk pending operation min set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_PENDING_OPERATIONS_MIN, val,
+                         "Disk pending operation min set");
   EVEL_EXIT();
 }
 
@@ -1393,7 +1585,9 @@ void evel_measurement_disk_use_timereadavg_set(MEASUREMENT_DISK_USE * const disk
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->timereadavg, val, "Disk read time average set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_TIME_READ_AVG, val,
+                         "Disk read time average set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1411,7 +1605,9 @@ void evel_measurement_disk_use_timereadlast_set(MEASUREMENT_DISK_USE * const dis
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->timereadlast, val, "Disk read time last set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_TIME_READ_LAST, val,
+                         "Disk read time last set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1429,7 +1625,9 @@ void evel_measurement_disk_use_timereadmax_set(MEASUREMENT_DISK_USE * const disk
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->timereadmax, val, "Disk read time maximum set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_TIME_READ_MAX, val,
+                         "Disk read time maximum set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1447,7 +1645,9 @@ void evel_measurement_disk_use_timereadmin_set(MEASUREMENT_DISK_USE * const disk
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->timereadmin, val, "Disk read time minimum set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_TIME_READ_MIN, val,
+                         "Disk read time minimum set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1465,7 +1665,9 @@ void evel_measurement_disk_use_timewriteavg_set(MEASUREMENT_DISK_USE * const dis
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->timewriteavg, val, "Disk write time average set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_TIME_WRITE_AVG, val,
+                         "Disk write time average set");
   EVEL_EXIT();
 }
 
@@ -1484,7 +1686,9 @@ void evel_measurement_disk_use_timewritelast_set(MEASUREMENT_DISK_USE * const di
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->timewritelast, val, "Disk write time last set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_TIME_WRITE_LAST, val,
+                         "Disk write time last set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1502,7 +1706,9 @@ void evel_measurement_disk_use_timewritemax_set(MEASUREMENT_DISK_USE * const dis
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->timewritemax, val, "Disk write time max set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_TIME_WRITE_MAX, val,
+                         "Disk write time max set");
   EVEL_EXIT();
 }
 /**************************************************************************//**
@@ -1520,7 +1726,9 @@ void evel_measurement_disk_use_timewritemin_set(MEASUREMENT_DISK_USE * const dis
                                     const double val)
 {
   EVEL_ENTER();
-  evel_set_option_double(&disk_use->timewritemin, val, "Disk write time min set");
+  evel_set_packed_double(&disk_use->present, disk_use->values,
+                         EVEL_DISK_TIME_WRITE_MIN, val,
+                         "Disk write time min set");
   EVEL_EXIT();
 }
 
@@ -1570,10 +1778,12 @@ void evel_measurement_fsys_use_add(EVENT_MEASUREMENT * measurement,
   /* Allocate a container for the value and push onto the list.              */
   /***************************************************************************/
   EVEL_DEBUG("Adding filesystem_name=%s", filesystem_name);
-  fsys_use = malloc(sizeof(MEASUREMENT_FSYS_USE));
+  fsys_use = evel_arena_alloc(measurement->header.arena,
+                              sizeof(MEASUREMENT_FSYS_USE));
   assert(fsys_use != NULL);
   memset(fsys_use, 0, sizeof(MEASUREMENT_FSYS_USE));
-  fsys_use->filesystem_name = strdup(filesystem_name);
+  fsys_use->filesystem_name = evel_arena_strdup(measurement->header.arena,
+                                                filesystem_name);
   fsys_use->block_configured = block_configured;
   fsys_use->block_used = block_used;
   fsys_use->block_iops = block_iops;
@@ -1581,7 +1791,9 @@ void evel_measurement_fsys_use_add(EVENT_MEASUREMENT * measurement,
   fsys_use->ephemeral_used = ephemeral_used;
   fsys_use->ephemeral_iops = ephemeral_iops;
 
-  dlist_push_last(&measurement->filesystem_usage, fsys_use);
+  evel_arena_list_push(measurement->header.arena,
+                       &measurement->filesystem_usage,
+                       fsys_use);
 
   EVEL_EXIT();
 }
@@ -1616,14 +1828,18 @@ void evel_measurement_feature_use_add(EVENT_MEASUREMENT * measurement,
   /* Allocate a container for the value and push onto the list.              */
   /***************************************************************************/
   EVEL_DEBUG("Adding Feature=%s Use=%d", feature, utilization);
-  feature_use = malloc(sizeof(MEASUREMENT_FEATURE_USE));
+  feature_use = evel_arena_alloc(measurement->header.arena,
+                                 sizeof(MEASUREMENT_FEATURE_USE));
   assert(feature_use != NULL);
   memset(feature_use, 0, sizeof(MEASUREMENT_FEATURE_USE));
-  feature_use->feature_id = strdup(feature);
+  feature_use->feature_id = evel_arena_strdup(measurement->header.arena,
+                                              feature);
   assert(feature_use->feature_id != NULL);
   feature_use->feature_utilization = utilization;
 
-  dlist_push_last(&measurement->feature_usage, feature_use);
+  evel_arena_list_push(measurement->header.arena,
+                       &measurement->feature_usage,
+                       feature_use);
 
   EVEL_EXIT();
 }
@@ -1664,12 +1880,14 @@ void evel_measurement_custom_measurement_add(EVENT_MEASUREMENT * measurement,
   /***************************************************************************/
   EVEL_DEBUG("Adding Measurement Group=%s Name=%s Value=%s",
               group, name, value);
-  custom_measurement = malloc(sizeof(CUSTOM_MEASUREMENT));
+  custom_measurement = evel_arena_alloc(measurement->header.arena,
+                                        sizeof(CUSTOM_MEASUREMENT));
   assert(custom_measurement != NULL);
   memset(custom_measurement, 0, sizeof(CUSTOM_MEASUREMENT));
-  custom_measurement->name = strdup(name);
+  custom_measurement->name = evel_arena_strdup(measurement->header.arena, name);
   assert(custom_measurement->name != NULL);
-  custom_measurement->value = strdup(value);
+  custom_measurement->value = evel_arena_strdup(measurement->header.arena,
+                                                value);
   assert(custom_measurement->value != NULL);
 
   /***************************************************************************/
@@ -1696,19 +1914,25 @@ void evel_measurement_custom_measurement_add(EVENT_MEASUREMENT * measurement,
   if (item == NULL)
   {
     EVEL_DEBUG("Creating new Measurement Group");
-    measurement_group = malloc(sizeof(MEASUREMENT_GROUP));
+    measurement_group = evel_arena_alloc(measurement->header.arena,
+                                         sizeof(MEASUREMENT_GROUP));
     assert(measurement_group != NULL);
     memset(measurement_group, 0, sizeof(MEASUREMENT_GROUP));
-    measurement_group->name = strdup(group);
+    measurement_group->name = evel_arena_strdup(measurement->header.arena,
+                                                group);
     assert(measurement_group->name != NULL);
     dlist_initialize(&measurement_group->measurements);
-    dlist_push_last(&measurement->additional_measurements, measurement_group);
+    evel_arena_list_push(measurement->header.arena,
+                         &measurement->additional_measurements,
+                         measurement_group);
   }
 
   /***************************************************************************/
   /* If we didn't have the group already, create it.                         */
   /***************************************************************************/
-  dlist_push_last(&measurement_group->measurements, custom_measurement);
+  evel_arena_list_push(measurement->header.arena,
+                       &measurement_group->measurements,
+                       custom_measurement);
 
   EVEL_EXIT();
 }
@@ -1743,14 +1967,17 @@ void evel_measurement_codec_use_add(EVENT_MEASUREMENT * measurement,
   /* Allocate a container for the value and push onto the list.              */
   /***************************************************************************/
   EVEL_DEBUG("Adding Codec=%s Use=%d", codec, utilization);
-  codec_use = malloc(sizeof(MEASUREMENT_CODEC_USE));
+  codec_use = evel_arena_alloc(measurement->header.arena,
+                               sizeof(MEASUREMENT_CODEC_USE));
   assert(codec_use != NULL);
   memset(codec_use, 0, sizeof(MEASUREMENT_CODEC_USE));
-  codec_use->codec_id = strdup(codec);
+  codec_use->codec_id = evel_arena_strdup(measurement->header.arena, codec);
   assert(codec_use->codec_id != NULL);
   codec_use->number_in_use = utilization;
 
-  dlist_push_last(&measurement->codec_usage, codec_use);
+  evel_arena_list_push(measurement->header.arena,
+                       &measurement->codec_usage,
+                       codec_use);
 
   EVEL_EXIT();
 }
@@ -1927,7 +2154,18 @@ void evel_meas_latency_bucket_add(EVENT_MEASUREMENT * const measurement,
   assert(measurement != NULL);
   assert(measurement->header.event_domain == EVEL_DOMAIN_MEASUREMENT);
   assert(bucket != NULL);
-  dlist_push_last(&measurement->latency_distribution, bucket);
+
+  /***************************************************************************/
+  /* The bucket was allocated from the heap, so if the measurement has an    */
+  /* arena it must free the bucket along with everything else.               */
+  /***************************************************************************/
+  if (measurement->header.arena != NULL)
+  {
+    evel_arena_adopt(measurement->header.arena, free, bucket);
+  }
+  evel_arena_list_push(measurement->header.arena,
+                       &measurement->latency_distribution,
+                       bucket);
 
   EVEL_EXIT();
 }
@@ -2004,34 +2242,7 @@ MEASUREMENT_VNIC_PERFORMANCE * evel_measurement_new_vnic_performance(char * cons
   /***************************************************************************/
   /* Initialize Optional Parameters.                                         */
   /***************************************************************************/
-  evel_init_option_double(&vnic_performance-> recvd_bcast_packets_acc);
-  evel_init_option_double(&vnic_performance-> recvd_bcast_packets_delta);
-  evel_init_option_double(&vnic_performance-> recvd_discarded_packets_acc);
-  evel_init_option_double(&vnic_performance-> recvd_discarded_packets_delta);
-  evel_init_option_double(&vnic_performance-> recvd_error_packets_acc);
-  evel_init_option_double(&vnic_performance-> recvd_error_packets_delta);
-  evel_init_option_double(&vnic_performance-> recvd_mcast_packets_acc);
-  evel_init_option_double(&vnic_performance-> recvd_mcast_packets_delta);
-  evel_init_option_double(&vnic_performance-> recvd_octets_acc);
-  evel_init_option_double(&vnic_performance-> recvd_octets_delta);
-  evel_init_option_double(&vnic_performance-> recvd_total_packets_acc);
-  evel_init_option_double(&vnic_performance-> recvd_total_packets_delta);
-  evel_init_option_double(&vnic_performance-> recvd_ucast_packets_acc);
-  evel_init_option_double(&vnic_performance-> recvd_ucast_packets_delta);
-  evel_init_option_double(&vnic_performance-> tx_bcast_packets_acc);
-  evel_init_option_double(&vnic_performance-> tx_bcast_packets_delta);
-  evel_init_option_double(&vnic_performance-> tx_discarded_packets_acc);
-  evel_init_option_double(&vnic_performance-> tx_discarded_packets_delta);
-  evel_init_option_double(&vnic_performance-> tx_error_packets_acc);
-  evel_init_option_double(&vnic_performance-> tx_error_packets_delta);
-  evel_init_option_double(&vnic_performance-> tx_mcast_packets_acc);
-  evel_init_option_double(&vnic_performance-> tx_mcast_packets_delta);
-  evel_init_option_double(&vnic_performance-> tx_octets_acc);
-  evel_init_option_double(&vnic_performance-> tx_octets_delta);
-  evel_init_option_double(&vnic_performance-> tx_total_packets_acc);
-  evel_init_option_double(&vnic_performance-> tx_total_packets_delta);
-  evel_init_option_double(&vnic_performance-> tx_ucast_packets_acc);
-  evel_init_option_double(&vnic_performance-> tx_ucast_packets_delta);
+  vnic_performance->present = 0;
 
   EVEL_EXIT();
 
@@ -2068,6 +2279,18 @@ void evel_measurement_free_vnic_performance(MEASUREMENT_VNIC_PERFORMANCE * const
   EVEL_EXIT();
 }
 
+/**************************************************************************//**
+ * Free a vNIC Use adopted by the arena of a Measurement, including the vNIC
+ * Use itself.
+ *
+ * @param vnic_performance  Pointer to the ::MEASUREMENT_VNIC_PERFORMANCE.
+ *****************************************************************************/
+static void evel_free_adopted_vnic_performance(void * vnic_performance)
+{
+  evel_measurement_free_vnic_performance(vnic_performance);
+  free(vnic_performance);
+}
+
 /**************************************************************************//**
  * Set the Accumulated Broadcast Packets Received in measurement interval
  * property of the vNIC performance.
@@ -2089,9 +2312,10 @@ void evel_vnic_performance_rx_bcast_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE * c
   /***************************************************************************/
   assert(recvd_bcast_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_bcast_packets_acc,
-                      recvd_bcast_packets_acc,
-                      "Broadcast Packets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_BROADCAST_PACKETS_ACCUMULATED,
+                         recvd_bcast_packets_acc,
+                         "Broadcast Packets accumulated");
 
   EVEL_EXIT();
 }
@@ -2117,9 +2341,10 @@ void evel_vnic_performance_rx_bcast_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(recvd_bcast_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_bcast_packets_delta,
-                      recvd_bcast_packets_delta,
-                      "Delta Broadcast Packets recieved");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_BROADCAST_PACKETS_DELTA,
+                         recvd_bcast_packets_delta,
+                         "Delta Broadcast Packets recieved");
 
   EVEL_EXIT();
 }
@@ -2146,9 +2371,10 @@ void evel_vnic_performance_rx_discard_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(recvd_discard_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_discarded_packets_acc,
-                      recvd_discard_packets_acc,
-                      "Discarded Packets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_DISCARDED_PACKETS_ACCUMULATED,
+                         recvd_discard_packets_acc,
+                         "Discarded Packets accumulated");
 
   EVEL_EXIT();
 }
@@ -2174,9 +2400,10 @@ void evel_vnic_performance_rx_discard_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE
   /***************************************************************************/
   assert(recvd_discard_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_discarded_packets_delta,
-                      recvd_discard_packets_delta,
-                      "Delta Discarded Packets recieved");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_DISCARDED_PACKETS_DELTA,
+                         recvd_discard_packets_delta,
+                         "Delta Discarded Packets recieved");
 
   EVEL_EXIT();
 }
@@ -2203,9 +2430,10 @@ void evel_vnic_performance_rx_error_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE * c
   /***************************************************************************/
   assert(recvd_error_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_error_packets_acc,
-                      recvd_error_packets_acc,
-                      "Error Packets received accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_ERROR_PACKETS_ACCUMULATED,
+                         recvd_error_packets_acc,
+                         "Error Packets received accumulated");
 
   EVEL_EXIT();
 }
@@ -2231,9 +2459,10 @@ void evel_vnic_performance_rx_error_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(recvd_error_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_error_packets_delta,
-                      recvd_error_packets_delta,
-                      "Delta Error Packets recieved");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_ERROR_PACKETS_DELTA,
+                         recvd_error_packets_delta,
+                         "Delta Error Packets recieved");
 
   EVEL_EXIT();
 }
@@ -2259,9 +2488,10 @@ void evel_vnic_performance_rx_mcast_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE * c
   /***************************************************************************/
   assert(recvd_mcast_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_mcast_packets_acc,
-                      recvd_mcast_packets_acc,
-                      "Multicast Packets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_MULTICAST_PACKETS_ACCUMULATED,
+                         recvd_mcast_packets_acc,
+                         "Multicast Packets accumulated");
 
   EVEL_EXIT();
 }
@@ -2287,9 +2517,10 @@ void evel_vnic_performance_rx_mcast_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(recvd_mcast_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_mcast_packets_delta,
-                      recvd_mcast_packets_delta,
-                      "Delta Multicast Packets recieved");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_MULTICAST_PACKETS_DELTA,
+                         recvd_mcast_packets_delta,
+                         "Delta Multicast Packets recieved");
 
   EVEL_EXIT();
 }
@@ -2315,9 +2546,9 @@ void evel_vnic_performance_rx_octets_acc_set(MEASUREMENT_VNIC_PERFORMANCE * cons
   /***************************************************************************/
   assert(recvd_octets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_octets_acc,
-                      recvd_octets_acc,
-                      "Octets received accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_OCTETS_ACCUMULATED,
+                         recvd_octets_acc, "Octets received accumulated");
 
   EVEL_EXIT();
 }
@@ -2343,9 +2574,9 @@ void evel_vnic_performance_rx_octets_delta_set(MEASUREMENT_VNIC_PERFORMANCE * co
   /***************************************************************************/
   assert(recvd_octets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_octets_delta,
-                      recvd_octets_delta,
-                      "Delta Octets recieved");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_OCTETS_DELTA, recvd_octets_delta,
+                         "Delta Octets recieved");
 
   EVEL_EXIT();
 }
@@ -2371,9 +2602,9 @@ void evel_vnic_performance_rx_total_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE * c
   /***************************************************************************/
   assert(recvd_total_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_total_packets_acc,
-                      recvd_total_packets_acc,
-                      "Total Packets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_TOTAL_PACKETS_ACCUMULATED,
+                         recvd_total_packets_acc, "Total Packets accumulated");
 
   EVEL_EXIT();
 }
@@ -2399,9 +2630,10 @@ void evel_vnic_performance_rx_total_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(recvd_total_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_total_packets_delta,
-                      recvd_total_packets_delta,
-                      "Delta Total Packets recieved");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_TOTAL_PACKETS_DELTA,
+                         recvd_total_packets_delta,
+                         "Delta Total Packets recieved");
 
   EVEL_EXIT();
 }
@@ -2427,9 +2659,10 @@ void evel_vnic_performance_rx_ucast_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE * c
   /***************************************************************************/
   assert(recvd_ucast_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_ucast_packets_acc,
-                      recvd_ucast_packets_acc,
-                      "Unicast Packets received accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_UNICAST_PACKETS_ACCUMULATED,
+                         recvd_ucast_packets_acc,
+                         "Unicast Packets received accumulated");
 
   EVEL_EXIT();
 }
@@ -2455,9 +2688,10 @@ void evel_vnic_performance_rx_ucast_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(recvd_ucast_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->recvd_ucast_packets_delta,
-                      recvd_ucast_packets_delta,
-                      "Delta Unicast packets recieved");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_RECEIVED_UNICAST_PACKETS_DELTA,
+                         recvd_ucast_packets_delta,
+                         "Delta Unicast packets recieved");
 
   EVEL_EXIT();
 }
@@ -2483,9 +2717,10 @@ void evel_vnic_performance_tx_bcast_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE * c
   /***************************************************************************/
   assert(tx_bcast_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_bcast_packets_acc,
-                      tx_bcast_packets_acc,
-                      "Transmitted Broadcast Packets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_BROADCAST_PACKETS_ACCUMULATED,
+                         tx_bcast_packets_acc,
+                         "Transmitted Broadcast Packets accumulated");
 
   EVEL_EXIT();
 }
@@ -2511,9 +2746,10 @@ void evel_vnic_performance_tx_bcast_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(tx_bcast_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_bcast_packets_delta,
-                      tx_bcast_packets_delta,
-                      "Delta Transmitted Broadcast packets ");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_BROADCAST_PACKETS_DELTA,
+                         tx_bcast_packets_delta,
+                         "Delta Transmitted Broadcast packets ");
 
   EVEL_EXIT();
 }
@@ -2539,9 +2775,10 @@ void evel_vnic_performance_tx_discarded_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE
   /***************************************************************************/
   assert(tx_discarded_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_discarded_packets_acc,
-                      tx_discarded_packets_acc,
-                      "Transmitted Discarded Packets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_DISCARDED_PACKETS_ACCUMULATED,
+                         tx_discarded_packets_acc,
+                         "Transmitted Discarded Packets accumulated");
 
   EVEL_EXIT();
 }
@@ -2567,9 +2804,10 @@ void evel_vnic_performance_tx_discarded_pkt_delta_set(MEASUREMENT_VNIC_PERFORMAN
   /***************************************************************************/
   assert(tx_discarded_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_discarded_packets_delta,
-                      tx_discarded_packets_delta,
-                      "Delta Transmitted Discarded packets ");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_DISCARDED_PACKETS_DELTA,
+                         tx_discarded_packets_delta,
+                         "Delta Transmitted Discarded packets ");
 
   EVEL_EXIT();
 }
@@ -2595,9 +2833,10 @@ void evel_vnic_performance_tx_error_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE * c
   /***************************************************************************/
   assert(tx_error_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_error_packets_acc,
-                      tx_error_packets_acc,
-                      "Transmitted Error Packets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_ERROR_PACKETS_ACCUMULATED,
+                         tx_error_packets_acc,
+                         "Transmitted Error Packets accumulated");
 
   EVEL_EXIT();
 }
@@ -2623,9 +2862,10 @@ void evel_vnic_performance_tx_error_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(tx_error_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_error_packets_delta,
-                      tx_error_packets_delta,
-                      "Delta Transmitted Error packets ");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_ERROR_PACKETS_DELTA,
+                         tx_error_packets_delta,
+                         "Delta Transmitted Error packets ");
 
   EVEL_EXIT();
 }
@@ -2651,9 +2891,10 @@ void evel_vnic_performance_tx_mcast_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE * c
   /***************************************************************************/
   assert(tx_mcast_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_mcast_packets_acc,
-                      tx_mcast_packets_acc,
-                      "Transmitted Multicast Packets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_MULTICAST_PACKETS_ACCUMULATED,
+                         tx_mcast_packets_acc,
+                         "Transmitted Multicast Packets accumulated");
 
   EVEL_EXIT();
 }
@@ -2679,9 +2920,10 @@ void evel_vnic_performance_tx_mcast_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(tx_mcast_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_mcast_packets_delta,
-                      tx_mcast_packets_delta,
-                      "Delta Transmitted Multicast packets ");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_MULTICAST_PACKETS_DELTA,
+                         tx_mcast_packets_delta,
+                         "Delta Transmitted Multicast packets ");
 
   EVEL_EXIT();
 }
@@ -2707,9 +2949,9 @@ void evel_vnic_performance_tx_octets_acc_set(MEASUREMENT_VNIC_PERFORMANCE * cons
   /***************************************************************************/
   assert(tx_octets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_octets_acc,
-                      tx_octets_acc,
-                      "Transmitted Octets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_OCTETS_ACCUMULATED,
+                         tx_octets_acc, "Transmitted Octets accumulated");
 
   EVEL_EXIT();
 }
@@ -2735,9 +2977,9 @@ void evel_vnic_performance_tx_octets_delta_set(MEASUREMENT_VNIC_PERFORMANCE * co
   /***************************************************************************/
   assert(tx_octets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_octets_delta,
-                      tx_octets_delta,
-                      "Delta Transmitted Octets ");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_OCTETS_DELTA, tx_octets_delta,
+                         "Delta Transmitted Octets ");
 
   EVEL_EXIT();
 }
@@ -2764,9 +3006,10 @@ void evel_vnic_performance_tx_total_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE * c
   /***************************************************************************/
   assert(tx_total_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_total_packets_acc,
-                      tx_total_packets_acc,
-                      "Transmitted Total Packets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_TOTAL_PACKETS_ACCUMULATED,
+                         tx_total_packets_acc,
+                         "Transmitted Total Packets accumulated");
 
   EVEL_EXIT();
 }
@@ -2792,9 +3035,10 @@ void evel_vnic_performance_tx_total_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(tx_total_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_total_packets_delta,
-                      tx_total_packets_delta,
-                      "Delta Transmitted Total Packets ");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_TOTAL_PACKETS_DELTA,
+                         tx_total_packets_delta,
+                         "Delta Transmitted Total Packets ");
 
   EVEL_EXIT();
 }
@@ -2821,9 +3065,10 @@ void evel_vnic_performance_tx_ucast_pkt_acc_set(MEASUREMENT_VNIC_PERFORMANCE * c
   /***************************************************************************/
   assert(tx_ucast_packets_acc >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_ucast_packets_acc,
-                      tx_ucast_packets_acc,
-                      "Transmitted Unicast Packets accumulated");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_UNICAST_PACKETS_ACCUMULATED,
+                         tx_ucast_packets_acc,
+                         "Transmitted Unicast Packets accumulated");
 
   EVEL_EXIT();
 }
@@ -2849,9 +3094,10 @@ void evel_vnic_performance_tx_ucast_pkt_delta_set(MEASUREMENT_VNIC_PERFORMANCE *
   /***************************************************************************/
   assert(tx_ucast_packets_delta >= 0.0);
 
-  evel_set_option_double(&vnic_performance->tx_ucast_packets_delta,
-                      tx_ucast_packets_delta,
-                      "Delta Transmitted Unicast Packets ");
+  evel_set_packed_double(&vnic_performance->present, vnic_performance->values,
+                         EVEL_VNIC_TRANSMITTED_UNICAST_PACKETS_DELTA,
+                         tx_ucast_packets_delta,
+                         "Delta Transmitted Unicast Packets ");
 
   EVEL_EXIT();
 }
@@ -2875,7 +3121,19 @@ void evel_meas_vnic_performance_add(EVENT_MEASUREMENT * const measurement,
   assert(measurement->header.event_domain == EVEL_DOMAIN_MEASUREMENT);
   assert(vnic_performance != NULL);
 
-  dlist_push_last(&measurement->vnic_usage, vnic_performance);
+  /***************************************************************************/
+  /* The vNIC Use was allocated from the heap, so if the measurement has an  */
+  /* arena it must free the vNIC Use along with everything else.             */
+  /***************************************************************************/
+  if (measurement->header.arena != NULL)
+  {
+    evel_arena_adopt(measurement->header.arena,
+                     evel_free_adopted_vnic_performance,
+                     vnic_performance);
+  }
+  evel_arena_list_push(measurement->header.arena,
+                       &measurement->vnic_usage,
+                       vnic_performance);
 
   EVEL_EXIT();
 }
@@ -3025,22 +3283,21 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
   assert(event->header.event_domain == EVEL_DOMAIN_MEASUREMENT);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "measurementsForVfScalingFields");
+  evel_json_open_named_object(jbuf,
+                              EVEL_KEY_MEASUREMENTS_FOR_VF_SCALING_FIELDS);
 
   /***************************************************************************/
   /* Mandatory fields.                                                       */
   /***************************************************************************/
-  evel_enc_kv_int(jbuf, "measurementInterval", event->measurement_interval);
+  evel_enc_kv_int(
+    jbuf, EVEL_KEY_MEASUREMENT_INTERVAL, event->measurement_interval);
 
   /***************************************************************************/
   /* Optional fields.                                                        */
   /***************************************************************************/
   // additional fields
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "additionalFields"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_ADDITIONAL_FIELDS))
   {
-    bool item_added = false;
-
     addl_info_item = dlist_get_first(&event->additional_info);
     while (addl_info_item != NULL)
     {
@@ -3048,40 +3305,30 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
       assert(addl_info != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "additionalFields",
+                                          EVEL_KEY_ADDITIONAL_FIELDS,
                                           addl_info->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", addl_info->name);
-        evel_enc_kv_string(jbuf, "value", addl_info->value);
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, addl_info->name);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, addl_info->value);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       addl_info_item = dlist_get_next(addl_info_item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   // TBD additional json objects
-  evel_enc_kv_opt_int(jbuf, "concurrentSessions", &event->concurrent_sessions);
-  evel_enc_kv_opt_int(jbuf, "configuredEntities", &event->configured_entities);
+  evel_enc_kv_opt_int(
+    jbuf, EVEL_KEY_CONCURRENT_SESSIONS, &event->concurrent_sessions);
+  evel_enc_kv_opt_int(
+    jbuf, EVEL_KEY_CONFIGURED_ENTITIES, &event->configured_entities);
 
   /***************************************************************************/
   /* CPU Use list.                                                           */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "cpuUsageArray"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_CPU_USAGE_ARRAY))
   {
-    bool item_added = false;
-
     item = dlist_get_first(&event->cpu_usage);
     while (item != NULL)
     {
@@ -3089,45 +3336,35 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
       assert(cpu_use != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "cpuUsageArray",
+                                          EVEL_KEY_CPU_USAGE_ARRAY,
                                           cpu_use->id))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "cpuIdentifier", cpu_use->id);
-        evel_enc_kv_opt_double(jbuf, "cpuIdle", &cpu_use->idle);
-        evel_enc_kv_opt_double(jbuf, "cpuUsageInterrupt", &cpu_use->intrpt);
-        evel_enc_kv_opt_double(jbuf, "cpuUsageNice", &cpu_use->nice);
-        evel_enc_kv_opt_double(jbuf, "cpuUsageSoftIrq", &cpu_use->softirq);
-        evel_enc_kv_opt_double(jbuf, "cpuUsageSteal", &cpu_use->steal);
-        evel_enc_kv_opt_double(jbuf, "cpuUsageSystem", &cpu_use->sys);
-        evel_enc_kv_opt_double(jbuf, "cpuUsageUser", &cpu_use->user);
-        evel_enc_kv_opt_double(jbuf, "cpuWait", &cpu_use->wait);
-        evel_enc_kv_double(jbuf, "percentUsage",cpu_use->usage);
+        evel_enc_kv_string(jbuf, EVEL_KEY_CPU_IDENTIFIER, cpu_use->id);
+        evel_enc_kv_opt_double(jbuf, EVEL_KEY_CPU_IDLE, &cpu_use->idle);
+        evel_enc_kv_opt_double(
+          jbuf, EVEL_KEY_CPU_USAGE_INTERRUPT, &cpu_use->intrpt);
+        evel_enc_kv_opt_double(jbuf, EVEL_KEY_CPU_USAGE_NICE, &cpu_use->nice);
+        evel_enc_kv_opt_double(
+          jbuf, EVEL_KEY_CPU_USAGE_SOFT_IRQ, &cpu_use->softirq);
+        evel_enc_kv_opt_double(jbuf, EVEL_KEY_CPU_USAGE_STEAL, &cpu_use->steal);
+        evel_enc_kv_opt_double(jbuf, EVEL_KEY_CPU_USAGE_SYSTEM, &cpu_use->sys);
+        evel_enc_kv_opt_double(jbuf, EVEL_KEY_CPU_USAGE_USER, &cpu_use->user);
+        evel_enc_kv_opt_double(jbuf, EVEL_KEY_CPU_WAIT, &cpu_use->wait);
+        evel_enc_kv_double(jbuf, EVEL_KEY_PERCENT_USAGE,cpu_use->usage);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       item = dlist_get_next(item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
 
   /***************************************************************************/
   /* Disk Use list.                                                           */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "diskUsageArray"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_DISK_USAGE_ARRAY))
   {
-    bool item_added = false;
-
     item = dlist_get_first(&event->disk_usage);
     while (item != NULL)
     {
@@ -3135,75 +3372,25 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
       assert(disk_use != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "diskUsageArray",
+                                          EVEL_KEY_DISK_USAGE_ARRAY,
                                           disk_use->id))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "diskIdentifier", disk_use->id);
-        evel_enc_kv_opt_double(jbuf, "diskIoTimeAvg", &disk_use->iotimeavg);
-        evel_enc_kv_opt_double(jbuf, "diskIoTimeLast", &disk_use->iotimelast);
-        evel_enc_kv_opt_double(jbuf, "diskIoTimeMax", &disk_use->iotimemax);
-        evel_enc_kv_opt_double(jbuf, "diskIoTimeMin", &disk_use->iotimemin);
-        evel_enc_kv_opt_double(jbuf, "diskMergedReadAvg", &disk_use->mergereadavg);
-        evel_enc_kv_opt_double(jbuf, "diskMergedReadLast", &disk_use->mergereadlast);
-        evel_enc_kv_opt_double(jbuf, "diskMergedReadMax", &disk_use->mergereadmax);
-        evel_enc_kv_opt_double(jbuf, "diskMergedReadMin", &disk_use->mergereadmin);
-        evel_enc_kv_opt_double(jbuf, "diskMergedWriteAvg", &disk_use->mergewriteavg);
-        evel_enc_kv_opt_double(jbuf, "diskMergedWriteLast", &disk_use->mergewritelast);
-        evel_enc_kv_opt_double(jbuf, "diskMergedWriteMax", &disk_use->mergewritemax);
-        evel_enc_kv_opt_double(jbuf, "diskMergedWriteMin", &disk_use->mergewritemin);
-        evel_enc_kv_opt_double(jbuf, "diskOctetsReadAvg", &disk_use->octetsreadavg);
-        evel_enc_kv_opt_double(jbuf, "diskOctetsReadLast", &disk_use->octetsreadlast);
-        evel_enc_kv_opt_double(jbuf, "diskOctetsReadMax", &disk_use->octetsreadmax);
-        evel_enc_kv_opt_double(jbuf, "diskOctetsReadMin", &disk_use->octetsreadmin);
-        evel_enc_kv_opt_double(jbuf, "diskOctetsWriteAvg", &disk_use->octetswriteavg);
-        evel_enc_kv_opt_double(jbuf, "diskOctetsWriteLast", &disk_use->octetswritelast);
-        evel_enc_kv_opt_double(jbuf, "diskOctetsWriteMax", &disk_use->octetswritemax);
-        evel_enc_kv_opt_double(jbuf, "diskOctetsWriteMin", &disk_use->octetswritemin);
-        evel_enc_kv_opt_double(jbuf, "diskOpsReadAvg", &disk_use->opsreadavg);
-        evel_enc_kv_opt_double(jbuf, "diskOpsReadLast", &disk_use->opsreadlast);
-        evel_enc_kv_opt_double(jbuf, "diskOpsReadMax", &disk_use->opsreadmax);
-        evel_enc_kv_opt_double(jbuf, "diskOpsReadMin", &disk_use->opsreadmin);
-        evel_enc_kv_opt_double(jbuf, "diskOpsWriteAvg", &disk_use->opswriteavg);
-        evel_enc_kv_opt_double(jbuf, "diskOpsWriteLast", &disk_use->opswritelast);
-        evel_enc_kv_opt_double(jbuf, "diskOpsWriteMax", &disk_use->opswritemax);
-        evel_enc_kv_opt_double(jbuf, "diskOpsWriteMin", &disk_use->opswritemin);
-        evel_enc_kv_opt_double(jbuf, "diskPendingOperationsAvg", &disk_use->pendingopsavg);
-        evel_enc_kv_opt_double(jbuf, "diskPendingOperationsLast", &disk_use->pendingopslast);
-        evel_enc_kv_opt_double(jbuf, "diskPendingOperationsMax", &disk_use->pendingopsmax);
-        evel_enc_kv_opt_double(jbuf, "diskPendingOperationsMin", &disk_use->pendingopsmin);
-        evel_enc_kv_opt_double(jbuf, "diskTimeReadAvg", &disk_use->timereadavg);
-        evel_enc_kv_opt_double(jbuf, "diskTimeReadLast", &disk_use->timereadlast);
-        evel_enc_kv_opt_double(jbuf, "diskTimeReadMax", &disk_use->timereadmax);
-        evel_enc_kv_opt_double(jbuf, "diskTimeReadMin", &disk_use->timereadmin);
-        evel_enc_kv_opt_double(jbuf, "diskTimeWriteAvg", &disk_use->timewriteavg);
-        evel_enc_kv_opt_double(jbuf, "diskTimeWriteLast", &disk_use->timewritelast);
-        evel_enc_kv_opt_double(jbuf, "diskTimeWriteMax", &disk_use->timewritemax);
-        evel_enc_kv_opt_double(jbuf, "diskTimeWriteMin", &disk_use->timewritemin);
+        evel_enc_kv_string(jbuf, EVEL_KEY_DISK_IDENTIFIER, disk_use->id);
+        evel_enc_kv_packed_doubles(jbuf, evel_disk_keys, disk_use->present,
+                                   disk_use->values);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       item = dlist_get_next(item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
   /* Filesystem Usage list.                                                  */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "filesystemUsageArray"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_FILESYSTEM_USAGE_ARRAY))
   {
-    bool item_added = false;
-
     item = dlist_get_first(&event->filesystem_usage);
     while (item != NULL)
     {
@@ -3211,33 +3398,27 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
       assert(fsys_use != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "filesystemUsageArray",
+                                          EVEL_KEY_FILESYSTEM_USAGE_ARRAY,
                                           fsys_use->filesystem_name))
       {
         evel_json_open_object(jbuf);
         evel_enc_kv_double(
-          jbuf, "blockConfigured", fsys_use->block_configured);
-        evel_enc_kv_int(jbuf, "blockIops", fsys_use->block_iops);
-        evel_enc_kv_double(jbuf, "blockUsed", fsys_use->block_used);
+          jbuf, EVEL_KEY_BLOCK_CONFIGURED, fsys_use->block_configured);
+        evel_enc_kv_int(jbuf, EVEL_KEY_BLOCK_IOPS, fsys_use->block_iops);
+        evel_enc_kv_double(jbuf, EVEL_KEY_BLOCK_USED, fsys_use->block_used);
+        evel_enc_kv_double(
+          jbuf, EVEL_KEY_EPHEMERAL_CONFIGURED, fsys_use->ephemeral_configured);
+        evel_enc_kv_int(
+          jbuf, EVEL_KEY_EPHEMERAL_IOPS, fsys_use->ephemeral_iops);
         evel_enc_kv_double(
-          jbuf, "ephemeralConfigured", fsys_use->ephemeral_configured);
-        evel_enc_kv_int(jbuf, "ephemeralIops", fsys_use->ephemeral_iops);
-        evel_enc_kv_double(jbuf, "ephemeralUsed", fsys_use->ephemeral_used);
-        evel_enc_kv_string(jbuf, "filesystemName", fsys_use->filesystem_name);
+          jbuf, EVEL_KEY_EPHEMERAL_USED, fsys_use->ephemeral_used);
+        evel_enc_kv_string(
+          jbuf, EVEL_KEY_FILESYSTEM_NAME, fsys_use->filesystem_name);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       item = dlist_get_next(item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
@@ -3245,7 +3426,7 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
   /***************************************************************************/
   item = dlist_get_first(&event->latency_distribution);
   if ((item != NULL) &&
-      evel_json_open_opt_named_list(jbuf, "latencyDistribution"))
+      evel_json_open_opt_named_list(jbuf, EVEL_KEY_LATENCY_DISTRIBUTION))
   {
     while (item != NULL)
     {
@@ -3254,10 +3435,10 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
 
       evel_json_open_object(jbuf);
       evel_enc_kv_opt_double(
-        jbuf, "lowEndOfLatencyBucket", &bucket->low_end);
+        jbuf, EVEL_KEY_LOW_END_OF_LATENCY_BUCKET, &bucket->low_end);
       evel_enc_kv_opt_double(
-        jbuf, "highEndOfLatencyBucket", &bucket->high_end);
-      evel_enc_kv_int(jbuf, "countsInTheBucket", bucket->count);
+        jbuf, EVEL_KEY_HIGH_END_OF_LATENCY_BUCKET, &bucket->high_end);
+      evel_enc_kv_int(jbuf, EVEL_KEY_COUNTS_IN_THE_BUCKET, bucket->count);
       evel_json_close_object(jbuf);
       item = dlist_get_next(item);
     }
@@ -3265,17 +3446,14 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
   }
 
   evel_enc_kv_opt_double(
-    jbuf, "meanRequestLatency", &event->mean_request_latency);
-  evel_enc_kv_opt_int(jbuf, "requestRate", &event->request_rate);
+    jbuf, EVEL_KEY_MEAN_REQUEST_LATENCY, &event->mean_request_latency);
+  evel_enc_kv_opt_int(jbuf, EVEL_KEY_REQUEST_RATE, &event->request_rate);
 
   /***************************************************************************/
   /* vNIC Usage TBD Performance array                          */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "vNicUsageArray"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_V_NIC_USAGE_ARRAY))
   {
-    bool item_added = false;
-
     item = dlist_get_first(&event->vnic_usage);
     while (item != NULL)
     {
@@ -3283,7 +3461,7 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
       assert(vnic_performance != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "vNicPerformanceArray",
+                                          EVEL_KEY_V_NIC_PERFORMANCE_ARRAY,
                                           vnic_performance->vnic_id))
       {
         evel_json_open_object(jbuf);
@@ -3291,95 +3469,31 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
         /*********************************************************************/
         /* Optional fields.                                                  */
         /*********************************************************************/
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedBroadcastPacketsAccumulated", &vnic_performance->recvd_bcast_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedBroadcastPacketsDelta", &vnic_performance->recvd_bcast_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedDiscardedPacketsAccumulated", &vnic_performance->recvd_discarded_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedDiscardedPacketsDelta", &vnic_performance->recvd_discarded_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedErrorPacketsAccumulated", &vnic_performance->recvd_error_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedErrorPacketsDelta", &vnic_performance->recvd_error_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedMulticastPacketsAccumulated", &vnic_performance->recvd_mcast_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedMulticastPacketsDelta", &vnic_performance->recvd_mcast_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedOctetsAccumulated", &vnic_performance->recvd_octets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedOctetsDelta", &vnic_performance->recvd_octets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedTotalPacketsAccumulated", &vnic_performance->recvd_total_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedTotalPacketsDelta", &vnic_performance->recvd_total_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedUnicastPacketsAccumulated", &vnic_performance->recvd_ucast_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "receivedUnicastPacketsDelta", &vnic_performance->recvd_ucast_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedBroadcastPacketsAccumulated", &vnic_performance->tx_bcast_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedBroadcastPacketsDelta", &vnic_performance->tx_bcast_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedDiscardedPacketsAccumulated", &vnic_performance->tx_discarded_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedDiscardedPacketsDelta", &vnic_performance->tx_discarded_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedErrorPacketsAccumulated", &vnic_performance->tx_error_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedErrorPacketsDelta", &vnic_performance->tx_error_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedMulticastPacketsAccumulated", &vnic_performance->tx_mcast_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedMulticastPacketsDelta", &vnic_performance->tx_mcast_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedOctetsAccumulated", &vnic_performance->tx_octets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedOctetsDelta", &vnic_performance->tx_octets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedTotalPacketsAccumulated", &vnic_performance->tx_total_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedTotalPacketsDelta", &vnic_performance->tx_total_packets_delta);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedUnicastPacketsAccumulated", &vnic_performance->tx_ucast_packets_acc);
-        evel_enc_kv_opt_double( jbuf,
-		 "transmittedUnicastPacketsDelta", &vnic_performance->tx_ucast_packets_delta);
+        evel_enc_kv_packed_doubles(jbuf, evel_vnic_keys,
+                                   vnic_performance->present,
+                                   vnic_performance->values);
 
         /*********************************************************************/
         /* Mandatory fields.                                                 */
         /*********************************************************************/
-        evel_enc_kv_string(jbuf, "valuesAreSuspect", vnic_performance->valuesaresuspect);
-        evel_enc_kv_string(jbuf, "vNicIdentifier", vnic_performance->vnic_id);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VALUES_ARE_SUSPECT, vnic_performance->valuesaresuspect);
+        evel_enc_kv_string(
+          jbuf, EVEL_KEY_V_NIC_IDENTIFIER, vnic_performance->vnic_id);
 
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       item = dlist_get_next(item);
     }
 
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
 
   /***************************************************************************/
   /* Memory Use list.                                                           */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "memoryUsageArray"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_MEMORY_USAGE_ARRAY))
   {
-    bool item_added = false;
-
     item = dlist_get_first(&event->mem_usage);
     while (item != NULL)
     {
@@ -3387,62 +3501,55 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
       assert(mem_use != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "memoryUsageArray",
+                                          EVEL_KEY_MEMORY_USAGE_ARRAY,
                                           mem_use->id))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_double(jbuf, "memoryBuffered", mem_use->membuffsz);
-        evel_enc_kv_opt_double(jbuf, "memoryCached", &mem_use->memcache);
-        evel_enc_kv_opt_double(jbuf, "memoryConfigured", &mem_use->memconfig);
-        evel_enc_kv_opt_double(jbuf, "memoryFree", &mem_use->memfree);
-        evel_enc_kv_opt_double(jbuf, "memorySlabRecl", &mem_use->slabrecl);
-        evel_enc_kv_opt_double(jbuf, "memorySlabUnrecl", &mem_use->slabunrecl);
-        evel_enc_kv_opt_double(jbuf, "memoryUsed", &mem_use->memused);
-        evel_enc_kv_string(jbuf, "vmIdentifier", mem_use->id);
+        evel_enc_kv_double(jbuf, EVEL_KEY_MEMORY_BUFFERED, mem_use->membuffsz);
+        evel_enc_kv_opt_double(
+          jbuf, EVEL_KEY_MEMORY_CACHED, &mem_use->memcache);
+        evel_enc_kv_opt_double(
+          jbuf, EVEL_KEY_MEMORY_CONFIGURED, &mem_use->memconfig);
+        evel_enc_kv_opt_double(jbuf, EVEL_KEY_MEMORY_FREE, &mem_use->memfree);
+        evel_enc_kv_opt_double(
+          jbuf, EVEL_KEY_MEMORY_SLAB_RECL, &mem_use->slabrecl);
+        evel_enc_kv_opt_double(
+          jbuf, EVEL_KEY_MEMORY_SLAB_UNRECL, &mem_use->slabunrecl);
+        evel_enc_kv_opt_double(jbuf, EVEL_KEY_MEMORY_USED, &mem_use->memused);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VM_IDENTIFIER, mem_use->id);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       item = dlist_get_next(item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
 
   evel_enc_kv_opt_int(
-    jbuf, "numberOfMediaPortsInUse", &event->media_ports_in_use);
+    jbuf, EVEL_KEY_NUMBER_OF_MEDIA_PORTS_IN_USE, &event->media_ports_in_use);
   evel_enc_kv_opt_int(
-    jbuf, "vnfcScalingMetric", &event->vnfc_scaling_metric);
+    jbuf, EVEL_KEY_VNFC_SCALING_METRIC, &event->vnfc_scaling_metric);
 
   /***************************************************************************/
   /* Errors list.                                                            */
   /***************************************************************************/
   if ((event->errors != NULL) &&
-      evel_json_open_opt_named_object(jbuf, "errors"))
+      evel_json_open_opt_named_object(jbuf, EVEL_KEY_ERRORS))
   {
     errors = event->errors;
-    evel_enc_kv_int(jbuf, "receiveDiscards", errors->receive_discards);
-    evel_enc_kv_int(jbuf, "receiveErrors", errors->receive_errors);
-    evel_enc_kv_int(jbuf, "transmitDiscards", errors->transmit_discards);
-    evel_enc_kv_int(jbuf, "transmitErrors", errors->transmit_errors);
+    evel_enc_kv_int(jbuf, EVEL_KEY_RECEIVE_DISCARDS, errors->receive_discards);
+    evel_enc_kv_int(jbuf, EVEL_KEY_RECEIVE_ERRORS, errors->receive_errors);
+    evel_enc_kv_int(
+      jbuf, EVEL_KEY_TRANSMIT_DISCARDS, errors->transmit_discards);
+    evel_enc_kv_int(jbuf, EVEL_KEY_TRANSMIT_ERRORS, errors->transmit_errors);
     evel_json_close_object(jbuf);
   }
 
   /***************************************************************************/
   /* Feature Utilization list.                                               */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "featureUsageArray"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_FEATURE_USAGE_ARRAY))
   {
-    bool item_added = false;
-
     item = dlist_get_first(&event->feature_usage);
     while (item != NULL)
     {
@@ -3450,37 +3557,26 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
       assert(feature_use != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "featureUsageArray",
+                                          EVEL_KEY_FEATURE_USAGE_ARRAY,
                                           feature_use->feature_id))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "featureIdentifier", feature_use->feature_id);
+        evel_enc_kv_string(
+          jbuf, EVEL_KEY_FEATURE_IDENTIFIER, feature_use->feature_id);
         evel_enc_kv_int(
-          jbuf, "featureUtilization", feature_use->feature_utilization);
+          jbuf, EVEL_KEY_FEATURE_UTILIZATION, feature_use->feature_utilization);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       item = dlist_get_next(item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
   /* Codec Utilization list.                                                 */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "codecUsageArray"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_CODEC_USAGE_ARRAY))
   {
-    bool item_added = false;
-
     item = dlist_get_first(&event->codec_usage);
     while (item != NULL)
     {
@@ -3488,36 +3584,25 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
       assert(codec_use != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "codecUsageArray",
+                                          EVEL_KEY_CODEC_USAGE_ARRAY,
                                           codec_use->codec_id))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "codecIdentifier", codec_use->codec_id);
-        evel_enc_kv_int(jbuf, "numberInUse", codec_use->number_in_use);
+        evel_enc_kv_string(
+          jbuf, EVEL_KEY_CODEC_IDENTIFIER, codec_use->codec_id);
+        evel_enc_kv_int(jbuf, EVEL_KEY_NUMBER_IN_USE, codec_use->number_in_use);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       item = dlist_get_next(item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
   /* Additional Measurement Groups list.                                     */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "additionalMeasurements"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_ADDITIONAL_MEASUREMENTS))
   {
-    bool item_added = false;
-
     item = dlist_get_first(&event->additional_measurements);
     while (item != NULL)
     {
@@ -3525,12 +3610,12 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
       assert(measurement_group != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "additionalMeasurements",
+                                          EVEL_KEY_ADDITIONAL_MEASUREMENTS,
                                           measurement_group->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", measurement_group->name);
-        evel_json_open_opt_named_list(jbuf, "measurements");
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, measurement_group->name);
+        evel_json_open_named_list(jbuf, EVEL_KEY_MEASUREMENTS);
 
         /*********************************************************************/
         /* Measurements list.                                                */
@@ -3542,26 +3627,17 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
           assert(custom_measurement != NULL);
 
           evel_json_open_object(jbuf);
-          evel_enc_kv_string(jbuf, "name", custom_measurement->name);
-          evel_enc_kv_string(jbuf, "value", custom_measurement->value);
+          evel_enc_kv_string(jbuf, EVEL_KEY_NAME, custom_measurement->name);
+          evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, custom_measurement->value);
           evel_json_close_object(jbuf);
           nested_item = dlist_get_next(nested_item);
         }
         evel_json_close_list(jbuf);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       item = dlist_get_next(item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
@@ -3569,7 +3645,7 @@ void evel_json_encode_measurement(EVEL_JSON_BUFFER * jbuf,
   /* closes the object, too.                                                 */
   /***************************************************************************/
   evel_enc_version(jbuf,
-                   "measurementsForVfScalingVersion",
+                   EVEL_KEY_MEASUREMENTS_FOR_VF_SCALING_VERSION,
                    event->major_version,
                    event->minor_version);
   evel_json_close_object(jbuf);
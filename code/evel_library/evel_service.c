@@ -1042,30 +1042,24 @@ void evel_json_encode_service(EVEL_JSON_BUFFER * const jbuf,
   assert(event->header.event_domain == EVEL_DOMAIN_SERVICE);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "serviceEventsFields");
+  evel_json_open_named_object(jbuf, EVEL_KEY_SERVICE_EVENTS_FIELDS);
 
   /***************************************************************************/
   /* Mandatory fields                                                        */
   /***************************************************************************/
   evel_json_encode_instance_id(jbuf, &event->instance_id);
   evel_enc_version(jbuf,
-                   "serviceEventsFieldsVersion",
+                   EVEL_KEY_SERVICE_EVENTS_FIELDS_VERSION,
                    event->major_version,
                    event->minor_version);
 
   /***************************************************************************/
   /* Optional fields                                                         */
   /***************************************************************************/
-  evel_enc_kv_opt_string(jbuf, "correlator", &event->correlator);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_CORRELATOR, &event->correlator);
 
-  /***************************************************************************/
-  /* Checkpoint, so that we can wind back if all fields are suppressed.      */
-  /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "additionalFields"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_ADDITIONAL_FIELDS))
   {
-    bool added = false;
-
     dlist_item = dlist_get_first(&event->additional_fields);
     while (dlist_item != NULL)
     {
@@ -1073,192 +1067,135 @@ void evel_json_encode_service(EVEL_JSON_BUFFER * const jbuf,
       assert(nv_pair != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "additionalFields",
+                                          EVEL_KEY_ADDITIONAL_FIELDS,
                                           nv_pair->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", nv_pair->name);
-        evel_enc_kv_string(jbuf, "value", nv_pair->value);
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, nv_pair->name);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, nv_pair->value);
         evel_json_close_object(jbuf);
-        added = true;
       }
       dlist_item = dlist_get_next(dlist_item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
   /* Optional fields within JSON equivalent object: codecSelected            */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_object(jbuf, "codecSelected"))
+  if (evel_json_open_opt_named_object(jbuf, EVEL_KEY_CODEC_SELECTED))
   {
-    bool added = false;
-    added |= evel_enc_kv_opt_string(jbuf,
-                                    "codec",
-                                    &event->codec);
+    evel_enc_kv_opt_string(jbuf,
+                           EVEL_KEY_CODEC,
+                           &event->codec);
     evel_json_close_object(jbuf);
-
-    /*************************************************************************/
-    /* If the object is empty, rewind to before we opened it.                */
-    /*************************************************************************/
-    if (!added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
   /* Optional fields within JSON equivalent object: codecSelectedTranscoding */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_object(jbuf, "codecSelectedTranscoding"))
+  if (evel_json_open_opt_named_object(jbuf,
+                                      EVEL_KEY_CODEC_SELECTED_TRANSCODING))
   {
-    bool added = false;
-    added |= evel_enc_kv_opt_string(jbuf,
-                                    "calleeSideCodec",
-                                    &event->callee_side_codec);
-    added |= evel_enc_kv_opt_string(jbuf,
-                                    "callerSideCodec",
-                                    &event->caller_side_codec);
+    evel_enc_kv_opt_string(jbuf,
+                           EVEL_KEY_CALLEE_SIDE_CODEC,
+                           &event->callee_side_codec);
+    evel_enc_kv_opt_string(jbuf,
+                           EVEL_KEY_CALLER_SIDE_CODEC,
+                           &event->caller_side_codec);
     evel_json_close_object(jbuf);
-
-    /*************************************************************************/
-    /* If the object is empty, rewind to before we opened it.                */
-    /*************************************************************************/
-    if (!added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
   /* Optional fields within JSON equivalent object: midCallRtcp              */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_object(jbuf, "midCallRtcp"))
+  if (evel_json_open_opt_named_object(jbuf, EVEL_KEY_MID_CALL_RTCP))
   {
-    bool added = false;
-    added |= evel_enc_kv_opt_string(jbuf,
-                                    "rtcpData",
-                                    &event->rtcp_data);
+    evel_enc_kv_opt_string(jbuf,
+                           EVEL_KEY_RTCP_DATA,
+                           &event->rtcp_data);
     evel_json_close_object(jbuf);
-
-    /*************************************************************************/
-    /* If the object is empty, rewind to before we opened it.                */
-    /*************************************************************************/
-    if (!added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
   /* Optional fields within JSON equivalent object: endOfCallVqmSummaries    */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_object(jbuf, "endOfCallVqmSummaries"))
+  if (evel_json_open_opt_named_object(jbuf, EVEL_KEY_END_OF_CALL_VQM_SUMMARIES))
   {
-    bool added = false;
-    added |= evel_enc_kv_opt_string(jbuf,
-                                    "adjacencyName",
-                                    &event->adjacency_name);
-    added |= evel_enc_kv_opt_string(jbuf,
-                                    "endpointDescription",
-                                    &event->endpoint_description);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "endpointJitter",
-                                 &event->endpoint_jitter);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "endpointRtpOctetsDiscarded",
-                                 &event->endpoint_rtp_oct_disc);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "endpointRtpOctetsReceived",
-                                 &event->endpoint_rtp_oct_recv);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "endpointRtpOctetsSent",
-                                 &event->endpoint_rtp_oct_sent);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "endpointRtpPacketsDiscarded",
-                                 &event->endpoint_rtp_pkt_disc);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "endpointRtpPacketsReceived",
-                                 &event->endpoint_rtp_pkt_recv);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "endpointRtpPacketsSent",
-                                 &event->endpoint_rtp_pkt_sent);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "localJitter",
-                                 &event->local_jitter);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "localRtpOctetsDiscarded",
-                                 &event->local_rtp_oct_disc);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "localRtpOctetsReceived",
-                                 &event->local_rtp_oct_recv);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "localRtpOctetsSent",
-                                 &event->local_rtp_oct_sent);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "localRtpPacketsDiscarded",
-                                 &event->local_rtp_pkt_disc);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "localRtpPacketsReceived",
-                                 &event->local_rtp_pkt_recv);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "localRtpPacketsSent",
-                                 &event->local_rtp_pkt_sent);
-    added |= evel_enc_kv_opt_double(jbuf,
-                                    "mosCqe",
-                                    &event->mos_cqe);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "packetsLost",
-                                 &event->packets_lost);
-    added |= evel_enc_kv_opt_double(jbuf,
-                                    "packetLossPercent",
-                                    &event->packet_loss_percent);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "rFactor",
-                                 &event->r_factor);
-    added |= evel_enc_kv_opt_int(jbuf,
-                                 "roundTripDelay",
-                                 &event->round_trip_delay);
+    evel_enc_kv_opt_string(jbuf,
+                           EVEL_KEY_ADJACENCY_NAME,
+                           &event->adjacency_name);
+    evel_enc_kv_opt_string(jbuf,
+                           EVEL_KEY_ENDPOINT_DESCRIPTION,
+                           &event->endpoint_description);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_ENDPOINT_JITTER,
+                        &event->endpoint_jitter);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_ENDPOINT_RTP_OCTETS_DISCARDED,
+                        &event->endpoint_rtp_oct_disc);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_ENDPOINT_RTP_OCTETS_RECEIVED,
+                        &event->endpoint_rtp_oct_recv);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_ENDPOINT_RTP_OCTETS_SENT,
+                        &event->endpoint_rtp_oct_sent);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_ENDPOINT_RTP_PACKETS_DISCARDED,
+                        &event->endpoint_rtp_pkt_disc);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_ENDPOINT_RTP_PACKETS_RECEIVED,
+                        &event->endpoint_rtp_pkt_recv);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_ENDPOINT_RTP_PACKETS_SENT,
+                        &event->endpoint_rtp_pkt_sent);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_LOCAL_JITTER,
+                        &event->local_jitter);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_LOCAL_RTP_OCTETS_DISCARDED,
+                        &event->local_rtp_oct_disc);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_LOCAL_RTP_OCTETS_RECEIVED,
+                        &event->local_rtp_oct_recv);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_LOCAL_RTP_OCTETS_SENT,
+                        &event->local_rtp_oct_sent);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_LOCAL_RTP_PACKETS_DISCARDED,
+                        &event->local_rtp_pkt_disc);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_LOCAL_RTP_PACKETS_RECEIVED,
+                        &event->local_rtp_pkt_recv);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_LOCAL_RTP_PACKETS_SENT,
+                        &event->local_rtp_pkt_sent);
+    evel_enc_kv_opt_double(jbuf,
+                           EVEL_KEY_MOS_CQE,
+                           &event->mos_cqe);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_PACKETS_LOST,
+                        &event->packets_lost);
+    evel_enc_kv_opt_double(jbuf,
+                           EVEL_KEY_PACKET_LOSS_PERCENT,
+                           &event->packet_loss_percent);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_R_FACTOR,
+                        &event->r_factor);
+    evel_enc_kv_opt_int(jbuf,
+                        EVEL_KEY_ROUND_TRIP_DELAY,
+                        &event->round_trip_delay);
     evel_json_close_object(jbuf);
-
-    /*************************************************************************/
-    /* If the object is empty, rewind to before we opened it.                */
-    /*************************************************************************/
-    if (!added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   /***************************************************************************/
   /* Optional fields within JSON equivalent object: marker                   */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_object(jbuf, "marker"))
+  if (evel_json_open_opt_named_object(jbuf, EVEL_KEY_MARKER))
   {
-    bool added = false;
-    added |= evel_enc_kv_opt_string(jbuf, "phoneNumber", &event->phone_number);
+    evel_enc_kv_opt_string(
+      jbuf, EVEL_KEY_PHONE_NUMBER, &event->phone_number);
     evel_json_close_object(jbuf);
-
-    /*************************************************************************/
-    /* If the object is empty, rewind to before we opened it.                */
-    /*************************************************************************/
-    if (!added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   evel_json_close_object(jbuf);
@@ -450,27 +450,29 @@ void evel_json_encode_signaling(EVEL_JSON_BUFFER * const jbuf,
   assert(event->header.event_domain == EVEL_DOMAIN_SIGNALING);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "signalingFields");
+  evel_json_open_named_object(jbuf, EVEL_KEY_SIGNALING_FIELDS);
 
   /***************************************************************************/
   /* Mandatory fields                                                        */
   /***************************************************************************/
   evel_json_encode_instance_id(jbuf, &event->instance_id);
   evel_enc_version(jbuf,
-                   "signalingFieldsVersion",
+                   EVEL_KEY_SIGNALING_FIELDS_VERSION,
                    event->major_version,
                    event->minor_version);
 
   /***************************************************************************/
   /* Optional fields                                                         */
   /***************************************************************************/
-  evel_enc_kv_opt_string(jbuf, "correlator", &event->correlator);
-  evel_enc_kv_opt_string(jbuf, "localIpAddress", &event->local_ip_address);
-  evel_enc_kv_opt_string(jbuf, "localPort", &event->local_port);
-  evel_enc_kv_opt_string(jbuf, "remoteIpAddress", &event->remote_ip_address);
-  evel_enc_kv_opt_string(jbuf, "remotePort", &event->remote_port);
-  evel_enc_kv_opt_string(jbuf, "compressedSip", &event->compressed_sip);
-  evel_enc_kv_opt_string(jbuf, "summarySip", &event->summary_sip);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_CORRELATOR, &event->correlator);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_LOCAL_IP_ADDRESS, &event->local_ip_address);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_LOCAL_PORT, &event->local_port);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_REMOTE_IP_ADDRESS, &event->remote_ip_address);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_REMOTE_PORT, &event->remote_port);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_COMPRESSED_SIP, &event->compressed_sip);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_SUMMARY_SIP, &event->summary_sip);
   evel_json_close_object(jbuf);
 
   EVEL_EXIT();
@@ -38,6 +38,13 @@
 
 #include "evel_throttle.h"
 
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void evel_signaling_addl_info_push(EVENT_SIGNALING * event,
+                                          char * name,
+                                          char * value);
+
 /**************************************************************************//**
  * Create a new Signaling event.
  *
@@ -73,13 +80,13 @@ EVENT_SIGNALING * evel_new_signaling(const char* ev_name, const char *ev_id,
   /***************************************************************************/
   /* Allocate the Signaling event.                                           */
   /***************************************************************************/
-  event = malloc(sizeof(EVENT_SIGNALING));
+  event = evel_event_alloc(EVEL_DOMAIN_SIPSIGNALING);
   if (event == NULL)
   {
     log_error_state("Out of memory");
     goto exit_label;
   }
-  memset(event, 0, sizeof(EVENT_SIGNALING));
+  event->header.arena = evel_new_event_arena();
   EVEL_DEBUG("New Signaling event is at %lp", event);
 
   /***************************************************************************/
@@ -89,12 +96,29 @@ EVENT_SIGNALING * evel_new_signaling(const char* ev_name, const char *ev_id,
   event->header.event_domain = EVEL_DOMAIN_SIPSIGNALING;
   event->major_version = EVEL_SIGNALING_MAJOR_VERSION;
   event->minor_version = EVEL_SIGNALING_MINOR_VERSION;
-  evel_init_vendor_field(&event->vnfname_field, vendor_name);
-  evel_set_option_string(&event->correlator,correlator,"Init correlator");
-  evel_set_option_string(&event->local_ip_address,local_ip_address,"Init correlator");
-  evel_set_option_string(&event->local_port,local_port,"Init local port");
-  evel_set_option_string(&event->remote_ip_address,remote_ip_address,"Init remote ip");
-  evel_set_option_string(&event->remote_port,remote_port,"Init remote port");
+  evel_arena_init_vendor_field(event->header.arena,
+                               &event->vnfname_field,
+                               vendor_name);
+  evel_arena_set_option_string(event->header.arena,
+                               &event->correlator,
+                               correlator,
+                               "Init correlator");
+  evel_arena_set_option_string(event->header.arena,
+                               &event->local_ip_address,
+                               local_ip_address,
+                               "Init correlator");
+  evel_arena_set_option_string(event->header.arena,
+                               &event->local_port,
+                               local_port,
+                               "Init local port");
+  evel_arena_set_option_string(event->header.arena,
+                               &event->remote_ip_address,
+                               remote_ip_address,
+                               "Init remote ip");
+  evel_arena_set_option_string(event->header.arena,
+                               &event->remote_port,
+                               remote_port,
+                               "Init remote port");
   evel_init_option_string(&event->compressed_sip);
   evel_init_option_string(&event->summary_sip);
   dlist_initialize(&event->additional_info);
@@ -105,6 +129,41 @@ exit_label:
   return event;
 }
 
+/**************************************************************************//**
+ * Create a new Signaling event from a prototype.
+ *
+ * @param prototype   Pointer to the ::EVEL_PROTOTYPE, made from a Signaling
+ *                    event.
+ * @param ev_id       The eventId of the new event.  The caller does not need
+ *                    to preserve the value once the function returns.
+ *
+ * @returns pointer to the newly manufactured ::EVENT_SIGNALING.  If the event
+ *          is not used (i.e. posted) it must be released using
+ *          ::evel_free_event.
+ * @retval  NULL  Failed to create the event.
+ *****************************************************************************/
+EVENT_SIGNALING * evel_new_signaling_from_prototype(EVEL_PROTOTYPE * prototype,
+                                                    const char * const ev_id)
+{
+  EVENT_SIGNALING * event = NULL;
+
+  EVEL_ENTER();
+
+  event = (EVENT_SIGNALING *) evel_new_event_from_prototype(
+                                                   prototype,
+                                                   EVEL_DOMAIN_SIPSIGNALING,
+                                                   sizeof(EVENT_SIGNALING),
+                                                   ev_id);
+  if (event != NULL)
+  {
+    EVEL_DEBUG("New Signaling event from prototype is at %lp", event);
+    dlist_share_slots(&event->additional_info);
+  }
+
+  EVEL_EXIT();
+  return event;
+}
+
 /**************************************************************************//**
  * Add an additional value name/value pair to the SIP signaling.
  *
@@ -122,7 +181,6 @@ exit_label:
  *****************************************************************************/
 void evel_signaling_addl_info_add(EVENT_SIGNALING * event, char * name, char * value)
 {
-  FAULT_ADDL_INFO * addl_info = NULL;
   EVEL_ENTER();
 
   /***************************************************************************/
@@ -133,18 +191,77 @@ void evel_signaling_addl_info_add(EVENT_SIGNALING * event, char * name, char * v
   assert(name != NULL);
   assert(value != NULL);
 
+  evel_signaling_addl_info_push(event,
+                                evel_arena_strdup(event->header.arena, name),
+                                evel_arena_strdup(event->header.arena, value));
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Add an additional value name/value pair to the SIP signaling, without
+ * copying it.
+ *
+ * @param event     Pointer to the Signaling event.
+ * @param name      ASCIIZ string with the attribute's name, allocated with
+ *                  malloc.  The Signaling event takes ownership of it, so the
+ *                  caller must not use or free it after the function returns.
+ * @param value     ASCIIZ string with the attribute's value, allocated with
+ *                  malloc.  The Signaling event takes ownership of it, as for
+ *                  name.
+ *****************************************************************************/
+void evel_signaling_addl_info_add_take(EVENT_SIGNALING * event,
+                                       char * name,
+                                       char * value)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  assert(name != NULL);
+  assert(value != NULL);
+
+  evel_signaling_addl_info_push(event,
+                                evel_arena_take_string(event->header.arena,
+                                                       name),
+                                evel_arena_take_string(event->header.arena,
+                                                       value));
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Push an additional value name/value pair, whose strings the Signaling event
+ * already owns, onto the Signaling event.
+ *
+ * @param event     Pointer to the Signaling event.
+ * @param name      ASCIIZ string with the attribute's name.
+ * @param value     ASCIIZ string with the attribute's value.
+ *****************************************************************************/
+static void evel_signaling_addl_info_push(EVENT_SIGNALING * event,
+                                          char * name,
+                                          char * value)
+{
+  SIGNALING_ADDL_FIELD * addl_info = NULL;
+
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  assert(name != NULL);
+  assert(value != NULL);
+
   EVEL_DEBUG("Adding name=%s value=%s", name, value);
-  addl_info = malloc(sizeof(SIGNALING_ADDL_FIELD));
+  addl_info = evel_arena_alloc(event->header.arena,
+                               sizeof(SIGNALING_ADDL_FIELD));
   assert(addl_info != NULL);
   memset(addl_info, 0, sizeof(SIGNALING_ADDL_FIELD));
-  addl_info->name = strdup(name);
-  addl_info->value = strdup(value);
-  assert(addl_info->name != NULL);
-  assert(addl_info->value != NULL);
+  addl_info->name = name;
+  addl_info->value = value;
 
-  dlist_push_last(&event->additional_info, addl_info);
-
-  EVEL_EXIT();
+  evel_arena_list_push(event->header.arena,
+                       &event->additional_info,
+                       addl_info);
 }
 
 
@@ -175,6 +292,34 @@ void evel_signaling_type_set(EVENT_SIGNALING * const event,
   EVEL_EXIT();
 }
 
+/**************************************************************************//**
+ * Set the Event Type property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param type          The Event Type to be set.  ASCIIZ string allocated with
+ *                      malloc.  The Signaling event takes ownership of it, so
+ *                      the caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_signaling_type_set_take(EVENT_SIGNALING * const event,
+                                  char * const type)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions and call evel_header_type_set_take.                 */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  evel_header_type_set_take(&event->header, type);
+
+  EVEL_EXIT();
+}
+
 /**************************************************************************//**
  * Set the Local Ip Address property of the Signaling event.
  *
@@ -200,9 +345,47 @@ void evel_signaling_local_ip_address_set(EVENT_SIGNALING * const event,
   assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
   assert(local_ip_address != NULL);
 
-  evel_set_option_string(&event->local_ip_address,
-                         local_ip_address,
-                         "Local Ip Address");
+  evel_uninherit_option_string(&event->header, &event->local_ip_address);
+  evel_arena_set_option_string(event->header.arena,
+                               &event->local_ip_address,
+                               local_ip_address,
+                               "Local Ip Address");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Local Ip Address property of the Signaling event, without copying
+ * it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param local_ip_address
+ *                      The Local Ip Address to be set.  ASCIIZ string
+ *                      allocated with malloc.  The Signaling event takes
+ *                      ownership of it, so the caller must not use or free it
+ *                      after the function returns.
+ *****************************************************************************/
+void evel_signaling_local_ip_address_set_take(EVENT_SIGNALING * const event,
+                                              char * const local_ip_address)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  assert(local_ip_address != NULL);
+
+  evel_uninherit_option_string(&event->header, &event->local_ip_address);
+  evel_arena_take_option_string(event->header.arena,
+                                &event->local_ip_address,
+                                local_ip_address,
+                                "Local Ip Address");
 
   EVEL_EXIT();
 }
@@ -231,9 +414,45 @@ void evel_signaling_local_port_set(EVENT_SIGNALING * const event,
   assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
   assert(local_port != NULL);
 
-  evel_set_option_string(&event->local_port,
-                         local_port,
-                         "Local Port");
+  evel_uninherit_option_string(&event->header, &event->local_port);
+  evel_arena_set_option_string(event->header.arena,
+                               &event->local_port,
+                               local_port,
+                               "Local Port");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Local Port property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param local_port    The Local Port to be set.  ASCIIZ string allocated with
+ *                      malloc.  The Signaling event takes ownership of it, so
+ *                      the caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_signaling_local_port_set_take(EVENT_SIGNALING * const event,
+                                        char * const local_port)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  assert(local_port != NULL);
+
+  evel_uninherit_option_string(&event->header, &event->local_port);
+  evel_arena_take_option_string(event->header.arena,
+                                &event->local_port,
+                                local_port,
+                                "Local Port");
 
   EVEL_EXIT();
 }
@@ -263,9 +482,47 @@ void evel_signaling_remote_ip_address_set(EVENT_SIGNALING * const event,
   assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
   assert(remote_ip_address != NULL);
 
-  evel_set_option_string(&event->remote_ip_address,
-                         remote_ip_address,
-                         "Remote Ip Address");
+  evel_uninherit_option_string(&event->header, &event->remote_ip_address);
+  evel_arena_set_option_string(event->header.arena,
+                               &event->remote_ip_address,
+                               remote_ip_address,
+                               "Remote Ip Address");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Remote Ip Address property of the Signaling event, without copying
+ * it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param remote_ip_address
+ *                      The Remote Ip Address to be set.  ASCIIZ string
+ *                      allocated with malloc.  The Signaling event takes
+ *                      ownership of it, so the caller must not use or free it
+ *                      after the function returns.
+ *****************************************************************************/
+void evel_signaling_remote_ip_address_set_take(EVENT_SIGNALING * const event,
+                                               char * const remote_ip_address)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  assert(remote_ip_address != NULL);
+
+  evel_uninherit_option_string(&event->header, &event->remote_ip_address);
+  evel_arena_take_option_string(event->header.arena,
+                                &event->remote_ip_address,
+                                remote_ip_address,
+                                "Remote Ip Address");
 
   EVEL_EXIT();
 }
@@ -294,9 +551,45 @@ void evel_signaling_remote_port_set(EVENT_SIGNALING * const event,
   assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
   assert(remote_port != NULL);
 
-  evel_set_option_string(&event->remote_port,
-                         remote_port,
-                         "Remote Port");
+  evel_uninherit_option_string(&event->header, &event->remote_port);
+  evel_arena_set_option_string(event->header.arena,
+                               &event->remote_port,
+                               remote_port,
+                               "Remote Port");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Remote Port property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param remote_port   The Remote Port to be set.  ASCIIZ string allocated
+ *                      with malloc.  The Signaling event takes ownership of
+ *                      it, so the caller must not use or free it after the
+ *                      function returns.
+ *****************************************************************************/
+void evel_signaling_remote_port_set_take(EVENT_SIGNALING * const event,
+                                         char * const remote_port)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  assert(remote_port != NULL);
+
+  evel_uninherit_option_string(&event->header, &event->remote_port);
+  evel_arena_take_option_string(event->header.arena,
+                                &event->remote_port,
+                                remote_port,
+                                "Remote Port");
 
   EVEL_EXIT();
 }
@@ -325,7 +618,46 @@ void evel_signaling_vnfmodule_name_set(EVENT_SIGNALING * const event,
   assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
   assert(module_name != NULL);
 
-  evel_vendor_field_module_set(&event->vnfname_field, module_name);
+  evel_uninherit_option_string(&event->header,
+                               &event->vnfname_field.vfmodule);
+  evel_arena_set_option_string(event->header.arena,
+                               &event->vnfname_field.vfmodule,
+                               module_name,
+                               "Module name set");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Vendor module property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param modulename    The module name to be set. ASCIIZ string. The caller
+ *                      does not need to preserve the value once the function
+ *                      returns.
+ *****************************************************************************/
+void evel_signaling_vnfmodule_name_set_take(EVENT_SIGNALING * const event,
+                                            char * const module_name)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  assert(module_name != NULL);
+
+  evel_uninherit_option_string(&event->header,
+                               &event->vnfname_field.vfmodule);
+  evel_arena_take_option_string(event->header.arena,
+                                &event->vnfname_field.vfmodule,
+                                module_name,
+                                "Module name set");
 
   EVEL_EXIT();
 }
@@ -354,7 +686,47 @@ void evel_signaling_vnfname_set(EVENT_SIGNALING * const event,
   assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
   assert(vnfname != NULL);
 
-  evel_vendor_field_vnfname_set(&event->vnfname_field, vnfname);
+  evel_uninherit_option_string(&event->header,
+                               &event->vnfname_field.vnfname);
+  evel_arena_set_option_string(event->header.arena,
+                               &event->vnfname_field.vnfname,
+                               vnfname,
+                               "Virtual Network Function name set");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Vendor module property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param vnfname       The Virtual Network function to be set.  ASCIIZ string
+ *                      allocated with malloc.  The Signaling event takes
+ *                      ownership of it, so the caller must not use or free it
+ *                      after the function returns.
+ *****************************************************************************/
+void evel_signaling_vnfname_set_take(EVENT_SIGNALING * const event,
+                                     char * const vnfname)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  assert(vnfname != NULL);
+
+  evel_uninherit_option_string(&event->header,
+                               &event->vnfname_field.vnfname);
+  evel_arena_take_option_string(event->header.arena,
+                                &event->vnfname_field.vnfname,
+                                vnfname,
+                                "Virtual Network Function name set");
 
   EVEL_EXIT();
 }
@@ -384,9 +756,46 @@ void evel_signaling_compressed_sip_set(EVENT_SIGNALING * const event,
   assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
   assert(compressed_sip != NULL);
 
-  evel_set_option_string(&event->compressed_sip,
-                         compressed_sip,
-                         "Compressed SIP");
+  evel_uninherit_option_string(&event->header, &event->compressed_sip);
+  evel_arena_set_option_string(event->header.arena,
+                               &event->compressed_sip,
+                               compressed_sip,
+                               "Compressed SIP");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Compressed SIP property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param compressed_sip
+ *                      The Compressed SIP to be set.  ASCIIZ string allocated
+ *                      with malloc.  The Signaling event takes ownership of
+ *                      it, so the caller must not use or free it after the
+ *                      function returns.
+ *****************************************************************************/
+void evel_signaling_compressed_sip_set_take(EVENT_SIGNALING * const event,
+                                            char * const compressed_sip)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  assert(compressed_sip != NULL);
+
+  evel_uninherit_option_string(&event->header, &event->compressed_sip);
+  evel_arena_take_option_string(event->header.arena,
+                                &event->compressed_sip,
+                                compressed_sip,
+                                "Compressed SIP");
 
   EVEL_EXIT();
 }
@@ -415,9 +824,45 @@ void evel_signaling_summary_sip_set(EVENT_SIGNALING * const event,
   assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
   assert(summary_sip != NULL);
 
-  evel_set_option_string(&event->summary_sip,
-                         summary_sip,
-                         "Summary SIP");
+  evel_uninherit_option_string(&event->header, &event->summary_sip);
+  evel_arena_set_option_string(event->header.arena,
+                               &event->summary_sip,
+                               summary_sip,
+                               "Summary SIP");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Summary SIP property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param summary_sip   The Summary SIP to be set.  ASCIIZ string allocated
+ *                      with malloc.  The Signaling event takes ownership of
+ *                      it, so the caller must not use or free it after the
+ *                      function returns.
+ *****************************************************************************/
+void evel_signaling_summary_sip_set_take(EVENT_SIGNALING * const event,
+                                         char * const summary_sip)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  assert(summary_sip != NULL);
+
+  evel_uninherit_option_string(&event->header, &event->summary_sip);
+  evel_arena_take_option_string(event->header.arena,
+                                &event->summary_sip,
+                                summary_sip,
+                                "Summary SIP");
 
   EVEL_EXIT();
 }
@@ -444,9 +889,43 @@ void evel_signaling_correlator_set(EVENT_SIGNALING * const event,
   /***************************************************************************/
   assert(event != NULL);
   assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
-  evel_set_option_string(&event->correlator,
-                         correlator,
-                         "Correlator");
+  evel_uninherit_option_string(&event->header, &event->correlator);
+  evel_arena_set_option_string(event->header.arena,
+                               &event->correlator,
+                               correlator,
+                               "Correlator");
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Correlator property of the Signaling event, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param event         Pointer to the Signaling event.
+ * @param correlator    The correlator to be set.  ASCIIZ string allocated with
+ *                      malloc.  The Signaling event takes ownership of it, so
+ *                      the caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_signaling_correlator_set_take(EVENT_SIGNALING * const event,
+                                        char * const correlator)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions and call evel_header_type_set_take.                 */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
+  evel_uninherit_option_string(&event->header, &event->correlator);
+  evel_arena_take_option_string(event->header.arena,
+                                &event->correlator,
+                                correlator,
+                                "Correlator");
 
   EVEL_EXIT();
 }
@@ -473,7 +952,7 @@ void evel_json_encode_signaling(EVEL_JSON_BUFFER * const jbuf,
   assert(event->header.event_domain == EVEL_DOMAIN_SIPSIGNALING);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "signalingFields");
+  evel_json_open_named_object(jbuf, EVEL_KEY_SIGNALING_FIELDS);
 
   /***************************************************************************/
   /* Mandatory fields                                                        */
@@ -482,25 +961,21 @@ void evel_json_encode_signaling(EVEL_JSON_BUFFER * const jbuf,
   /***************************************************************************/
   /* Optional fields                                                         */
   /***************************************************************************/
-  evel_enc_kv_opt_string(jbuf, "compressedSip", &event->compressed_sip);
-  evel_enc_kv_opt_string(jbuf, "correlator", &event->correlator);
-  evel_enc_kv_opt_string(jbuf, "localIpAddress", &event->local_ip_address);
-  evel_enc_kv_opt_string(jbuf, "localPort", &event->local_port);
-  evel_enc_kv_opt_string(jbuf, "remoteIpAddress", &event->remote_ip_address);
-  evel_enc_kv_opt_string(jbuf, "remotePort", &event->remote_port);
-  evel_enc_version(jbuf, "signalingFieldsVersion", event->major_version,event->minor_version);
-  evel_enc_kv_opt_string(jbuf, "summarySip", &event->summary_sip);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_COMPRESSED_SIP, &event->compressed_sip);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_CORRELATOR, &event->correlator);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_LOCAL_IP_ADDRESS, &event->local_ip_address);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_LOCAL_PORT, &event->local_port);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_REMOTE_IP_ADDRESS, &event->remote_ip_address);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_REMOTE_PORT, &event->remote_port);
+  evel_enc_version(jbuf, EVEL_KEY_SIGNALING_FIELDS_VERSION, event->major_version,event->minor_version);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_SUMMARY_SIP, &event->summary_sip);
   evel_json_encode_vendor_field(jbuf, &event->vnfname_field);
 
 
-  /***************************************************************************/
-  /* Checkpoint, so that we can wind back if all fields are suppressed.      */
-  /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "additionalInformation"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_ADDITIONAL_INFORMATION))
   {
-    bool item_added = false;
-
     addl_info_item = dlist_get_first(&event->additional_info);
     while (addl_info_item != NULL)
     { 
@@ -508,26 +983,17 @@ void evel_json_encode_signaling(EVEL_JSON_BUFFER * const jbuf,
       assert(addl_info != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "additionalInformation",
+                                          EVEL_KEY_ADDITIONAL_INFORMATION,
                                           addl_info->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", addl_info->name);
-        evel_enc_kv_string(jbuf, "value", addl_info->value);
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, addl_info->name);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, addl_info->value);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       addl_info_item = dlist_get_next(addl_info_item);
     }
     evel_json_close_list(jbuf);
-    
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   evel_json_close_object(jbuf);
@@ -38,6 +38,14 @@
 
 #include "evel_throttle.h"
 
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void evel_state_change_addl_field_push(
+                                       EVENT_STATE_CHANGE * const state_change,
+                                       char * name,
+                                       char * value);
+
 /**************************************************************************//**
  * Create a new State Change event.
  *
@@ -74,13 +82,13 @@ EVENT_STATE_CHANGE * evel_new_state_change(const char* ev_name,
   /***************************************************************************/
   /* Allocate the State Change.                                              */
   /***************************************************************************/
-  state_change = malloc(sizeof(EVENT_STATE_CHANGE));
+  state_change = evel_event_alloc(EVEL_DOMAIN_STATE_CHANGE);
   if (state_change == NULL)
   {
     log_error_state("Out of memory");
     goto exit_label;
   }
-  memset(state_change, 0, sizeof(EVENT_STATE_CHANGE));
+  state_change->header.arena = evel_new_event_arena();
   EVEL_DEBUG("New State Change is at %lp", state_change);
 
   /***************************************************************************/
@@ -93,7 +101,8 @@ EVENT_STATE_CHANGE * evel_new_state_change(const char* ev_name,
   state_change->minor_version = EVEL_STATE_CHANGE_MINOR_VERSION;
   state_change->new_state = new_state;
   state_change->old_state = old_state;
-  state_change->state_interface = strdup(interface);
+  state_change->state_interface = evel_arena_strdup(state_change->header.arena,
+                                                     interface);
   dlist_initialize(&state_change->additional_fields);
 
 exit_label:
@@ -170,6 +179,34 @@ void evel_state_change_type_set(EVENT_STATE_CHANGE * const state_change,
   EVEL_EXIT();
 }
 
+/**************************************************************************//**
+ * Set the Event Type property of the State Change, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param state_change  Pointer to the ::EVENT_STATE_CHANGE.
+ * @param type          The Event Type to be set.  ASCIIZ string allocated with
+ *                      malloc.  The State Change takes ownership of it, so the
+ *                      caller must not use or free it after the function
+ *                      returns.
+ *****************************************************************************/
+void evel_state_change_type_set_take(EVENT_STATE_CHANGE * const state_change,
+                                     char * const type)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions and call evel_header_type_set_take.                 */
+  /***************************************************************************/
+  assert(state_change != NULL);
+  assert(state_change->header.event_domain == EVEL_DOMAIN_STATE_CHANGE);
+  evel_header_type_set_take(&state_change->header, type);
+
+  EVEL_EXIT();
+}
+
 /**************************************************************************//**
  * Add an additional field name/value pair to the State Change.
  *
@@ -189,7 +226,6 @@ void evel_state_change_addl_field_add(EVENT_STATE_CHANGE * const state_change,
                                       const char * const name,
                                       const char * const value)
 {
-  STATE_CHANGE_ADDL_FIELD * addl_field = NULL;
   EVEL_ENTER();
 
   /***************************************************************************/
@@ -200,18 +236,82 @@ void evel_state_change_addl_field_add(EVENT_STATE_CHANGE * const state_change,
   assert(name != NULL);
   assert(value != NULL);
 
+  evel_state_change_addl_field_push(
+                           state_change,
+                           evel_arena_strdup(state_change->header.arena, name),
+                           evel_arena_strdup(state_change->header.arena,
+                                             value));
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Add an additional field name/value pair to the State Change, without
+ * copying it.
+ *
+ * @param state_change  Pointer to the ::EVENT_STATE_CHANGE.
+ * @param name          ASCIIZ string with the attribute's name, allocated
+ *                      with malloc.  The State Change takes ownership of it,
+ *                      so the caller must not use or free it after the
+ *                      function returns.
+ * @param value         ASCIIZ string with the attribute's value, allocated
+ *                      with malloc.  The State Change takes ownership of it,
+ *                      as for name.
+ *****************************************************************************/
+void evel_state_change_addl_field_add_take(
+                                       EVENT_STATE_CHANGE * const state_change,
+                                       char * name,
+                                       char * value)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(state_change != NULL);
+  assert(state_change->header.event_domain == EVEL_DOMAIN_STATE_CHANGE);
+  assert(name != NULL);
+  assert(value != NULL);
+
+  evel_state_change_addl_field_push(
+                      state_change,
+                      evel_arena_take_string(state_change->header.arena, name),
+                      evel_arena_take_string(state_change->header.arena,
+                                             value));
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Push an additional field name/value pair, whose strings the State Change
+ * already owns, onto the State Change.
+ *
+ * @param state_change  Pointer to the ::EVENT_STATE_CHANGE.
+ * @param name          ASCIIZ string with the attribute's name.
+ * @param value         ASCIIZ string with the attribute's value.
+ *****************************************************************************/
+static void evel_state_change_addl_field_push(
+                                       EVENT_STATE_CHANGE * const state_change,
+                                       char * name,
+                                       char * value)
+{
+  STATE_CHANGE_ADDL_FIELD * addl_field = NULL;
+
+  assert(state_change->header.event_domain == EVEL_DOMAIN_STATE_CHANGE);
+  assert(name != NULL);
+  assert(value != NULL);
+
   EVEL_DEBUG("Adding name=%s value=%s", name, value);
-  addl_field = malloc(sizeof(STATE_CHANGE_ADDL_FIELD));
+  addl_field = evel_arena_alloc(state_change->header.arena,
+                                sizeof(STATE_CHANGE_ADDL_FIELD));
   assert(addl_field != NULL);
   memset(addl_field, 0, sizeof(STATE_CHANGE_ADDL_FIELD));
-  addl_field->name = strdup(name);
-  addl_field->value = strdup(value);
-  assert(addl_field->name != NULL);
-  assert(addl_field->value != NULL);
-
-  dlist_push_last(&state_change->additional_fields, addl_field);
+  addl_field->name = name;
+  addl_field->value = value;
 
-  EVEL_EXIT();
+  evel_arena_list_push(state_change->header.arena,
+                       &state_change->additional_fields,
+                       addl_field);
 }
 
 /**************************************************************************//**
@@ -240,23 +340,21 @@ void evel_json_encode_state_change(EVEL_JSON_BUFFER * jbuf,
   old_state = evel_entity_state(state_change->old_state);
 
   evel_json_encode_header(jbuf, &state_change->header);
-  evel_json_open_named_object(jbuf, "stateChangeFields");
+  evel_json_open_named_object(jbuf, EVEL_KEY_STATE_CHANGE_FIELDS);
 
   /***************************************************************************/
   /* Mandatory fields.                                                       */
   /***************************************************************************/
-  evel_enc_kv_string(jbuf, "newState", new_state);
-  evel_enc_kv_string(jbuf, "oldState", old_state);
-  evel_enc_kv_string(jbuf, "stateInterface", state_change->state_interface);
+  evel_enc_kv_string(jbuf, EVEL_KEY_NEW_STATE, new_state);
+  evel_enc_kv_string(jbuf, EVEL_KEY_OLD_STATE, old_state);
+  evel_enc_kv_string(
+    jbuf, EVEL_KEY_STATE_INTERFACE, state_change->state_interface);
 
   /***************************************************************************/
   /* Optional fields.                                                        */
   /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "additionalFields"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_ADDITIONAL_FIELDS))
   {
-    bool item_added = false;
-
     addl_field_item = dlist_get_first(&state_change->additional_fields);
     while (addl_field_item != NULL)
     {
@@ -264,30 +362,21 @@ void evel_json_encode_state_change(EVEL_JSON_BUFFER * jbuf,
       assert(addl_field != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "additionalFields",
+                                          EVEL_KEY_ADDITIONAL_FIELDS,
                                           addl_field->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", addl_field->name);
-        evel_enc_kv_string(jbuf, "value", addl_field->value);
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, addl_field->name);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, addl_field->value);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       addl_field_item = dlist_get_next(addl_field_item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
   evel_enc_version(jbuf,
-                   "stateChangeFieldsVersion",
+                   EVEL_KEY_STATE_CHANGE_FIELDS_VERSION,
                    state_change->major_version,state_change->minor_version);
 
   evel_json_close_object(jbuf);
@@ -71,13 +71,13 @@ EVENT_SYSLOG * evel_new_syslog(const char* ev_name, const char *ev_id,
   /***************************************************************************/
   /* Allocate the Syslog.                                                    */
   /***************************************************************************/
-  syslog = malloc(sizeof(EVENT_SYSLOG));
+  syslog = evel_event_alloc(EVEL_DOMAIN_SYSLOG);
   if (syslog == NULL)
   {
     log_error_state("Out of memory");
     goto exit_label;
   }
-  memset(syslog, 0, sizeof(EVENT_SYSLOG));
+  syslog->header.arena = evel_new_event_arena();
   EVEL_DEBUG("New Syslog is at %lp", syslog);
 
   /***************************************************************************/
@@ -89,8 +89,8 @@ EVENT_SYSLOG * evel_new_syslog(const char* ev_name, const char *ev_id,
   syslog->major_version = EVEL_SYSLOG_MAJOR_VERSION;
   syslog->minor_version = EVEL_SYSLOG_MINOR_VERSION;
   syslog->event_source_type = event_source_type;
-  syslog->syslog_msg = strdup(syslog_msg);
-  syslog->syslog_tag = strdup(syslog_tag);
+  syslog->syslog_msg = evel_arena_strdup(syslog->header.arena, syslog_msg);
+  syslog->syslog_tag = evel_arena_strdup(syslog->header.arena, syslog_tag);
   evel_init_option_int(&syslog->syslog_facility);
   evel_init_option_int(&syslog->syslog_proc_id);
   evel_init_option_int(&syslog->syslog_ver);
@@ -133,6 +133,32 @@ void evel_syslog_type_set(EVENT_SYSLOG * syslog,
   EVEL_EXIT();
 }
 
+/**************************************************************************//**
+ * Set the Event Type property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param syslog      Pointer to the syslog.
+ * @param type        The Event Type to be set.  ASCIIZ string allocated with
+ *                    malloc.  The Syslog takes ownership of it, so the caller
+ *                    must not use or free it after the function returns.
+ *****************************************************************************/
+void evel_syslog_type_set_take(EVENT_SYSLOG * syslog, char * const type)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions and call evel_header_type_set_take.                 */
+  /***************************************************************************/
+  assert(syslog != NULL);
+  assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
+  evel_header_type_set_take(&syslog->header, type);
+
+  EVEL_EXIT();
+}
+
 /**************************************************************************//**
  * Add an additional value name/value pair to the Syslog.
  *
@@ -160,9 +186,10 @@ void evel_syslog_addl_filter_set(EVENT_SYSLOG * syslog,
   assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
   assert(filter != NULL);
 
-  evel_set_option_string(&syslog->additional_filters,
-                         filter,
-                         "Syslog filter string");
+  evel_arena_set_option_string(syslog->header.arena,
+                               &syslog->additional_filters,
+                               filter,
+                               "Syslog filter string");
 
   EVEL_EXIT();
 }
@@ -191,9 +218,41 @@ void evel_syslog_event_source_host_set(EVENT_SYSLOG * syslog,
   assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
   assert(host != NULL);
 
-  evel_set_option_string(&syslog->event_source_host,
-                         host,
-                         "Event Source Host");
+  evel_arena_set_option_string(syslog->header.arena,
+                               &syslog->event_source_host,
+                               host,
+                               "Event Source Host");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Event Source Host property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param syslog     Pointer to the Syslog.
+ * @param host       The Event Source Host to be set.  ASCIIZ string allocated
+ *                   with malloc.  The Syslog takes ownership of it, so the
+ *                   caller must not use or free it after the function returns.
+ *****************************************************************************/
+void evel_syslog_event_source_host_set_take(EVENT_SYSLOG * syslog,
+                                            char * const host)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(syslog != NULL);
+  assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
+  assert(host != NULL);
+
+  evel_arena_take_option_string(syslog->header.arena,
+                                &syslog->event_source_host,
+                                host,
+                                "Event Source Host");
   EVEL_EXIT();
 }
 
@@ -249,7 +308,40 @@ void evel_syslog_proc_set(EVENT_SYSLOG * syslog, const char * const proc)
   assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
   assert(proc != NULL);
 
-  evel_set_option_string(&syslog->syslog_proc, proc, "Process");
+  evel_arena_set_option_string(syslog->header.arena,
+                               &syslog->syslog_proc,
+                               proc,
+                               "Process");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Process property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param syslog     Pointer to the Syslog.
+ * @param proc       The Process to be set.  ASCIIZ string allocated with
+ *                   malloc.  The Syslog takes ownership of it, so the caller
+ *                   must not use or free it after the function returns.
+ *****************************************************************************/
+void evel_syslog_proc_set_take(EVENT_SYSLOG * syslog, char * const proc)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(syslog != NULL);
+  assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
+  assert(proc != NULL);
+
+  evel_arena_take_option_string(syslog->header.arena,
+                                &syslog->syslog_proc,
+                                proc,
+                                "Process");
   EVEL_EXIT();
 }
 
@@ -332,9 +424,40 @@ void evel_syslog_s_data_set(EVENT_SYSLOG * syslog, const char * const s_data)
   assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
   assert(s_data != NULL);
 
-  evel_set_option_string(&syslog->syslog_s_data,
-                         s_data,
-                         "Structured Data");
+  evel_arena_set_option_string(syslog->header.arena,
+                               &syslog->syslog_s_data,
+                               s_data,
+                               "Structured Data");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Structured Data property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param syslog     Pointer to the Syslog.
+ * @param s_data     The Structured Data to be set.  ASCIIZ string allocated
+ *                   with malloc.  The Syslog takes ownership of it, so the
+ *                   caller must not use or free it after the function returns.
+ *****************************************************************************/
+void evel_syslog_s_data_set_take(EVENT_SYSLOG * syslog, char * const s_data)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(syslog != NULL);
+  assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
+  assert(s_data != NULL);
+
+  evel_arena_take_option_string(syslog->header.arena,
+                                &syslog->syslog_s_data,
+                                s_data,
+                                "Structured Data");
   EVEL_EXIT();
 }
 
@@ -361,9 +484,40 @@ void evel_syslog_sdid_set(EVENT_SYSLOG * syslog, const char * const sdid)
   assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
   assert(sdid != NULL);
 
-  evel_set_option_string(&syslog->syslog_sdid,
-                         sdid,
-                         "SdId set");
+  evel_arena_set_option_string(syslog->header.arena,
+                               &syslog->syslog_sdid,
+                               sdid,
+                               "SdId set");
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Structured SDID property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.
+ *
+ * @param syslog     Pointer to the Syslog.
+ * @param sdid     The Structured Data to be set.  ASCIIZ string allocated with
+ *                 malloc.  The Syslog takes ownership of it, so the caller
+ *                 must not use or free it after the function returns.
+ *****************************************************************************/
+void evel_syslog_sdid_set_take(EVENT_SYSLOG * syslog, char * const sdid)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(syslog != NULL);
+  assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
+  assert(sdid != NULL);
+
+  evel_arena_take_option_string(syslog->header.arena,
+                                &syslog->syslog_sdid,
+                                sdid,
+                                "SdId set");
   EVEL_EXIT();
 }
 
@@ -394,9 +548,52 @@ void evel_syslog_severity_set(EVENT_SYSLOG * syslog, const char * const severty)
       !strcmp(severty,"Emergency") || !strcmp(severty,"Error") || !strcmp(severty,"Info") ||
       !strcmp(severty,"Notice") || !strcmp(severty,"Warning") )
   {
-     evel_set_option_string(&syslog->syslog_severity,
-                         severty,
-                         "Severity set");
+     evel_arena_set_option_string(syslog->header.arena,
+                                  &syslog->syslog_severity,
+                                  severty,
+                                  "Severity set");
+  }
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set the Structured Severity property of the Syslog, without copying it.
+ *
+ * @note  The property is treated as immutable: it is only valid to call
+ *        the setter once.  However, we don't assert if the caller tries to
+ *        overwrite, just ignoring (and freeing) the update instead.  An
+ *        unrecognized severity is freed and ignored in the same way.
+ *
+ * @param syslog     Pointer to the Syslog.
+ * @param severty    The Severity to be set.  ASCIIZ string allocated with
+ *                   malloc.  The Syslog takes ownership of it, so the caller
+ *                   must not use or free it after the function returns.
+ *****************************************************************************/
+void evel_syslog_severity_set_take(EVENT_SYSLOG * syslog,
+                                   char * const severty)
+{
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(syslog != NULL);
+  assert(syslog->header.event_domain == EVEL_DOMAIN_SYSLOG);
+  assert(severty != NULL);
+
+  if( !strcmp(severty,"Alert") || !strcmp(severty,"Critical") ||
+      !strcmp(severty,"Debug") || !strcmp(severty,"Emergency") ||
+      !strcmp(severty,"Error") || !strcmp(severty,"Info") ||
+      !strcmp(severty,"Notice") || !strcmp(severty,"Warning") )
+  {
+     evel_arena_take_option_string(syslog->header.arena,
+                                   &syslog->syslog_severity,
+                                   severty,
+                                   "Severity set");
+  }
+  else
+  {
+     free(severty);
   }
   EVEL_EXIT();
 }
@@ -423,30 +620,33 @@ void evel_json_encode_syslog(EVEL_JSON_BUFFER * jbuf,
   event_source_type = evel_source_type(event->event_source_type);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "syslogFields");
+  evel_json_open_named_object(jbuf, EVEL_KEY_SYSLOG_FIELDS);
 
-  evel_enc_kv_opt_string(jbuf, "additionalFields", &event->additional_filters);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_ADDITIONAL_FIELDS, &event->additional_filters);
   /***************************************************************************/
   /* Mandatory fields                                                        */
   /***************************************************************************/
-  evel_enc_kv_string(jbuf, "eventSourceType", event_source_type);
-  evel_enc_kv_string(jbuf, "syslogMsg", event->syslog_msg);
-  evel_enc_kv_string(jbuf, "syslogTag", event->syslog_tag);
+  evel_enc_kv_string(jbuf, EVEL_KEY_EVENT_SOURCE_TYPE, event_source_type);
+  evel_enc_kv_string(jbuf, EVEL_KEY_SYSLOG_MSG, event->syslog_msg);
+  evel_enc_kv_string(jbuf, EVEL_KEY_SYSLOG_TAG, event->syslog_tag);
   evel_enc_version(
-    jbuf, "syslogFieldsVersion", event->major_version, event->minor_version);
+    jbuf, EVEL_KEY_SYSLOG_FIELDS_VERSION,
+    event->major_version, event->minor_version);
 
   /***************************************************************************/
   /* Optional fields                                                         */
   /***************************************************************************/
-  evel_enc_kv_opt_string(jbuf, "eventSourceHost", &event->event_source_host);
-  evel_enc_kv_opt_int(jbuf, "syslogFacility", &event->syslog_facility);
-  evel_enc_kv_opt_int(jbuf, "syslogPri", &event->syslog_priority);
-  evel_enc_kv_opt_string(jbuf, "syslogProc", &event->syslog_proc);
-  evel_enc_kv_opt_int(jbuf, "syslogProcId", &event->syslog_proc_id);
-  evel_enc_kv_opt_string(jbuf, "syslogSData", &event->syslog_s_data);
-  evel_enc_kv_opt_string(jbuf, "syslogSdId", &event->syslog_sdid);
-  evel_enc_kv_opt_string(jbuf, "syslogSev", &event->syslog_severity);
-  evel_enc_kv_opt_int(jbuf, "syslogVer", &event->syslog_ver);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_EVENT_SOURCE_HOST, &event->event_source_host);
+  evel_enc_kv_opt_int(jbuf, EVEL_KEY_SYSLOG_FACILITY, &event->syslog_facility);
+  evel_enc_kv_opt_int(jbuf, EVEL_KEY_SYSLOG_PRI, &event->syslog_priority);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_SYSLOG_PROC, &event->syslog_proc);
+  evel_enc_kv_opt_int(jbuf, EVEL_KEY_SYSLOG_PROC_ID, &event->syslog_proc_id);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_SYSLOG_S_DATA, &event->syslog_s_data);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_SYSLOG_SD_ID, &event->syslog_sdid);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_SYSLOG_SEV, &event->syslog_severity);
+  evel_enc_kv_opt_int(jbuf, EVEL_KEY_SYSLOG_VER, &event->syslog_ver);
   evel_json_close_object(jbuf);
 
   EVEL_CT_ASSERT(EVEL_SYSLOG_FACILITY_KERNEL == 0);
@@ -0,0 +1,621 @@
+/**************************************************************************//**
+ * @file
+ * Templates for posting recurring events of the same shape.
+ *
+ * A representative event is encoded once, noting where each value which can
+ * change was written.  Events posted from the template are copies of that
+ * encoding with just those values replaced in place, so heartbeats and
+ * periodic measurements are not encoded from scratch each time.
+ *
+ * License
+ * -------
+ *
+ * Copyright(c) <2016>, AT&T Intellectual Property.  All other rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. All advertising materials mentioning features or use of this software
+ *    must display the following acknowledgement:  This product includes
+ *    software developed by the AT&T.
+ * 4. Neither the name of AT&T nor the names of its contributors may be used to
+ *    endorse or promote products derived from this software without specific
+ *    prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AT&T INTELLECTUAL PROPERTY ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AT&T INTELLECTUAL PROPERTY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+
+#include "evel.h"
+#include "evel_internal.h"
+#include "evel_throttle.h"
+
+/*****************************************************************************/
+/* Space for any value in a slot, the longest being a double formatted with  */
+/* "%1f".                                                                    */
+/*****************************************************************************/
+#define EVEL_TEMPLATE_MAX_VALUE_LEN 336
+
+/*****************************************************************************/
+/* Number of slots to allow for initially, doubled as more are needed.       */
+/*****************************************************************************/
+#define EVEL_TEMPLATE_INITIAL_SLOTS 16
+
+/**************************************************************************//**
+ * A value in the encoding of a template.
+ *****************************************************************************/
+typedef struct evel_template_slot {
+  EVEL_JSON_KEY_ID key;
+  EVEL_TEMPLATE_SLOT_TYPES type;
+  int offset;
+  int length;
+} EVEL_TEMPLATE_SLOT;
+
+/**************************************************************************//**
+ * A template, being the encoding of a representative event and the values in
+ * it which can be replaced.
+ *****************************************************************************/
+struct evel_template {
+  EVEL_EVENT_DOMAINS domain;
+  EVEL_ENCODINGS encoding;
+
+  /***************************************************************************/
+  /* Generation of the domain's throttle specification it was encoded with.  */
+  /***************************************************************************/
+  unsigned int throttle_generation;
+
+  /***************************************************************************/
+  /* The encoding, which grows or shrinks as values are replaced.            */
+  /***************************************************************************/
+  char * encoded;
+  int size;
+  int capacity;
+
+  /***************************************************************************/
+  /* The values which can be replaced, in the order they were encoded.       */
+  /***************************************************************************/
+  EVEL_TEMPLATE_SLOT * slots;
+  int num_slots;
+  int max_slots;
+  bool slots_failed;
+
+  /***************************************************************************/
+  /* The eventId given to every event, or NULL if each gets its sequence     */
+  /* number as it did in the representative event.                           */
+  /***************************************************************************/
+  char * event_id;
+
+  /***************************************************************************/
+  /* How long before lastEpochMicrosec the startEpochMicrosec is.            */
+  /***************************************************************************/
+  unsigned long long epoch_interval;
+};
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void evel_template_value_buffer(EVEL_TEMPLATE * tmpl,
+                                       EVEL_JSON_BUFFER * jbuf,
+                                       char * const value);
+static bool evel_template_replace(EVEL_TEMPLATE * tmpl,
+                                  const int index,
+                                  const char * const value,
+                                  const int length);
+
+/**************************************************************************//**
+ * Create a template from a representative event.
+ *
+ * The event is encoded once, noting where each double and unsigned long long
+ * value, the eventId, the sequence and the epochs were written.  Events
+ * posted from the template are copies of that encoding with just those values
+ * replaced, so are not encoded again.
+ *
+ * The event is encoded with the throttle specification for its domain in
+ * force now.  If that changes, ::evel_post_template fails and a new template
+ * must be made.
+ *
+ * @note  A template must only be used from one thread at a time.
+ *
+ * @param event   The representative event.  The caller keeps ownership.
+ *
+ * @returns Pointer to the new ::EVEL_TEMPLATE, which must be released using
+ *          ::evel_free_template.
+ * @retval  NULL  Failed to allocate memory for the template.
+ *****************************************************************************/
+EVEL_TEMPLATE * evel_new_template(EVENT_HEADER * event)
+{
+  EVEL_TEMPLATE * tmpl = NULL;
+  EVEL_JSON_BUFFER json_buffer;
+  EVEL_JSON_BUFFER * jbuf = &json_buffer;
+  char sequence[EVEL_SEQUENCE_ID_LEN];
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(event != NULL);
+  assert(event->event_domain != EVEL_DOMAIN_INTERNAL);
+
+  /***************************************************************************/
+  /* Allocate the template.                                                  */
+  /***************************************************************************/
+  tmpl = malloc(sizeof(EVEL_TEMPLATE));
+  if (tmpl == NULL)
+  {
+    log_error_state("Out of memory");
+    goto exit_label;
+  }
+  memset(tmpl, 0, sizeof(EVEL_TEMPLATE));
+  EVEL_DEBUG("New template is at %lp", tmpl);
+
+  tmpl->domain = event->event_domain;
+  tmpl->encoding = event_encoding;
+  tmpl->capacity = evel_event_encoded_size(event) + 1;
+  tmpl->encoded = malloc(tmpl->capacity);
+  if (tmpl->encoded == NULL)
+  {
+    log_error_state("Out of memory");
+    goto free_template;
+  }
+
+  /***************************************************************************/
+  /* Keep an eventId which is not just the sequence number, as is the        */
+  /* default, for all the events.                                            */
+  /***************************************************************************/
+  evel_format_sequence(sequence, event->sequence);
+  if (strcmp(event->event_id, sequence) != 0)
+  {
+    tmpl->event_id = strdup(event->event_id);
+    if (tmpl->event_id == NULL)
+    {
+      log_error_state("Out of memory");
+      goto free_template;
+    }
+  }
+  if (event->last_epoch_microsec > event->start_epoch_microsec)
+  {
+    tmpl->epoch_interval =
+                     event->last_epoch_microsec - event->start_epoch_microsec;
+  }
+
+  /***************************************************************************/
+  /* Encode the event, noting the slots as we go.                            */
+  /***************************************************************************/
+  evel_throttle_lock_specs();
+  tmpl->throttle_generation = evel_get_throttle_generation(tmpl->domain);
+  evel_json_buffer_init_sized(jbuf,
+                              tmpl->encoded,
+                              tmpl->capacity,
+                              evel_get_throttle_spec(tmpl->domain));
+  jbuf->tmpl = tmpl;
+  evel_json_encode_event_object(jbuf, event);
+  evel_throttle_unlock_specs();
+  tmpl->size = jbuf->offset;
+
+  if (tmpl->slots_failed)
+  {
+    log_error_state("Out of memory");
+    goto free_template;
+  }
+  EVEL_DEBUG("Template of %d bytes with %d slots",
+             tmpl->size, tmpl->num_slots);
+  goto exit_label;
+
+free_template:
+  evel_free_template(tmpl);
+  tmpl = NULL;
+
+exit_label:
+  EVEL_EXIT();
+  return tmpl;
+}
+
+/**************************************************************************//**
+ * Note a value in the encoding of a template, which can be replaced in the
+ * events posted from it.
+ *
+ * Slots must be added in the order they are encoded.
+ *
+ * @param tmpl          Pointer to the ::EVEL_TEMPLATE.
+ * @param key           Identifier of the key of the value.
+ * @param type          The type of the value.
+ * @param offset        Offset of the value in the encoding.
+ * @param length        Length of the encoded value.
+ *****************************************************************************/
+void evel_template_add_slot(EVEL_TEMPLATE * tmpl,
+                            const EVEL_JSON_KEY_ID key,
+                            const EVEL_TEMPLATE_SLOT_TYPES type,
+                            const int offset,
+                            const int length)
+{
+  EVEL_TEMPLATE_SLOT * slots;
+  int max_slots;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(tmpl != NULL);
+  assert((tmpl->num_slots == 0) ||
+         (offset >= tmpl->slots[tmpl->num_slots - 1].offset +
+                    tmpl->slots[tmpl->num_slots - 1].length));
+
+  if (tmpl->num_slots == tmpl->max_slots)
+  {
+    max_slots = (tmpl->max_slots == 0) ? EVEL_TEMPLATE_INITIAL_SLOTS :
+                                         tmpl->max_slots * 2;
+    slots = realloc(tmpl->slots, max_slots * sizeof(EVEL_TEMPLATE_SLOT));
+    if (slots == NULL)
+    {
+      tmpl->slots_failed = true;
+      goto exit_label;
+    }
+    tmpl->slots = slots;
+    tmpl->max_slots = max_slots;
+  }
+
+  tmpl->slots[tmpl->num_slots].key = key;
+  tmpl->slots[tmpl->num_slots].type = type;
+  tmpl->slots[tmpl->num_slots].offset = offset;
+  tmpl->slots[tmpl->num_slots].length = length;
+  tmpl->num_slots++;
+
+exit_label:
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Find a value which can be set in a template.
+ *
+ * @param tmpl        Pointer to the ::EVEL_TEMPLATE.
+ * @param key         The JSON key of the value, such as "cpuIdle".
+ * @param occurrence  Which of the values with that key, counting from 0 in
+ *                    the order they are encoded.
+ *
+ * @returns The slot holding the value.
+ * @retval  -1  There is no such value in the template.
+ *****************************************************************************/
+int evel_template_find_slot(EVEL_TEMPLATE * tmpl,
+                            const char * const key,
+                            const int occurrence)
+{
+  int index;
+  int found = 0;
+  int slot = -1;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(tmpl != NULL);
+  assert(key != NULL);
+
+  for (index = 0; index < tmpl->num_slots; index++)
+  {
+    if (strcmp(evel_json_key_names[tmpl->slots[index].key], key) == 0)
+    {
+      if (found == occurrence)
+      {
+        slot = index;
+        break;
+      }
+      found++;
+    }
+  }
+
+  EVEL_EXIT();
+  return slot;
+}
+
+/**************************************************************************//**
+ * Set a double value in a template, for the events posted from it.
+ *
+ * @param tmpl        Pointer to the ::EVEL_TEMPLATE.
+ * @param slot        The slot, from ::evel_template_find_slot, which must
+ *                    hold a double.
+ * @param value       The value to set.
+ *****************************************************************************/
+void evel_template_set_double(EVEL_TEMPLATE * tmpl,
+                              const int slot,
+                              const double value)
+{
+  EVEL_JSON_BUFFER json_buffer;
+  EVEL_JSON_BUFFER * jbuf = &json_buffer;
+  char encoded[EVEL_TEMPLATE_MAX_VALUE_LEN];
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(tmpl != NULL);
+  assert((slot >= 0) && (slot < tmpl->num_slots));
+  assert(tmpl->slots[slot].type == EVEL_TEMPLATE_SLOT_DOUBLE);
+
+  evel_template_value_buffer(tmpl, jbuf, encoded);
+  evel_enc_double(jbuf, value);
+  if (!evel_template_replace(tmpl, slot, encoded, jbuf->offset))
+  {
+    log_error_state("Out of memory setting template value");
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Set an unsigned long long value in a template, for the events posted from
+ * it.
+ *
+ * @param tmpl        Pointer to the ::EVEL_TEMPLATE.
+ * @param slot        The slot, from ::evel_template_find_slot, which must
+ *                    hold an unsigned long long.
+ * @param value       The value to set.
+ *****************************************************************************/
+void evel_template_set_ull(EVEL_TEMPLATE * tmpl,
+                           const int slot,
+                           const unsigned long long value)
+{
+  EVEL_JSON_BUFFER json_buffer;
+  EVEL_JSON_BUFFER * jbuf = &json_buffer;
+  char encoded[EVEL_TEMPLATE_MAX_VALUE_LEN];
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(tmpl != NULL);
+  assert((slot >= 0) && (slot < tmpl->num_slots));
+  assert(tmpl->slots[slot].type == EVEL_TEMPLATE_SLOT_ULL);
+
+  evel_template_value_buffer(tmpl, jbuf, encoded);
+  evel_enc_ull(jbuf, value);
+  if (!evel_template_replace(tmpl, slot, encoded, jbuf->offset))
+  {
+    log_error_state("Out of memory setting template value");
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Post an event from a template.
+ *
+ * The event gets the next sequence number and, if the representative event's
+ * eventId was its sequence number, that as its eventId too.  Its
+ * lastEpochMicrosec is the current time, and its startEpochMicrosec the same
+ * time before that as in the representative event.
+ *
+ * @param tmpl        Pointer to the ::EVEL_TEMPLATE.
+ *
+ * @returns Status code
+ * @retval  EVEL_SUCCESS On success
+ * @retval  EVEL_TEMPLATE_STALE The throttle specification has changed since
+ *                              the template was made.
+ * @retval  "One of ::EVEL_ERR_CODES" On failure.
+ *****************************************************************************/
+EVEL_ERR_CODES evel_post_template(EVEL_TEMPLATE * tmpl)
+{
+  EVEL_ERR_CODES rc = EVEL_SUCCESS;
+  EVEL_JSON_BUFFER json_buffer;
+  EVEL_JSON_BUFFER * jbuf = &json_buffer;
+  EVENT_INTERNAL * event = NULL;
+  char encoded[EVEL_TEMPLATE_MAX_VALUE_LEN];
+  char event_id[EVEL_SEQUENCE_ID_LEN];
+  char * json = NULL;
+  unsigned int generation;
+  unsigned long long epoch;
+  int sequence;
+  int index;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(tmpl != NULL);
+
+  /***************************************************************************/
+  /* Fields suppressed by throttling are missing from the encoding, or       */
+  /* present when they should not be, once the specification changes.       */
+  /***************************************************************************/
+  evel_throttle_lock_specs();
+  generation = evel_get_throttle_generation(tmpl->domain);
+  evel_throttle_unlock_specs();
+  if (generation != tmpl->throttle_generation)
+  {
+    EVEL_INFO("Template for domain %d made before throttling changed",
+              tmpl->domain);
+    rc = EVEL_TEMPLATE_STALE;
+    goto exit_label;
+  }
+
+  /***************************************************************************/
+  /* Replace the values in the header which change with every event.         */
+  /***************************************************************************/
+  sequence = evel_next_event_sequence();
+  evel_format_sequence(event_id, sequence);
+  epoch = evel_time_microsec();
+
+  for (index = 0; index < tmpl->num_slots; index++)
+  {
+    evel_template_value_buffer(tmpl, jbuf, encoded);
+    switch (tmpl->slots[index].key)
+    {
+      case EVEL_KEY_EVENT_ID:
+        if (tmpl->event_id != NULL)
+        {
+          continue;
+        }
+        evel_enc_string(jbuf, event_id);
+        break;
+
+      case EVEL_KEY_SEQUENCE:
+        evel_enc_int(jbuf, sequence);
+        break;
+
+      case EVEL_KEY_LAST_EPOCH_MICROSEC:
+        evel_enc_ull(jbuf, epoch);
+        break;
+
+      case EVEL_KEY_START_EPOCH_MICROSEC:
+        evel_enc_ull(jbuf, epoch - tmpl->epoch_interval);
+        break;
+
+      default:
+        continue;
+    }
+
+    if (!evel_template_replace(tmpl, index, encoded, jbuf->offset))
+    {
+      log_error_state("Out of memory posting template");
+      rc = EVEL_OUT_OF_MEMORY;
+      goto exit_label;
+    }
+  }
+
+  /***************************************************************************/
+  /* Post a copy of the encoding, as if it had been encoded when posted.     */
+  /***************************************************************************/
+  json = malloc(tmpl->size + 1);
+  if (json == NULL)
+  {
+    log_error_state("Out of memory posting template");
+    rc = EVEL_OUT_OF_MEMORY;
+    goto exit_label;
+  }
+  memcpy(json, tmpl->encoded, tmpl->size);
+  json[tmpl->size] = '\0';
+
+  event = evel_new_encoded_internal_event(
+                    json,
+                    tmpl->size,
+                    (tmpl->event_id != NULL) ? tmpl->event_id : event_id);
+  if (event == NULL)
+  {
+    free(json);
+    rc = EVEL_OUT_OF_MEMORY;
+    goto exit_label;
+  }
+  event->header.memory_domain = tmpl->domain;
+  rc = evel_post_event(&event->header);
+
+exit_label:
+  EVEL_EXIT();
+  return rc;
+}
+
+/**************************************************************************//**
+ * Free a template.
+ *
+ * @note  It is safe to free a NULL pointer.
+ *
+ * @param tmpl        Pointer to the ::EVEL_TEMPLATE.
+ *****************************************************************************/
+void evel_free_template(EVEL_TEMPLATE * tmpl)
+{
+  EVEL_ENTER();
+
+  if (tmpl != NULL)
+  {
+    free(tmpl->encoded);
+    free(tmpl->slots);
+    free(tmpl->event_id);
+    free(tmpl);
+  }
+
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Initialize a ::EVEL_JSON_BUFFER for encoding a single value for a slot in
+ * a template.
+ *
+ * @param tmpl          Pointer to the ::EVEL_TEMPLATE.
+ * @param jbuf          Pointer to the ::EVEL_JSON_BUFFER to initialise.
+ * @param value         Storage for the value, of
+ *                      ::EVEL_TEMPLATE_MAX_VALUE_LEN bytes.
+ *****************************************************************************/
+static void evel_template_value_buffer(EVEL_TEMPLATE * tmpl,
+                                       EVEL_JSON_BUFFER * jbuf,
+                                       char * const value)
+{
+  evel_json_buffer_init(jbuf, value, EVEL_TEMPLATE_MAX_VALUE_LEN, NULL);
+  jbuf->encoding = tmpl->encoding;
+}
+
+/**************************************************************************//**
+ * Replace the value in a slot of a template.
+ *
+ * If the new value is a different length, the rest of the encoding is moved
+ * up or down to suit.
+ *
+ * @param tmpl          Pointer to the ::EVEL_TEMPLATE.
+ * @param index         The slot to replace.
+ * @param value         Pointer to the encoded value.
+ * @param length        Length of the encoded value.
+ * @returns true if the value was replaced, false if out of memory.
+ *****************************************************************************/
+static bool evel_template_replace(EVEL_TEMPLATE * tmpl,
+                                  const int index,
+                                  const char * const value,
+                                  const int length)
+{
+  EVEL_TEMPLATE_SLOT * slot = &tmpl->slots[index];
+  const int change = length - slot->length;
+  char * encoded;
+  int capacity;
+  int later;
+
+  if (change != 0)
+  {
+    /*************************************************************************/
+    /* Grow with some room to spare, since counters tend to keep growing.    */
+    /*************************************************************************/
+    if (tmpl->size + change >= tmpl->capacity)
+    {
+      capacity = tmpl->size + change + 1;
+      capacity += capacity / 4;
+      encoded = realloc(tmpl->encoded, capacity);
+      if (encoded == NULL)
+      {
+        return false;
+      }
+      tmpl->encoded = encoded;
+      tmpl->capacity = capacity;
+    }
+
+    memmove(tmpl->encoded + slot->offset + length,
+            tmpl->encoded + slot->offset + slot->length,
+            tmpl->size - slot->offset - slot->length);
+    tmpl->size += change;
+    slot->length = length;
+    for (later = index + 1; later < tmpl->num_slots; later++)
+    {
+      tmpl->slots[later].offset += change;
+    }
+  }
+
+  memcpy(tmpl->encoded + slot->offset, value, length);
+  return true;
+}
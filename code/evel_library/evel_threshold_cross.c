@@ -80,13 +80,13 @@ EVENT_THRESHOLD_CROSS * evel_new_threshold_cross(
 	/***************************************************************************/
 	/* Allocate the Threshold crossing event.                                  */
 	/***************************************************************************/
-	event = malloc(sizeof(EVENT_THRESHOLD_CROSS));
+	event = evel_event_alloc(EVEL_DOMAIN_THRESHOLD_CROSS);
 	if (event == NULL)
 	{
 	    log_error_state("Out of memory");
 	    goto exit_label;
 	}
-	memset(event, 0, sizeof(EVENT_THRESHOLD_CROSS));
+	event->header.arena = evel_new_event_arena();
 	EVEL_DEBUG("New Threshold Cross event is at %lp", event);
 
   /***************************************************************************/
@@ -98,12 +98,17 @@ EVENT_THRESHOLD_CROSS * evel_new_threshold_cross(
   event->minor_version = EVEL_THRESHOLD_CROSS_MINOR_VERSION;
 
 
-  event->additionalParameters.criticality = strdup(tcriticality);
-  event->additionalParameters.name = strdup(tname);
-  event->additionalParameters.thresholdCrossed = strdup(tthresholdCrossed);
-  event->additionalParameters.value = strdup(tvalue);
+  event->additionalParameters.criticality =
+    evel_arena_strdup(event->header.arena, tcriticality);
+  event->additionalParameters.name =
+    evel_arena_strdup(event->header.arena, tname);
+  event->additionalParameters.thresholdCrossed =
+    evel_arena_strdup(event->header.arena, tthresholdCrossed);
+  event->additionalParameters.value =
+    evel_arena_strdup(event->header.arena, tvalue);
   event->alertAction      =  talertAction;
-  event->alertDescription =  strdup(talertDescription); 
+  event->alertDescription =  evel_arena_strdup(event->header.arena,
+                                               talertDescription);
   event->alertType        =  talertType;
   event->collectionTimestamp =   tcollectionTimestamp; 
   event->eventSeverity       =   teventSeverity;
@@ -168,10 +173,10 @@ void evel_threshold_cross_alertid_add(EVENT_THRESHOLD_CROSS * const event,char *
   assert(alertid != NULL);
 
   EVEL_DEBUG("Adding AlertId=%s", alertid);
-  alid = strdup(alertid);
+  alid = evel_arena_strdup(event->header.arena, alertid);
   assert(alid != NULL);
 
-  dlist_push_last(&event->alertidList, alid);
+  evel_arena_list_push(event->header.arena, &event->alertidList, alid);
 
   EVEL_EXIT();
 }
@@ -204,14 +209,14 @@ void evel_threshold_cross_addl_info_add(EVENT_THRESHOLD_CROSS * const event, con
   assert(value != NULL);
 
   EVEL_DEBUG("Adding name=%s value=%s", name, value);
-  nv_pair = malloc(sizeof(OTHER_FIELD));
+  nv_pair = evel_arena_alloc(event->header.arena, sizeof(OTHER_FIELD));
   assert(nv_pair != NULL);
-  nv_pair->name = strdup(name);
-  nv_pair->value = strdup(value);
+  nv_pair->name = evel_arena_strdup(event->header.arena, name);
+  nv_pair->value = evel_arena_strdup(event->header.arena, value);
   assert(nv_pair->name != NULL);
   assert(nv_pair->value != NULL);
 
-  dlist_push_last(&event->additional_info, nv_pair);
+  evel_arena_list_push(event->header.arena, &event->additional_info, nv_pair);
 
   EVEL_EXIT();
 }
@@ -291,9 +296,10 @@ void evel_free_threshold_cross(EVENT_THRESHOLD_CROSS * const event)
     assert(event->header.event_domain == EVEL_DOMAIN_THRESHOLD_CROSS);
     assert(sheader != NULL);
 
-    evel_set_option_string(&event->possibleRootCause,
-                         sheader,
-                         "Rootcause value");
+    evel_arena_set_option_string(event->header.arena,
+                                 &event->possibleRootCause,
+                                 sheader,
+                                 "Rootcause value");
 
     EVEL_EXIT();
   }
@@ -313,9 +319,10 @@ void evel_free_threshold_cross(EVENT_THRESHOLD_CROSS * const event)
     assert(event->header.event_domain == EVEL_DOMAIN_THRESHOLD_CROSS);
     assert(sheader != NULL);
 
-    evel_set_option_string(&event->networkService,
-                         sheader,
-                         "Networking service value");
+    evel_arena_set_option_string(event->header.arena,
+                                 &event->networkService,
+                                 sheader,
+                                 "Networking service value");
 
 	    EVEL_EXIT();
   }
@@ -335,9 +342,10 @@ void evel_free_threshold_cross(EVENT_THRESHOLD_CROSS * const event)
             assert(event->header.event_domain == EVEL_DOMAIN_THRESHOLD_CROSS);
 	    assert(sheader != NULL);
 
-	    evel_set_option_string(&event->interfaceName,
-	                           sheader,
-	                           "TCA Interface name");
+	    evel_arena_set_option_string(event->header.arena,
+	                                 &event->interfaceName,
+	                                 sheader,
+	                                 "TCA Interface name");
 	    EVEL_EXIT();
   }
     
@@ -356,9 +364,10 @@ void evel_free_threshold_cross(EVENT_THRESHOLD_CROSS * const event)
             assert(event->header.event_domain == EVEL_DOMAIN_THRESHOLD_CROSS);
 	    assert(sheader != NULL);
 
-	    evel_set_option_string(&event->elementType,
-	                           sheader,
-	                           "TCA Element type value");
+	    evel_arena_set_option_string(event->header.arena,
+	                                 &event->elementType,
+	                                 sheader,
+	                                 "TCA Element type value");
 	    EVEL_EXIT();
   }
 
@@ -377,9 +386,10 @@ void evel_free_threshold_cross(EVENT_THRESHOLD_CROSS * const event)
             assert(event->header.event_domain == EVEL_DOMAIN_THRESHOLD_CROSS);
 	    assert(sheader != NULL);
 
-	    evel_set_option_string(&event->dataCollector,
-	                           sheader,
-	                           "Datacollector value");
+	    evel_arena_set_option_string(event->header.arena,
+	                                 &event->dataCollector,
+	                                 sheader,
+	                                 "Datacollector value");
 	    EVEL_EXIT();
   }
     
@@ -400,9 +410,10 @@ void evel_free_threshold_cross(EVENT_THRESHOLD_CROSS * const event)
             assert(event->header.event_domain == EVEL_DOMAIN_THRESHOLD_CROSS);
 	    assert(sheader != NULL);
 
-	    evel_set_option_string(&event->alertValue,
-	                           sheader,
-	                           "Alert value");
+	    evel_arena_set_option_string(event->header.arena,
+	                                 &event->alertValue,
+	                                 sheader,
+	                                 "Alert value");
 	    EVEL_EXIT();
   }
 
@@ -423,15 +434,15 @@ void evel_json_encode_perf_counter( EVEL_JSON_BUFFER * jbuf, PERF_COUNTER *pcoun
   assert(jbuf != NULL);
   assert(pcounter != NULL);
 
-  evel_json_open_named_object(jbuf, "additionalParameters");
+  evel_json_open_named_object(jbuf, EVEL_KEY_ADDITIONAL_PARAMETERS);
 
   /***************************************************************************/
   /* Mandatory parameters.                                                   */
   /***************************************************************************/
-  evel_enc_kv_string(jbuf, "criticality", pcounter->criticality);
-  evel_enc_kv_string(jbuf, "name", pcounter->name);
-  evel_enc_kv_string(jbuf, "thresholdCrossed", pcounter->name);
-  evel_enc_kv_string(jbuf, "value", pcounter->value);
+  evel_enc_kv_string(jbuf, EVEL_KEY_CRITICALITY, pcounter->criticality);
+  evel_enc_kv_string(jbuf, EVEL_KEY_NAME, pcounter->name);
+  evel_enc_kv_string(jbuf, EVEL_KEY_THRESHOLD_CROSSED, pcounter->name);
+  evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, pcounter->value);
 
   evel_json_close_object(jbuf);
 
@@ -460,39 +471,35 @@ void evel_json_encode_threshold_cross(EVEL_JSON_BUFFER * const jbuf,
   assert(event->header.event_domain == EVEL_DOMAIN_THRESHOLD_CROSS);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "thresholdCrossingAlert");
+  evel_json_open_named_object(jbuf, EVEL_KEY_THRESHOLD_CROSSING_ALERT);
 
   /***************************************************************************/
   /* Mandatory fields                                                        */
   /***************************************************************************/
   evel_json_encode_perf_counter(jbuf, &event->additionalParameters);
-  evel_enc_kv_int(jbuf, "alertAction", event->alertAction);
-  evel_enc_kv_string(jbuf, "alertDescription", event->alertDescription);
-  evel_enc_kv_int(jbuf, "alertType", event->alertType);
+  evel_enc_kv_int(jbuf, EVEL_KEY_ALERT_ACTION, event->alertAction);
+  evel_enc_kv_string(jbuf, EVEL_KEY_ALERT_DESCRIPTION, event->alertDescription);
+  evel_enc_kv_int(jbuf, EVEL_KEY_ALERT_TYPE, event->alertType);
   evel_enc_kv_ull(
-    jbuf, "collectionTimestamp", event->collectionTimestamp);
-  evel_enc_kv_int(jbuf, "eventSeverity", event->eventSeverity);
+    jbuf, EVEL_KEY_COLLECTION_TIMESTAMP, event->collectionTimestamp);
+  evel_enc_kv_int(jbuf, EVEL_KEY_EVENT_SEVERITY, event->eventSeverity);
   evel_enc_kv_ull(
-    jbuf, "eventStartTimestamp", event->eventStartTimestamp);
+    jbuf, EVEL_KEY_EVENT_START_TIMESTAMP, event->eventStartTimestamp);
 
   /***************************************************************************/
   /* Optional fields                                                         */
   /***************************************************************************/
-  evel_enc_kv_opt_string(jbuf, "alertValue", &event->alertValue);
-  evel_enc_kv_opt_string(jbuf, "dataCollector", &event->dataCollector);
-  evel_enc_kv_opt_string(jbuf, "elementType", &event->elementType);
-  evel_enc_kv_opt_string(jbuf, "interfaceName", &event->interfaceName);
-  evel_enc_kv_opt_string(jbuf, "networkService", &event->networkService);
-  evel_enc_kv_opt_string(jbuf, "possibleRootCause", &event->possibleRootCause);
-
-  /***************************************************************************/
-  /* Checkpoint, so that we can wind back if all fields are suppressed.      */
-  /***************************************************************************/
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "additionalFields"))
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_ALERT_VALUE, &event->alertValue);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_DATA_COLLECTOR, &event->dataCollector);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_ELEMENT_TYPE, &event->elementType);
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_INTERFACE_NAME, &event->interfaceName);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_NETWORK_SERVICE, &event->networkService);
+  evel_enc_kv_opt_string(
+    jbuf, EVEL_KEY_POSSIBLE_ROOT_CAUSE, &event->possibleRootCause);
+
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_ADDITIONAL_FIELDS))
   {
-    bool added = false;
-
     dlist_item = dlist_get_first(&event->additional_info);
     while (dlist_item != NULL)
     {
@@ -500,29 +507,20 @@ void evel_json_encode_threshold_cross(EVEL_JSON_BUFFER * const jbuf,
       assert(nv_pair != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "additionalFields",
+                                          EVEL_KEY_ADDITIONAL_FIELDS,
                                           nv_pair->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", nv_pair->name);
-        evel_enc_kv_string(jbuf, "value", nv_pair->value);
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, nv_pair->name);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, nv_pair->value);
         evel_json_close_object(jbuf);
-        added = true;
       }
       dlist_item = dlist_get_next(dlist_item);
     }
     evel_json_close_list(jbuf);
-
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
   evel_enc_version(jbuf,
-                   "thresholdCrossingFieldsVersion",
+                   EVEL_KEY_THRESHOLD_CROSSING_FIELDS_VERSION,
                    event->major_version,
                    event->minor_version);
 
@@ -43,7 +43,6 @@
 #include <stdlib.h>
 #include <limits.h>
 #include <pthread.h>
-#include <search.h>
 
 #include "evel_throttle.h"
 
@@ -56,6 +55,12 @@
 /*****************************************************************************/
 static EVEL_THROTTLE_SPEC * evel_throttle_spec[EVEL_MAX_DOMAINS];
 
+/*****************************************************************************/
+/* Generation of the throttle specification for each domain, bumped each     */
+/* time it is replaced.  Protected by evel_throttle_spec_lock.               */
+/*****************************************************************************/
+static unsigned int evel_throttle_spec_generation[EVEL_MAX_DOMAINS];
+
 /*****************************************************************************/
 /* The current measurement interval.  Default: MEASUREMENT_INTERVAL_UKNOWN.  */
 /* Must be protected by evel_measurement_interval_mutex.                     */
@@ -68,6 +73,12 @@ static int evel_measurement_interval;
 /*****************************************************************************/
 static pthread_mutex_t evel_measurement_interval_mutex;
 
+/*****************************************************************************/
+/* Lock protecting ::evel_throttle_spec from contention between threads      */
+/* encoding events, and the EVEL event handler replacing a specification.    */
+/*****************************************************************************/
+static pthread_rwlock_t evel_throttle_spec_lock;
+
 /*****************************************************************************/
 /* Flag stating that we have received a "provideThrottlingState" command.    */
 /* Set during JSON processing and cleared on sending the throttling state.   */
@@ -155,8 +166,18 @@ static const char * evel_domain_strings[EVEL_MAX_DOMAINS] = {
 /* Local prototypes.                                                         */
 /*****************************************************************************/
 static void evel_throttle_finalize(EVEL_THROTTLE_SPEC * throttle_spec);
-static struct hsearch_data * evel_throttle_hash_create(DLIST * hash_keys);
+static EVEL_JSON_KEY_ID evel_throttle_json_key(const char * const name);
+static int evel_throttle_json_key_compare(const void * name,
+                                          const void * key_name);
+static unsigned int evel_throttle_name_hash(const char * name);
+static void evel_throttle_name_set_create(EVEL_THROTTLE_NAME_SET * name_set,
+                                          DLIST * names);
+static bool evel_throttle_name_set_contains(
+                                   const EVEL_THROTTLE_NAME_SET * name_set,
+                                   const char * const name);
 static void evel_throttle_free(EVEL_THROTTLE_SPEC * throttle_spec);
+static size_t evel_throttle_size(EVEL_THROTTLE_SPEC * throttle_spec);
+static size_t evel_throttle_names_size(DLIST * names);
 static void evel_throttle_free_nv_pair(EVEL_SUPPRESSED_NV_PAIRS * nv_pairs);
 static void evel_init_json_stack(EVEL_JSON_STACK * json_stack,
                                  const MEMORY_CHUNK * const chunk);
@@ -247,14 +268,56 @@ EVEL_THROTTLE_SPEC * evel_get_throttle_spec(EVEL_EVENT_DOMAINS domain)
 }
 
 /**************************************************************************//**
- * Determine whether a field_name should be suppressed.
+ * Return the generation of the ::EVEL_THROTTLE_SPEC for a given domain, which
+ * changes whenever the specification is replaced.
+ *
+ * @note  Except on the event handler thread, ::evel_throttle_lock_specs must
+ *        be held.
+ *
+ * @param domain        The domain for which to return the generation.
+ *****************************************************************************/
+unsigned int evel_get_throttle_generation(EVEL_EVENT_DOMAINS domain)
+{
+  assert(domain < EVEL_MAX_DOMAINS);
+
+  return evel_throttle_spec_generation[domain];
+}
+
+/**************************************************************************//**
+ * Lock the throttle specifications against replacement while encoding.
+ *
+ * Any ::EVEL_THROTTLE_SPEC returned by ::evel_get_throttle_spec may only be
+ * used by threads other than the event handler while this is held.  It must
+ * not be taken recursively.
+ *****************************************************************************/
+void evel_throttle_lock_specs()
+{
+  int pthread_rc;
+
+  pthread_rc = pthread_rwlock_rdlock(&evel_throttle_spec_lock);
+  assert(pthread_rc == 0);
+}
+
+/**************************************************************************//**
+ * Release the lock taken by ::evel_throttle_lock_specs.
+ *****************************************************************************/
+void evel_throttle_unlock_specs()
+{
+  int pthread_rc;
+
+  pthread_rc = pthread_rwlock_unlock(&evel_throttle_spec_lock);
+  assert(pthread_rc == 0);
+}
+
+/**************************************************************************//**
+ * Determine whether a field should be suppressed.
  *
  * @param throttle_spec Throttle specification for the domain being encoded.
- * @param field_name    The field name to encoded or suppress.
- * @return true if the field_name should be suppressed, false otherwise.
+ * @param key           Identifier of the field to encode or suppress.
+ * @return true if the field should be suppressed, false otherwise.
  *****************************************************************************/
 bool evel_throttle_suppress_field(EVEL_THROTTLE_SPEC * throttle_spec,
-                                  const char * const field_name)
+                                  const EVEL_JSON_KEY_ID key)
 {
   bool suppress = false;
 
@@ -263,20 +326,15 @@ bool evel_throttle_suppress_field(EVEL_THROTTLE_SPEC * throttle_spec,
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
-  assert(field_name != NULL);
+  assert(key < EVEL_MAX_JSON_KEYS);
 
   /***************************************************************************/
-  /* If the throttle spec and hash table exist, query the field_names table. */
+  /* If the throttle spec exists, test the field's bit in its bitmap.        */
   /***************************************************************************/
-  if ((throttle_spec != NULL) && (throttle_spec->hash_field_names != NULL))
+  if (throttle_spec != NULL)
   {
-    ENTRY hash_query;
-    ENTRY * hash_result;
-    hash_query.key = (char * const) field_name;
-    suppress = (hsearch_r(hash_query,
-                          FIND,
-                          &hash_result,
-                          throttle_spec->hash_field_names) != 0);
+    suppress = ((throttle_spec->suppressed_fields[key / 32] &
+                 (1u << (key % 32))) != 0);
   }
 
   EVEL_EXIT();
@@ -288,16 +346,15 @@ bool evel_throttle_suppress_field(EVEL_THROTTLE_SPEC * throttle_spec,
  * Determine whether a name-value pair should be allowed (not suppressed).
  *
  * @param throttle_spec Throttle specification for the domain being encoded.
- * @param field_name    The field name holding the name-value pairs.
+ * @param field_key     Identifier of the field holding the name-value pairs.
  * @param name          The name of the name-value pair to encoded or suppress.
  * @return true if the name-value pair should be suppressed, false otherwise.
  *****************************************************************************/
 bool evel_throttle_suppress_nv_pair(EVEL_THROTTLE_SPEC * throttle_spec,
-                                    const char * const field_name,
+                                    const EVEL_JSON_KEY_ID field_key,
                                     const char * const name)
 {
   EVEL_SUPPRESSED_NV_PAIRS * nv_pairs;
-  bool hit = false;
   bool suppress = false;
 
   EVEL_ENTER();
@@ -305,42 +362,22 @@ bool evel_throttle_suppress_nv_pair(EVEL_THROTTLE_SPEC * throttle_spec,
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
-  assert(field_name != NULL);
+  assert(field_key < EVEL_MAX_JSON_KEYS);
   assert(name != NULL);
 
   /***************************************************************************/
-  /* If the throttle spec and hash table exist, query the nv_pairs table.    */
+  /* If the throttle spec has an entry for the field, query its name set.    */
   /***************************************************************************/
-  if ((throttle_spec != NULL) && (throttle_spec->hash_nv_pairs_list != NULL))
+  if (throttle_spec != NULL)
   {
-    ENTRY hash_query;
-    ENTRY * hash_result;
-    hash_query.key = (char * const) field_name;
-    hit = (hsearch_r(hash_query,
-                     FIND,
-                     &hash_result,
-                     throttle_spec->hash_nv_pairs_list) != 0);
-    if (hit)
+    nv_pairs = throttle_spec->suppressed_nv_pairs[field_key];
+    if (nv_pairs != NULL)
     {
-      nv_pairs = hash_result->data;
+      suppress = evel_throttle_name_set_contains(&nv_pairs->nv_pair_names,
+                                                 name);
     }
   }
 
-  /***************************************************************************/
-  /* If we got a hit, and the nv_pairs and hash table exist, query the       */
-  /* nv_pairs table.                                                         */
-  /***************************************************************************/
-  if (hit && (nv_pairs != NULL) && (nv_pairs->hash_nv_pair_names != NULL))
-  {
-    ENTRY hash_query;
-    ENTRY * hash_result;
-    hash_query.key = (char * const) name;
-    suppress = (hsearch_r(hash_query,
-                          FIND,
-                          &hash_result,
-                          nv_pairs->hash_nv_pair_names) != 0);
-  }
-
   EVEL_EXIT();
 
   return suppress;
@@ -354,6 +391,7 @@ bool evel_throttle_suppress_nv_pair(EVEL_THROTTLE_SPEC * throttle_spec,
 void evel_throttle_initialize()
 {
   int pthread_rc;
+  pthread_rwlockattr_t rwlock_attr;
   int ii;
 
   EVEL_ENTER();
@@ -366,6 +404,20 @@ void evel_throttle_initialize()
   pthread_rc = pthread_mutex_init(&evel_measurement_interval_mutex, NULL);
   assert(pthread_rc == 0);
 
+  /***************************************************************************/
+  /* Prefer the writer so that a steady stream of encoding threads can't     */
+  /* hold off a new throttle specification indefinitely.                     */
+  /***************************************************************************/
+  pthread_rc = pthread_rwlockattr_init(&rwlock_attr);
+  assert(pthread_rc == 0);
+  pthread_rc = pthread_rwlockattr_setkind_np(
+                  &rwlock_attr,
+                  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+  assert(pthread_rc == 0);
+  pthread_rc = pthread_rwlock_init(&evel_throttle_spec_lock, &rwlock_attr);
+  assert(pthread_rc == 0);
+  pthread_rwlockattr_destroy(&rwlock_attr);
+
   evel_measurement_interval = EVEL_MEASUREMENT_INTERVAL_UKNOWN;
 
   EVEL_EXIT();
@@ -387,6 +439,7 @@ void evel_throttle_terminate()
   {
     if (evel_throttle_spec[ii] != NULL)
     {
+      evel_memory_release_bytes(ii, evel_throttle_spec[ii]->memory_size);
       evel_throttle_free(evel_throttle_spec[ii]);
       evel_throttle_spec[ii] = NULL;
     }
@@ -395,22 +448,27 @@ void evel_throttle_terminate()
   pthread_rc = pthread_mutex_destroy(&evel_measurement_interval_mutex);
   assert(pthread_rc == 0);
 
+  pthread_rc = pthread_rwlock_destroy(&evel_throttle_spec_lock);
+  assert(pthread_rc == 0);
+
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
  * Finalize a single ::EVEL_THROTTLE_SPEC.
  *
- * Now that the specification is collected, build hash tables to simplify the
- * throttling itself.
+ * Now that the specification is collected, compile it into a form which
+ * makes the throttling itself cheap: a bitmap of suppressed fields, and a
+ * perfect hash set of suppressed names for each name-value pair field, both
+ * indexed by ::EVEL_JSON_KEY_ID.  Field names which the encoders never
+ * write are ignored.
  *
  * @param throttle_spec The ::EVEL_THROTTLE_SPEC to finalize.
  *****************************************************************************/
 void evel_throttle_finalize(EVEL_THROTTLE_SPEC * throttle_spec)
 {
-  int nv_pairs_count;
   DLIST_ITEM * dlist_item;
-  ENTRY * add_result;
+  EVEL_JSON_KEY_ID key;
 
   EVEL_ENTER();
 
@@ -420,126 +478,303 @@ void evel_throttle_finalize(EVEL_THROTTLE_SPEC * throttle_spec)
   assert(throttle_spec != NULL);
 
   /***************************************************************************/
-  /* Populate the hash table for suppressed field names.                     */
+  /* Set the bits for suppressed field names.                                */
   /***************************************************************************/
-  throttle_spec->hash_field_names =
-             evel_throttle_hash_create(&throttle_spec->suppressed_field_names);
-
-  /***************************************************************************/
-  /* Create the hash table for suppressed nv pairs.                          */
-  /***************************************************************************/
-  nv_pairs_count = dlist_count(&throttle_spec->suppressed_nv_pairs_list);
-  if (nv_pairs_count > 0)
+  dlist_item = dlist_get_first(&throttle_spec->suppressed_field_names);
+  while (dlist_item != NULL)
   {
-    throttle_spec->hash_nv_pairs_list = calloc(1, sizeof(struct hsearch_data));
-    assert(throttle_spec->hash_nv_pairs_list != NULL);
-
-    /*************************************************************************/
-    /* Provide plenty of space in the table - see hcreate_r notes.           */
-    /*************************************************************************/
-    if (hcreate_r(nv_pairs_count * 2, throttle_spec->hash_nv_pairs_list) == 0)
+    assert(dlist_item->item != NULL);
+    key = evel_throttle_json_key(dlist_item->item);
+    if (key < EVEL_MAX_JSON_KEYS)
     {
-      EVEL_ERROR("Failed to create hash table");
-      free(throttle_spec->hash_nv_pairs_list);
-      throttle_spec->hash_nv_pairs_list = NULL;
+      throttle_spec->suppressed_fields[key / 32] |= (1u << (key % 32));
     }
+    else
+    {
+      EVEL_DEBUG("Ignoring unknown field: %s", dlist_item->item);
+    }
+    dlist_item = dlist_get_next(dlist_item);
   }
 
   /***************************************************************************/
-  /* Populate the hash tables under suppressed field names.                  */
+  /* Compile the name sets under suppressed nv pair field names.  As before, */
+  /* the first entry for a given field name is the one that applies.         */
   /***************************************************************************/
   dlist_item = dlist_get_first(&throttle_spec->suppressed_nv_pairs_list);
   while (dlist_item != NULL)
   {
     EVEL_SUPPRESSED_NV_PAIRS * nv_pairs = dlist_item->item;
-    ENTRY hash_add;
 
-    /*************************************************************************/
-    /* Set the key to the string, and the item to the nv_pairs.              */
-    /*************************************************************************/
     assert(nv_pairs != NULL);
-    hash_add.key = nv_pairs->nv_pair_field_name;
-    hash_add.data = nv_pairs;
-    hsearch_r(hash_add, ENTER, &add_result, throttle_spec->hash_nv_pairs_list);
+    evel_throttle_name_set_create(&nv_pairs->nv_pair_names,
+                                  &nv_pairs->suppressed_nv_pair_names);
 
-    /*************************************************************************/
-    /* Create the nv_pair_names hash since we're in here.                    */
-    /*************************************************************************/
-    nv_pairs->hash_nv_pair_names =
-      evel_throttle_hash_create(&nv_pairs->suppressed_nv_pair_names);
+    key = evel_throttle_json_key(nv_pairs->nv_pair_field_name);
+    if (key < EVEL_MAX_JSON_KEYS)
+    {
+      if (throttle_spec->suppressed_nv_pairs[key] == NULL)
+      {
+        throttle_spec->suppressed_nv_pairs[key] = nv_pairs;
+      }
+    }
+    else
+    {
+      EVEL_DEBUG("Ignoring unknown nv pair field: %s",
+                 nv_pairs->nv_pair_field_name);
+    }
 
     dlist_item = dlist_get_next(dlist_item);
   }
 
+  throttle_spec->memory_size = evel_throttle_size(throttle_spec);
+
   EVEL_EXIT();
 }
 
 /**************************************************************************//**
- * Create and populate a hash table from a DLIST of keys.
+ * Count the bytes held by a finalized ::EVEL_THROTTLE_SPEC.
+ *
+ * @param throttle_spec The ::EVEL_THROTTLE_SPEC to size.
+ * @return The size in bytes.
+ *****************************************************************************/
+static size_t evel_throttle_size(EVEL_THROTTLE_SPEC * throttle_spec)
+{
+  DLIST_ITEM * dlist_item;
+  EVEL_SUPPRESSED_NV_PAIRS * nv_pairs;
+  size_t size;
+
+  size = sizeof(EVEL_THROTTLE_SPEC) +
+         evel_throttle_names_size(&throttle_spec->suppressed_field_names);
+
+  if (throttle_spec->suppressed_nv_pairs_list.slots != NULL)
+  {
+    size += throttle_spec->suppressed_nv_pairs_list.capacity *
+            sizeof(DLIST_ITEM);
+  }
+  dlist_item = dlist_get_first(&throttle_spec->suppressed_nv_pairs_list);
+  while (dlist_item != NULL)
+  {
+    nv_pairs = dlist_item->item;
+    size += sizeof(EVEL_SUPPRESSED_NV_PAIRS) +
+            evel_throttle_names_size(&nv_pairs->suppressed_nv_pair_names);
+    if (nv_pairs->nv_pair_field_name != NULL)
+    {
+      size += strlen(nv_pairs->nv_pair_field_name) + 1;
+    }
+    if (nv_pairs->nv_pair_names.slots != NULL)
+    {
+      size += (nv_pairs->nv_pair_names.mask + 1) *
+              sizeof(nv_pairs->nv_pair_names.slots[0]);
+    }
+    dlist_item = dlist_get_next(dlist_item);
+  }
+
+  return size;
+}
+
+/**************************************************************************//**
+ * Count the bytes held by a DLIST of names, other than the DLIST itself.
  *
- * @param hash_keys     Pointer to a DLIST of hash table keys.
- * @return Pointer to the created hash-table, or NULL on failure.
+ * @param names         Pointer to the DLIST of names.
+ * @return The size in bytes.
  *****************************************************************************/
-struct hsearch_data * evel_throttle_hash_create(DLIST * hash_keys)
+static size_t evel_throttle_names_size(DLIST * names)
 {
-  int key_count;
-  struct hsearch_data * hash_table;
-  ENTRY * add_result;
+  DLIST_ITEM * dlist_item;
+  size_t size = 0;
+
+  if (names->slots != NULL)
+  {
+    size += names->capacity * sizeof(DLIST_ITEM);
+  }
+  dlist_item = dlist_get_first(names);
+  while (dlist_item != NULL)
+  {
+    size += strlen(dlist_item->item) + 1;
+    dlist_item = dlist_get_next(dlist_item);
+  }
+
+  return size;
+}
+
+/**************************************************************************//**
+ * Look up the ::EVEL_JSON_KEY_ID with a given name.
+ *
+ * @param name          The JSON field name.
+ * @return The key, or ::EVEL_MAX_JSON_KEYS if the name is not a known key.
+ *****************************************************************************/
+static EVEL_JSON_KEY_ID evel_throttle_json_key(const char * const name)
+{
+  const char * const * key_name;
+  EVEL_JSON_KEY_ID key = EVEL_MAX_JSON_KEYS;
 
   EVEL_ENTER();
 
   /***************************************************************************/
   /* Check preconditions.                                                    */
   /***************************************************************************/
-  assert(hash_keys != NULL);
+  assert(name != NULL);
 
   /***************************************************************************/
-  /* Count the keys and if there are any, populate the hash table with them. */
+  /* The key names are held in strcmp() order, so we can binary search them. */
   /***************************************************************************/
-  key_count = dlist_count(hash_keys);
-  if (key_count > 0)
+  key_name = bsearch(name,
+                     evel_json_key_names,
+                     EVEL_MAX_JSON_KEYS,
+                     sizeof(evel_json_key_names[0]),
+                     evel_throttle_json_key_compare);
+  if (key_name != NULL)
   {
-    EVEL_DEBUG("Populating table for %d keys", key_count);
+    key = key_name - evel_json_key_names;
+  }
 
-    hash_table = calloc(1, sizeof(struct hsearch_data));
-    assert(hash_table != NULL);
+  EVEL_EXIT();
 
-    /*************************************************************************/
-    /* We need to leave plenty of space in the table - see hcreate_r notes.  */
-    /*************************************************************************/
-    if (hcreate_r(key_count * 2, hash_table) != 0)
-    {
-      DLIST_ITEM * dlist_item;
-      dlist_item = dlist_get_first(hash_keys);
-      while (dlist_item != NULL)
-      {
-        assert(dlist_item->item != NULL);
-
-        /*********************************************************************/
-        /* Set the key and data to the item, which is a string in this case. */
-        /*********************************************************************/
-        ENTRY hash_add;
-        hash_add.key = dlist_item->item;
-        hash_add.data = dlist_item->item;
-        hsearch_r(hash_add, ENTER, &add_result, hash_table);
-        dlist_item = dlist_get_next(dlist_item);
-      }
-    }
-    else
+  return key;
+}
+
+/**************************************************************************//**
+ * Comparison function for binary searching ::evel_json_key_names.
+ *
+ * @param name          The name being searched for.
+ * @param key_name      Pointer to an entry in ::evel_json_key_names.
+ * @return As for strcmp().
+ *****************************************************************************/
+static int evel_throttle_json_key_compare(const void * name,
+                                          const void * key_name)
+{
+  return strcmp(name, *(const char * const *) key_name);
+}
+
+/**************************************************************************//**
+ * FNV-1a hash of a name, for ::EVEL_THROTTLE_NAME_SET.
+ *
+ * @param name          The name to hash.
+ * @return The hash value.
+ *****************************************************************************/
+static unsigned int evel_throttle_name_hash(const char * name)
+{
+  unsigned int hash = 2166136261u;
+
+  while (*name != '\0')
+  {
+    hash ^= (unsigned char) *name++;
+    hash *= 16777619u;
+  }
+
+  /***************************************************************************/
+  /* Fold the high bits down, since only the low bits select a slot.         */
+  /***************************************************************************/
+  return hash ^ (hash >> 16);
+}
+
+/**************************************************************************//**
+ * Compile a DLIST of names into a ::EVEL_THROTTLE_NAME_SET.
+ *
+ * The table has at least twice as many slots as there are names, and a name
+ * whose slot is taken goes in the next free one.  This always succeeds, in
+ * memory proportional to the number of names.
+ *
+ * @param name_set      Pointer to the ::EVEL_THROTTLE_NAME_SET to populate.
+ * @param names         Pointer to a DLIST of names.
+ *****************************************************************************/
+static void evel_throttle_name_set_create(EVEL_THROTTLE_NAME_SET * name_set,
+                                          DLIST * names)
+{
+  DLIST_ITEM * dlist_item;
+  unsigned int num_slots;
+  unsigned int slot;
+  int name_count;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(name_set != NULL);
+  assert(names != NULL);
+
+  name_set->mask = 0;
+  name_set->slots = NULL;
+
+  name_count = dlist_count(names);
+  if (name_count == 0)
+  {
+    goto exit_label;
+  }
+
+  num_slots = 2;
+  while (num_slots < 2 * (unsigned int) name_count)
+  {
+    num_slots <<= 1;
+  }
+
+  name_set->slots = calloc(num_slots, sizeof(name_set->slots[0]));
+  assert(name_set->slots != NULL);
+  name_set->mask = num_slots - 1;
+
+  /***************************************************************************/
+  /* Probe from each name's slot for a free one.  Duplicate names are only   */
+  /* stored once.                                                            */
+  /***************************************************************************/
+  dlist_item = dlist_get_first(names);
+  while (dlist_item != NULL)
+  {
+    assert(dlist_item->item != NULL);
+    slot = evel_throttle_name_hash(dlist_item->item) & name_set->mask;
+    while ((name_set->slots[slot] != NULL) &&
+           (strcmp(name_set->slots[slot], dlist_item->item) != 0))
     {
-      EVEL_ERROR("Failed to create hash table");
-      free(hash_table);
-      hash_table = NULL;
+      slot = (slot + 1) & name_set->mask;
     }
+    name_set->slots[slot] = dlist_item->item;
+    dlist_item = dlist_get_next(dlist_item);
   }
-  else
+
+exit_label:
+  EVEL_EXIT();
+}
+
+/**************************************************************************//**
+ * Query whether a ::EVEL_THROTTLE_NAME_SET contains a name.
+ *
+ * @param name_set      Pointer to the ::EVEL_THROTTLE_NAME_SET to query.
+ * @param name          The name to look for.
+ * @return true if the name is in the set, false otherwise.
+ *****************************************************************************/
+static bool evel_throttle_name_set_contains(
+                                   const EVEL_THROTTLE_NAME_SET * name_set,
+                                   const char * const name)
+{
+  const char * slot_name;
+  unsigned int slot;
+  bool found = false;
+
+  EVEL_ENTER();
+
+  /***************************************************************************/
+  /* Check preconditions.                                                    */
+  /***************************************************************************/
+  assert(name_set != NULL);
+  assert(name != NULL);
+
+  /***************************************************************************/
+  /* The table is never full, so the probe ends at a free slot if the name   */
+  /* is not there.                                                           */
+  /***************************************************************************/
+  if (name_set->slots != NULL)
   {
-    hash_table = NULL;
+    slot = evel_throttle_name_hash(name) & name_set->mask;
+    while ((!found) && ((slot_name = name_set->slots[slot]) != NULL))
+    {
+      found = (strcmp(slot_name, name) == 0);
+      slot = (slot + 1) & name_set->mask;
+    }
   }
 
   EVEL_EXIT();
 
-  return hash_table;
+  return found;
 }
 
 /**************************************************************************//**
@@ -559,20 +794,6 @@ void evel_throttle_free(EVEL_THROTTLE_SPEC * throttle_spec)
   /***************************************************************************/
   assert(throttle_spec != NULL);
 
-  /***************************************************************************/
-  /* Free any hash tables.                                                   */
-  /***************************************************************************/
-  if (throttle_spec->hash_field_names != NULL)
-  {
-    hdestroy_r(throttle_spec->hash_field_names);
-    free(throttle_spec->hash_field_names);
-  }
-  if (throttle_spec->hash_nv_pairs_list != NULL)
-  {
-    hdestroy_r(throttle_spec->hash_nv_pairs_list);
-    free(throttle_spec->hash_nv_pairs_list);
-  }
-
   /***************************************************************************/
   /* Iterate through the linked lists, freeing memory.                       */
   /***************************************************************************/
@@ -612,13 +833,9 @@ void evel_throttle_free_nv_pair(EVEL_SUPPRESSED_NV_PAIRS * nv_pairs)
   assert(nv_pairs != NULL);
 
   /***************************************************************************/
-  /* Free any hash tables.                                                   */
+  /* Free the compiled name set.  The names themselves belong to the list.   */
   /***************************************************************************/
-  if (nv_pairs->hash_nv_pair_names != NULL)
-  {
-    hdestroy_r(nv_pairs->hash_nv_pair_names);
-    free(nv_pairs->hash_nv_pair_names);
-  }
+  free(nv_pairs->nv_pair_names.slots);
 
   /***************************************************************************/
   /* Iterate through the linked lists, freeing memory.                       */
@@ -1791,6 +2008,8 @@ void evel_close_command()
  *****************************************************************************/
 void evel_set_throttling_spec()
 {
+  int pthread_rc;
+
   EVEL_ENTER();
 
   if ((evel_throttle_spec_domain >= 0) &&
@@ -1800,20 +2019,29 @@ void evel_set_throttling_spec()
                evel_domain_strings[evel_throttle_spec_domain]);
 
     /*************************************************************************/
-    /* Free off the previous throttle specification for the domain, if there */
-    /* is one.                                                               */
+    /* Finalize the working throttling spec, if there is one.                */
     /*************************************************************************/
-    if (evel_throttle_spec[evel_throttle_spec_domain] != NULL)
+    if (evel_temp_throttle != NULL)
     {
-      evel_throttle_free(evel_throttle_spec[evel_throttle_spec_domain]);
+      evel_throttle_finalize(evel_temp_throttle);
     }
 
     /*************************************************************************/
-    /* Finalize the working throttling spec, if there is one.                */
+    /* Wait for any threads encoding with the previous specification.        */
     /*************************************************************************/
-    if (evel_temp_throttle != NULL)
+    pthread_rc = pthread_rwlock_wrlock(&evel_throttle_spec_lock);
+    assert(pthread_rc == 0);
+
+    /*************************************************************************/
+    /* Free off the previous throttle specification for the domain, if there */
+    /* is one.                                                               */
+    /*************************************************************************/
+    if (evel_throttle_spec[evel_throttle_spec_domain] != NULL)
     {
-      evel_throttle_finalize(evel_temp_throttle);
+      evel_memory_release_bytes(
+                 evel_throttle_spec_domain,
+                 evel_throttle_spec[evel_throttle_spec_domain]->memory_size);
+      evel_throttle_free(evel_throttle_spec[evel_throttle_spec_domain]);
     }
 
     /*************************************************************************/
@@ -1822,7 +2050,16 @@ void evel_set_throttling_spec()
     /* specification has been received for a domain.                         */
     /*************************************************************************/
     evel_throttle_spec[evel_throttle_spec_domain] = evel_temp_throttle;
+    evel_throttle_spec_generation[evel_throttle_spec_domain]++;
+    if (evel_temp_throttle != NULL)
+    {
+      evel_memory_charge_bytes(evel_throttle_spec_domain,
+                               evel_temp_throttle->memory_size);
+    }
     evel_temp_throttle = NULL;
+
+    pthread_rc = pthread_rwlock_unlock(&evel_throttle_spec_lock);
+    assert(pthread_rc == 0);
   }
 
   EVEL_EXIT();
@@ -1878,12 +2115,10 @@ void evel_open_throttle_spec()
   /* Allocate and initialize an ::EVEL_THROTTLE_SPEC in which to hold        */
   /* captured JSON elements.                                                 */
   /***************************************************************************/
-  evel_temp_throttle = malloc(sizeof(EVEL_THROTTLE_SPEC));
+  evel_temp_throttle = calloc(1, sizeof(EVEL_THROTTLE_SPEC));
   assert(evel_temp_throttle != NULL);
   dlist_initialize(&evel_temp_throttle->suppressed_field_names);
   dlist_initialize(&evel_temp_throttle->suppressed_nv_pairs_list);
-  evel_temp_throttle->hash_field_names = NULL;
-  evel_temp_throttle->hash_nv_pairs_list = NULL;
 
   EVEL_EXIT();
 }
@@ -1978,7 +2213,8 @@ void evel_open_nv_pairs_list_entry()
   assert(nv_pairs != NULL);
   nv_pairs->nv_pair_field_name = NULL;
   dlist_initialize(&nv_pairs->suppressed_nv_pair_names);
-  nv_pairs->hash_nv_pair_names = NULL;
+  nv_pairs->nv_pair_names.mask = 0;
+  nv_pairs->nv_pair_names.slots = NULL;
   dlist_push_last(&evel_temp_throttle->suppressed_nv_pairs_list, nv_pairs);
 
   EVEL_EXIT();
@@ -204,25 +204,43 @@ bool evel_handle_command_list(const MEMORY_CHUNK * const chunk,
 EVEL_THROTTLE_SPEC * evel_get_throttle_spec(EVEL_EVENT_DOMAINS domain);
 
 /**************************************************************************//**
- * Determine whether a field_name should be suppressed.
+ * Return the generation of the ::EVEL_THROTTLE_SPEC for a given domain, which
+ * changes whenever the specification is replaced.
+ *
+ * @param domain        The domain for which to return the generation.
+ *****************************************************************************/
+unsigned int evel_get_throttle_generation(EVEL_EVENT_DOMAINS domain);
+
+/**************************************************************************//**
+ * Lock the throttle specifications against replacement while encoding.
+ *****************************************************************************/
+void evel_throttle_lock_specs();
+
+/**************************************************************************//**
+ * Release the lock taken by ::evel_throttle_lock_specs.
+ *****************************************************************************/
+void evel_throttle_unlock_specs();
+
+/**************************************************************************//**
+ * Determine whether a field should be suppressed.
  *
  * @param throttle_spec Throttle specification for the domain being encoded.
- * @param field_name    The field name to encoded or suppress.
- * @return true if the field_name should be suppressed, false otherwise.
+ * @param key           Identifier of the field to encode or suppress.
+ * @return true if the field should be suppressed, false otherwise.
  *****************************************************************************/
 bool evel_throttle_suppress_field(EVEL_THROTTLE_SPEC * throttle_spec,
-                                  const char * const field_name);
+                                  const EVEL_JSON_KEY_ID key);
 
 /**************************************************************************//**
  * Determine whether a name-value pair should be allowed (not suppressed).
  *
  * @param throttle_spec Throttle specification for the domain being encoded.
- * @param field_name    The field name holding the name-value pairs.
+ * @param field_key     Identifier of the field holding the name-value pairs.
  * @param name          The name of the name-value pair to encoded or suppress.
  * @return true if the name-value pair should be suppressed, false otherwise.
  *****************************************************************************/
 bool evel_throttle_suppress_nv_pair(EVEL_THROTTLE_SPEC * throttle_spec,
-                                    const char * const field_name,
+                                    const EVEL_JSON_KEY_ID field_key,
                                     const char * const name);
 
 #endif
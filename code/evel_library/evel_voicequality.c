@@ -42,6 +42,35 @@
 #include "evel_internal.h"
 #include "evel_throttle.h"
 
+/*****************************************************************************/
+/* The key of each voice quality metric, indexed by ::EVEL_VQM_FIELDS.       */
+/*****************************************************************************/
+static const EVEL_JSON_KEY_ID evel_vqm_keys[EVEL_MAX_VQM_FIELDS] = {
+  [EVEL_VQM_ENDPOINT_JITTER] = EVEL_KEY_ENDPOINT_JITTER,
+  [EVEL_VQM_ENDPOINT_RTP_OCTETS_DISCARDED] =
+    EVEL_KEY_ENDPOINT_RTP_OCTETS_DISCARDED,
+  [EVEL_VQM_ENDPOINT_RTP_OCTETS_RECEIVED] =
+    EVEL_KEY_ENDPOINT_RTP_OCTETS_RECEIVED,
+  [EVEL_VQM_ENDPOINT_RTP_OCTETS_SENT] = EVEL_KEY_ENDPOINT_RTP_OCTETS_SENT,
+  [EVEL_VQM_ENDPOINT_RTP_PACKETS_DISCARDED] =
+    EVEL_KEY_ENDPOINT_RTP_PACKETS_DISCARDED,
+  [EVEL_VQM_ENDPOINT_RTP_PACKETS_RECEIVED] =
+    EVEL_KEY_ENDPOINT_RTP_PACKETS_RECEIVED,
+  [EVEL_VQM_ENDPOINT_RTP_PACKETS_SENT] = EVEL_KEY_ENDPOINT_RTP_PACKETS_SENT,
+  [EVEL_VQM_LOCAL_JITTER] = EVEL_KEY_LOCAL_JITTER,
+  [EVEL_VQM_LOCAL_RTP_OCTETS_DISCARDED] = EVEL_KEY_LOCAL_RTP_OCTETS_DISCARDED,
+  [EVEL_VQM_LOCAL_RTP_OCTETS_RECEIVED] = EVEL_KEY_LOCAL_RTP_OCTETS_RECEIVED,
+  [EVEL_VQM_LOCAL_RTP_OCTETS_SENT] = EVEL_KEY_LOCAL_RTP_OCTETS_SENT,
+  [EVEL_VQM_LOCAL_RTP_PACKETS_DISCARDED] = EVEL_KEY_LOCAL_RTP_PACKETS_DISCARDED,
+  [EVEL_VQM_LOCAL_RTP_PACKETS_RECEIVED] = EVEL_KEY_LOCAL_RTP_PACKETS_RECEIVED,
+  [EVEL_VQM_LOCAL_RTP_PACKETS_SENT] = EVEL_KEY_LOCAL_RTP_PACKETS_SENT,
+  [EVEL_VQM_MOS_CQE] = EVEL_KEY_MOS_CQE,
+  [EVEL_VQM_PACKETS_LOST] = EVEL_KEY_PACKETS_LOST,
+  [EVEL_VQM_PACKET_LOSS_PERCENT] = EVEL_KEY_PACKET_LOSS_PERCENT,
+  [EVEL_VQM_R_FACTOR] = EVEL_KEY_R_FACTOR,
+  [EVEL_VQM_ROUND_TRIP_DELAY] = EVEL_KEY_ROUND_TRIP_DELAY,
+};
+
 /**************************************************************************//**
  * Create a new voice quality event.
  *
@@ -82,7 +111,7 @@ EVENT_VOICE_QUALITY * evel_new_voice_quality(
     /***************************************************************************/
     /* Allocate the Voice Quality.                                                     */
     /***************************************************************************/
-    voiceQuality = malloc(sizeof(EVENT_VOICE_QUALITY));
+    voiceQuality = evel_event_alloc(EVEL_DOMAIN_VOICE_QUALITY);
     
     if (voiceQuality == NULL)
     {
@@ -92,7 +121,7 @@ EVENT_VOICE_QUALITY * evel_new_voice_quality(
 
     //Only in case of successful allocation initialize data.
     if (inError == false) {
-        memset(voiceQuality, 0, sizeof(EVENT_VOICE_QUALITY));
+        voiceQuality->header.arena = evel_new_event_arena();
         EVEL_DEBUG("New Voice Quality is at %lp", voiceQuality);
 
         /***************************************************************************/
@@ -104,11 +133,17 @@ EVENT_VOICE_QUALITY * evel_new_voice_quality(
         voiceQuality->major_version = EVEL_VOICEQ_MAJOR_VERSION;
         voiceQuality->minor_version = EVEL_VOICEQ_MINOR_VERSION;
 
-        voiceQuality->calleeSideCodec = strdup(calleeSideCodec);
-        voiceQuality->callerSideCodec = strdup(callerSideCodec);
-        voiceQuality->correlator = strdup(correlator);
-        voiceQuality->midCallRtcp = strdup(midCallRtcp);
-        evel_init_vendor_field(&voiceQuality->vendorVnfNameFields, vendorName);
+        voiceQuality->calleeSideCodec =
+            evel_arena_strdup(voiceQuality->header.arena, calleeSideCodec);
+        voiceQuality->callerSideCodec =
+            evel_arena_strdup(voiceQuality->header.arena, callerSideCodec);
+        voiceQuality->correlator =
+            evel_arena_strdup(voiceQuality->header.arena, correlator);
+        voiceQuality->midCallRtcp =
+            evel_arena_strdup(voiceQuality->header.arena, midCallRtcp);
+        evel_arena_init_vendor_field(voiceQuality->header.arena,
+                                     &voiceQuality->vendorVnfNameFields,
+                                     vendorName);
         dlist_initialize(&voiceQuality->additionalInformation);
         voiceQuality->endOfCallVqmSummaries = NULL;
         evel_init_option_string(&voiceQuality->phoneNumber);
@@ -147,15 +182,18 @@ void evel_voice_quality_addl_info_add(EVENT_VOICE_QUALITY * voiceQ, char * name,
     assert(value != NULL);
 
     EVEL_DEBUG("Adding name=%s value=%s", name, value);
-    addlInfo = malloc(sizeof(VOICE_QUALITY_ADDL_INFO));
+    addlInfo = evel_arena_alloc(voiceQ->header.arena,
+                                sizeof(VOICE_QUALITY_ADDL_INFO));
     assert(addlInfo != NULL);
     memset(addlInfo, 0, sizeof(VOICE_QUALITY_ADDL_INFO));
-    addlInfo->name = strdup(name);
-    addlInfo->value = strdup(value);
+    addlInfo->name = evel_arena_strdup(voiceQ->header.arena, name);
+    addlInfo->value = evel_arena_strdup(voiceQ->header.arena, value);
     assert(addlInfo->name != NULL);
     assert(addlInfo->value != NULL);
 
-    dlist_push_last(&voiceQ->additionalInformation, addlInfo);
+    evel_arena_list_push(voiceQ->header.arena,
+                         &voiceQ->additionalInformation,
+                         addlInfo);
 
     EVEL_EXIT();
 }
@@ -184,7 +222,16 @@ void evel_voice_quality_callee_codec_set(EVENT_VOICE_QUALITY * voiceQuality,
     assert(voiceQuality->header.event_domain == EVEL_DOMAIN_VOICE_QUALITY);
     assert(calleeCodecForCall != NULL);
 
-    voiceQuality->calleeSideCodec = strdup(calleeCodecForCall);
+    /***************************************************************************/
+    /* Free the previous value, unless it is in the event's arena which        */
+    /* frees it with the event.                                                */
+    /***************************************************************************/
+    if (voiceQuality->header.arena == NULL)
+    {
+        free(voiceQuality->calleeSideCodec);
+    }
+    voiceQuality->calleeSideCodec =
+        evel_arena_strdup(voiceQuality->header.arena, calleeCodecForCall);
 
     EVEL_EXIT();
 }
@@ -213,7 +260,16 @@ void evel_voice_quality_caller_codec_set(EVENT_VOICE_QUALITY * voiceQuality,
     assert(voiceQuality->header.event_domain == EVEL_DOMAIN_VOICE_QUALITY);
     assert(callerCodecForCall != NULL);
 
-    voiceQuality->calleeSideCodec = strdup(callerCodecForCall);
+    /***************************************************************************/
+    /* Free the previous value, unless it is in the event's arena which        */
+    /* frees it with the event.                                                */
+    /***************************************************************************/
+    if (voiceQuality->header.arena == NULL)
+    {
+        free(voiceQuality->calleeSideCodec);
+    }
+    voiceQuality->calleeSideCodec =
+        evel_arena_strdup(voiceQuality->header.arena, callerCodecForCall);
 
     EVEL_EXIT();
 }
@@ -242,7 +298,16 @@ void evel_voice_quality_correlator_set(EVENT_VOICE_QUALITY * voiceQuality,
     assert(voiceQuality->header.event_domain == EVEL_DOMAIN_VOICE_QUALITY);
     assert(vCorrelator != NULL);
 
-    voiceQuality->correlator = strdup(vCorrelator);
+    /***************************************************************************/
+    /* Free the previous value, unless it is in the event's arena which        */
+    /* frees it with the event.                                                */
+    /***************************************************************************/
+    if (voiceQuality->header.arena == NULL)
+    {
+        free(voiceQuality->correlator);
+    }
+    voiceQuality->correlator =
+        evel_arena_strdup(voiceQuality->header.arena, vCorrelator);
 
     EVEL_EXIT();
 }
@@ -271,7 +336,16 @@ void evel_voice_quality_rtcp_data_set(EVENT_VOICE_QUALITY * voiceQuality,
     assert(voiceQuality->header.event_domain == EVEL_DOMAIN_VOICE_QUALITY);
     assert(rtcpCallData != NULL);
 
-    voiceQuality->midCallRtcp = strdup(rtcpCallData);
+    /***************************************************************************/
+    /* Free the previous value, unless it is in the event's arena which        */
+    /* frees it with the event.                                                */
+    /***************************************************************************/
+    if (voiceQuality->header.arena == NULL)
+    {
+        free(voiceQuality->midCallRtcp);
+    }
+    voiceQuality->midCallRtcp =
+        evel_arena_strdup(voiceQuality->header.arena, rtcpCallData);
 
     EVEL_EXIT();
 }
@@ -300,7 +374,10 @@ void evel_voice_quality_vnfmodule_name_set(EVENT_VOICE_QUALITY * voiceQuality,
     assert(voiceQuality->header.event_domain == EVEL_DOMAIN_VOICE_QUALITY);
     assert(module_name != NULL);
 
-    evel_vendor_field_module_set(&voiceQuality->vendorVnfNameFields, module_name);
+    evel_arena_set_option_string(voiceQuality->header.arena,
+                                 &voiceQuality->vendorVnfNameFields.vfmodule,
+                                 module_name,
+                                 "Module name set");
 
     EVEL_EXIT();
 }
@@ -329,7 +406,10 @@ void evel_voice_quality_vnfname_set(EVENT_VOICE_QUALITY * voiceQuality,
     assert(voiceQuality->header.event_domain == EVEL_DOMAIN_VOICE_QUALITY);
     assert(vnfname != NULL);
 
-    evel_vendor_field_vnfname_set(&voiceQuality->vendorVnfNameFields, vnfname);
+    evel_arena_set_option_string(voiceQuality->header.arena,
+                                 &voiceQuality->vendorVnfNameFields.vnfname,
+                                 vnfname,
+                                 "Virtual Network Function name set");
 
     EVEL_EXIT();
 }
@@ -358,7 +438,10 @@ void evel_voice_quality_phone_number_set(EVENT_VOICE_QUALITY * voiceQuality,
     assert(voiceQuality->header.event_domain == EVEL_DOMAIN_VOICE_QUALITY);
     assert(phoneNumber != NULL);
 
-    evel_set_option_string(&voiceQuality->phoneNumber, phoneNumber, "Phone_Number");
+    evel_arena_set_option_string(voiceQuality->header.arena,
+                                 &voiceQuality->phoneNumber,
+                                 phoneNumber,
+                                 "Phone_Number");
 
     EVEL_EXIT();
 }
@@ -434,32 +517,74 @@ void evel_voice_quality_end_metrics_add(EVENT_VOICE_QUALITY * voiceQuality,
     /* Allocate a container for the value and push onto the list.              */
     /***************************************************************************/
     EVEL_DEBUG("Adding adjacencyName=%s endpointDescription=%d", adjacencyName, endpointDescription);
-    vQMetrices = malloc(sizeof(END_OF_CALL_VOICE_QUALITY_METRICS));
+    vQMetrices = evel_arena_alloc(voiceQuality->header.arena,
+                                  sizeof(END_OF_CALL_VOICE_QUALITY_METRICS));
     assert(vQMetrices != NULL);
     memset(vQMetrices, 0, sizeof(END_OF_CALL_VOICE_QUALITY_METRICS));
 
-    vQMetrices->adjacencyName = strdup(adjacencyName);
+    vQMetrices->adjacencyName = evel_arena_strdup(voiceQuality->header.arena,
+                                                  adjacencyName);
     vQMetrices->endpointDescription = evel_service_endpoint_desc(endpointDescription);
 
-    evel_set_option_int(&vQMetrices->endpointJitter, endpointJitter, "Endpoint jitter");
-    evel_set_option_int(&vQMetrices->endpointRtpOctetsDiscarded, endpointRtpOctetsDiscarded, "Endpoint RTP octets discarded");
-    evel_set_option_int(&vQMetrices->endpointRtpOctetsReceived, endpointRtpOctetsReceived, "Endpoint RTP octets received");
-    evel_set_option_int(&vQMetrices->endpointRtpOctetsSent, endpointRtpOctetsSent, "Endpoint RTP octets sent");
-    evel_set_option_int(&vQMetrices->endpointRtpPacketsDiscarded, endpointRtpPacketsDiscarded, "Endpoint RTP packets discarded");
-    evel_set_option_int(&vQMetrices->endpointRtpPacketsReceived, endpointRtpPacketsReceived, "Endpoint RTP packets received");
-    evel_set_option_int(&vQMetrices->endpointRtpPacketsSent, endpointRtpPacketsSent, "Endpoint RTP packets sent");
-    evel_set_option_int(&vQMetrices->localJitter, localJitter, "Local jitter");
-    evel_set_option_int(&vQMetrices->localRtpOctetsDiscarded, localRtpOctetsDiscarded, "Local RTP octets discarded");
-    evel_set_option_int(&vQMetrices->localRtpOctetsReceived, localRtpOctetsReceived, "Local RTP octets received");
-    evel_set_option_int(&vQMetrices->localRtpOctetsSent, localRtpOctetsSent, "Local RTP octets sent");
-    evel_set_option_int(&vQMetrices->localRtpPacketsDiscarded, localRtpPacketsDiscarded, "Local RTP packets discarded");
-    evel_set_option_int(&vQMetrices->localRtpPacketsReceived, localRtpPacketsReceived, "Local RTP packets received");
-    evel_set_option_int(&vQMetrices->localRtpPacketsSent, localRtpPacketsSent, "Local RTP packets sent");
-    evel_set_option_int(&vQMetrices->mosCqe, mosCqe, "Decimal range from 1 to 5 (1 decimal place)");
-    evel_set_option_int(&vQMetrices->packetsLost, packetsLost, "Packets lost");
-    evel_set_option_int(&vQMetrices->packetLossPercent, packetLossPercent, "Calculated percentage packet loss");
-    evel_set_option_int(&vQMetrices->rFactor, rFactor, "rFactor ");
-    evel_set_option_int(&vQMetrices->roundTripDelay, roundTripDelay, "Round trip delay in milliseconds ");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_ENDPOINT_JITTER, endpointJitter,
+                        "Endpoint jitter");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_ENDPOINT_RTP_OCTETS_DISCARDED,
+                        endpointRtpOctetsDiscarded,
+                        "Endpoint RTP octets discarded");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_ENDPOINT_RTP_OCTETS_RECEIVED,
+                        endpointRtpOctetsReceived,
+                        "Endpoint RTP octets received");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_ENDPOINT_RTP_OCTETS_SENT,
+                        endpointRtpOctetsSent, "Endpoint RTP octets sent");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_ENDPOINT_RTP_PACKETS_DISCARDED,
+                        endpointRtpPacketsDiscarded,
+                        "Endpoint RTP packets discarded");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_ENDPOINT_RTP_PACKETS_RECEIVED,
+                        endpointRtpPacketsReceived,
+                        "Endpoint RTP packets received");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_ENDPOINT_RTP_PACKETS_SENT,
+                        endpointRtpPacketsSent, "Endpoint RTP packets sent");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_LOCAL_JITTER, localJitter, "Local jitter");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_LOCAL_RTP_OCTETS_DISCARDED,
+                        localRtpOctetsDiscarded, "Local RTP octets discarded");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_LOCAL_RTP_OCTETS_RECEIVED,
+                        localRtpOctetsReceived, "Local RTP octets received");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_LOCAL_RTP_OCTETS_SENT, localRtpOctetsSent,
+                        "Local RTP octets sent");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_LOCAL_RTP_PACKETS_DISCARDED,
+                        localRtpPacketsDiscarded,
+                        "Local RTP packets discarded");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_LOCAL_RTP_PACKETS_RECEIVED,
+                        localRtpPacketsReceived, "Local RTP packets received");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_LOCAL_RTP_PACKETS_SENT, localRtpPacketsSent,
+                        "Local RTP packets sent");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_MOS_CQE, mosCqe,
+                        "Decimal range from 1 to 5 (1 decimal place)");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_PACKETS_LOST, packetsLost, "Packets lost");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_PACKET_LOSS_PERCENT, packetLossPercent,
+                        "Calculated percentage packet loss");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_R_FACTOR, rFactor, "rFactor ");
+    evel_set_packed_int(&vQMetrices->present, vQMetrices->values,
+                        EVEL_VQM_ROUND_TRIP_DELAY, roundTripDelay,
+                        "Round trip delay in milliseconds ");
 
     voiceQuality->endOfCallVqmSummaries = vQMetrices;
 
@@ -491,31 +616,25 @@ void evel_json_encode_voice_quality(EVEL_JSON_BUFFER * jbuf,
   assert(event->header.event_domain == EVEL_DOMAIN_VOICE_QUALITY);
 
   evel_json_encode_header(jbuf, &event->header);
-  evel_json_open_named_object(jbuf, "voiceQualityFields");
+  evel_json_open_named_object(jbuf, EVEL_KEY_VOICE_QUALITY_FIELDS);
 
   /***************************************************************************/
   /* Mandatory fields.                                                       */
   /***************************************************************************/
-  evel_enc_kv_string(jbuf, "calleeSideCodec", event->calleeSideCodec);
-  evel_enc_kv_string(jbuf, "callerSideCodec", event->callerSideCodec);
-  evel_enc_kv_string(jbuf, "correlator", event->correlator);
-  evel_enc_kv_string(jbuf, "midCallRtcp", event->midCallRtcp);
+  evel_enc_kv_string(jbuf, EVEL_KEY_CALLEE_SIDE_CODEC, event->calleeSideCodec);
+  evel_enc_kv_string(jbuf, EVEL_KEY_CALLER_SIDE_CODEC, event->callerSideCodec);
+  evel_enc_kv_string(jbuf, EVEL_KEY_CORRELATOR, event->correlator);
+  evel_enc_kv_string(jbuf, EVEL_KEY_MID_CALL_RTCP, event->midCallRtcp);
   evel_json_encode_vendor_field(jbuf, &event->vendorVnfNameFields);
   evel_enc_version(
-    jbuf, "voiceQualityFieldsVersion", event->major_version, event->minor_version);
+    jbuf, EVEL_KEY_VOICE_QUALITY_FIELDS_VERSION, event->major_version, event->minor_version);
 
   /***************************************************************************/
   /* Optional fields.                                                        */
   /***************************************************************************/
-  evel_enc_kv_opt_string(jbuf, "phoneNumber", &event->phoneNumber);
-  /***************************************************************************/
-  /* Checkpoint, so that we can wind back if all fields are suppressed.      */
-  /***************************************************************************/
+  evel_enc_kv_opt_string(jbuf, EVEL_KEY_PHONE_NUMBER, &event->phoneNumber);
   //additionalInformation for Voice Quality
-  bool item_added = false;
- 
-  evel_json_checkpoint(jbuf);
-  if (evel_json_open_opt_named_list(jbuf, "additionalInformation"))
+  if (evel_json_open_opt_named_list(jbuf, EVEL_KEY_ADDITIONAL_INFORMATION))
   {
 
     addlInfoItem = dlist_get_first(&event->additionalInformation);
@@ -525,58 +644,33 @@ void evel_json_encode_voice_quality(EVEL_JSON_BUFFER * jbuf,
       assert(addlInfo != NULL);
 
       if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                                          "additionalInformation",
+                                          EVEL_KEY_ADDITIONAL_INFORMATION,
                                           addlInfo->name))
       {
         evel_json_open_object(jbuf);
-        evel_enc_kv_string(jbuf, "name", addlInfo->name);
-        evel_enc_kv_string(jbuf, "value", addlInfo->value);
+        evel_enc_kv_string(jbuf, EVEL_KEY_NAME, addlInfo->name);
+        evel_enc_kv_string(jbuf, EVEL_KEY_VALUE, addlInfo->value);
         evel_json_close_object(jbuf);
-        item_added = true;
       }
       addlInfoItem = dlist_get_next(addlInfoItem);
     }
     evel_json_close_list(jbuf);
-    /*************************************************************************/
-    /* If we've not written anything, rewind to before we opened the list.   */
-    /*************************************************************************/
-    if (!item_added)
-    {
-      evel_json_rewind(jbuf);
-    }
   }
 
     //endOfCallVqmSummaries
   if( event->endOfCallVqmSummaries != NULL )
   {
-     evel_json_open_named_object(jbuf, "endOfCallVqmSummaries");
+     evel_json_open_named_object(jbuf, EVEL_KEY_END_OF_CALL_VQM_SUMMARIES);
      vQMetrics = event->endOfCallVqmSummaries;
      assert(vQMetrics != NULL);
 
             if (!evel_throttle_suppress_nv_pair(jbuf->throttle_spec,
-                "endOfCallVqmSummaries", vQMetrics->adjacencyName))
+                EVEL_KEY_END_OF_CALL_VQM_SUMMARIES, vQMetrics->adjacencyName))
             {
-                evel_enc_kv_string(jbuf, "adjacencyName", vQMetrics->adjacencyName);
-                evel_enc_kv_string(jbuf, "endpointDescription", vQMetrics->endpointDescription);
-                evel_enc_kv_opt_int(jbuf, "endpointJitter", &vQMetrics->endpointJitter);
-                evel_enc_kv_opt_int(jbuf, "endpointRtpOctetsDiscarded", &vQMetrics->endpointRtpOctetsDiscarded);
-                evel_enc_kv_opt_int(jbuf, "endpointRtpOctetsReceived", &vQMetrics->endpointRtpOctetsReceived);
-                evel_enc_kv_opt_int(jbuf, "endpointRtpOctetsSent", &vQMetrics->endpointRtpOctetsSent);
-                evel_enc_kv_opt_int(jbuf, "endpointRtpPacketsDiscarded", &vQMetrics->endpointRtpPacketsDiscarded);
-                evel_enc_kv_opt_int(jbuf, "endpointRtpPacketsReceived", &vQMetrics->endpointRtpPacketsReceived);
-                evel_enc_kv_opt_int(jbuf, "endpointRtpPacketsSent", &vQMetrics->endpointRtpPacketsSent);
-                evel_enc_kv_opt_int(jbuf, "localJitter", &vQMetrics->localJitter);
-                evel_enc_kv_opt_int(jbuf, "localRtpOctetsDiscarded", &vQMetrics->localRtpOctetsDiscarded);
-                evel_enc_kv_opt_int(jbuf, "localRtpOctetsReceived", &vQMetrics->localRtpOctetsReceived);
-                evel_enc_kv_opt_int(jbuf, "localRtpOctetsSent", &vQMetrics->localRtpOctetsSent);
-                evel_enc_kv_opt_int(jbuf, "localRtpPacketsDiscarded", &vQMetrics->localRtpPacketsDiscarded);
-                evel_enc_kv_opt_int(jbuf, "localRtpPacketsReceived", &vQMetrics->localRtpPacketsReceived);
-                evel_enc_kv_opt_int(jbuf, "localRtpPacketsSent", &vQMetrics->localRtpPacketsSent);
-                evel_enc_kv_opt_int(jbuf, "mosCqe", &vQMetrics->mosCqe);
-                evel_enc_kv_opt_int(jbuf, "packetsLost", &vQMetrics->packetsLost);
-                evel_enc_kv_opt_int(jbuf, "packetLossPercent", &vQMetrics->packetLossPercent);
-                evel_enc_kv_opt_int(jbuf, "rFactor", &vQMetrics->rFactor);
-                evel_enc_kv_opt_int(jbuf, "roundTripDelay", &vQMetrics->roundTripDelay);
+                evel_enc_kv_string(jbuf, EVEL_KEY_ADJACENCY_NAME, vQMetrics->adjacencyName);
+                evel_enc_kv_string(jbuf, EVEL_KEY_ENDPOINT_DESCRIPTION, vQMetrics->endpointDescription);
+                evel_enc_kv_packed_ints(jbuf, evel_vqm_keys, vQMetrics->present,
+                                        vQMetrics->values);
 
             }
 
@@ -308,6 +308,12 @@ EVEL_ERR_CODES openstack_metadata(int verbosity)
 
 exit_label:
 
+  /***************************************************************************/
+  /* Whatever we managed to extract, headers created from now on may have a  */
+  /* different identity to those before.                                     */
+  /***************************************************************************/
+  evel_header_identity_changed();
+
   /***************************************************************************/
   /* Shut down the cURL library in a tidy manner.                            */
   /***************************************************************************/
@@ -333,6 +339,7 @@ void openstack_metadata_initialize()
   strncpy(vm_name,
           "Dummy VM name - No Metadata available",
           MAX_METADATA_STRING);
+  evel_header_identity_changed();
 }
 
 /**************************************************************************//**
@@ -0,0 +1,810 @@
+/**************************************************************************//**
+ * @file
+ * Standalone checks of the library's list storage, arenas, templates,
+ * prototypes and CBOR encoding.
+ *
+ * Unlike the encoder unit tests these need no fixed expected encodings, so
+ * they check the properties that matter directly.  Every check asserts, so
+ * the program fails hard on the first failure.
+ *
+ * License
+ * -------
+ *
+ * Copyright(c) <2016>, AT&T Intellectual Property.  All other rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 3. All advertising materials mentioning features or use of this software
+ * must display the following acknowledgement:  This product includes software
+ * developed by the AT&T.
+ * 4. Neither the name of AT&T nor the names of its contributors may be used to
+ * endorse or promote products derived from this software without specific
+ * prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY AT&T INTELLECTUAL PROPERTY ''AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL AT&T INTELLECTUAL PROPERTY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "evel.h"
+#include "evel_internal.h"
+#include "evel_throttle.h"
+#include "metadata.h"
+
+/*****************************************************************************/
+/* Number of items to push to take a list well past its inline slots.        */
+/*****************************************************************************/
+#define CHECK_LIST_ITEMS 100
+
+/*****************************************************************************/
+/* Size of the buffers events are encoded into.                              */
+/*****************************************************************************/
+#define CHECK_BUFFER_SIZE 16384
+
+/*****************************************************************************/
+/* The last event posted, copied by our evel_post_event.                     */
+/*****************************************************************************/
+static char posted[CHECK_BUFFER_SIZE];
+static int posted_size = 0;
+
+/*****************************************************************************/
+/* Local prototypes.                                                         */
+/*****************************************************************************/
+static void check_dlist_push();
+static void check_dlist_pop_last();
+static void check_dlist_share_slots();
+static void check_arena_list_push();
+static void check_template(const EVEL_ENCODINGS encoding);
+static void check_prototype();
+static void check_cbor();
+static void check_list_items(DLIST * list, int * values, const int count);
+static EVENT_MEASUREMENT * new_check_measurement();
+static EVENT_FAULT * new_check_fault();
+static int encode_check_event(char * buffer, EVENT_HEADER * event);
+static int cbor_item_end(const unsigned char * cbor,
+                         const int size,
+                         int offset);
+static int cbor_head(const unsigned char * cbor,
+                     const int size,
+                     int offset,
+                     uint64_t * argument);
+static bool contains(const char * data,
+                     const int size,
+                     const char * part,
+                     const int part_size);
+
+/**************************************************************************//**
+ * Main function.
+ *
+ * Runs all checks, and fails hard on the first failure.
+ *
+ * @param[in] argc  Argument count.
+ * @param[in] argv  Argument vector.
+ *****************************************************************************/
+int main(int argc, char ** argv)
+{
+  assert(argc >= 0);
+  assert(argv != NULL);
+
+  /***************************************************************************/
+  /* Minimal initialisation to create and encode events.                     */
+  /***************************************************************************/
+  openstack_metadata_initialize();
+  functional_role = "CHECK";
+  log_initialize(EVEL_LOG_ERROR, "EVEL");
+  evel_throttle_initialize();
+
+  /***************************************************************************/
+  /* Check the list storage.                                                 */
+  /***************************************************************************/
+  check_dlist_push();
+  check_dlist_pop_last();
+  check_dlist_share_slots();
+  check_arena_list_push();
+
+  /***************************************************************************/
+  /* Check templates and prototypes, which use arenas and shared lists.      */
+  /***************************************************************************/
+  check_template(EVEL_ENCODING_JSON);
+  check_template(EVEL_ENCODING_CBOR);
+  check_prototype();
+
+  /***************************************************************************/
+  /* Check the CBOR encoding.                                                */
+  /***************************************************************************/
+  check_cbor();
+
+  evel_throttle_terminate();
+  evel_free_header_identity();
+
+  printf("\nAll Checks Passed\n");
+
+  return 0;
+}
+
+/**************************************************************************//**
+ * Post an event, by copying its encoding for the checks to inspect.
+ *
+ * We link with this evel_post_event so that events posted from templates are
+ * kept rather than sent.  Only already-encoded events are expected.
+ *
+ * @param event     Pointer to the ::EVENT_HEADER, which is freed.
+ * @returns ::EVEL_SUCCESS.
+ *****************************************************************************/
+EVEL_ERR_CODES evel_post_event(EVENT_HEADER * event)
+{
+  EVENT_INTERNAL * internal = (EVENT_INTERNAL *) event;
+
+  assert(event->event_domain == EVEL_DOMAIN_INTERNAL);
+  assert(internal->command == EVT_CMD_POST_ENCODED);
+  assert(internal->encoded.size < sizeof(posted));
+
+  memcpy(posted, internal->encoded.memory, internal->encoded.size);
+  posted_size = internal->encoded.size;
+  evel_free_event(event);
+
+  return EVEL_SUCCESS;
+}
+
+/**************************************************************************//**
+ * Check pushing at both ends of a list, across the switch from its inline
+ * slots to slots on the heap.
+ *****************************************************************************/
+void check_dlist_push()
+{
+  DLIST list;
+  int items[CHECK_LIST_ITEMS];
+  int expected[CHECK_LIST_ITEMS];
+  int ii;
+
+  dlist_initialize(&list);
+  assert(dlist_is_empty(&list));
+  assert(dlist_get_first(&list) == NULL);
+  assert(dlist_get_last(&list) == NULL);
+
+  /***************************************************************************/
+  /* Alternate between the ends, so that the list holds the odd items in     */
+  /* reverse order followed by the even items in order.                      */
+  /***************************************************************************/
+  for (ii = 0; ii < CHECK_LIST_ITEMS; ii++)
+  {
+    items[ii] = ii;
+    if (ii % 2)
+    {
+      dlist_push_first(&list, &items[ii]);
+    }
+    else
+    {
+      dlist_push_last(&list, &items[ii]);
+    }
+
+    /*************************************************************************/
+    /* Only a list too long for its inline slots uses the heap.              */
+    /*************************************************************************/
+    assert((list.slots == NULL) == (ii + 2 <= DLIST_INLINE_SLOTS));
+    assert(list.slots == NULL || list.owns_slots);
+  }
+
+  for (ii = 0; ii < CHECK_LIST_ITEMS / 2; ii++)
+  {
+    expected[ii] = CHECK_LIST_ITEMS - 1 - 2 * ii;
+    expected[CHECK_LIST_ITEMS / 2 + ii] = 2 * ii;
+  }
+  check_list_items(&list, expected, CHECK_LIST_ITEMS);
+
+  while (dlist_pop_last(&list) != NULL)
+  {
+  }
+  assert(list.slots == NULL);
+
+  printf("Checked list pushes\n");
+}
+
+/**************************************************************************//**
+ * Check popping items back off a list, back down to its inline slots.
+ *****************************************************************************/
+void check_dlist_pop_last()
+{
+  DLIST list;
+  int items[CHECK_LIST_ITEMS];
+  int ii;
+
+  dlist_initialize(&list);
+  assert(dlist_pop_last(&list) == NULL);
+
+  for (ii = 0; ii < CHECK_LIST_ITEMS; ii++)
+  {
+    items[ii] = ii;
+    dlist_push_last(&list, &items[ii]);
+  }
+  assert(list.slots != NULL);
+
+  /***************************************************************************/
+  /* Items come off the end in reverse order, and the list ends where it     */
+  /* started, holding nothing on the heap.                                   */
+  /***************************************************************************/
+  for (ii = CHECK_LIST_ITEMS - 1; ii >= 0; ii--)
+  {
+    assert(dlist_pop_last(&list) == &items[ii]);
+    assert(dlist_count(&list) == ii);
+    check_list_items(&list, items, ii);
+  }
+  assert(dlist_is_empty(&list));
+  assert(list.slots == NULL);
+  assert(list.capacity == 0);
+  assert(!list.owns_slots);
+  assert(dlist_pop_last(&list) == NULL);
+
+  /***************************************************************************/
+  /* The inline slots are usable again.                                      */
+  /***************************************************************************/
+  for (ii = 0; ii < DLIST_INLINE_SLOTS - 1; ii++)
+  {
+    dlist_push_last(&list, &items[ii]);
+  }
+  assert(list.slots == NULL);
+  check_list_items(&list, items, DLIST_INLINE_SLOTS - 1);
+
+  while (dlist_pop_last(&list) != NULL)
+  {
+  }
+
+  printf("Checked list pops\n");
+}
+
+/**************************************************************************//**
+ * Check that a copy of a list sharing its slots copies them before it is
+ * added to, leaving the original untouched.
+ *****************************************************************************/
+void check_dlist_share_slots()
+{
+  DLIST original;
+  DLIST copy;
+  int items[CHECK_LIST_ITEMS];
+  DLIST_ITEM * original_slots;
+  int ii;
+
+  for (ii = 0; ii < CHECK_LIST_ITEMS; ii++)
+  {
+    items[ii] = ii;
+  }
+
+  /***************************************************************************/
+  /* A list on the heap, whose copy shares its slots until pushed to.        */
+  /***************************************************************************/
+  dlist_initialize(&original);
+  for (ii = 0; ii < 10; ii++)
+  {
+    dlist_push_last(&original, &items[ii]);
+  }
+  original_slots = original.slots;
+
+  memcpy(&copy, &original, sizeof(DLIST));
+  dlist_share_slots(&copy);
+  assert(copy.slots == original_slots);
+  assert(!copy.owns_slots);
+  check_list_items(&copy, items, 10);
+
+  for (ii = 10; ii < 20; ii++)
+  {
+    dlist_push_last(&copy, &items[ii]);
+  }
+  assert(copy.slots != original_slots);
+  assert(copy.owns_slots);
+  check_list_items(&copy, items, 20);
+  assert(original.slots == original_slots);
+  check_list_items(&original, items, 10);
+
+  while (dlist_pop_last(&copy) != NULL)
+  {
+  }
+  check_list_items(&original, items, 10);
+  while (dlist_pop_last(&original) != NULL)
+  {
+  }
+
+  /***************************************************************************/
+  /* An inline list is copied with the structure, so shares nothing.         */
+  /***************************************************************************/
+  dlist_initialize(&original);
+  dlist_push_last(&original, &items[0]);
+  dlist_push_last(&original, &items[1]);
+  memcpy(&copy, &original, sizeof(DLIST));
+  dlist_share_slots(&copy);
+  assert(copy.slots == NULL);
+  dlist_push_last(&copy, &items[2]);
+  check_list_items(&copy, items, 3);
+  check_list_items(&original, items, 2);
+  while (dlist_pop_last(&copy) != NULL)
+  {
+  }
+  while (dlist_pop_last(&original) != NULL)
+  {
+  }
+
+  printf("Checked shared list slots\n");
+}
+
+/**************************************************************************//**
+ * Check pushing onto lists whose slots come from an arena, or from the heap
+ * when there is no arena.
+ *****************************************************************************/
+void check_arena_list_push()
+{
+  EVEL_ARENA * arena;
+  DLIST list;
+  int items[CHECK_LIST_ITEMS];
+  int ii;
+
+  arena = evel_new_arena();
+  assert(arena != NULL);
+
+  dlist_initialize(&list);
+  for (ii = 0; ii < CHECK_LIST_ITEMS; ii++)
+  {
+    items[ii] = ii;
+    evel_arena_list_push(arena, &list, &items[ii]);
+
+    /*************************************************************************/
+    /* The arena, not the list, owns slots outside the list.                 */
+    /*************************************************************************/
+    assert(!list.owns_slots);
+    assert(list.capacity == 0 || list.capacity > dlist_count(&list));
+    check_list_items(&list, items, ii + 1);
+  }
+  assert(list.slots != NULL);
+  assert(evel_arena_size(arena) >= CHECK_LIST_ITEMS * sizeof(DLIST_ITEM));
+  evel_free_arena(arena);
+
+  /***************************************************************************/
+  /* Without an arena, the list grows on the heap as usual.                  */
+  /***************************************************************************/
+  dlist_initialize(&list);
+  for (ii = 0; ii < CHECK_LIST_ITEMS; ii++)
+  {
+    evel_arena_list_push(NULL, &list, &items[ii]);
+  }
+  assert(list.owns_slots);
+  check_list_items(&list, items, CHECK_LIST_ITEMS);
+  while (dlist_pop_last(&list) != NULL)
+  {
+  }
+
+  printf("Checked arena list pushes\n");
+}
+
+/**************************************************************************//**
+ * Check that events posted from a template carry the values set in it, and
+ * a new sequence number each.
+ *
+ * @param encoding      The encoding to make the template in.
+ *****************************************************************************/
+void check_template(const EVEL_ENCODINGS encoding)
+{
+  EVENT_MEASUREMENT * measurement;
+  EVEL_TEMPLATE * tmpl;
+  char first[CHECK_BUFFER_SIZE];
+  int first_size;
+  int slot;
+  const unsigned char cbor_double[] = {
+    0xfb, 0x40, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  };
+
+  evel_set_encoding(encoding);
+
+  measurement = new_check_measurement();
+  tmpl = evel_new_template((EVENT_HEADER *) measurement);
+  assert(tmpl != NULL);
+  evel_free_event(measurement);
+
+  assert(evel_template_find_slot(tmpl, "cpuIdle", 0) >= 0);
+  assert(evel_template_find_slot(tmpl, "cpuIdle", 1) == -1);
+  assert(evel_template_find_slot(tmpl, "noSuchKey", 0) == -1);
+
+  /***************************************************************************/
+  /* Post twice, changing a value between.  12.5 is exact as a double.       */
+  /***************************************************************************/
+  assert(evel_post_template(tmpl) == EVEL_SUCCESS);
+  memcpy(first, posted, posted_size);
+  first_size = posted_size;
+
+  slot = evel_template_find_slot(tmpl, "cpuIdle", 0);
+  evel_template_set_double(tmpl, slot, 12.5);
+  assert(evel_post_template(tmpl) == EVEL_SUCCESS);
+
+  if (encoding == EVEL_ENCODING_JSON)
+  {
+    assert(!contains(first, first_size, "12.500000", 9));
+    assert(contains(posted, posted_size, "\"cpuIdle\": 12.500000", 20));
+  }
+  else
+  {
+    assert(cbor_item_end((unsigned char *) first, first_size, 0) ==
+           first_size);
+    assert(cbor_item_end((unsigned char *) posted, posted_size, 0) ==
+           posted_size);
+    assert(!contains(first, first_size,
+                     (const char *) cbor_double, sizeof(cbor_double)));
+    assert(contains(posted, posted_size,
+                    (const char *) cbor_double, sizeof(cbor_double)));
+  }
+  assert((first_size != posted_size) ||
+         (memcmp(first, posted, posted_size) != 0));
+
+  evel_free_template(tmpl);
+  evel_set_encoding(EVEL_ENCODING_JSON);
+
+  printf("Checked templates in encoding %d\n", encoding);
+}
+
+/**************************************************************************//**
+ * Check that events created from a prototype share its fields, and that
+ * changing one changes neither the prototype nor the other events.
+ *****************************************************************************/
+void check_prototype()
+{
+  EVEL_PROTOTYPE * prototype;
+  EVENT_FAULT * fault;
+  EVENT_FAULT * other;
+  char fault_json[CHECK_BUFFER_SIZE];
+  char other_json[CHECK_BUFFER_SIZE];
+  int fault_size;
+  int other_size;
+  int ii;
+
+  prototype = evel_new_prototype((EVENT_HEADER *) new_check_fault());
+  assert(prototype != NULL);
+
+  fault = evel_new_fault_from_prototype(prototype, "fault 1");
+  other = evel_new_fault_from_prototype(prototype, "fault 2");
+  assert(fault != NULL);
+  assert(other != NULL);
+  assert(fault->header.arena != NULL);
+
+  /***************************************************************************/
+  /* Add enough to copy the shared list, and replace a set-once field.       */
+  /***************************************************************************/
+  for (ii = 0; ii < 10; ii++)
+  {
+    evel_fault_addl_info_add(fault, "added", "value");
+  }
+  evel_fault_category_set(fault, "replaced");
+  assert(dlist_count(&fault->additional_info) == 16);
+  assert(dlist_count(&other->additional_info) == 6);
+
+  fault_size = encode_check_event(fault_json, (EVENT_HEADER *) fault);
+  other_size = encode_check_event(other_json, (EVENT_HEADER *) other);
+  assert(contains(fault_json, fault_size, "\"fault 1\"", 9));
+  assert(contains(fault_json, fault_size, "\"added\"", 7));
+  assert(contains(fault_json, fault_size, "\"replaced\"", 10));
+  assert(contains(fault_json, fault_size, "\"name5\"", 7));
+  assert(contains(other_json, other_size, "\"fault 2\"", 9));
+  assert(!contains(other_json, other_size, "\"added\"", 7));
+  assert(!contains(other_json, other_size, "\"replaced\"", 10));
+  assert(contains(other_json, other_size, "\"category\"", 10));
+  assert(contains(other_json, other_size, "\"name5\"", 7));
+
+  /***************************************************************************/
+  /* Events keep the prototype until they are freed.                         */
+  /***************************************************************************/
+  evel_free_prototype(prototype);
+  assert(encode_check_event(other_json, (EVENT_HEADER *) other) ==
+         other_size);
+  evel_free_event(fault);
+  evel_free_event(other);
+
+  printf("Checked prototypes\n");
+}
+
+/**************************************************************************//**
+ * Check that events encode as well-formed CBOR, no longer than they are
+ * sized, holding the same strings as their JSON.
+ *****************************************************************************/
+void check_cbor()
+{
+  EVENT_FAULT * fault;
+  EVENT_MEASUREMENT * measurement;
+  EVENT_HEADER * events[2];
+  char cbor[CHECK_BUFFER_SIZE];
+  int size;
+  int ii;
+  const unsigned char event_key[] = { 0xbf, 0x65, 'e', 'v', 'e', 'n', 't' };
+
+  fault = new_check_fault();
+  measurement = new_check_measurement();
+  events[0] = (EVENT_HEADER *) fault;
+  events[1] = (EVENT_HEADER *) measurement;
+
+  evel_set_encoding(EVEL_ENCODING_CBOR);
+  for (ii = 0; ii < 2; ii++)
+  {
+    size = encode_check_event(cbor, events[ii]);
+    assert(size > (int) sizeof(event_key));
+    assert(size <= evel_event_encoded_size(events[ii]));
+    assert(memcmp(cbor, event_key, sizeof(event_key)) == 0);
+    assert(cbor_item_end((unsigned char *) cbor, size, 0) == size);
+  }
+
+  /***************************************************************************/
+  /* Strings are written raw, as a length and the bytes.                     */
+  /***************************************************************************/
+  size = encode_check_event(cbor, events[0]);
+  assert(contains(cbor, size, "\x69" "condition", 10));
+  assert(contains(cbor, size, "\x68" "category", 9));
+  evel_set_encoding(EVEL_ENCODING_JSON);
+
+  evel_free_event(fault);
+  evel_free_event(measurement);
+
+  printf("Checked CBOR encoding\n");
+}
+
+/**************************************************************************//**
+ * Check that a list holds the given values in order, and no more.
+ *
+ * @param list      Pointer to the ::DLIST, of pointers to ints.
+ * @param values    The values the ints should have.
+ * @param count     The number of values.
+ *****************************************************************************/
+void check_list_items(DLIST * list, int * values, const int count)
+{
+  DLIST_ITEM * item;
+  int ii = 0;
+
+  assert(dlist_count(list) == count);
+
+  for (item = dlist_get_first(list); item != NULL; item = dlist_get_next(item))
+  {
+    assert(ii < count);
+    assert(*(int *) item->item == values[ii]);
+    ii++;
+  }
+  assert(ii == count);
+  assert((count == 0) ||
+         (*(int *) dlist_get_last(list)->item == values[count - 1]));
+}
+
+/**************************************************************************//**
+ * Create a measurement with a CPU, for templates.
+ *
+ * @returns The measurement, which the caller must free.
+ *****************************************************************************/
+EVENT_MEASUREMENT * new_check_measurement()
+{
+  EVENT_MEASUREMENT * measurement;
+  MEASUREMENT_CPU_USE * cpu_use;
+
+  measurement = evel_new_measurement(60.0, "Measurement", "measurement");
+  assert(measurement != NULL);
+  evel_measurement_conc_sess_set(measurement, 10);
+  cpu_use = evel_measurement_new_cpu_use_add(measurement, "cpu1", 11.0);
+  assert(cpu_use != NULL);
+  evel_measurement_cpu_use_idle_set(cpu_use, 21.0);
+
+  return measurement;
+}
+
+/**************************************************************************//**
+ * Create a fault with additional info on the heap, for prototypes.
+ *
+ * Event arenas are enabled while it is created, as they are for events
+ * created from prototypes.
+ *
+ * @returns The fault, which the caller must free.
+ *****************************************************************************/
+EVENT_FAULT * new_check_fault()
+{
+  EVENT_FAULT * fault;
+  char name[16];
+  int ii;
+
+  evel_set_event_arenas(true);
+  fault = evel_new_fault("Fault", "fault", "condition", "problem",
+                         EVEL_PRIORITY_HIGH,
+                         EVEL_SEVERITY_MAJOR,
+                         EVEL_SOURCE_HOST,
+                         EVEL_VF_STATUS_ACTIVE);
+  assert(fault != NULL);
+  evel_set_event_arenas(false);
+
+  evel_fault_category_set(fault, "category");
+  for (ii = 0; ii < 6; ii++)
+  {
+    sprintf(name, "name%d", ii);
+    evel_fault_addl_info_add(fault, name, "value");
+  }
+
+  return fault;
+}
+
+/**************************************************************************//**
+ * Encode an event in the current encoding.
+ *
+ * @param buffer    Where to encode it, ::CHECK_BUFFER_SIZE bytes.
+ * @param event     Pointer to the ::EVENT_HEADER.
+ * @returns The number of bytes encoded.
+ *****************************************************************************/
+int encode_check_event(char * buffer, EVENT_HEADER * event)
+{
+  int size;
+
+  size = evel_json_encode_event(buffer, CHECK_BUFFER_SIZE, event);
+  assert(size > 0);
+  assert(size < CHECK_BUFFER_SIZE - 1);
+
+  return size;
+}
+
+/**************************************************************************//**
+ * Find the end of a CBOR data item.
+ *
+ * Strings must have definite lengths, since the library writes no others,
+ * but maps and arrays may be indefinite.
+ *
+ * @param cbor      The CBOR.
+ * @param size      The number of bytes of CBOR.
+ * @param offset    Offset of the data item.
+ * @returns Offset just after the data item.
+ * @retval  -1      The data item is not well-formed.
+ *****************************************************************************/
+int cbor_item_end(const unsigned char * cbor, const int size, int offset)
+{
+  uint64_t argument;
+  uint64_t ii;
+  int major_type;
+
+  /***************************************************************************/
+  /* Items of indefinite maps and arrays run up to a break.                  */
+  /***************************************************************************/
+  if ((offset < size) &&
+      ((cbor[offset] == 0x9f) || (cbor[offset] == 0xbf)))
+  {
+    offset++;
+    while ((offset >= 0) && (offset < size) && (cbor[offset] != 0xff))
+    {
+      offset = cbor_item_end(cbor, size, offset);
+    }
+    return ((offset >= 0) && (offset < size)) ? offset + 1 : -1;
+  }
+
+  major_type = (offset < size) ? cbor[offset] >> 5 : 0;
+  offset = cbor_head(cbor, size, offset, &argument);
+  if (offset < 0)
+  {
+    return -1;
+  }
+
+  switch (major_type)
+  {
+    case 2:
+    case 3:
+      /***********************************************************************/
+      /* Byte and text strings.                                              */
+      /***********************************************************************/
+      if (argument > (uint64_t) (size - offset))
+      {
+        return -1;
+      }
+      offset += argument;
+      break;
+
+    case 4:
+    case 5:
+      /***********************************************************************/
+      /* Arrays, and maps of twice as many items.                            */
+      /***********************************************************************/
+      if (major_type == 5)
+      {
+        argument *= 2;
+      }
+      for (ii = 0; (ii < argument) && (offset >= 0); ii++)
+      {
+        offset = cbor_item_end(cbor, size, offset);
+      }
+      break;
+
+    case 6:
+      offset = cbor_item_end(cbor, size, offset);
+      break;
+
+    default:
+      break;
+  }
+
+  return offset;
+}
+
+/**************************************************************************//**
+ * Read the head of a CBOR data item: its initial byte and argument.
+ *
+ * @param cbor      The CBOR.
+ * @param size      The number of bytes of CBOR.
+ * @param offset    Offset of the data item.
+ * @param argument  Where to store the argument.  For major type 7 this is
+ *                  the raw bits of any float.
+ * @returns Offset just after the head.
+ * @retval  -1      The head is not well-formed.
+ *****************************************************************************/
+int cbor_head(const unsigned char * cbor,
+              const int size,
+              int offset,
+              uint64_t * argument)
+{
+  int info;
+  int length;
+
+  if (offset >= size)
+  {
+    return -1;
+  }
+  info = cbor[offset++] & 0x1f;
+
+  if (info < 24)
+  {
+    *argument = info;
+    return offset;
+  }
+  if (info > 27)
+  {
+    return -1;
+  }
+
+  length = 1 << (info - 24);
+  if (length > size - offset)
+  {
+    return -1;
+  }
+  *argument = 0;
+  while (length-- > 0)
+  {
+    *argument = (*argument << 8) | cbor[offset++];
+  }
+
+  return offset;
+}
+
+/**************************************************************************//**
+ * Whether some data contains a run of bytes.
+ *
+ * @param data      The data.
+ * @param size      The number of bytes of data.
+ * @param part      The bytes to look for.
+ * @param part_size The number of bytes to look for.
+ * @returns Whether the data contains the bytes.
+ *****************************************************************************/
+bool contains(const char * data,
+              const int size,
+              const char * part,
+              const int part_size)
+{
+  int ii;
+
+  for (ii = 0; ii + part_size <= size; ii++)
+  {
+    if (memcmp(data + ii, part, part_size) == 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}